@@ -137,6 +137,8 @@ HYPRE_IJMatrixDestroy( HYPRE_IJMatrix matrix )
       {
          hypre_AssumedPartitionDestroy((hypre_IJAssumedPart*)hypre_IJMatrixAssumedPart(ijmatrix));
       }
+      hypre_IJElementPlanDestroy(hypre_IJMatrixElementPlan(ijmatrix));
+      hypre_IJOffProcStreamDestroy(hypre_IJMatrixOffProcStream(ijmatrix));
       if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
       {
          hypre_IJMatrixDestroyParCSR( ijmatrix );
@@ -651,7 +653,12 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
          hypre_PrefixSumInt(nrows, ncols_tmp, row_indexes_tmp);
       }
 
-      if (hypre_IJMatrixOMPFlag(ijmatrix))
+      if (hypre_IJMatrixOffProcStream(ijmatrix))
+      {
+         hypre_IJMatrixAddToValuesStreamParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp,
+                                               cols, values);
+      }
+      else if (hypre_IJMatrixOMPFlag(ijmatrix))
       {
          hypre_IJMatrixAddToValuesOMPParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
       }
@@ -674,6 +681,84 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetElementPlan( HYPRE_IJMatrix      matrix,
+                              HYPRE_Int           num_elements,
+                              HYPRE_Int           element_size,
+                              const HYPRE_BigInt *element_dofs )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (num_elements < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (element_size < 0)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (!element_dofs && num_elements > 0)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) != HYPRE_PARCSR )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_GetExecPolicy1(hypre_IJMatrixMemoryLocation(ijmatrix)) == HYPRE_EXEC_DEVICE )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Element plans are not supported on device");
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixSetElementPlanParCSR(ijmatrix, num_elements, element_size, element_dofs);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixAddToElementValues( HYPRE_IJMatrix       matrix,
+                                  const HYPRE_Complex *values )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix || !hypre_IJMatrixElementPlan(ijmatrix))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (!values && hypre_IJMatrixElementPlan(ijmatrix) -> num_elements > 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixAddToElementValuesParCSR(ijmatrix, values);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -700,6 +785,10 @@ HYPRE_IJMatrixAssemble( HYPRE_IJMatrix matrix )
       else
 #endif
       {
+         if (hypre_IJMatrixOffProcStream(ijmatrix))
+         {
+            hypre_IJMatrixAssembleStreamParCSR(ijmatrix);
+         }
          return ( hypre_IJMatrixAssembleParCSR( ijmatrix ) );
       }
    }
@@ -1009,6 +1098,43 @@ HYPRE_IJMatrixSetMaxOffProcElmts( HYPRE_IJMatrix matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetOffProcStreaming( HYPRE_IJMatrix matrix,
+                                   HYPRE_Int      buffer_size )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (buffer_size < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) != HYPRE_PARCSR )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_IJOffProcStreamDestroy(hypre_IJMatrixOffProcStream(ijmatrix));
+   hypre_IJMatrixOffProcStream(ijmatrix) = NULL;
+   if (buffer_size > 0)
+   {
+      hypre_IJOffProcStreamCreate(ijmatrix, buffer_size, &hypre_IJMatrixOffProcStream(ijmatrix));
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_IJMatrixRead
  *
@@ -192,6 +192,35 @@ HYPRE_Int HYPRE_IJMatrixAddToValues2(HYPRE_IJMatrix       matrix,
                                      const HYPRE_BigInt  *cols,
                                      const HYPRE_Complex *values);
 
+/**
+ * (Optional) Set up batched element assembly for a fixed connectivity of
+ * \e num_elements elements with \e element_size degrees of freedom each.
+ * Entry \e element\_dofs[e*element\_size + i] is the global row (and column)
+ * of local degree of freedom \e i of element \e e.  Negative entries are
+ * skipped.  A scatter plan from element entries to matrix storage is
+ * computed once, including the off-processor communication layout.  If the
+ * matrix has not been assembled yet, the element couplings are first added
+ * with zero values and the matrix is assembled.  This is a collective call.
+ *
+ * @see HYPRE_IJMatrixAddToElementValues
+ **/
+HYPRE_Int HYPRE_IJMatrixSetElementPlan(HYPRE_IJMatrix      matrix,
+                                       HYPRE_Int           num_elements,
+                                       HYPRE_Int           element_size,
+                                       const HYPRE_BigInt *element_dofs);
+
+/**
+ * Add element matrices to an assembled matrix using the plan set by
+ * \c HYPRE_IJMatrixSetElementPlan.  The array \e values holds one dense,
+ * row-major element\_size x element\_size block per element, in the order of
+ * the plan connectivity.  Off-processor contributions are exchanged within
+ * this call, so the matrix does not need to be assembled again.  Use
+ * \c HYPRE_IJMatrixSetConstantValues to zero the matrix before reassembly.
+ * This is a collective call.  Not available for device memory.
+ **/
+HYPRE_Int HYPRE_IJMatrixAddToElementValues(HYPRE_IJMatrix       matrix,
+                                           const HYPRE_Complex *values);
+
 /**
  * Finalize the construction of the matrix before using.
  **/
@@ -295,6 +324,23 @@ HYPRE_Int HYPRE_IJMatrixSetDiagOffdSizes(HYPRE_IJMatrix   matrix,
 HYPRE_Int HYPRE_IJMatrixSetMaxOffProcElmts(HYPRE_IJMatrix matrix,
                                            HYPRE_Int      max_off_proc_elmts);
 
+/**
+ * (Optional) Streams entries added with HYPRE_IJMatrixAddToValues to rows
+ * owned by other processors while they are added, instead of stashing them
+ * until HYPRE_IJMatrixAssemble.  Entries are buffered per destination
+ * processor and duplicate (row, col) pairs are summed on the sender.  When a
+ * buffer holds \e buffer\_size entries it is sent with a non-blocking send,
+ * and incoming entries are added between AddToValues calls.  Assemble then
+ * only exchanges what is left.  A \e buffer\_size of 0 turns streaming off.
+ *
+ * Only AddToValues is streamed; off-processor SetValues still uses the
+ * stash.  Matrices that live in device memory ignore this setting.
+ *
+ * Collective.  All processors must call this with streaming on or off.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetOffProcStreaming(HYPRE_IJMatrix matrix,
+                                            HYPRE_Int      buffer_size);
+
 /**
  * (Optional) Sets the print level, if the user wants to print
  * error messages. The default is 0, i.e. no error messages are printed.
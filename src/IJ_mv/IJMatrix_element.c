@@ -0,0 +1,637 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Batched element assembly for IJMatrix of type ParCSR
+ *
+ * A scatter plan is computed once for a fixed element connectivity.  It maps
+ * every entry of every dense element matrix to a position in the local ParCSR
+ * data arrays, or to a slot of a fixed off-processor send buffer.  Later
+ * assemblies with the same connectivity then only gather element values into
+ * the data arrays and exchange the (pre-summed) off-processor slots.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+
+#define hypre_IJ_ELEMENT_TAG 2023
+
+/*--------------------------------------------------------------------------
+ * Find the position of (row_local, col) in the local ParCSR data arrays,
+ * where positions in offd data are offset by the number of diag nonzeros.
+ * Returns -1 if the coupling is not in the nonzero pattern.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJElementFindPosition( hypre_ParCSRMatrix *par_matrix,
+                             HYPRE_Int           row_local,
+                             HYPRE_BigInt        col,
+                             HYPRE_BigInt        col_0,
+                             HYPRE_BigInt        col_n,
+                             HYPRE_BigInt        first )
+{
+   hypre_CSRMatrix *diag          = hypre_ParCSRMatrixDiag(par_matrix);
+   HYPRE_Int       *diag_i        = hypre_CSRMatrixI(diag);
+   HYPRE_Int       *diag_j        = hypre_CSRMatrixJ(diag);
+   hypre_CSRMatrix *offd          = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int       *offd_i        = hypre_CSRMatrixI(offd);
+   HYPRE_Int       *offd_j        = hypre_CSRMatrixJ(offd);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_BigInt    *col_map_offd  = hypre_ParCSRMatrixColMapOffd(par_matrix);
+   HYPRE_Int        j, j_offd;
+
+   if (col >= col_0 && col <= col_n)
+   {
+      for (j = diag_i[row_local]; j < diag_i[row_local + 1]; j++)
+      {
+         if (diag_j[j] == (HYPRE_Int)(col - col_0))
+         {
+            return j;
+         }
+      }
+   }
+   else if (num_cols_offd)
+   {
+      j_offd = hypre_BigBinarySearch(col_map_offd, col - first, num_cols_offd);
+      if (j_offd > -1)
+      {
+         for (j = offd_i[row_local]; j < offd_i[row_local + 1]; j++)
+         {
+            if (offd_j[j] == j_offd)
+            {
+               return hypre_CSRMatrixNumNonzeros(diag) + j;
+            }
+         }
+      }
+   }
+
+   return -1;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJElementPlanDestroy( hypre_IJElementPlan *plan )
+{
+   if (plan)
+   {
+      hypre_TFree(plan -> local_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> local_ptr, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> local_map, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> send_procs, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> send_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> send_ptr, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> send_map, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> send_buf, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> recv_procs, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> recv_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> recv_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> recv_buf, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixSetElementPlanParCSR
+ *
+ * Computes the scatter plan for 'num_elements' elements with 'element_size'
+ * degrees of freedom each.  element_dofs[e * element_size + i] is the global
+ * row (and column) of local dof i of element e; negative dofs are skipped.
+ * If the matrix is not assembled yet, the element pattern is first added
+ * with zero values and the matrix is assembled.  Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixSetElementPlanParCSR( hypre_IJMatrix     *matrix,
+                                    HYPRE_Int           num_elements,
+                                    HYPRE_Int           element_size,
+                                    const HYPRE_BigInt *element_dofs )
+{
+   MPI_Comm             comm             = hypre_IJMatrixComm(matrix);
+   HYPRE_BigInt        *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt        *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_BigInt         col_0            = col_partitioning[0];
+   HYPRE_BigInt         col_n            = col_partitioning[1] - 1;
+   HYPRE_BigInt         first            = hypre_IJMatrixGlobalFirstCol(matrix);
+   HYPRE_Int            esize2           = element_size * element_size;
+   HYPRE_Int            num_values       = num_elements * esize2;
+
+   hypre_ParCSRMatrix  *par_matrix;
+   hypre_IJElementPlan *plan;
+   HYPRE_Int            num_procs;
+   HYPRE_Int            nnz_diag, nnz_offd;
+   HYPRE_Int           *pos, *pos_count;
+   HYPRE_Int            num_local, num_off, num_slots, num_missing;
+   HYPRE_Int           *off_k;
+   HYPRE_BigInt        *row_starts, *off_row, *off_col;
+   HYPRE_Int           *proc_count, *proc_slots, *recv_count;
+   HYPRE_BigInt        *send_ij, *recv_ij;
+   hypre_MPI_Request   *requests;
+   hypre_MPI_Status    *status;
+   HYPRE_Int            num_requests;
+   HYPRE_Int            e, i, j, k, p, s, lo, hi, mid;
+   HYPRE_BigInt         row, col;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /*-----------------------------------------------------------------------
+    * Make sure the element couplings are in the nonzero pattern
+    *-----------------------------------------------------------------------*/
+
+   if (!hypre_IJMatrixAssembleFlag(matrix))
+   {
+      HYPRE_Int     *ncols  = hypre_CTAlloc(HYPRE_Int, element_size, HYPRE_MEMORY_HOST);
+      HYPRE_BigInt  *rows   = hypre_CTAlloc(HYPRE_BigInt, element_size, HYPRE_MEMORY_HOST);
+      HYPRE_BigInt  *cols   = hypre_CTAlloc(HYPRE_BigInt, esize2, HYPRE_MEMORY_HOST);
+      HYPRE_Complex *zeros  = hypre_CTAlloc(HYPRE_Complex, esize2, HYPRE_MEMORY_HOST);
+      HYPRE_Int      nrows, ncol;
+
+      for (e = 0; e < num_elements; e++)
+      {
+         const HYPRE_BigInt *dofs = &element_dofs[e * element_size];
+
+         ncol = 0;
+         for (j = 0; j < element_size; j++)
+         {
+            if (dofs[j] > -1)
+            {
+               cols[ncol++] = dofs[j];
+            }
+         }
+         nrows = 0;
+         for (i = 0; i < element_size; i++)
+         {
+            if (dofs[i] > -1)
+            {
+               rows[nrows]  = dofs[i];
+               ncols[nrows] = ncol;
+               nrows++;
+            }
+         }
+         /* every row of the element has the same columns */
+         for (i = 1; i < nrows; i++)
+         {
+            hypre_TMemcpy(&cols[i * ncol], cols, HYPRE_BigInt, ncol,
+                          HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         }
+         if (nrows > 0 && ncol > 0)
+         {
+            HYPRE_IJMatrixAddToValues((HYPRE_IJMatrix) matrix, nrows, ncols,
+                                      rows, cols, zeros);
+         }
+      }
+      hypre_TFree(ncols, HYPRE_MEMORY_HOST);
+      hypre_TFree(rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(zeros, HYPRE_MEMORY_HOST);
+
+      HYPRE_IJMatrixAssemble((HYPRE_IJMatrix) matrix);
+   }
+
+   hypre_IJElementPlanDestroy(hypre_IJMatrixElementPlan(matrix));
+   hypre_IJMatrixElementPlan(matrix) = NULL;
+
+   par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   nnz_diag   = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(par_matrix));
+   nnz_offd   = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(par_matrix));
+
+   plan = hypre_CTAlloc(hypre_IJElementPlan, 1, HYPRE_MEMORY_HOST);
+   plan -> num_elements = num_elements;
+   plan -> element_size = element_size;
+   plan -> nnz_diag     = nnz_diag;
+   plan -> nnz_offd     = nnz_offd;
+
+   /*-----------------------------------------------------------------------
+    * Locate every element entry: local data position or owning processor
+    *-----------------------------------------------------------------------*/
+
+   row_starts = hypre_TAlloc(HYPRE_BigInt, num_procs + 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&row_partitioning[0], 1, HYPRE_MPI_BIG_INT,
+                       row_starts, 1, HYPRE_MPI_BIG_INT, comm);
+   row_starts[num_procs] = hypre_IJMatrixGlobalFirstRow(matrix) +
+                           hypre_IJMatrixGlobalNumRows(matrix);
+
+   /* pos[k] >= 0: data position; -1: skipped; -2 - p: owned by processor p */
+   pos = hypre_TAlloc(HYPRE_Int, num_values, HYPRE_MEMORY_HOST);
+   num_off = 0;
+   num_missing = 0;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, j, k, p, row, col, lo, hi, mid) reduction(+:num_off,num_missing) HYPRE_SMP_SCHEDULE
+#endif
+   for (e = 0; e < num_elements; e++)
+   {
+      for (i = 0; i < element_size; i++)
+      {
+         row = element_dofs[e * element_size + i];
+         for (j = 0; j < element_size; j++)
+         {
+            k   = e * esize2 + i * element_size + j;
+            col = element_dofs[e * element_size + j];
+            if (row < 0 || col < 0)
+            {
+               pos[k] = -1;
+            }
+            else if (row >= row_partitioning[0] && row < row_partitioning[1])
+            {
+               pos[k] = hypre_IJElementFindPosition(par_matrix,
+                                                    (HYPRE_Int)(row - row_partitioning[0]),
+                                                    col, col_0, col_n, first);
+               if (pos[k] < 0)
+               {
+                  num_missing++;
+               }
+            }
+            else
+            {
+               /* last processor whose first row is <= row */
+               lo = 0;
+               hi = num_procs;
+               while (hi - lo > 1)
+               {
+                  mid = (lo + hi) / 2;
+                  if (row_starts[mid] <= row)
+                  {
+                     lo = mid;
+                  }
+                  else
+                  {
+                     hi = mid;
+                  }
+               }
+               p = lo;
+               pos[k] = -2 - p;
+               num_off++;
+            }
+         }
+      }
+   }
+   hypre_TFree(row_starts, HYPRE_MEMORY_HOST);
+   if (num_missing)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Element coupling is not in the matrix pattern");
+   }
+
+   /*-----------------------------------------------------------------------
+    * On-process part: invert pos[] into a gather map per touched position
+    *-----------------------------------------------------------------------*/
+
+   pos_count = hypre_CTAlloc(HYPRE_Int, nnz_diag + nnz_offd + 1, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_values; k++)
+   {
+      if (pos[k] > -1)
+      {
+         pos_count[pos[k] + 1]++;
+      }
+   }
+   num_local = 0;
+   for (i = 0; i < nnz_diag + nnz_offd; i++)
+   {
+      if (pos_count[i + 1])
+      {
+         num_local++;
+      }
+   }
+   plan -> num_local = num_local;
+   plan -> local_pos = hypre_TAlloc(HYPRE_Int, num_local, HYPRE_MEMORY_HOST);
+   plan -> local_ptr = hypre_TAlloc(HYPRE_Int, num_local + 1, HYPRE_MEMORY_HOST);
+   plan -> local_ptr[0] = 0;
+   num_local = 0;
+   for (i = 0; i < nnz_diag + nnz_offd; i++)
+   {
+      if (pos_count[i + 1])
+      {
+         plan -> local_pos[num_local] = i;
+         plan -> local_ptr[num_local + 1] = plan -> local_ptr[num_local] + pos_count[i + 1];
+         /* reuse pos_count as the fill cursor of position i */
+         pos_count[i] = plan -> local_ptr[num_local];
+         num_local++;
+      }
+   }
+   plan -> local_map = hypre_TAlloc(HYPRE_Int, plan -> local_ptr[num_local], HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_values; k++)
+   {
+      if (pos[k] > -1)
+      {
+         plan -> local_map[pos_count[pos[k]]++] = k;
+      }
+   }
+   hypre_TFree(pos_count, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Off-process part: sort by (processor, row, col) and merge duplicates
+    * into send slots
+    *-----------------------------------------------------------------------*/
+
+   proc_count = hypre_CTAlloc(HYPRE_Int, num_procs + 1, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_values; k++)
+   {
+      if (pos[k] < -1)
+      {
+         proc_count[-2 - pos[k] + 1]++;
+      }
+   }
+   for (p = 0; p < num_procs; p++)
+   {
+      proc_count[p + 1] += proc_count[p];
+   }
+   off_k    = hypre_TAlloc(HYPRE_Int, num_off, HYPRE_MEMORY_HOST);
+   off_row  = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+   off_col  = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_values; k++)
+   {
+      if (pos[k] < -1)
+      {
+         p = -2 - pos[k];
+         off_k[proc_count[p]++] = k;
+      }
+   }
+   for (p = num_procs; p > 0; p--)
+   {
+      proc_count[p] = proc_count[p - 1];
+   }
+   proc_count[0] = 0;
+   hypre_TFree(pos, HYPRE_MEMORY_HOST);
+
+   for (p = 0; p < num_procs; p++)
+   {
+      for (i = proc_count[p]; i < proc_count[p + 1]; i++)
+      {
+         k = off_k[i];
+         off_row[i] = element_dofs[(k / esize2) * element_size + (k % esize2) / element_size];
+      }
+      if (proc_count[p + 1] - proc_count[p] > 1)
+      {
+         hypre_BigQsortbi(off_row, off_k, proc_count[p], proc_count[p + 1] - 1);
+      }
+      for (i = proc_count[p]; i < proc_count[p + 1]; i++)
+      {
+         k = off_k[i];
+         off_col[i] = element_dofs[(k / esize2) * element_size + k % element_size];
+      }
+      /* sort columns within runs of equal rows */
+      for (i = proc_count[p]; i < proc_count[p + 1]; i = j)
+      {
+         for (j = i + 1; j < proc_count[p + 1] && off_row[j] == off_row[i]; j++);
+         if (j - i > 1)
+         {
+            hypre_BigQsortbi(off_col, off_k, i, j - 1);
+         }
+      }
+   }
+
+   /* slots: unique (row, col) pairs */
+   proc_slots = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   plan -> send_ptr = hypre_TAlloc(HYPRE_Int, num_off + 1, HYPRE_MEMORY_HOST);
+   plan -> send_map = off_k;
+   send_ij = hypre_TAlloc(HYPRE_BigInt, 2 * num_off, HYPRE_MEMORY_HOST);
+   num_slots = 0;
+   plan -> num_sends = 0;
+   for (p = 0; p < num_procs; p++)
+   {
+      for (i = proc_count[p]; i < proc_count[p + 1]; i++)
+      {
+         if (i == proc_count[p] || off_row[i] != off_row[i - 1] || off_col[i] != off_col[i - 1])
+         {
+            plan -> send_ptr[num_slots] = i;
+            send_ij[2 * num_slots]     = off_row[i];
+            send_ij[2 * num_slots + 1] = off_col[i];
+            num_slots++;
+            proc_slots[p]++;
+         }
+      }
+      if (proc_slots[p])
+      {
+         plan -> num_sends++;
+      }
+   }
+   plan -> send_ptr[num_slots] = num_off;
+   hypre_TFree(off_row, HYPRE_MEMORY_HOST);
+   hypre_TFree(off_col, HYPRE_MEMORY_HOST);
+   hypre_TFree(proc_count, HYPRE_MEMORY_HOST);
+
+   plan -> send_procs  = hypre_TAlloc(HYPRE_Int, plan -> num_sends, HYPRE_MEMORY_HOST);
+   plan -> send_starts = hypre_TAlloc(HYPRE_Int, plan -> num_sends + 1, HYPRE_MEMORY_HOST);
+   plan -> send_buf    = hypre_TAlloc(HYPRE_Complex, num_slots, HYPRE_MEMORY_HOST);
+   plan -> send_starts[0] = 0;
+   for (p = 0, s = 0; p < num_procs; p++)
+   {
+      if (proc_slots[p])
+      {
+         plan -> send_procs[s] = p;
+         plan -> send_starts[s + 1] = plan -> send_starts[s] + proc_slots[p];
+         s++;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Tell the owners which couplings they will receive and let them
+    * locate the data positions
+    *-----------------------------------------------------------------------*/
+
+   recv_count = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   hypre_MPI_Alltoall(proc_slots, 1, HYPRE_MPI_INT, recv_count, 1, HYPRE_MPI_INT, comm);
+
+   plan -> num_recvs = 0;
+   for (p = 0; p < num_procs; p++)
+   {
+      if (recv_count[p])
+      {
+         plan -> num_recvs++;
+      }
+   }
+   plan -> recv_procs  = hypre_TAlloc(HYPRE_Int, plan -> num_recvs, HYPRE_MEMORY_HOST);
+   plan -> recv_starts = hypre_TAlloc(HYPRE_Int, plan -> num_recvs + 1, HYPRE_MEMORY_HOST);
+   plan -> recv_starts[0] = 0;
+   for (p = 0, s = 0; p < num_procs; p++)
+   {
+      if (recv_count[p])
+      {
+         plan -> recv_procs[s] = p;
+         plan -> recv_starts[s + 1] = plan -> recv_starts[s] + recv_count[p];
+         s++;
+      }
+   }
+   hypre_TFree(proc_slots, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_count, HYPRE_MEMORY_HOST);
+
+   i = plan -> recv_starts[plan -> num_recvs];
+   recv_ij          = hypre_TAlloc(HYPRE_BigInt, 2 * i, HYPRE_MEMORY_HOST);
+   plan -> recv_pos = hypre_TAlloc(HYPRE_Int, i, HYPRE_MEMORY_HOST);
+   plan -> recv_buf = hypre_TAlloc(HYPRE_Complex, i, HYPRE_MEMORY_HOST);
+
+   num_requests = plan -> num_recvs + plan -> num_sends;
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+   status   = hypre_CTAlloc(hypre_MPI_Status, num_requests, HYPRE_MEMORY_HOST);
+   j = 0;
+   for (s = 0; s < plan -> num_recvs; s++)
+   {
+      i = plan -> recv_starts[s];
+      hypre_MPI_Irecv(&recv_ij[2 * i], 2 * (plan -> recv_starts[s + 1] - i), HYPRE_MPI_BIG_INT,
+                      plan -> recv_procs[s], hypre_IJ_ELEMENT_TAG, comm, &requests[j++]);
+   }
+   for (s = 0; s < plan -> num_sends; s++)
+   {
+      i = plan -> send_starts[s];
+      hypre_MPI_Isend(&send_ij[2 * i], 2 * (plan -> send_starts[s + 1] - i), HYPRE_MPI_BIG_INT,
+                      plan -> send_procs[s], hypre_IJ_ELEMENT_TAG, comm, &requests[j++]);
+   }
+   hypre_MPI_Waitall(num_requests, requests, status);
+   hypre_TFree(send_ij, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < plan -> recv_starts[plan -> num_recvs]; i++)
+   {
+      row = recv_ij[2 * i];
+      col = recv_ij[2 * i + 1];
+      plan -> recv_pos[i] = -1;
+      if (row >= row_partitioning[0] && row < row_partitioning[1])
+      {
+         plan -> recv_pos[i] =
+            hypre_IJElementFindPosition(par_matrix, (HYPRE_Int)(row - row_partitioning[0]),
+                                        col, col_0, col_n, first);
+      }
+      if (plan -> recv_pos[i] < 0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Element coupling is not in the matrix pattern");
+      }
+   }
+   hypre_TFree(recv_ij, HYPRE_MEMORY_HOST);
+   hypre_TFree(requests, HYPRE_MEMORY_HOST);
+   hypre_TFree(status, HYPRE_MEMORY_HOST);
+
+   hypre_IJMatrixElementPlan(matrix) = plan;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAddToElementValuesParCSR
+ *
+ * Adds the element matrices 'values' (num_elements dense blocks of
+ * element_size^2 row-major entries, in the order given to the plan) to the
+ * assembled matrix.  Off-processor contributions are exchanged here, so no
+ * further assembly is needed.  Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAddToElementValuesParCSR( hypre_IJMatrix      *matrix,
+                                        const HYPRE_Complex *values )
+{
+   MPI_Comm             comm       = hypre_IJMatrixComm(matrix);
+   hypre_IJElementPlan *plan       = hypre_IJMatrixElementPlan(matrix);
+   hypre_ParCSRMatrix  *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   HYPRE_Complex       *diag_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(par_matrix));
+   HYPRE_Complex       *offd_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(par_matrix));
+   HYPRE_Int            nnz_diag   = plan -> nnz_diag;
+   HYPRE_Int           *local_pos  = plan -> local_pos;
+   HYPRE_Int           *local_ptr  = plan -> local_ptr;
+   HYPRE_Int           *local_map  = plan -> local_map;
+   HYPRE_Int           *send_ptr   = plan -> send_ptr;
+   HYPRE_Int           *send_map   = plan -> send_map;
+   HYPRE_Complex       *send_buf   = plan -> send_buf;
+   HYPRE_Int           *recv_pos   = plan -> recv_pos;
+   HYPRE_Complex       *recv_buf   = plan -> recv_buf;
+   HYPRE_Int            num_slots  = plan -> send_starts[plan -> num_sends];
+   HYPRE_Int            num_recv   = plan -> recv_starts[plan -> num_recvs];
+
+   hypre_MPI_Request   *requests;
+   hypre_MPI_Status    *status;
+   HYPRE_Int            num_requests;
+   HYPRE_Int            i, j, s;
+   HYPRE_Complex        sum;
+
+   if (hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(par_matrix)) != plan -> nnz_diag ||
+       hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(par_matrix)) != plan -> nnz_offd)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Matrix pattern changed since the element plan was set");
+      return hypre_error_flag;
+   }
+
+   /* pre-sum off-processor contributions and start the exchange */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(j, sum) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_slots; i++)
+   {
+      sum = 0.0;
+      for (j = send_ptr[i]; j < send_ptr[i + 1]; j++)
+      {
+         sum += values[send_map[j]];
+      }
+      send_buf[i] = sum;
+   }
+
+   num_requests = plan -> num_recvs + plan -> num_sends;
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+   status   = hypre_CTAlloc(hypre_MPI_Status, num_requests, HYPRE_MEMORY_HOST);
+   j = 0;
+   for (s = 0; s < plan -> num_recvs; s++)
+   {
+      i = plan -> recv_starts[s];
+      hypre_MPI_Irecv(&recv_buf[i], plan -> recv_starts[s + 1] - i, HYPRE_MPI_COMPLEX,
+                      plan -> recv_procs[s], hypre_IJ_ELEMENT_TAG, comm, &requests[j++]);
+   }
+   for (s = 0; s < plan -> num_sends; s++)
+   {
+      i = plan -> send_starts[s];
+      hypre_MPI_Isend(&send_buf[i], plan -> send_starts[s + 1] - i, HYPRE_MPI_COMPLEX,
+                      plan -> send_procs[s], hypre_IJ_ELEMENT_TAG, comm, &requests[j++]);
+   }
+
+   /* on-processor contributions; each position is owned by one iteration */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(j, sum) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < plan -> num_local; i++)
+   {
+      sum = 0.0;
+      for (j = local_ptr[i]; j < local_ptr[i + 1]; j++)
+      {
+         sum += values[local_map[j]];
+      }
+      if (local_pos[i] < nnz_diag)
+      {
+         diag_data[local_pos[i]] += sum;
+      }
+      else
+      {
+         offd_data[local_pos[i] - nnz_diag] += sum;
+      }
+   }
+
+   hypre_MPI_Waitall(num_requests, requests, status);
+   hypre_TFree(requests, HYPRE_MEMORY_HOST);
+   hypre_TFree(status, HYPRE_MEMORY_HOST);
+
+   /* received slots may hit the same position, so add them serially */
+   for (i = 0; i < num_recv; i++)
+   {
+      if (recv_pos[i] < 0)
+      {
+         continue;
+      }
+      if (recv_pos[i] < nnz_diag)
+      {
+         diag_data[recv_pos[i]] += recv_buf[i];
+      }
+      else
+      {
+         offd_data[recv_pos[i] - nnz_diag] += recv_buf[i];
+      }
+   }
+
+   /* Values were changed in place, so drop the SELL copy */
+   hypre_ParCSRMatrixSellDataInvalidate(par_matrix);
+
+   return hypre_error_flag;
+}
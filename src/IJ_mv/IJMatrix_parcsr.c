@@ -2915,6 +2915,9 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       hypre_CSRMatrixSetRownnz(offd);
    }
 
+   /* Values may have been changed in place since the last assembly */
+   hypre_ParCSRMatrixSellDataInvalidate(par_matrix);
+
    /* Free memory */
    hypre_AuxParCSRMatrixDestroy(aux_matrix);
    hypre_IJMatrixTranslator(matrix) = NULL;
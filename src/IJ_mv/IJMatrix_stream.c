@@ -0,0 +1,540 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Streaming of off-processor AddToValues entries for IJMatrix of type ParCSR
+ *
+ * Instead of stashing off-processor entries and shipping all of them with the
+ * data-exchange protocol inside HYPRE_IJMatrixAssemble, entries are packed
+ * into per-destination buffers as they are added, merged by (row, col), and
+ * sent with non-blocking sends when a buffer fills.  Incoming messages are
+ * drained between AddToValues calls.  Assemble only flushes the remaining
+ * buffers and receives the outstanding messages; one Alltoall of message
+ * counts tells every processor how many messages to expect.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+
+#define hypre_IJ_STREAM_TAG  2024
+#define hypre_IJ_STREAM_POLL 32    /* AddToValues calls between polls */
+
+/* message layout: n rows, n cols, n values */
+#define hypre_IJStreamMsgSize(n) \
+   ((size_t)(n) * (2 * sizeof(HYPRE_BigInt) + sizeof(HYPRE_Complex)))
+
+/*--------------------------------------------------------------------------
+ * hypre_IJOffProcStreamCreate
+ *
+ * Collective.  buffer_size is the number of entries buffered per destination
+ * before a flush is attempted.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJOffProcStreamCreate( hypre_IJMatrix         *matrix,
+                             HYPRE_Int               buffer_size,
+                             hypre_IJOffProcStream **stream_ptr )
+{
+   MPI_Comm               comm             = hypre_IJMatrixComm(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   hypre_IJOffProcStream *stream;
+   HYPRE_Int              num_procs;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   stream = hypre_CTAlloc(hypre_IJOffProcStream, 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Comm_dup(comm, &(stream -> comm));
+   stream -> num_procs   = num_procs;
+   stream -> buffer_size = buffer_size;
+
+   stream -> row_starts = hypre_TAlloc(HYPRE_BigInt, num_procs + 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&row_partitioning[0], 1, HYPRE_MPI_BIG_INT,
+                       stream -> row_starts, 1, HYPRE_MPI_BIG_INT, comm);
+   stream -> row_starts[num_procs] = hypre_IJMatrixGlobalFirstRow(matrix) +
+                                     hypre_IJMatrixGlobalNumRows(matrix);
+
+   stream -> buf_num   = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   stream -> buf_alloc = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   stream -> buf_rows  = hypre_CTAlloc(HYPRE_BigInt *, num_procs, HYPRE_MEMORY_HOST);
+   stream -> buf_cols  = hypre_CTAlloc(HYPRE_BigInt *, num_procs, HYPRE_MEMORY_HOST);
+   stream -> buf_data  = hypre_CTAlloc(HYPRE_Complex *, num_procs, HYPRE_MEMORY_HOST);
+   stream -> num_msgs  = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+
+   *stream_ptr = stream;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJOffProcStreamDestroy( hypre_IJOffProcStream *stream )
+{
+   HYPRE_Int p;
+
+   if (stream)
+   {
+      if (stream -> num_requests)
+      {
+         hypre_MPI_Waitall(stream -> num_requests, stream -> requests, hypre_MPI_STATUSES_IGNORE);
+      }
+      for (p = 0; p < stream -> num_requests; p++)
+      {
+         hypre_TFree(stream -> send_bufs[p], HYPRE_MEMORY_HOST);
+      }
+      for (p = 0; p < stream -> num_procs; p++)
+      {
+         hypre_TFree(stream -> buf_rows[p], HYPRE_MEMORY_HOST);
+         hypre_TFree(stream -> buf_cols[p], HYPRE_MEMORY_HOST);
+         hypre_TFree(stream -> buf_data[p], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(stream -> row_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(stream -> buf_num, HYPRE_MEMORY_HOST);
+      hypre_TFree(stream -> buf_alloc, HYPRE_MEMORY_HOST);
+      hypre_TFree(stream -> buf_rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(stream -> buf_cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(stream -> buf_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(stream -> num_msgs, HYPRE_MEMORY_HOST);
+      hypre_TFree(stream -> requests, HYPRE_MEMORY_HOST);
+      hypre_TFree(stream -> send_bufs, HYPRE_MEMORY_HOST);
+      hypre_TFree(stream -> local_rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(stream -> local_ncols, HYPRE_MEMORY_HOST);
+      hypre_TFree(stream -> local_indexes, HYPRE_MEMORY_HOST);
+      hypre_MPI_Comm_free(&(stream -> comm));
+      hypre_TFree(stream, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Sort the buffer of destination p by (row, col) and merge duplicates.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJOffProcStreamCompact( hypre_IJOffProcStream *stream,
+                              HYPRE_Int              p )
+{
+   HYPRE_Int      n     = stream -> buf_num[p];
+   HYPRE_BigInt  *rows  = stream -> buf_rows[p];
+   HYPRE_BigInt  *cols  = stream -> buf_cols[p];
+   HYPRE_Complex *data  = stream -> buf_data[p];
+   HYPRE_BigInt  *srows, *scols;
+   HYPRE_Complex *sdata;
+   HYPRE_Int     *perm;
+   HYPRE_Int      i, j, cnt;
+
+   if (n < 2)
+   {
+      return hypre_error_flag;
+   }
+
+   srows = hypre_TAlloc(HYPRE_BigInt, n, HYPRE_MEMORY_HOST);
+   scols = hypre_TAlloc(HYPRE_BigInt, n, HYPRE_MEMORY_HOST);
+   sdata = hypre_TAlloc(HYPRE_Complex, n, HYPRE_MEMORY_HOST);
+   perm  = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      srows[i] = rows[i];
+      perm[i]  = i;
+   }
+   hypre_BigQsortbi(srows, perm, 0, n - 1);
+   for (i = 0; i < n; i++)
+   {
+      scols[i] = cols[perm[i]];
+   }
+   /* sort columns within runs of equal rows */
+   for (i = 0; i < n; i = j)
+   {
+      for (j = i + 1; j < n && srows[j] == srows[i]; j++);
+      if (j - i > 1)
+      {
+         hypre_BigQsortbi(scols, perm, i, j - 1);
+      }
+   }
+   for (i = 0; i < n; i++)
+   {
+      sdata[i] = data[perm[i]];
+   }
+
+   cnt = 0;
+   for (i = 0; i < n; i++)
+   {
+      if (cnt > 0 && srows[i] == rows[cnt - 1] && scols[i] == cols[cnt - 1])
+      {
+         data[cnt - 1] += sdata[i];
+      }
+      else
+      {
+         rows[cnt] = srows[i];
+         cols[cnt] = scols[i];
+         data[cnt] = sdata[i];
+         cnt++;
+      }
+   }
+   stream -> buf_num[p] = cnt;
+
+   hypre_TFree(srows, HYPRE_MEMORY_HOST);
+   hypre_TFree(scols, HYPRE_MEMORY_HOST);
+   hypre_TFree(sdata, HYPRE_MEMORY_HOST);
+   hypre_TFree(perm, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Pack the buffer of destination p and start a non-blocking send.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJOffProcStreamSend( hypre_IJOffProcStream *stream,
+                           HYPRE_Int              p )
+{
+   HYPRE_Int  n = stream -> buf_num[p];
+   size_t     size = hypre_IJStreamMsgSize(n);
+   char      *msg;
+
+   if (stream -> num_requests == stream -> max_requests)
+   {
+      stream -> max_requests = hypre_max(2 * stream -> max_requests, 16);
+      stream -> requests  = hypre_TReAlloc(stream -> requests, hypre_MPI_Request,
+                                           stream -> max_requests, HYPRE_MEMORY_HOST);
+      stream -> send_bufs = hypre_TReAlloc(stream -> send_bufs, char *,
+                                           stream -> max_requests, HYPRE_MEMORY_HOST);
+   }
+
+   msg = hypre_TAlloc(char, size, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(msg, stream -> buf_rows[p], HYPRE_BigInt, n,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(msg + n * sizeof(HYPRE_BigInt), stream -> buf_cols[p], HYPRE_BigInt, n,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(msg + 2 * n * sizeof(HYPRE_BigInt), stream -> buf_data[p], HYPRE_Complex, n,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Isend(msg, (HYPRE_Int) size, hypre_MPI_BYTE, p,
+                   hypre_IJ_STREAM_TAG + (stream -> cycle % 2), stream -> comm,
+                   &(stream -> requests[stream -> num_requests]));
+   stream -> send_bufs[stream -> num_requests] = msg;
+   stream -> num_requests++;
+
+   stream -> num_msgs[p]++;
+   stream -> need_progress = 1;
+   stream -> buf_num[p] = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Receive one message that has been probed and add it to the local rows.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJOffProcStreamRecv( hypre_IJMatrix        *matrix,
+                           hypre_IJOffProcStream *stream,
+                           hypre_MPI_Status      *status )
+{
+   HYPRE_Int      size, n, nrows, i;
+   char          *msg;
+   HYPRE_BigInt  *rows, *cols, *urows;
+   HYPRE_Complex *data;
+   HYPRE_Int     *ncols, *row_indexes;
+   hypre_MPI_Status recv_status;
+
+   hypre_MPI_Get_count(status, hypre_MPI_BYTE, &size);
+   n = (HYPRE_Int)(size / hypre_IJStreamMsgSize(1));
+
+   msg = hypre_TAlloc(char, size, HYPRE_MEMORY_HOST);
+   hypre_MPI_Recv(msg, size, hypre_MPI_BYTE, status -> hypre_MPI_SOURCE,
+                  status -> hypre_MPI_TAG, stream -> comm, &recv_status);
+   stream -> num_recvd++;
+
+   rows = (HYPRE_BigInt *) msg;
+   cols = rows + n;
+   data = (HYPRE_Complex *) (msg + 2 * n * sizeof(HYPRE_BigInt));
+
+   /* entries are sorted by row, so add them one row segment at a time */
+   urows       = hypre_TAlloc(HYPRE_BigInt, n, HYPRE_MEMORY_HOST);
+   ncols       = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   row_indexes = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   nrows = 0;
+   for (i = 0; i < n; i++)
+   {
+      if (i == 0 || rows[i] != rows[i - 1])
+      {
+         urows[nrows]       = rows[i];
+         ncols[nrows]       = 0;
+         row_indexes[nrows] = i;
+         nrows++;
+      }
+      ncols[nrows - 1]++;
+   }
+   if (nrows)
+   {
+      hypre_IJMatrixAddToValuesParCSR(matrix, nrows, ncols, urows, row_indexes, cols, data);
+   }
+
+   hypre_TFree(urows, HYPRE_MEMORY_HOST);
+   hypre_TFree(ncols, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_indexes, HYPRE_MEMORY_HOST);
+   hypre_TFree(msg, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Drain messages that have already arrived and release completed sends.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJOffProcStreamProgress( hypre_IJMatrix        *matrix,
+                               hypre_IJOffProcStream *stream )
+{
+   hypre_MPI_Status status;
+   HYPRE_Int        flag, i, cnt;
+
+   hypre_MPI_Iprobe(hypre_MPI_ANY_SOURCE, hypre_IJ_STREAM_TAG + (stream -> cycle % 2),
+                    stream -> comm, &flag, &status);
+   while (flag)
+   {
+      hypre_IJOffProcStreamRecv(matrix, stream, &status);
+      hypre_MPI_Iprobe(hypre_MPI_ANY_SOURCE, hypre_IJ_STREAM_TAG + (stream -> cycle % 2),
+                       stream -> comm, &flag, &status);
+   }
+
+   stream -> need_progress = 0;
+   cnt = 0;
+   for (i = 0; i < stream -> num_requests; i++)
+   {
+      hypre_MPI_Test(&(stream -> requests[i]), &flag, &status);
+      if (flag)
+      {
+         hypre_TFree(stream -> send_bufs[i], HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         stream -> requests[cnt]  = stream -> requests[i];
+         stream -> send_bufs[cnt] = stream -> send_bufs[i];
+         cnt++;
+      }
+   }
+   stream -> num_requests = cnt;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAddToValuesStreamParCSR
+ *
+ * AddToValues with streaming of the off-processor rows.  On-processor rows
+ * are passed on to the usual AddToValues routines.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAddToValuesStreamParCSR( hypre_IJMatrix       *matrix,
+                                       HYPRE_Int             nrows,
+                                       HYPRE_Int            *ncols,
+                                       const HYPRE_BigInt   *rows,
+                                       const HYPRE_Int      *row_indexes,
+                                       const HYPRE_BigInt   *cols,
+                                       const HYPRE_Complex  *values )
+{
+   hypre_IJOffProcStream *stream           = hypre_IJMatrixOffProcStream(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt          *row_starts       = stream -> row_starts;
+   HYPRE_Int              buffer_size      = stream -> buffer_size;
+   HYPRE_Int              num_local, num_off;
+   HYPRE_Int             *local_ncols      = (HYPRE_Int *) ncols;
+   HYPRE_Int             *local_indexes    = (HYPRE_Int *) row_indexes;
+   HYPRE_BigInt          *local_rows       = (HYPRE_BigInt *) rows;
+   HYPRE_BigInt           row;
+   HYPRE_Int              ii, j, n, p, lo, hi, mid, indx, cnt;
+
+   num_off = 0;
+   for (ii = 0; ii < nrows; ii++)
+   {
+      if (rows[ii] < row_partitioning[0] || rows[ii] >= row_partitioning[1])
+      {
+         num_off++;
+      }
+   }
+
+   /* pass the on-processor rows on as a subset; cols and values stay in place */
+   num_local = nrows - num_off;
+   if (num_off && num_local)
+   {
+      if (num_local > stream -> max_local)
+      {
+         stream -> max_local     = hypre_max(num_local, 2 * stream -> max_local);
+         stream -> local_rows    = hypre_TReAlloc(stream -> local_rows, HYPRE_BigInt,
+                                                  stream -> max_local, HYPRE_MEMORY_HOST);
+         stream -> local_ncols   = hypre_TReAlloc(stream -> local_ncols, HYPRE_Int,
+                                                  stream -> max_local, HYPRE_MEMORY_HOST);
+         stream -> local_indexes = hypre_TReAlloc(stream -> local_indexes, HYPRE_Int,
+                                                  stream -> max_local, HYPRE_MEMORY_HOST);
+      }
+      local_rows    = stream -> local_rows;
+      local_ncols   = stream -> local_ncols;
+      local_indexes = stream -> local_indexes;
+      num_local     = 0;
+   }
+
+   for (ii = 0; ii < nrows && (num_off || num_local); ii++)
+   {
+      row  = rows[ii];
+      n    = ncols[ii];
+      indx = row_indexes[ii];
+
+      if (row >= row_partitioning[0] && row < row_partitioning[1])
+      {
+         if (local_rows != rows)
+         {
+            local_rows[num_local]    = row;
+            local_ncols[num_local]   = n;
+            local_indexes[num_local] = indx;
+            num_local++;
+         }
+         continue;
+      }
+      if (n == 0)
+      {
+         continue;
+      }
+
+      /* last processor whose first row is <= row */
+      lo = 0;
+      hi = stream -> num_procs;
+      while (hi - lo > 1)
+      {
+         mid = (lo + hi) / 2;
+         if (row_starts[mid] <= row)
+         {
+            lo = mid;
+         }
+         else
+         {
+            hi = mid;
+         }
+      }
+      p = lo;
+
+      cnt = stream -> buf_num[p];
+      if (cnt + n > stream -> buf_alloc[p])
+      {
+         stream -> buf_alloc[p] = hypre_max(cnt + n, buffer_size + n);
+         stream -> buf_rows[p]  = hypre_TReAlloc(stream -> buf_rows[p], HYPRE_BigInt,
+                                                 stream -> buf_alloc[p], HYPRE_MEMORY_HOST);
+         stream -> buf_cols[p]  = hypre_TReAlloc(stream -> buf_cols[p], HYPRE_BigInt,
+                                                 stream -> buf_alloc[p], HYPRE_MEMORY_HOST);
+         stream -> buf_data[p]  = hypre_TReAlloc(stream -> buf_data[p], HYPRE_Complex,
+                                                 stream -> buf_alloc[p], HYPRE_MEMORY_HOST);
+      }
+      for (j = 0; j < n; j++)
+      {
+         stream -> buf_rows[p][cnt] = row;
+         stream -> buf_cols[p][cnt] = cols[indx + j];
+         stream -> buf_data[p][cnt] = values[indx + j];
+         cnt++;
+      }
+      stream -> buf_num[p] = cnt;
+
+      /* merge duplicates first; only ship buffers that stay at least half full */
+      if (cnt >= buffer_size)
+      {
+         hypre_IJOffProcStreamCompact(stream, p);
+         if (2 * stream -> buf_num[p] >= buffer_size)
+         {
+            hypre_IJOffProcStreamSend(stream, p);
+         }
+      }
+   }
+
+   if (num_local)
+   {
+      if (hypre_IJMatrixOMPFlag(matrix))
+      {
+         hypre_IJMatrixAddToValuesOMPParCSR(matrix, num_local, local_ncols, local_rows,
+                                            local_indexes, cols, values);
+      }
+      else
+      {
+         hypre_IJMatrixAddToValuesParCSR(matrix, num_local, local_ncols, local_rows,
+                                         local_indexes, cols, values);
+      }
+   }
+
+   /* polling is not free, so only do it after sends or every few calls */
+   if (stream -> need_progress || ++(stream -> num_calls) % hypre_IJ_STREAM_POLL == 0)
+   {
+      hypre_IJOffProcStreamProgress(matrix, stream);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleStreamParCSR
+ *
+ * Flushes the remaining buffers and receives all outstanding messages of the
+ * current assembly cycle.  Called from HYPRE_IJMatrixAssemble before the
+ * regular assembly.  Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAssembleStreamParCSR( hypre_IJMatrix *matrix )
+{
+   hypre_IJOffProcStream *stream    = hypre_IJMatrixOffProcStream(matrix);
+   HYPRE_Int              num_procs = stream -> num_procs;
+   HYPRE_Int             *recv_msgs;
+   HYPRE_Int              num_expected, p;
+   hypre_MPI_Status       status;
+
+   for (p = 0; p < num_procs; p++)
+   {
+      if (stream -> buf_num[p])
+      {
+         hypre_IJOffProcStreamCompact(stream, p);
+         hypre_IJOffProcStreamSend(stream, p);
+      }
+   }
+
+   recv_msgs = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   hypre_MPI_Alltoall(stream -> num_msgs, 1, HYPRE_MPI_INT, recv_msgs, 1, HYPRE_MPI_INT,
+                      stream -> comm);
+   num_expected = 0;
+   for (p = 0; p < num_procs; p++)
+   {
+      num_expected += recv_msgs[p];
+   }
+   hypre_TFree(recv_msgs, HYPRE_MEMORY_HOST);
+
+   while (stream -> num_recvd < num_expected)
+   {
+      hypre_MPI_Probe(hypre_MPI_ANY_SOURCE, hypre_IJ_STREAM_TAG + (stream -> cycle % 2),
+                      stream -> comm, &status);
+      hypre_IJOffProcStreamRecv(matrix, stream, &status);
+   }
+
+   hypre_MPI_Waitall(stream -> num_requests, stream -> requests, hypre_MPI_STATUSES_IGNORE);
+   for (p = 0; p < stream -> num_requests; p++)
+   {
+      hypre_TFree(stream -> send_bufs[p], HYPRE_MEMORY_HOST);
+   }
+   stream -> num_requests = 0;
+
+   /* start the next cycle; messages sent early for it use the other tag */
+   for (p = 0; p < num_procs; p++)
+   {
+      stream -> num_msgs[p] = 0;
+   }
+   stream -> num_recvd     = 0;
+   stream -> need_progress = 0;
+   stream -> cycle++;
+
+   return hypre_error_flag;
+}
@@ -14,6 +14,88 @@
 #ifndef hypre_IJ_MATRIX_HEADER
 #define hypre_IJ_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_IJElementPlan:
+ *
+ * Scatter plan for batched element assembly (HYPRE_IJMatrixAddToElementValues).
+ * Positions index the local ParCSR data: [0, nnz_diag) is diag data and
+ * [nnz_diag, nnz_diag + nnz_offd) is offd data.  Element values (one dense
+ * element_size^2 block per element) are gathered into each position through
+ * the CSR-like maps below, so the additions are race-free across threads.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int       num_elements;
+   HYPRE_Int       element_size;
+   HYPRE_Int       nnz_diag;        /* ParCSR sizes the plan was built for */
+   HYPRE_Int       nnz_offd;
+
+   /* on-process couplings */
+   HYPRE_Int       num_local;       /* number of touched positions */
+   HYPRE_Int      *local_pos;       /* data position of each touched entry */
+   HYPRE_Int      *local_ptr;       /* element values for local_pos[i] are */
+   HYPRE_Int      *local_map;       /* local_map[local_ptr[i]:local_ptr[i+1]] */
+
+   /* off-process couplings, summed per (row, col) before sending */
+   HYPRE_Int       num_sends;
+   HYPRE_Int      *send_procs;
+   HYPRE_Int      *send_starts;     /* slots per send processor */
+   HYPRE_Int      *send_ptr;        /* element values for slot j are */
+   HYPRE_Int      *send_map;        /* send_map[send_ptr[j]:send_ptr[j+1]] */
+   HYPRE_Complex  *send_buf;
+
+   HYPRE_Int       num_recvs;
+   HYPRE_Int      *recv_procs;
+   HYPRE_Int      *recv_starts;     /* slots per recv processor */
+   HYPRE_Int      *recv_pos;        /* data position of each received slot */
+   HYPRE_Complex  *recv_buf;
+
+} hypre_IJElementPlan;
+
+/*--------------------------------------------------------------------------
+ * hypre_IJOffProcStream:
+ *
+ * Streaming mode for off-processor AddToValues.  Entries for rows owned by
+ * another processor are packed into a per-destination buffer as they are
+ * added.  When a buffer reaches buffer_size entries, duplicate (row, col)
+ * pairs are merged and, if it is still at least half full, the buffer is
+ * shipped with a non-blocking send on a private communicator.  Messages that
+ * have already arrived are drained between AddToValues calls, so only the
+ * remaining tail is exchanged inside HYPRE_IJMatrixAssemble.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm            comm;            /* duplicate of the matrix communicator */
+   HYPRE_Int           num_procs;
+   HYPRE_Int           buffer_size;     /* flush threshold (entries per destination) */
+   HYPRE_BigInt       *row_starts;      /* first row of every processor */
+
+   HYPRE_Int          *buf_num;         /* entries currently buffered per destination */
+   HYPRE_Int          *buf_alloc;
+   HYPRE_BigInt      **buf_rows;        /* (row, col, value) per destination */
+   HYPRE_BigInt      **buf_cols;
+   HYPRE_Complex     **buf_data;
+
+   HYPRE_Int           cycle;           /* assembly count; its parity selects the tag */
+   HYPRE_Int          *num_msgs;        /* messages sent to each processor */
+   HYPRE_Int           num_recvd;       /* messages received so far */
+
+   HYPRE_Int           num_requests;    /* sends still in flight */
+   HYPRE_Int           max_requests;
+   hypre_MPI_Request  *requests;
+   char              **send_bufs;
+   HYPRE_Int           need_progress;   /* a send was started since the last poll */
+   HYPRE_Int           num_calls;
+
+   HYPRE_Int           max_local;       /* scratch for the on-processor rows */
+   HYPRE_BigInt       *local_rows;
+   HYPRE_Int          *local_ncols;
+   HYPRE_Int          *local_indexes;
+
+} hypre_IJOffProcStream;
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrix:
  *--------------------------------------------------------------------------*/
@@ -40,6 +122,11 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_Int     omp_flag;
    HYPRE_Int     print_level;
 
+   hypre_IJElementPlan *element_plan; /* optional batched element
+                                         assembly plan */
+   hypre_IJOffProcStream *off_proc_stream; /* optional streaming of
+                                              off-processor entries */
+
 } hypre_IJMatrix;
 
 /*--------------------------------------------------------------------------
@@ -63,6 +150,8 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
+#define hypre_IJMatrixElementPlan(matrix)      ((matrix) -> element_plan)
+#define hypre_IJMatrixOffProcStream(matrix)    ((matrix) -> off_proc_stream)
 
 static inline HYPRE_MemoryLocation
 hypre_IJMatrixMemoryLocation(hypre_IJMatrix *matrix)
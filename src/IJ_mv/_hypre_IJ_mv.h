@@ -223,6 +223,88 @@ typedef struct
 #ifndef hypre_IJ_MATRIX_HEADER
 #define hypre_IJ_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_IJElementPlan:
+ *
+ * Scatter plan for batched element assembly (HYPRE_IJMatrixAddToElementValues).
+ * Positions index the local ParCSR data: [0, nnz_diag) is diag data and
+ * [nnz_diag, nnz_diag + nnz_offd) is offd data.  Element values (one dense
+ * element_size^2 block per element) are gathered into each position through
+ * the CSR-like maps below, so the additions are race-free across threads.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int       num_elements;
+   HYPRE_Int       element_size;
+   HYPRE_Int       nnz_diag;        /* ParCSR sizes the plan was built for */
+   HYPRE_Int       nnz_offd;
+
+   /* on-process couplings */
+   HYPRE_Int       num_local;       /* number of touched positions */
+   HYPRE_Int      *local_pos;       /* data position of each touched entry */
+   HYPRE_Int      *local_ptr;       /* element values for local_pos[i] are */
+   HYPRE_Int      *local_map;       /* local_map[local_ptr[i]:local_ptr[i+1]] */
+
+   /* off-process couplings, summed per (row, col) before sending */
+   HYPRE_Int       num_sends;
+   HYPRE_Int      *send_procs;
+   HYPRE_Int      *send_starts;     /* slots per send processor */
+   HYPRE_Int      *send_ptr;        /* element values for slot j are */
+   HYPRE_Int      *send_map;        /* send_map[send_ptr[j]:send_ptr[j+1]] */
+   HYPRE_Complex  *send_buf;
+
+   HYPRE_Int       num_recvs;
+   HYPRE_Int      *recv_procs;
+   HYPRE_Int      *recv_starts;     /* slots per recv processor */
+   HYPRE_Int      *recv_pos;        /* data position of each received slot */
+   HYPRE_Complex  *recv_buf;
+
+} hypre_IJElementPlan;
+
+/*--------------------------------------------------------------------------
+ * hypre_IJOffProcStream:
+ *
+ * Streaming mode for off-processor AddToValues.  Entries for rows owned by
+ * another processor are packed into a per-destination buffer as they are
+ * added.  When a buffer reaches buffer_size entries, duplicate (row, col)
+ * pairs are merged and, if it is still at least half full, the buffer is
+ * shipped with a non-blocking send on a private communicator.  Messages that
+ * have already arrived are drained between AddToValues calls, so only the
+ * remaining tail is exchanged inside HYPRE_IJMatrixAssemble.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm            comm;            /* duplicate of the matrix communicator */
+   HYPRE_Int           num_procs;
+   HYPRE_Int           buffer_size;     /* flush threshold (entries per destination) */
+   HYPRE_BigInt       *row_starts;      /* first row of every processor */
+
+   HYPRE_Int          *buf_num;         /* entries currently buffered per destination */
+   HYPRE_Int          *buf_alloc;
+   HYPRE_BigInt      **buf_rows;        /* (row, col, value) per destination */
+   HYPRE_BigInt      **buf_cols;
+   HYPRE_Complex     **buf_data;
+
+   HYPRE_Int           cycle;           /* assembly count; its parity selects the tag */
+   HYPRE_Int          *num_msgs;        /* messages sent to each processor */
+   HYPRE_Int           num_recvd;       /* messages received so far */
+
+   HYPRE_Int           num_requests;    /* sends still in flight */
+   HYPRE_Int           max_requests;
+   hypre_MPI_Request  *requests;
+   char              **send_bufs;
+   HYPRE_Int           need_progress;   /* a send was started since the last poll */
+   HYPRE_Int           num_calls;
+
+   HYPRE_Int           max_local;       /* scratch for the on-processor rows */
+   HYPRE_BigInt       *local_rows;
+   HYPRE_Int          *local_ncols;
+   HYPRE_Int          *local_indexes;
+
+} hypre_IJOffProcStream;
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrix:
  *--------------------------------------------------------------------------*/
@@ -249,6 +331,11 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_Int     omp_flag;
    HYPRE_Int     print_level;
 
+   hypre_IJElementPlan *element_plan; /* optional batched element
+                                         assembly plan */
+   hypre_IJOffProcStream *off_proc_stream; /* optional streaming of
+                                              off-processor entries */
+
 } hypre_IJMatrix;
 
 /*--------------------------------------------------------------------------
@@ -272,6 +359,8 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
+#define hypre_IJMatrixElementPlan(matrix)      ((matrix) -> element_plan)
+#define hypre_IJMatrixOffProcStream(matrix)    ((matrix) -> off_proc_stream)
 
 static inline HYPRE_MemoryLocation
 hypre_IJMatrixMemoryLocation(hypre_IJMatrix *matrix)
@@ -430,6 +519,24 @@ HYPRE_Int hypre_IJMatrixApplyISIS ( hypre_IJMatrix *matrix, hypre_ParVector *x,
 HYPRE_Int hypre_IJMatrixDestroyISIS ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixSetTotalSizeISIS ( hypre_IJMatrix *matrix, HYPRE_Int size );
 
+/* IJMatrix_element.c */
+HYPRE_Int hypre_IJElementPlanDestroy ( hypre_IJElementPlan *plan );
+HYPRE_Int hypre_IJMatrixSetElementPlanParCSR ( hypre_IJMatrix *matrix, HYPRE_Int num_elements,
+                                               HYPRE_Int element_size, const HYPRE_BigInt *element_dofs );
+HYPRE_Int hypre_IJMatrixAddToElementValuesParCSR ( hypre_IJMatrix *matrix,
+                                                   const HYPRE_Complex *values );
+
+/* IJMatrix_stream.c */
+HYPRE_Int hypre_IJOffProcStreamCreate ( hypre_IJMatrix *matrix, HYPRE_Int buffer_size,
+                                        hypre_IJOffProcStream **stream_ptr );
+HYPRE_Int hypre_IJOffProcStreamDestroy ( hypre_IJOffProcStream *stream );
+HYPRE_Int hypre_IJMatrixAddToValuesStreamParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                                  HYPRE_Int *ncols, const HYPRE_BigInt *rows,
+                                                  const HYPRE_Int *row_indexes,
+                                                  const HYPRE_BigInt *cols,
+                                                  const HYPRE_Complex *values );
+HYPRE_Int hypre_IJMatrixAssembleStreamParCSR ( hypre_IJMatrix *matrix );
+
 /* IJMatrix_parcsr.c */
 HYPRE_Int hypre_IJMatrixCreateParCSR ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixSetRowSizesParCSR ( hypre_IJMatrix *matrix, const HYPRE_Int *sizes );
@@ -547,6 +654,9 @@ HYPRE_Int HYPRE_IJMatrixSetValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPR
 HYPRE_Int HYPRE_IJMatrixSetConstantValues ( HYPRE_IJMatrix matrix, HYPRE_Complex value );
 HYPRE_Int HYPRE_IJMatrixAddToValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
                                       const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
+HYPRE_Int HYPRE_IJMatrixSetElementPlan ( HYPRE_IJMatrix matrix, HYPRE_Int num_elements,
+                                         HYPRE_Int element_size, const HYPRE_BigInt *element_dofs );
+HYPRE_Int HYPRE_IJMatrixAddToElementValues ( HYPRE_IJMatrix matrix, const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixAssemble ( HYPRE_IJMatrix matrix );
 HYPRE_Int HYPRE_IJMatrixGetRowCounts ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_BigInt *rows,
                                        HYPRE_Int *ncols );
@@ -561,6 +671,7 @@ HYPRE_Int HYPRE_IJMatrixSetRowSizes ( HYPRE_IJMatrix matrix, const HYPRE_Int *si
 HYPRE_Int HYPRE_IJMatrixSetDiagOffdSizes ( HYPRE_IJMatrix matrix, const HYPRE_Int *diag_sizes,
                                            const HYPRE_Int *offdiag_sizes );
 HYPRE_Int HYPRE_IJMatrixSetMaxOffProcElmts ( HYPRE_IJMatrix matrix, HYPRE_Int max_off_proc_elmts );
+HYPRE_Int HYPRE_IJMatrixSetOffProcStreaming ( HYPRE_IJMatrix matrix, HYPRE_Int buffer_size );
 HYPRE_Int HYPRE_IJMatrixRead ( const char *filename, MPI_Comm comm, HYPRE_Int type,
                                HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixReadBinary ( const char *filename, MPI_Comm comm, HYPRE_Int type,
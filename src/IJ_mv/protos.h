@@ -60,6 +60,24 @@ HYPRE_Int hypre_IJMatrixApplyISIS ( hypre_IJMatrix *matrix, hypre_ParVector *x,
 HYPRE_Int hypre_IJMatrixDestroyISIS ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixSetTotalSizeISIS ( hypre_IJMatrix *matrix, HYPRE_Int size );
 
+/* IJMatrix_element.c */
+HYPRE_Int hypre_IJElementPlanDestroy ( hypre_IJElementPlan *plan );
+HYPRE_Int hypre_IJMatrixSetElementPlanParCSR ( hypre_IJMatrix *matrix, HYPRE_Int num_elements,
+                                               HYPRE_Int element_size, const HYPRE_BigInt *element_dofs );
+HYPRE_Int hypre_IJMatrixAddToElementValuesParCSR ( hypre_IJMatrix *matrix,
+                                                   const HYPRE_Complex *values );
+
+/* IJMatrix_stream.c */
+HYPRE_Int hypre_IJOffProcStreamCreate ( hypre_IJMatrix *matrix, HYPRE_Int buffer_size,
+                                        hypre_IJOffProcStream **stream_ptr );
+HYPRE_Int hypre_IJOffProcStreamDestroy ( hypre_IJOffProcStream *stream );
+HYPRE_Int hypre_IJMatrixAddToValuesStreamParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                                  HYPRE_Int *ncols, const HYPRE_BigInt *rows,
+                                                  const HYPRE_Int *row_indexes,
+                                                  const HYPRE_BigInt *cols,
+                                                  const HYPRE_Complex *values );
+HYPRE_Int hypre_IJMatrixAssembleStreamParCSR ( hypre_IJMatrix *matrix );
+
 /* IJMatrix_parcsr.c */
 HYPRE_Int hypre_IJMatrixCreateParCSR ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixSetRowSizesParCSR ( hypre_IJMatrix *matrix, const HYPRE_Int *sizes );
@@ -177,6 +195,9 @@ HYPRE_Int HYPRE_IJMatrixSetValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPR
 HYPRE_Int HYPRE_IJMatrixSetConstantValues ( HYPRE_IJMatrix matrix, HYPRE_Complex value );
 HYPRE_Int HYPRE_IJMatrixAddToValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
                                       const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
+HYPRE_Int HYPRE_IJMatrixSetElementPlan ( HYPRE_IJMatrix matrix, HYPRE_Int num_elements,
+                                         HYPRE_Int element_size, const HYPRE_BigInt *element_dofs );
+HYPRE_Int HYPRE_IJMatrixAddToElementValues ( HYPRE_IJMatrix matrix, const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixAssemble ( HYPRE_IJMatrix matrix );
 HYPRE_Int HYPRE_IJMatrixGetRowCounts ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_BigInt *rows,
                                        HYPRE_Int *ncols );
@@ -191,6 +212,7 @@ HYPRE_Int HYPRE_IJMatrixSetRowSizes ( HYPRE_IJMatrix matrix, const HYPRE_Int *si
 HYPRE_Int HYPRE_IJMatrixSetDiagOffdSizes ( HYPRE_IJMatrix matrix, const HYPRE_Int *diag_sizes,
                                            const HYPRE_Int *offdiag_sizes );
 HYPRE_Int HYPRE_IJMatrixSetMaxOffProcElmts ( HYPRE_IJMatrix matrix, HYPRE_Int max_off_proc_elmts );
+HYPRE_Int HYPRE_IJMatrixSetOffProcStreaming ( HYPRE_IJMatrix matrix, HYPRE_Int buffer_size );
 HYPRE_Int HYPRE_IJMatrixRead ( const char *filename, MPI_Comm comm, HYPRE_Int type,
                                HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixReadBinary ( const char *filename, MPI_Comm comm, HYPRE_Int type,
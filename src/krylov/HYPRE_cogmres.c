@@ -104,6 +104,24 @@ HYPRE_COGMRESGetCGS( HYPRE_Solver solver,
    return ( hypre_COGMRESGetCGS( (void *) solver, cgs ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_COGMRESSetPipelined, HYPRE_COGMRESGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_COGMRESSetPipelined( HYPRE_Solver solver,
+                           HYPRE_Int             pipelined )
+{
+   return ( hypre_COGMRESSetPipelined( (void *) solver, pipelined ) );
+}
+
+HYPRE_Int
+HYPRE_COGMRESGetPipelined( HYPRE_Solver solver,
+                           HYPRE_Int           * pipelined )
+{
+   return ( hypre_COGMRESGetPipelined( (void *) solver, pipelined ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_COGMRESSetTol, HYPRE_COGMRESGetTol
  *--------------------------------------------------------------------------*/
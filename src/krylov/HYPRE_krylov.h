@@ -195,6 +195,30 @@ HYPRE_Int HYPRE_PCGSetFlex(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGSetSkipBreak(HYPRE_Solver solver,
                                 HYPRE_Int    skip_break);
 
+/**
+ * (Optional) Selects the CG variant:
+ *
+ *    - 0 : standard PCG (default)
+ *    - 1 : pipelined PCG; one global reduction per iteration, overlapped with
+ *          the preconditioner and the matrix-vector product
+ *    - 2 : s-step PCG; one global reduction every {\tt s\_step} iterations
+ *
+ * The variants 1 and 2 use one extra matrix-vector product and preconditioner
+ * application for the setup, and respectively 6 and 4*{\tt s\_step} extra
+ * vectors. They ignore the relative change, residual recomputation,
+ * residual tolerance, convergence factor and flexible options.
+ **/
+HYPRE_Int HYPRE_PCGSetVariant(HYPRE_Solver solver,
+                              HYPRE_Int    variant);
+
+/**
+ * (Optional) Number of iterations per block of the s-step variant. The
+ * default is 3. Larger values are prone to loss of accuracy, in particular with
+ * strong preconditioners such as BoomerAMG.
+ **/
+HYPRE_Int HYPRE_PCGSetSStep(HYPRE_Solver solver,
+                            HYPRE_Int    s_step);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -286,6 +310,16 @@ HYPRE_Int HYPRE_PCGGetSkipBreak(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGGetFlex(HYPRE_Solver solver,
                            HYPRE_Int   *flex);
 
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetVariant(HYPRE_Solver solver,
+                              HYPRE_Int   *variant);
+
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetSStep(HYPRE_Solver solver,
+                            HYPRE_Int   *s_step);
+
 /**
  **/
 HYPRE_Int HYPRE_PCGGetPrecond(HYPRE_Solver  solver,
@@ -918,11 +952,27 @@ HYPRE_Int HYPRE_COGMRESSetUnroll(HYPRE_Solver solver,
                                  HYPRE_Int    unroll);
 
 /**
- * (Optional) Set the number of orthogonalizations in COGMRES (at most 2).
+ * (Optional) Set the orthogonalization in COGMRES: 1 for classical
+ * Gram-Schmidt (default), 2 for classical Gram-Schmidt with (lagged)
+ * reorthogonalization, 3 for classical Gram-Schmidt with the
+ * reorthogonalization and the normalization of each basis vector lagged to
+ * the next iteration (one global reduction per iteration, and one more per
+ * restart cycle). Options 3 and above ignore the relative change and
+ * convergence factor options.
  **/
 HYPRE_Int HYPRE_COGMRESSetCGS(HYPRE_Solver solver,
                               HYPRE_Int    cgs);
 
+/**
+ * (Optional) If set to 1, use pipelined COGMRES: the orthogonalization of
+ * CGS option 3, with its global reduction overlapped with the application of
+ * the preconditioner and of the matrix for the next iteration. Uses k\_dim+1
+ * extra vectors and ignores the CGS, relative change and convergence factor
+ * options.
+ **/
+HYPRE_Int HYPRE_COGMRESSetPipelined(HYPRE_Solver solver,
+                                    HYPRE_Int    pipelined);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -1004,6 +1054,11 @@ HYPRE_Int HYPRE_COGMRESGetUnroll(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_COGMRESGetCGS(HYPRE_Solver  solver,
                               HYPRE_Int    *cgs);
 
+/**
+ **/
+HYPRE_Int HYPRE_COGMRESGetPipelined(HYPRE_Solver  solver,
+                                    HYPRE_Int    *pipelined);
+
 /**
  **/
 HYPRE_Int HYPRE_COGMRESGetPrecond(HYPRE_Solver  solver,
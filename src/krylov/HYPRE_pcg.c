@@ -282,6 +282,42 @@ HYPRE_PCGGetFlex( HYPRE_Solver  solver,
    return ( hypre_PCGGetFlex( (void *) solver, flex ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_PCGSetVariant, HYPRE_PCGGetVariant
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PCGSetVariant( HYPRE_Solver solver,
+                     HYPRE_Int    variant )
+{
+   return ( hypre_PCGSetVariant( (void *) solver, variant ) );
+}
+
+HYPRE_Int
+HYPRE_PCGGetVariant( HYPRE_Solver  solver,
+                     HYPRE_Int    *variant )
+{
+   return ( hypre_PCGGetVariant( (void *) solver, variant ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PCGSetSStep, HYPRE_PCGGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PCGSetSStep( HYPRE_Solver solver,
+                   HYPRE_Int    s_step )
+{
+   return ( hypre_PCGSetSStep( (void *) solver, s_step ) );
+}
+
+HYPRE_Int
+HYPRE_PCGGetSStep( HYPRE_Solver  solver,
+                   HYPRE_Int    *s_step )
+{
+   return ( hypre_PCGGetSStep( (void *) solver, s_step ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_PCGSetPrecond
  *--------------------------------------------------------------------------*/
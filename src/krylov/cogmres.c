@@ -73,6 +73,27 @@ hypre_COGMRESFunctionsCreate(
    return cogmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESFunctionsSetBlockInnerProd
+ *
+ * Sets the optional (non-blocking) block inner product used by the
+ * pipelined variant. Without it, the variant uses MassDotpTwo.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESFunctionsSetBlockInnerProd(
+   hypre_COGMRESFunctions *cogmres_functions,
+   void *       (*BlockInnerProdStart)  ( HYPRE_Int kx, void **x, HYPRE_Int ky, void **y,
+                                          HYPRE_Real *result ),
+   HYPRE_Int    (*BlockInnerProdFinish) ( void *handle )
+)
+{
+   cogmres_functions->BlockInnerProdStart  = BlockInnerProdStart;
+   cogmres_functions->BlockInnerProdFinish = BlockInnerProdFinish;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESCreate
  *--------------------------------------------------------------------------*/
@@ -90,6 +111,7 @@ hypre_COGMRESCreate( hypre_COGMRESFunctions *cogmres_functions )
    /* set defaults */
    (cogmres_data -> k_dim)          = 5;
    (cogmres_data -> cgs)            = 1; /* if 2 performs reorthogonalization */
+   (cogmres_data -> pipelined)      = 0;
    (cogmres_data -> tol)            = 1.0e-06; /* relative residual tol */
    (cogmres_data -> cf_tol)         = 0.0;
    (cogmres_data -> a_tol)          = 0.0; /* abs. residual tol */
@@ -109,6 +131,8 @@ hypre_COGMRESCreate( hypre_COGMRESFunctions *cogmres_functions )
    (cogmres_data -> norms)          = NULL;
    (cogmres_data -> log_file_name)  = NULL;
    (cogmres_data -> unroll)         = 0;
+   (cogmres_data -> z)              = NULL;
+   (cogmres_data -> num_z)          = 0;
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -167,6 +191,7 @@ hypre_COGMRESDestroy( void *cogmres_vdata )
          }
          hypre_TFreeF( cogmres_data->p, cogmres_functions );
       }
+      hypre_COGMRESLowSynchVectorsDestroy(cogmres_data);
       hypre_TFreeF( cogmres_data, cogmres_functions );
       hypre_TFreeF( cogmres_functions, cogmres_functions );
    }
@@ -337,6 +362,12 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
 
    HYPRE_Real real_r_norm_old, real_r_norm_new;
 
+   /* one-reduce and pipelined variants (see cogmres_ca.c) */
+   if ((cogmres_data -> pipelined) || cgs > 2)
+   {
+      return hypre_COGMRESSolveLowSynch(cogmres_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (cogmres_data -> converged) = 0;
@@ -980,6 +1011,28 @@ hypre_COGMRESGetCGS( void   *cogmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetPipelined, hypre_COGMRESGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetPipelined( void   *cogmres_vdata,
+                           HYPRE_Int   pipelined )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *) cogmres_vdata;
+   (cogmres_data -> pipelined) = pipelined;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetPipelined( void   *cogmres_vdata,
+                           HYPRE_Int * pipelined )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *pipelined = (cogmres_data -> pipelined);
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESSetTol, hypre_COGMRESGetTol
  *--------------------------------------------------------------------------*/
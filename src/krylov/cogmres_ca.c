@@ -0,0 +1,524 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Low-synchronization variants of COGMRES (right preconditioning):
+ *
+ *  - one-reduce CGS2 (cgs = 3): classical Gram-Schmidt with
+ *    reorthogonalization, where the second pass and the normalization of a
+ *    basis vector are lagged to the next iteration (DCGS2). All the inner
+ *    products of an iteration are done in a single global reduction;
+ *
+ *  - pipelined (pipelined = 1): the same orthogonalization, with the global
+ *    reduction of iteration i overlapped with the application of the
+ *    preconditioner and of the matrix for iteration i+1 (as in p(1)-GMRES).
+ *    The vectors z_k = A*C*v_k are kept and updated with the same linear
+ *    combinations as the basis vectors.
+ *
+ * At iteration i, u = p[i-1] has been orthogonalized once against
+ * v_0, ..., v_{i-2}, and w = A*C*u. One reduction gives <w, v_k> and
+ * <u, v_k>, k < i. Then u is reorthogonalized and normalized into v_{i-1},
+ * which completes column i-2 of the Hessenberg matrix, and w is
+ * orthogonalized once into the next u. The residual norm is thus known one
+ * iteration later than in COGMRES, and each restart cycle ends with one
+ * extra reduction.
+ *
+ * The reductions go through the optional BlockInnerProdStart/Finish
+ * callbacks of hypre_COGMRESFunctions when present. The true residual is
+ * recomputed at every restart. rel_change and cf_tol are not supported.
+ *
+ *****************************************************************************/
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESLowSynchVectorsDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESLowSynchVectorsDestroy( void *cogmres_vdata )
+{
+   hypre_COGMRESData      *cogmres_data      = (hypre_COGMRESData *) cogmres_vdata;
+   hypre_COGMRESFunctions *cogmres_functions = cogmres_data -> functions;
+   HYPRE_Int               i;
+
+   if (cogmres_data -> z)
+   {
+      for (i = 0; i < (cogmres_data -> num_z); i++)
+      {
+         if ((cogmres_data -> z)[i] != NULL)
+         {
+            (*(cogmres_functions -> DestroyVector))((cogmres_data -> z)[i]);
+         }
+      }
+      hypre_TFreeF(cogmres_data -> z, cogmres_functions);
+   }
+   (cogmres_data -> z)     = NULL;
+   (cogmres_data -> num_z) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESLowSynchGivens
+ *
+ * Copies column c of the Hessenberg matrix hf into hh, applies the previous
+ * Givens rotations and a new one to it, and updates rs. Returns the residual
+ * norm of the least-squares problem with c+1 columns.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+hypre_COGMRESLowSynchGivens( HYPRE_Int   k_dim,
+                             HYPRE_Int   c,
+                             HYPRE_Real *hf,
+                             HYPRE_Real *hh,
+                             HYPRE_Real *cs,
+                             HYPRE_Real *sn,
+                             HYPRE_Real *rs )
+{
+   HYPRE_Int   col    = c * (k_dim + 1);
+   HYPRE_Real  epsmac = 1.e-16;
+   HYPRE_Real  t, gamma;
+   HYPRE_Int   j;
+
+   for (j = 0; j <= c + 1; j++)
+   {
+      hh[col + j] = hf[col + j];
+   }
+   for (j = 1; j <= c; j++)
+   {
+      t = hh[col + j - 1];
+      hh[col + j - 1] = sn[j - 1] * hh[col + j] + cs[j - 1] * t;
+      hh[col + j] = -sn[j - 1] * t + cs[j - 1] * hh[col + j];
+   }
+   t  = hh[col + c + 1] * hh[col + c + 1];
+   t += hh[col + c] * hh[col + c];
+   gamma = hypre_sqrt(t);
+   if (gamma == 0.0) { gamma = epsmac; }
+   cs[c] = hh[col + c] / gamma;
+   sn[c] = hh[col + c + 1] / gamma;
+   rs[c + 1] = -hh[col + c + 1] * rs[c];
+   rs[c + 1] /= gamma;
+   rs[c] = cs[c] * rs[c];
+   hh[col + c] = sn[c] * hh[col + c + 1] + cs[c] * hh[col + c];
+
+   return hypre_abs(rs[c + 1]);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESLowSynchApply
+ *
+ * y = A*C*x, with r as temporary vector.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESLowSynchApply( hypre_COGMRESData *cogmres_data,
+                            void              *A,
+                            void              *x,
+                            void              *y )
+{
+   hypre_COGMRESFunctions *cogmres_functions = cogmres_data -> functions;
+   void                   *r                 = (cogmres_data -> r);
+
+   (*(cogmres_functions -> ClearVector))(r);
+   (*(cogmres_functions -> precond))(cogmres_data -> precond_data, A, x, r);
+   (*(cogmres_functions -> Matvec))(cogmres_data -> matvec_data, 1.0, A, r, 0.0, y);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSolveLowSynch
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSolveLowSynch( void *cogmres_vdata,
+                            void *A,
+                            void *b,
+                            void *x )
+{
+   hypre_COGMRESData      *cogmres_data      = (hypre_COGMRESData *) cogmres_vdata;
+   hypre_COGMRESFunctions *cogmres_functions = cogmres_data -> functions;
+
+   HYPRE_Int     k_dim             = (cogmres_data -> k_dim);
+   HYPRE_Int     unroll            = (cogmres_data -> unroll);
+   HYPRE_Int     pipelined         = (cogmres_data -> pipelined);
+   HYPRE_Int     min_iter          = (cogmres_data -> min_iter);
+   HYPRE_Int     max_iter          = (cogmres_data -> max_iter);
+   HYPRE_Int     skip_real_r_check = (cogmres_data -> skip_real_r_check);
+   HYPRE_Real    r_tol             = (cogmres_data -> tol);
+   HYPRE_Real    a_tol             = (cogmres_data -> a_tol);
+   void         *matvec_data       = (cogmres_data -> matvec_data);
+   void         *r                 = (cogmres_data -> r);
+   void         *w                 = (cogmres_data -> w);
+   void        **p                 = (cogmres_data -> p);
+   HYPRE_Int     print_level       = (cogmres_data -> print_level);
+   HYPRE_Int     logging           = (cogmres_data -> logging);
+   HYPRE_Real   *norms             = (cogmres_data -> norms);
+
+   HYPRE_Int   (*precond)(void*, void*, void*, void*) = (cogmres_functions -> precond);
+   void         *precond_data      = (cogmres_data -> precond_data);
+
+   void        **z = NULL;
+   void         *xs[2];
+   void         *handle;
+   HYPRE_Real   *rs, *hh, *hf, *cs, *sn, *prods, *c;
+   HYPRE_Real   *hw, *su;
+   HYPRE_Real    b_norm, r_norm, den_norm, epsilon, t, nu;
+   HYPRE_Int     i, j, k, l, m, iter, cycle_done;
+   HYPRE_Int     my_id, num_procs;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (cogmres_data -> converged) = 0;
+   (*(cogmres_functions -> CommInfo))(A, &my_id, &num_procs);
+
+   if (pipelined)
+   {
+      if ((cogmres_data -> num_z) != k_dim + 1)
+      {
+         hypre_COGMRESLowSynchVectorsDestroy(cogmres_data);
+         (cogmres_data -> z) = (void **) (*(cogmres_functions -> CreateVectorArray))(k_dim + 1, x);
+         (cogmres_data -> num_z) = k_dim + 1;
+      }
+      z = (cogmres_data -> z);
+   }
+
+   rs    = hypre_CTAllocF(HYPRE_Real, k_dim + 1, cogmres_functions, HYPRE_MEMORY_HOST);
+   cs    = hypre_CTAllocF(HYPRE_Real, k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   sn    = hypre_CTAllocF(HYPRE_Real, k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   hh    = hypre_CTAllocF(HYPRE_Real, (k_dim + 1) * k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   hf    = hypre_CTAllocF(HYPRE_Real, (k_dim + 1) * k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   prods = hypre_CTAllocF(HYPRE_Real, 2 * (k_dim + 1), cogmres_functions, HYPRE_MEMORY_HOST);
+   c     = hypre_CTAllocF(HYPRE_Real, k_dim + 1, cogmres_functions, HYPRE_MEMORY_HOST);
+
+   b_norm = hypre_sqrt((*(cogmres_functions -> InnerProd))(b, b));
+
+   /* compute initial residual */
+   (*(cogmres_functions -> CopyVector))(b, p[0]);
+   (*(cogmres_functions -> Matvec))(matvec_data, -1.0, A, x, 1.0, p[0]);
+   r_norm = hypre_sqrt((*(cogmres_functions -> InnerProd))(p[0], p[0]));
+
+   if (b_norm != b_norm || r_norm != r_norm)
+   {
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+         hypre_printf("ERROR -- hypre_COGMRESSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+
+      hypre_TFreeF(rs, cogmres_functions);
+      hypre_TFreeF(cs, cogmres_functions);
+      hypre_TFreeF(sn, cogmres_functions);
+      hypre_TFreeF(hh, cogmres_functions);
+      hypre_TFreeF(hf, cogmres_functions);
+      hypre_TFreeF(prods, cogmres_functions);
+      hypre_TFreeF(c, cogmres_functions);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   if (logging > 0 || print_level > 0)
+   {
+      norms[0] = r_norm;
+      if (print_level > 1 && my_id == 0)
+      {
+         hypre_printf("L2 norm of b: %e\n", b_norm);
+         if (b_norm == 0.0)
+         {
+            hypre_printf("Rel_resid_norm actually contains the residual norm\n");
+         }
+         hypre_printf("Initial L2 norm of residual: %e\n", r_norm);
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters     resid.norm     conv.rate  rel.res.norm\n");
+         hypre_printf("-----    ------------    ---------- ------------\n");
+      }
+   }
+
+   /* convergence criteria: |r_i| <= max(a_tol, r_tol * den_norm) */
+   den_norm = (b_norm > 0.0) ? b_norm : r_norm;
+   epsilon  = hypre_max(a_tol, r_tol * den_norm);
+
+   iter = 0;
+   while (1)
+   {
+      /* r_norm is the norm of the true residual p[0] here */
+      if ((r_norm <= epsilon && iter >= min_iter) || r_norm == 0.0)
+      {
+         (cogmres_data -> converged) = 1;
+         break;
+      }
+      if (iter >= max_iter)
+      {
+         break;
+      }
+
+      rs[0] = r_norm;
+      (*(cogmres_functions -> ScaleVector))(1.0 / r_norm, p[0]);
+      if (pipelined)
+      {
+         hypre_COGMRESLowSynchApply(cogmres_data, A, p[0], z[0]);
+      }
+
+      /* m is the number of completed columns of the Hessenberg matrix */
+      m = 0;
+      cycle_done = 0;
+      for (i = 1; i <= k_dim; i++)
+      {
+         /* u = p[i-1] and w = A*C*u, in p[i] (in z[i-1] if pipelined) */
+         if (pipelined)
+         {
+            xs[0] = z[i - 1];
+         }
+         else
+         {
+            hypre_COGMRESLowSynchApply(cogmres_data, A, p[i - 1], p[i]);
+            xs[0] = p[i];
+         }
+         xs[1] = p[i - 1];
+
+         /* single reduction: hw[k] = <w, v_k>, su[k] = <u, v_k>, k < i */
+         hw = prods;
+         su = prods + i;
+         if (pipelined && (cogmres_functions -> BlockInnerProdStart))
+         {
+            handle = (*(cogmres_functions -> BlockInnerProdStart))(2, xs, i, p, prods);
+
+            /* overlapped with the reduction: z[i] = A*C*w */
+            if (i < k_dim)
+            {
+               hypre_COGMRESLowSynchApply(cogmres_data, A, xs[0], z[i]);
+            }
+
+            (*(cogmres_functions -> BlockInnerProdFinish))(handle);
+         }
+         else
+         {
+            (*(cogmres_functions -> MassDotpTwo))(xs[0], xs[1], p, i, unroll, hw, su);
+            if (pipelined && i < k_dim)
+            {
+               hypre_COGMRESLowSynchApply(cogmres_data, A, xs[0], z[i]);
+            }
+         }
+         if (pipelined)
+         {
+            (*(cogmres_functions -> CopyVector))(xs[0], p[i]);
+         }
+
+         /* second pass on u: v_{i-1} = (u - sum_k su[k] v_k) / nu */
+         t = su[i - 1];
+         for (k = 0; k < i - 1; k++)
+         {
+            t -= su[k] * su[k];
+            c[k] = -su[k];
+         }
+         nu = (t > 0.0) ? hypre_sqrt(t) : 0.0;
+
+         if (i > 1)
+         {
+            (*(cogmres_functions -> MassAxpy))(c, p, p[i - 1], i - 1, unroll);
+            if (pipelined)
+            {
+               (*(cogmres_functions -> MassAxpy))(c, z, z[i - 1], i - 1, unroll);
+            }
+
+            /* complete column i-2 */
+            for (k = 0; k < i - 1; k++)
+            {
+               hf[(i - 2) * (k_dim + 1) + k] += su[k];
+            }
+            hf[(i - 2) * (k_dim + 1) + i - 1] = nu;
+            r_norm = hypre_COGMRESLowSynchGivens(k_dim, i - 2, hf, hh, cs, sn, rs);
+            m = i - 1;
+            iter++;
+
+            if (logging > 0 || print_level > 0)
+            {
+               norms[iter] = r_norm;
+               if (print_level > 1 && my_id == 0)
+               {
+                  if (b_norm > 0.0)
+                     hypre_printf("% 5d    %e    %f   %e\n", iter,
+                                  norms[iter], norms[iter] / norms[iter - 1],
+                                  norms[iter] / b_norm);
+                  else
+                     hypre_printf("% 5d    %e    %f\n", iter, norms[iter],
+                                  norms[iter] / norms[iter - 1]);
+               }
+            }
+         }
+         else
+         {
+            /* v_0 was scaled with the norm of one pass only */
+            rs[0] *= nu;
+         }
+
+         /* u is in the span of the previous basis vectors (breakdown) */
+         if (nu == 0.0)
+         {
+            cycle_done = 1;
+            break;
+         }
+         (*(cogmres_functions -> ScaleVector))(1.0 / nu, p[i - 1]);
+         if (pipelined)
+         {
+            (*(cogmres_functions -> ScaleVector))(1.0 / nu, z[i - 1]);
+         }
+
+         if ((m > 0 && r_norm <= epsilon && iter >= min_iter) || iter >= max_iter)
+         {
+            cycle_done = 1;
+            break;
+         }
+
+         /* first pass on w against v_0, ..., v_{i-1}, using
+            A*C*v_{i-1} = (w - sum_k su[k] A*C*v_k) / nu for column i-1 */
+         t = hw[i - 1];
+         for (k = 0; k < i - 1; k++)
+         {
+            c[k] = hw[k];
+            t -= su[k] * hw[k];
+         }
+         c[i - 1] = t / nu;
+
+         for (l = 0; l < i; l++)
+         {
+            t = c[l];
+            for (k = hypre_max(l - 1, 0); k < i - 1; k++)
+            {
+               t -= su[k] * hf[k * (k_dim + 1) + l];
+            }
+            hf[(i - 1) * (k_dim + 1) + l] = t / nu;
+         }
+
+         /* next u = (w - sum_k c[k] v_k) / nu */
+         for (k = 0; k < i; k++)
+         {
+            c[k] = -c[k];
+         }
+         (*(cogmres_functions -> MassAxpy))(c, p, p[i], i, unroll);
+         (*(cogmres_functions -> ScaleVector))(1.0 / nu, p[i]);
+         if (pipelined && i < k_dim)
+         {
+            (*(cogmres_functions -> MassAxpy))(c, z, z[i], i, unroll);
+            (*(cogmres_functions -> ScaleVector))(1.0 / nu, z[i]);
+         }
+      }
+
+      if (!cycle_done)
+      {
+         /* complete the last column with the second pass on u = p[k_dim] */
+         (*(cogmres_functions -> MassInnerProd))(p[k_dim], p, k_dim + 1, unroll, prods);
+         t = prods[k_dim];
+         for (k = 0; k < k_dim; k++)
+         {
+            hf[(k_dim - 1) * (k_dim + 1) + k] += prods[k];
+            t -= prods[k] * prods[k];
+         }
+         hf[(k_dim - 1) * (k_dim + 1) + k_dim] = (t > 0.0) ? hypre_sqrt(t) : 0.0;
+         r_norm = hypre_COGMRESLowSynchGivens(k_dim, k_dim - 1, hf, hh, cs, sn, rs);
+         m = k_dim;
+         iter++;
+
+         if (logging > 0 || print_level > 0)
+         {
+            norms[iter] = r_norm;
+            if (print_level > 1 && my_id == 0)
+            {
+               if (b_norm > 0.0)
+                  hypre_printf("% 5d    %e    %f   %e\n", iter,
+                               norms[iter], norms[iter] / norms[iter - 1],
+                               norms[iter] / b_norm);
+               else
+                  hypre_printf("% 5d    %e    %f\n", iter, norms[iter],
+                               norms[iter] / norms[iter - 1]);
+            }
+         }
+      }
+
+      if (m > 0)
+      {
+         /* solve the upper triangular system */
+         rs[m - 1] = rs[m - 1] / hh[(m - 1) * (k_dim + 1) + m - 1];
+         for (k = m - 2; k >= 0; k--)
+         {
+            t = 0.0;
+            for (j = k + 1; j < m; j++)
+            {
+               t -= hh[j * (k_dim + 1) + k] * rs[j];
+            }
+            t += rs[k];
+            rs[k] = t / hh[k * (k_dim + 1) + k];
+         }
+
+         /* x += C*V*y */
+         (*(cogmres_functions -> CopyVector))(p[m - 1], w);
+         (*(cogmres_functions -> ScaleVector))(rs[m - 1], w);
+         for (j = m - 2; j >= 0; j--)
+         {
+            (*(cogmres_functions -> Axpy))(rs[j], p[j], w);
+         }
+         (*(cogmres_functions -> ClearVector))(r);
+         precond(precond_data, A, w, r);
+         (*(cogmres_functions -> Axpy))(1.0, r, x);
+      }
+
+      if (skip_real_r_check && r_norm <= epsilon && iter >= min_iter)
+      {
+         (cogmres_data -> converged) = 1;
+         break;
+      }
+
+      /* true residual, for the convergence check and the restart */
+      (*(cogmres_functions -> CopyVector))(b, p[0]);
+      (*(cogmres_functions -> Matvec))(matvec_data, -1.0, A, x, 1.0, p[0]);
+      r_norm = hypre_sqrt((*(cogmres_functions -> InnerProd))(p[0], p[0]));
+
+      for (k = 0; k < (k_dim + 1) * k_dim; k++)
+      {
+         hf[k] = 0.0;
+      }
+   }
+
+   if (print_level > 1 && my_id == 0)
+   {
+      hypre_printf("\n\n");
+      hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+   }
+
+   (cogmres_data -> num_iterations) = iter;
+   if (b_norm > 0.0)
+   {
+      (cogmres_data -> rel_residual_norm) = r_norm / b_norm;
+   }
+   else
+   {
+      (cogmres_data -> rel_residual_norm) = r_norm;
+   }
+
+   if (iter >= max_iter && r_norm > epsilon && epsilon > 0)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   hypre_TFreeF(rs, cogmres_functions);
+   hypre_TFreeF(cs, cogmres_functions);
+   hypre_TFreeF(sn, cogmres_functions);
+   hypre_TFreeF(hh, cogmres_functions);
+   hypre_TFreeF(hf, cogmres_functions);
+   hypre_TFreeF(prods, cogmres_functions);
+   hypre_TFreeF(c, cogmres_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
@@ -65,6 +65,24 @@ hypre_GMRESFunctionsCreate(
    return gmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESFunctionsSetAxpyInnerProd
+ *
+ * Sets the optional fused axpy and inner product used in the modified
+ * Gram-Schmidt loop. Without it, GMRES uses Axpy and InnerProd.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESFunctionsSetAxpyInnerProd(
+   hypre_GMRESFunctions *gmres_functions,
+   HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z )
+)
+{
+   gmres_functions->AxpyInnerProd = AxpyInnerProd;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESCreate
  *--------------------------------------------------------------------------*/
@@ -539,12 +557,27 @@ hypre_GMRESSolve(void  *gmres_vdata,
          precond(precond_data, A, p[i - 1], r);
          (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
          /* modified Gram_Schmidt */
-         for (j = 0; j < i; j++)
+         if (gmres_functions->AxpyInnerProd)
+         {
+            /* each axpy is fused with the next inner product */
+            hh[0][i - 1] = (*(gmres_functions->InnerProd))(p[0], p[i]);
+            for (j = 0; j < i - 1; j++)
+            {
+               hh[j + 1][i - 1] = (*(gmres_functions->AxpyInnerProd))(-hh[j][i - 1], p[j],
+                                                                      p[i], p[j + 1]);
+            }
+            t = hypre_sqrt((*(gmres_functions->AxpyInnerProd))(-hh[i - 1][i - 1], p[i - 1],
+                                                               p[i], p[i]));
+         }
+         else
          {
-            hh[j][i - 1] = (*(gmres_functions->InnerProd))(p[j], p[i]);
-            (*(gmres_functions->Axpy))(-hh[j][i - 1], p[j], p[i]);
+            for (j = 0; j < i; j++)
+            {
+               hh[j][i - 1] = (*(gmres_functions->InnerProd))(p[j], p[i]);
+               (*(gmres_functions->Axpy))(-hh[j][i - 1], p[j], p[i]);
+            }
+            t = hypre_sqrt((*(gmres_functions->InnerProd))(p[i], p[i]));
          }
-         t = hypre_sqrt((*(gmres_functions->InnerProd))(p[i], p[i]));
          hh[i][i - 1] = t;
          if (t != 0.0)
          {
@@ -415,6 +415,9 @@ typedef struct
    HYPRE_Int    (*precond)       (void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup) (void *vdata, void *A, void *b, void *x);
 
+   /* optional fused vector operation: y = y + alpha*x, returns <z,y> */
+   HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z );
+
 } hypre_GMRESFunctions;
 
 /**
@@ -507,6 +510,12 @@ extern "C" {
    void *
    hypre_GMRESCreate( hypre_GMRESFunctions *gmres_functions );
 
+   HYPRE_Int
+   hypre_GMRESFunctionsSetAxpyInnerProd(
+      hypre_GMRESFunctions *gmres_functions,
+      HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z )
+   );
+
 #ifdef __cplusplus
 }
 #endif
@@ -582,6 +591,12 @@ typedef struct
 
    HYPRE_Int    (*modify_pc)( void *precond_data, HYPRE_Int iteration, HYPRE_Real rel_residual_norm);
 
+   /* optional, used by the pipelined variant: starts the computation of
+      result[i*ky+j] = <x[i],y[j]> and returns a handle that must be passed to
+      BlockInnerProdFinish before result is read */
+   void *       (*BlockInnerProdStart)  ( HYPRE_Int kx, void **x, HYPRE_Int ky, void **y,
+                                          HYPRE_Real *result );
+   HYPRE_Int    (*BlockInnerProdFinish) ( void *handle );
 
 } hypre_COGMRESFunctions;
 
@@ -594,6 +609,7 @@ typedef struct
    HYPRE_Int      k_dim;
    HYPRE_Int      unroll;
    HYPRE_Int      cgs;
+   HYPRE_Int      pipelined;
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
@@ -610,6 +626,8 @@ typedef struct
    void  *w;
    void  *w_2;
    void  **p;
+   HYPRE_Int num_z; /* work vectors of the pipelined variant */
+   void  **z;
 
    void    *matvec_data;
    void    *precond_data;
@@ -679,6 +697,14 @@ extern "C" {
    void *
    hypre_COGMRESCreate( hypre_COGMRESFunctions *gmres_functions );
 
+   HYPRE_Int
+   hypre_COGMRESFunctionsSetBlockInnerProd(
+      hypre_COGMRESFunctions *cogmres_functions,
+      void *       (*BlockInnerProdStart)  ( HYPRE_Int kx, void **x, HYPRE_Int ky, void **y,
+                                             HYPRE_Real *result ),
+      HYPRE_Int    (*BlockInnerProdFinish) ( void *handle )
+   );
+
 #ifdef __cplusplus
 }
 #endif
@@ -1070,6 +1096,19 @@ typedef struct
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x);
 
+   /* optional, used by the pipelined and s-step variants: starts the
+      computation of result[i*ky+j] = <x[i],y[j]> and returns a handle that
+      must be passed to BlockInnerProdFinish before result is read */
+   void *       (*BlockInnerProdStart)  ( HYPRE_Int kx, void **x, HYPRE_Int ky, void **y,
+                                          HYPRE_Real *result );
+   HYPRE_Int    (*BlockInnerProdFinish) ( void *handle );
+
+   /* optional fused vector operations: y = alpha*x + beta*y, and y1 += alpha*x1,
+      y2 += beta*x2 with result = <y2,y2> if result is not NULL */
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+   HYPRE_Int    (*Axpy2)         ( HYPRE_Complex alpha, void *x1, void *y1,
+                                   HYPRE_Complex beta, void *x2, void *y2, HYPRE_Real *result );
+
 } hypre_PCGFunctions;
 
 /**
@@ -1124,6 +1163,8 @@ typedef struct
    HYPRE_Int      hybrid;
    HYPRE_Int      skip_break;
    HYPRE_Int      flex;
+   HYPRE_Int      variant; /* 0: standard, 1: pipelined, 2: s-step */
+   HYPRE_Int      s_step;
 
    void    *A;
    void    *p;
@@ -1132,6 +1173,8 @@ typedef struct
                    If that is ever changed, it still must be kept if logging>1 */
    void    *r_old; /* only needed for flexible CG */
    void    *v; /* work vector; only needed if recompute_residual_p is set */
+   HYPRE_Int      num_ca_vectors; /* work vectors of the pipelined and s-step variants */
+   void   **ca_vectors;
 
    HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void    *matvec_data;
@@ -1200,6 +1243,22 @@ extern "C" {
    void *
    hypre_PCGCreate( hypre_PCGFunctions *pcg_functions );
 
+   HYPRE_Int
+   hypre_PCGFunctionsSetBlockInnerProd(
+      hypre_PCGFunctions *pcg_functions,
+      void *       (*BlockInnerProdStart)  ( HYPRE_Int kx, void **x, HYPRE_Int ky, void **y,
+                                             HYPRE_Real *result ),
+      HYPRE_Int    (*BlockInnerProdFinish) ( void *handle )
+   );
+
+   HYPRE_Int
+   hypre_PCGFunctionsSetFusedOps(
+      hypre_PCGFunctions *pcg_functions,
+      HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y ),
+      HYPRE_Int    (*Axpy2)         ( HYPRE_Complex alpha, void *x1, void *y1,
+                                      HYPRE_Complex beta, void *x2, void *y2, HYPRE_Real *result )
+   );
+
 #ifdef __cplusplus
 }
 #endif
@@ -1299,6 +1358,8 @@ HYPRE_Int hypre_COGMRESSetUnroll ( void *gmres_vdata, HYPRE_Int unroll );
 HYPRE_Int hypre_COGMRESGetUnroll ( void *gmres_vdata, HYPRE_Int *unroll );
 HYPRE_Int hypre_COGMRESSetCGS ( void *gmres_vdata, HYPRE_Int cgs );
 HYPRE_Int hypre_COGMRESGetCGS ( void *gmres_vdata, HYPRE_Int *cgs );
+HYPRE_Int hypre_COGMRESSetPipelined ( void *gmres_vdata, HYPRE_Int pipelined );
+HYPRE_Int hypre_COGMRESGetPipelined ( void *gmres_vdata, HYPRE_Int *pipelined );
 HYPRE_Int hypre_COGMRESSetTol ( void *gmres_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_COGMRESGetTol ( void *gmres_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_COGMRESSetAbsoluteTol ( void *gmres_vdata, HYPRE_Real a_tol );
@@ -1327,6 +1388,10 @@ HYPRE_Int hypre_COGMRESGetFinalRelativeResidualNorm ( void *gmres_vdata,
 HYPRE_Int hypre_COGMRESSetModifyPC ( void *fgmres_vdata, HYPRE_Int (*modify_pc )(void *precond_data,
                                                                                  HYPRE_Int iteration, HYPRE_Real rel_residual_norm));
 
+/* cogmres_ca.c */
+HYPRE_Int hypre_COGMRESLowSynchVectorsDestroy ( void *cogmres_vdata );
+HYPRE_Int hypre_COGMRESSolveLowSynch ( void *cogmres_vdata, void *A, void *b, void *x );
+
 
 
 /* flexgmres.c */
@@ -1479,6 +1544,8 @@ HYPRE_Int HYPRE_COGMRESSetUnroll ( HYPRE_Solver solver, HYPRE_Int unroll );
 HYPRE_Int HYPRE_COGMRESGetUnroll ( HYPRE_Solver solver, HYPRE_Int *unroll );
 HYPRE_Int HYPRE_COGMRESSetCGS ( HYPRE_Solver solver, HYPRE_Int cgs );
 HYPRE_Int HYPRE_COGMRESGetCGS ( HYPRE_Solver solver, HYPRE_Int *cgs );
+HYPRE_Int HYPRE_COGMRESSetPipelined ( HYPRE_Solver solver, HYPRE_Int pipelined );
+HYPRE_Int HYPRE_COGMRESGetPipelined ( HYPRE_Solver solver, HYPRE_Int *pipelined );
 HYPRE_Int HYPRE_COGMRESSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_COGMRESGetTol ( HYPRE_Solver solver, HYPRE_Real *tol );
 HYPRE_Int HYPRE_COGMRESSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
@@ -1596,6 +1663,10 @@ HYPRE_Int HYPRE_PCGSetSkipBreak ( HYPRE_Solver solver, HYPRE_Int skip_break );
 HYPRE_Int HYPRE_PCGGetSkipBreak ( HYPRE_Solver solver, HYPRE_Int *skip_break );
 HYPRE_Int HYPRE_PCGSetFlex ( HYPRE_Solver solver, HYPRE_Int flex );
 HYPRE_Int HYPRE_PCGGetFlex ( HYPRE_Solver solver, HYPRE_Int *flex );
+HYPRE_Int HYPRE_PCGSetVariant ( HYPRE_Solver solver, HYPRE_Int variant );
+HYPRE_Int HYPRE_PCGGetVariant ( HYPRE_Solver solver, HYPRE_Int *variant );
+HYPRE_Int HYPRE_PCGSetSStep ( HYPRE_Solver solver, HYPRE_Int s_step );
+HYPRE_Int HYPRE_PCGGetSStep ( HYPRE_Solver solver, HYPRE_Int *s_step );
 HYPRE_Int HYPRE_PCGSetPrecond ( HYPRE_Solver solver, HYPRE_PtrToSolverFcn precond,
                                 HYPRE_PtrToSolverFcn precond_setup, HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_PCGGetPrecond ( HYPRE_Solver solver, HYPRE_Solver *precond_data_ptr );
@@ -1640,6 +1711,10 @@ HYPRE_Int hypre_PCGSetSkipBreak ( void *pcg_vdata, HYPRE_Int skip_break );
 HYPRE_Int hypre_PCGGetSkipBreak ( void *pcg_vdata, HYPRE_Int *skip_break );
 HYPRE_Int hypre_PCGSetFlex ( void *pcg_vdata, HYPRE_Int flex );
 HYPRE_Int hypre_PCGGetFlex ( void *pcg_vdata, HYPRE_Int *flex );
+HYPRE_Int hypre_PCGSetVariant ( void *pcg_vdata, HYPRE_Int variant );
+HYPRE_Int hypre_PCGGetVariant ( void *pcg_vdata, HYPRE_Int *variant );
+HYPRE_Int hypre_PCGSetSStep ( void *pcg_vdata, HYPRE_Int s_step );
+HYPRE_Int hypre_PCGGetSStep ( void *pcg_vdata, HYPRE_Int *s_step );
 HYPRE_Int hypre_PCGGetPrecond ( void *pcg_vdata, HYPRE_Solver *precond_data_ptr );
 HYPRE_Int hypre_PCGSetPrecond ( void *pcg_vdata, HYPRE_Int (*precond )(void*, void*, void*, void*),
                                 HYPRE_Int (*precond_setup )(void*, void*, void*, void*), void *precond_data );
@@ -1654,6 +1729,11 @@ HYPRE_Int hypre_PCGPrintLogging ( void *pcg_vdata, HYPRE_Int myid );
 HYPRE_Int hypre_PCGGetFinalRelativeResidualNorm ( void *pcg_vdata,
                                                   HYPRE_Real *relative_residual_norm );
 
+/* pcg_ca.c */
+HYPRE_Int hypre_PCGCAVectorsDestroy ( void *pcg_vdata );
+HYPRE_Int hypre_PCGSolvePipelined ( void *pcg_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_PCGSolveSStep ( void *pcg_vdata, void *A, void *b, void *x );
+
 #ifdef __cplusplus
 }
 #endif
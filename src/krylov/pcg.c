@@ -72,6 +72,48 @@ hypre_PCGFunctionsCreate(
    return pcg_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetBlockInnerProd
+ *
+ * Sets the optional (non-blocking) block inner product used by the
+ * pipelined and s-step variants. Without it, they use InnerProd.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetBlockInnerProd(
+   hypre_PCGFunctions *pcg_functions,
+   void *       (*BlockInnerProdStart)  ( HYPRE_Int kx, void **x, HYPRE_Int ky, void **y,
+                                          HYPRE_Real *result ),
+   HYPRE_Int    (*BlockInnerProdFinish) ( void *handle )
+)
+{
+   pcg_functions->BlockInnerProdStart  = BlockInnerProdStart;
+   pcg_functions->BlockInnerProdFinish = BlockInnerProdFinish;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetFusedOps
+ *
+ * Sets the optional fused vector operations used by PCG for the updates of
+ * x, r and p. Without them, PCG uses Axpy, ScaleVector and InnerProd.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetFusedOps(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*Axpy2)         ( HYPRE_Complex alpha, void *x1, void *y1,
+                                   HYPRE_Complex beta, void *x2, void *y2, HYPRE_Real *result )
+)
+{
+   pcg_functions->Axpby = Axpby;
+   pcg_functions->Axpy2 = Axpy2;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGCreate
  *--------------------------------------------------------------------------*/
@@ -100,6 +142,8 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> recompute_residual_p) = 0;
    (pcg_data -> stop_crit)    = 0;
    (pcg_data -> skip_break)   = 0;
+   (pcg_data -> variant)      = 0;
+   (pcg_data -> s_step)       = 3;
    (pcg_data -> converged)    = 0;
    (pcg_data -> hybrid)       = 0;
    (pcg_data -> owns_matvec_data ) = 1;
@@ -114,6 +158,8 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> r)            = NULL;
    (pcg_data -> r_old)        = NULL;
    (pcg_data -> v)            = NULL;
+   (pcg_data -> num_ca_vectors) = 0;
+   (pcg_data -> ca_vectors)   = NULL;
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -174,6 +220,7 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> v);
          pcg_data -> v = NULL;
       }
+      hypre_PCGCAVectorsDestroy(pcg_data);
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -244,6 +291,9 @@ hypre_PCGSetup( void *pcg_vdata,
    }
    (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
 
+   /* The pipelined/s-step work vectors are recreated from x on first use */
+   hypre_PCGCAVectorsDestroy(pcg_data);
+
    if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
    {
       (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
@@ -373,12 +423,24 @@ hypre_PCGSolve( void *pcg_vdata,
    HYPRE_Real      ratio;
 
    HYPRE_Real      guard_zero_residual, sdotp;
+   HYPRE_Real      ri_prod = 0.0;
+   HYPRE_Int       ri_prod_set = 0;
    HYPRE_Int       tentatively_converged = 0;
    HYPRE_Int       recompute_true_residual = 0;
 
    HYPRE_Int       i = 0;
    HYPRE_Int       my_id, num_procs;
 
+   /* communication-avoiding variants (see pcg_ca.c) */
+   if ((pcg_data -> variant) == 1)
+   {
+      return hypre_PCGSolvePipelined(pcg_vdata, A, b, x);
+   }
+   else if ((pcg_data -> variant) == 2)
+   {
+      return hypre_PCGSolveSStep(pcg_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (pcg_data -> converged) = 0;
@@ -630,21 +692,28 @@ hypre_PCGSolve( void *pcg_vdata,
 
       gamma_old = gamma;
 
-      /* x = x + alpha*p */
-      (*(pcg_functions->Axpy))(alpha, p, x);
-
-      if (flex) 
+      if (flex)
       {
-	 (*(pcg_functions->CopyVector))(r, r_old); /*save old residual */
+         (*(pcg_functions->CopyVector))(r, r_old); /*save old residual */
       }
 
-      /* r = r - alpha*s */
-      if ( !recompute_true_residual )
+      /* x = x + alpha*p and r = r - alpha*s */
+      ri_prod_set = 0;
+      if ( !recompute_true_residual && pcg_functions->Axpy2 )
+      {
+         /* in one pass, with <r,r> for the convergence test if needed */
+         (*(pcg_functions->Axpy2))(alpha, p, x, -alpha, s, r, two_norm ? &ri_prod : NULL);
+         ri_prod_set = two_norm;
+      }
+      else if ( !recompute_true_residual )
       {
+         (*(pcg_functions->Axpy))(alpha, p, x);
          (*(pcg_functions->Axpy))(-alpha, s, r);
       }
       else
       {
+         (*(pcg_functions->Axpy))(alpha, p, x);
+
          if (print_level > 1 && my_id == 0)
          {
             hypre_printf("Recomputing the residual...\n");
@@ -744,7 +813,7 @@ hypre_PCGSolve( void *pcg_vdata,
       /* set i_prod for convergence test */
       if (two_norm)
       {
-         i_prod = (*(pcg_functions->InnerProd))(r, r);
+         i_prod = ri_prod_set ? ri_prod : (*(pcg_functions->InnerProd))(r, r);
       }
       else
       {
@@ -965,7 +1034,11 @@ hypre_PCGSolve( void *pcg_vdata,
       } 
 
       /* p = s + beta p */
-      if ( !recompute_true_residual )
+      if ( !recompute_true_residual && pcg_functions->Axpby )
+      {
+         (*(pcg_functions->Axpby))(1.0, s, beta, p);
+      }
+      else if ( !recompute_true_residual )
       {
          (*(pcg_functions->ScaleVector))(beta, p);
          (*(pcg_functions->Axpy))(1.0, s, p);
@@ -1357,6 +1430,70 @@ hypre_PCGGetFlex( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetVariant, hypre_PCGGetVariant
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetVariant( void      *pcg_vdata,
+                     HYPRE_Int  variant )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   if (variant < 0 || variant > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   (pcg_data -> variant) = variant;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetVariant( void      *pcg_vdata,
+                     HYPRE_Int *variant )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *variant = (pcg_data -> variant);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetSStep, hypre_PCGGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetSStep( void      *pcg_vdata,
+                   HYPRE_Int  s_step )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   if (s_step < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   (pcg_data -> s_step) = s_step;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetSStep( void      *pcg_vdata,
+                   HYPRE_Int *s_step )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *s_step = (pcg_data -> s_step);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGGetPrecond
  *--------------------------------------------------------------------------*/
@@ -0,0 +1,754 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Communication-avoiding variants of preconditioned conjugate gradient:
+ *
+ *  - pipelined PCG (Ghysels and Vanroose, Parallel Computing 40, 2014): a
+ *    single global reduction per iteration, overlapped with the application
+ *    of the preconditioner and of the matrix;
+ *
+ *  - s-step PCG (Chronopoulos and Gear, J. Comput. Appl. Math. 25, 1989): s
+ *    iterations with a single global reduction, using the basis
+ *    (C*A - theta)^j C*r, j = 0, ..., s-1, shifted by a Rayleigh quotient of
+ *    C*A from the previous block. Only small values of s are numerically
+ *    safe.
+ *
+ * The reductions go through the optional BlockInnerProdStart/Finish
+ * callbacks of hypre_PCGFunctions when present, and through InnerProd
+ * otherwise. Both variants support the same stopping criteria as
+ * hypre_PCGSolve for the tolerances (tol, a_tol, atolf, stop_crit) and the
+ * norm (two_norm), but ignore rel_change, recompute_residual(_p), rtol,
+ * cf_tol and flex.
+ *
+ *****************************************************************************/
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGCABlockInnerProdStart
+ *
+ * result[i*ky + j] = <x[i], y[j]>. Returns the handle to be passed to
+ * hypre_PCGCABlockInnerProdFinish before result is read.
+ *--------------------------------------------------------------------------*/
+
+static void *
+hypre_PCGCABlockInnerProdStart( hypre_PCGFunctions *pcg_functions,
+                                HYPRE_Int           kx,
+                                void              **x,
+                                HYPRE_Int           ky,
+                                void              **y,
+                                HYPRE_Real         *result )
+{
+   HYPRE_Int i, j;
+
+   if (pcg_functions -> BlockInnerProdStart)
+   {
+      return (*(pcg_functions -> BlockInnerProdStart))(kx, x, ky, y, result);
+   }
+
+   for (i = 0; i < kx; i++)
+   {
+      for (j = 0; j < ky; j++)
+      {
+         result[i * ky + j] = (*(pcg_functions -> InnerProd))(x[i], y[j]);
+      }
+   }
+
+   return NULL;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGCABlockInnerProdFinish
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGCABlockInnerProdFinish( hypre_PCGFunctions *pcg_functions,
+                                 void               *handle )
+{
+   if (pcg_functions -> BlockInnerProdFinish)
+   {
+      (*(pcg_functions -> BlockInnerProdFinish))(handle);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGCAVectors
+ *
+ * Returns the num work vectors used by the variant, (re)creating them if
+ * needed.
+ *--------------------------------------------------------------------------*/
+
+static void **
+hypre_PCGCAVectors( hypre_PCGData *pcg_data,
+                    HYPRE_Int      num,
+                    void          *x )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data -> functions;
+   HYPRE_Int           i;
+
+   if ((pcg_data -> num_ca_vectors) != num)
+   {
+      hypre_PCGCAVectorsDestroy(pcg_data);
+
+      (pcg_data -> ca_vectors) = hypre_CTAllocF(void *, num, pcg_functions, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num; i++)
+      {
+         (pcg_data -> ca_vectors)[i] = (*(pcg_functions -> CreateVector))(x);
+      }
+      (pcg_data -> num_ca_vectors) = num;
+   }
+
+   return (pcg_data -> ca_vectors);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGCAVectorsDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGCAVectorsDestroy( void *pcg_vdata )
+{
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *) pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data -> functions;
+   HYPRE_Int           i;
+
+   if (pcg_data -> ca_vectors)
+   {
+      for (i = 0; i < (pcg_data -> num_ca_vectors); i++)
+      {
+         (*(pcg_functions -> DestroyVector))((pcg_data -> ca_vectors)[i]);
+      }
+      hypre_TFreeF(pcg_data -> ca_vectors, pcg_functions);
+   }
+   (pcg_data -> ca_vectors)     = NULL;
+   (pcg_data -> num_ca_vectors) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGCAStoppingTolerance
+ *
+ * Computes bi_prod and eps as in hypre_PCGSolve. Returns 1 if b is zero, in
+ * which case x is set to zero.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGCAStoppingTolerance( hypre_PCGData *pcg_data,
+                              void          *A,
+                              void          *b,
+                              void          *x,
+                              HYPRE_Real    *bi_prod_ptr,
+                              HYPRE_Real    *eps_ptr )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data -> functions;
+   HYPRE_Real          r_tol         = (pcg_data -> tol);
+   HYPRE_Real          a_tol         = (pcg_data -> a_tol);
+   HYPRE_Real          atolf         = (pcg_data -> atolf);
+   HYPRE_Int           stop_crit     = (pcg_data -> stop_crit);
+   HYPRE_Real          bi_prod, eps;
+
+   if (pcg_data -> two_norm)
+   {
+      bi_prod = (*(pcg_functions -> InnerProd))(b, b);
+   }
+   else
+   {
+      (*(pcg_functions -> ClearVector))(pcg_data -> p);
+      (*(pcg_functions -> precond))(pcg_data -> precond_data, A, b, pcg_data -> p);
+      bi_prod = (*(pcg_functions -> InnerProd))(pcg_data -> p, b);
+   }
+
+   if (bi_prod != bi_prod)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "INFs and/or NaNs detected in input in PCG");
+      return 1;
+   }
+
+   eps = r_tol * r_tol;
+   if (bi_prod > 0.0)
+   {
+      if (stop_crit && atolf <= 0)
+      {
+         eps = eps / bi_prod;
+      }
+      else if (atolf > 0)
+      {
+         bi_prod += atolf;
+      }
+      else
+      {
+         eps = hypre_max(r_tol * r_tol, a_tol * a_tol / bi_prod);
+      }
+   }
+   else
+   {
+      (*(pcg_functions -> CopyVector))(b, x);
+      if ((pcg_data -> logging) > 0 || (pcg_data -> print_level) > 0)
+      {
+         (pcg_data -> norms)[0]     = 0.0;
+         (pcg_data -> rel_norms)[0] = 0.0;
+      }
+      (pcg_data -> num_iterations)    = 0;
+      (pcg_data -> rel_residual_norm) = 0.0;
+      (pcg_data -> converged)         = 1;
+
+      return 1;
+   }
+
+   *bi_prod_ptr = bi_prod;
+   *eps_ptr     = eps;
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGCALogNorm
+ *
+ * Logs and prints the norm of the residual after i iterations.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGCALogNorm( hypre_PCGData *pcg_data,
+                    HYPRE_Int      my_id,
+                    HYPRE_Int      i,
+                    HYPRE_Real     i_prod,
+                    HYPRE_Real     bi_prod )
+{
+   HYPRE_Real *norms     = (pcg_data -> norms);
+   HYPRE_Real *rel_norms = (pcg_data -> rel_norms);
+
+   if ((pcg_data -> logging) > 0 || (pcg_data -> print_level) > 0)
+   {
+      norms[i]     = hypre_sqrt(i_prod);
+      rel_norms[i] = bi_prod ? hypre_sqrt(i_prod / bi_prod) : 0;
+   }
+
+   if ((pcg_data -> print_level) > 1 && my_id == 0)
+   {
+      if (i == 0)
+      {
+         hypre_printf("\n\n");
+         if (pcg_data -> two_norm)
+         {
+            hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+            hypre_printf("-----    ------------   ---------  ------------ \n");
+         }
+         else
+         {
+            hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+            hypre_printf("-----    ------------    ---------  ------------ \n");
+         }
+      }
+      else
+      {
+         hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                      norms[i] / norms[i - 1], rel_norms[i]);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolvePipelined
+ *
+ * Preconditioned pipelined CG (Algorithm 4 of Ghysels and Vanroose). The
+ * reduction for gamma = <r,u>, delta = <w,u> (and <r,r>) is overlapped with
+ * m = C*w and n = A*m. Here u = C*r and w = A*u are updated by recurrences.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSolvePipelined( void *pcg_vdata,
+                         void *A,
+                         void *b,
+                         void *x )
+{
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *) pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data -> functions;
+
+   HYPRE_Int           max_iter      = (pcg_data -> max_iter);
+   HYPRE_Int           two_norm      = (pcg_data -> two_norm);
+   HYPRE_Int           skip_break    = (pcg_data -> skip_break);
+   HYPRE_Int           print_level   = (pcg_data -> print_level);
+   void               *p             = (pcg_data -> p);
+   void               *s             = (pcg_data -> s);
+   void               *r             = (pcg_data -> r);
+   void               *matvec_data   = (pcg_data -> matvec_data);
+   void               *precond_data  = (pcg_data -> precond_data);
+   HYPRE_Int         (*precond)(void*, void*, void*, void*) = (pcg_functions -> precond);
+
+   void              **vecs;
+   void               *u, *w, *m, *n, *z, *q;
+   void               *xs[2], *ys[2];
+   void               *handle;
+   HYPRE_Real          prods[4];
+   HYPRE_Real          alpha = 0.0, alpha_old = 0.0, beta, denom;
+   HYPRE_Real          gamma, gamma_old = 0.0, delta;
+   HYPRE_Real          bi_prod, eps, i_prod = 0.0;
+   HYPRE_Int           i, my_id, num_procs;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (pcg_data -> converged) = 0;
+   (*(pcg_functions -> CommInfo))(A, &my_id, &num_procs);
+
+   if (hypre_PCGCAStoppingTolerance(pcg_data, A, b, x, &bi_prod, &eps))
+   {
+      HYPRE_ANNOTATE_FUNC_END;
+      return hypre_error_flag;
+   }
+
+   vecs = hypre_PCGCAVectors(pcg_data, 6, x);
+   u = vecs[0]; w = vecs[1]; m = vecs[2];
+   n = vecs[3]; z = vecs[4]; q = vecs[5];
+
+   /* r = b - A*x, u = C*r, w = A*u */
+   (*(pcg_functions -> CopyVector))(b, r);
+   (*(pcg_functions -> Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   (*(pcg_functions -> ClearVector))(u);
+   precond(precond_data, A, r, u);
+   (*(pcg_functions -> Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+
+   /* prods = [<u,r>, <u,w>, <r,r>, <r,w>] */
+   xs[0] = u; xs[1] = r;
+   ys[0] = r; ys[1] = w;
+
+   for (i = 0; i <= max_iter; i++)
+   {
+      handle = hypre_PCGCABlockInnerProdStart(pcg_functions, 2, xs, 2, ys, prods);
+
+      /* m = C*w, n = A*m */
+      (*(pcg_functions -> ClearVector))(m);
+      precond(precond_data, A, w, m);
+      (*(pcg_functions -> Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+
+      hypre_PCGCABlockInnerProdFinish(pcg_functions, handle);
+
+      gamma  = prods[0];
+      delta  = prods[1];
+      i_prod = two_norm ? prods[2] : gamma;
+
+      if (i_prod != i_prod)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "INFs and/or NaNs detected in PCG");
+         break;
+      }
+
+      hypre_PCGCALogNorm(pcg_data, my_id, i, i_prod, bi_prod);
+
+      if (i_prod / bi_prod < eps)
+      {
+         (pcg_data -> converged) = 1;
+         break;
+      }
+      if (i == max_iter)
+      {
+         break;
+      }
+
+      if (gamma <= 0.0 && skip_break < 3)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Negative or zero gamma value in PCG");
+         break;
+      }
+
+      if (i > 0)
+      {
+         beta  = gamma / gamma_old;
+         denom = delta - beta * gamma / alpha_old;
+      }
+      else
+      {
+         beta  = 0.0;
+         denom = delta;
+      }
+
+      if (denom == 0.0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Zero <p,Ap> value in pipelined PCG");
+         break;
+      }
+      alpha = gamma / denom;
+      if (alpha <= 0.0 && skip_break < 3)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Negative or zero alpha value in PCG");
+         break;
+      }
+
+      /* z = n + beta*z, q = m + beta*q, s = w + beta*s, p = u + beta*p */
+      if (i > 0)
+      {
+         (*(pcg_functions -> ScaleVector))(beta, z);
+         (*(pcg_functions -> Axpy))(1.0, n, z);
+         (*(pcg_functions -> ScaleVector))(beta, q);
+         (*(pcg_functions -> Axpy))(1.0, m, q);
+         (*(pcg_functions -> ScaleVector))(beta, s);
+         (*(pcg_functions -> Axpy))(1.0, w, s);
+         (*(pcg_functions -> ScaleVector))(beta, p);
+         (*(pcg_functions -> Axpy))(1.0, u, p);
+      }
+      else
+      {
+         (*(pcg_functions -> CopyVector))(n, z);
+         (*(pcg_functions -> CopyVector))(m, q);
+         (*(pcg_functions -> CopyVector))(w, s);
+         (*(pcg_functions -> CopyVector))(u, p);
+      }
+
+      /* x += alpha*p, r -= alpha*s, u -= alpha*q, w -= alpha*z */
+      (*(pcg_functions -> Axpy))( alpha, p, x);
+      (*(pcg_functions -> Axpy))(-alpha, s, r);
+      (*(pcg_functions -> Axpy))(-alpha, q, u);
+      (*(pcg_functions -> Axpy))(-alpha, z, w);
+
+      gamma_old = gamma;
+      alpha_old = alpha;
+   }
+
+   if (print_level > 1 && my_id == 0)
+   {
+      hypre_printf("\n\n");
+   }
+
+   if (!(pcg_data -> converged) && i >= max_iter && eps > 0 && (pcg_data -> hybrid) != -1)
+   {
+      char msg[1024];
+      hypre_sprintf(msg, "Reached max iterations %d in PCG before convergence", max_iter);
+      hypre_error_w_msg(HYPRE_ERROR_CONV, msg);
+   }
+
+   (pcg_data -> num_iterations)    = hypre_min(i, max_iter);
+   (pcg_data -> rel_residual_norm) = hypre_sqrt(i_prod / bi_prod);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGCADenseSolve
+ *
+ * Solves M X = B for the n x n matrix M and the n x nrhs matrix B (both row
+ * major, overwritten) by Gaussian elimination with partial pivoting. Returns
+ * 1 if M is numerically singular.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGCADenseSolve( HYPRE_Int   n,
+                       HYPRE_Real *M,
+                       HYPRE_Int   nrhs,
+                       HYPRE_Real *B )
+{
+   HYPRE_Int  i, j, k, piv;
+   HYPRE_Real tmp, scale = 0.0;
+
+   for (i = 0; i < n * n; i++)
+   {
+      scale = hypre_max(scale, hypre_abs(M[i]));
+   }
+
+   for (k = 0; k < n; k++)
+   {
+      piv = k;
+      for (i = k + 1; i < n; i++)
+      {
+         if (hypre_abs(M[i * n + k]) > hypre_abs(M[piv * n + k]))
+         {
+            piv = i;
+         }
+      }
+      if (!(hypre_abs(M[piv * n + k]) > scale * HYPRE_REAL_EPSILON))
+      {
+         return 1;
+      }
+      if (piv != k)
+      {
+         for (j = 0; j < n; j++)
+         {
+            tmp = M[k * n + j]; M[k * n + j] = M[piv * n + j]; M[piv * n + j] = tmp;
+         }
+         for (j = 0; j < nrhs; j++)
+         {
+            tmp = B[k * nrhs + j]; B[k * nrhs + j] = B[piv * nrhs + j]; B[piv * nrhs + j] = tmp;
+         }
+      }
+      for (i = k + 1; i < n; i++)
+      {
+         tmp = M[i * n + k] / M[k * n + k];
+         for (j = k; j < n; j++)
+         {
+            M[i * n + j] -= tmp * M[k * n + j];
+         }
+         for (j = 0; j < nrhs; j++)
+         {
+            B[i * nrhs + j] -= tmp * B[k * nrhs + j];
+         }
+      }
+   }
+
+   for (k = n - 1; k >= 0; k--)
+   {
+      for (j = 0; j < nrhs; j++)
+      {
+         tmp = B[k * nrhs + j];
+         for (i = k + 1; i < n; i++)
+         {
+            tmp -= M[k * n + i] * B[i * nrhs + j];
+         }
+         B[k * nrhs + j] = tmp / M[k * n + k];
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolveSStep
+ *
+ * Each outer iteration builds V = [C*r, (C*A - theta) C*r, ...,
+ * (C*A - theta)^(s-1) C*r] and AV, and computes G = V^T A V, Q = (A P_old)^T V, g = V^T r with one
+ * reduction. The new directions P = V + P_old B, with B = -W_old^{-1} Q,
+ * are A-conjugate to P_old, W = P^T A P = G + Q^T B, and the step is
+ * x += P a, r -= A P a with W a = g.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSolveSStep( void *pcg_vdata,
+                     void *A,
+                     void *b,
+                     void *x )
+{
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *) pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data -> functions;
+
+   HYPRE_Int           max_iter      = (pcg_data -> max_iter);
+   HYPRE_Int           two_norm      = (pcg_data -> two_norm);
+   HYPRE_Int           print_level   = (pcg_data -> print_level);
+   HYPRE_Int           s             = hypre_max(pcg_data -> s_step, 1);
+   void               *r             = (pcg_data -> r);
+   void               *matvec_data   = (pcg_data -> matvec_data);
+   void               *precond_data  = (pcg_data -> precond_data);
+   HYPRE_Int         (*precond)(void*, void*, void*, void*) = (pcg_functions -> precond);
+
+   void              **vecs, **V, **AV, **P, **AP, **tmp, **ys;
+   void               *handle, *handle_rr = NULL;
+   HYPRE_Real         *prods, *W, *W_old, *B, *a, *Q;
+   HYPRE_Real          rr = 0.0, bi_prod, eps, i_prod = 0.0, theta = 0.0;
+   HYPRE_Int           ky, i, j, l, k, it, s_cur, s_old, my_id, num_procs;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (pcg_data -> converged) = 0;
+   (*(pcg_functions -> CommInfo))(A, &my_id, &num_procs);
+
+   if (hypre_PCGCAStoppingTolerance(pcg_data, A, b, x, &bi_prod, &eps))
+   {
+      HYPRE_ANNOTATE_FUNC_END;
+      return hypre_error_flag;
+   }
+
+   vecs  = hypre_PCGCAVectors(pcg_data, 4 * s, x);
+   V     = vecs;
+   AV    = vecs + s;
+   P     = vecs + 2 * s;
+   AP    = vecs + 3 * s;
+   ys    = hypre_CTAllocF(void *, 2 * s + 1, pcg_functions, HYPRE_MEMORY_HOST);
+   prods = hypre_CTAllocF(HYPRE_Real, s * (2 * s + 1), pcg_functions, HYPRE_MEMORY_HOST);
+   W     = hypre_CTAllocF(HYPRE_Real, s * s, pcg_functions, HYPRE_MEMORY_HOST);
+   W_old = hypre_CTAllocF(HYPRE_Real, s * s, pcg_functions, HYPRE_MEMORY_HOST);
+   Q     = hypre_CTAllocF(HYPRE_Real, s * s, pcg_functions, HYPRE_MEMORY_HOST);
+   B     = hypre_CTAllocF(HYPRE_Real, s * s, pcg_functions, HYPRE_MEMORY_HOST);
+   a     = hypre_CTAllocF(HYPRE_Real, s, pcg_functions, HYPRE_MEMORY_HOST);
+
+   /* r = b - A*x */
+   (*(pcg_functions -> CopyVector))(b, r);
+   (*(pcg_functions -> Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+
+   it    = 0;
+   s_old = 0;
+   while (1)
+   {
+      /* the last block is shortened to end at max_iter */
+      s_cur = hypre_max(hypre_min(s, max_iter - it), 1);
+
+      /* V_0 = C*r, V_j = (C*A - theta)*V_{j-1}, AV_j = A*V_j */
+      for (j = 0; j < s_cur; j++)
+      {
+         (*(pcg_functions -> ClearVector))(V[j]);
+         precond(precond_data, A, j ? AV[j - 1] : r, V[j]);
+         if (j && theta != 0.0)
+         {
+            (*(pcg_functions -> Axpy))(-theta, V[j - 1], V[j]);
+         }
+         (*(pcg_functions -> Matvec))(matvec_data, 1.0, A, V[j], 0.0, AV[j]);
+      }
+
+      /* prods = V^T [AV, AP_old, r] */
+      ky = 0;
+      for (j = 0; j < s_cur; j++)
+      {
+         ys[ky++] = AV[j];
+      }
+      for (j = 0; j < s_old; j++)
+      {
+         ys[ky++] = AP[j];
+      }
+      ys[ky++] = r;
+
+      handle = hypre_PCGCABlockInnerProdStart(pcg_functions, s_cur, V, ky, ys, prods);
+      if (two_norm)
+      {
+         handle_rr = hypre_PCGCABlockInnerProdStart(pcg_functions, 1, &r, 1, &r, &rr);
+      }
+      hypre_PCGCABlockInnerProdFinish(pcg_functions, handle);
+      if (two_norm)
+      {
+         hypre_PCGCABlockInnerProdFinish(pcg_functions, handle_rr);
+      }
+
+      /* g_0 = <C*r, r> */
+      i_prod = two_norm ? rr : prods[ky - 1];
+      if (i_prod != i_prod)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "INFs and/or NaNs detected in PCG");
+         break;
+      }
+
+      hypre_PCGCALogNorm(pcg_data, my_id, it, i_prod, bi_prod);
+
+      if (i_prod / bi_prod < eps)
+      {
+         (pcg_data -> converged) = 1;
+         break;
+      }
+      if (it >= max_iter)
+      {
+         break;
+      }
+
+      /* Rayleigh quotient <C*r, A*C*r> / <C*r, r> of C*A, used as the shift of
+         the basis of the next block */
+      theta = prods[0] / prods[ky - 1];
+
+      /* W = G, a = g */
+      for (i = 0; i < s_cur; i++)
+      {
+         for (j = 0; j < s_cur; j++)
+         {
+            W[i * s_cur + j] = prods[i * ky + j];
+         }
+         a[i] = prods[i * ky + ky - 1];
+      }
+
+      if (s_old)
+      {
+         /* B = -W_old^{-1} Q with Q_lj = <AP_old_l, V_j> */
+         for (l = 0; l < s_old; l++)
+         {
+            for (j = 0; j < s_cur; j++)
+            {
+               Q[l * s_cur + j] = prods[j * ky + s_cur + l];
+               B[l * s_cur + j] = -Q[l * s_cur + j];
+            }
+         }
+         if (hypre_PCGCADenseSolve(s_old, W_old, s_cur, B))
+         {
+            hypre_error_w_msg(HYPRE_ERROR_CONV, "Singular P^T A P in s-step PCG");
+            break;
+         }
+
+         /* W += Q^T B */
+         for (i = 0; i < s_cur; i++)
+         {
+            for (j = 0; j < s_cur; j++)
+            {
+               for (l = 0; l < s_old; l++)
+               {
+                  W[i * s_cur + j] += Q[l * s_cur + i] * B[l * s_cur + j];
+               }
+            }
+         }
+
+         /* V_j += sum_l P_old_l B_lj, AV_j += sum_l AP_old_l B_lj */
+         for (j = 0; j < s_cur; j++)
+         {
+            for (l = 0; l < s_old; l++)
+            {
+               (*(pcg_functions -> Axpy))(B[l * s_cur + j], P[l], V[j]);
+               (*(pcg_functions -> Axpy))(B[l * s_cur + j], AP[l], AV[j]);
+            }
+         }
+      }
+
+      /* the new directions */
+      tmp = P;  P  = V;  V  = tmp;
+      tmp = AP; AP = AV; AV = tmp;
+
+      /* W a = g, keeping W for the next block */
+      for (i = 0; i < s_cur * s_cur; i++)
+      {
+         W_old[i] = W[i];
+      }
+      if (hypre_PCGCADenseSolve(s_cur, W, 1, a))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Singular P^T A P in s-step PCG");
+         break;
+      }
+
+      /* x += P a, r -= AP a */
+      for (j = 0; j < s_cur; j++)
+      {
+         (*(pcg_functions -> Axpy))( a[j],  P[j], x);
+         (*(pcg_functions -> Axpy))(-a[j], AP[j], r);
+      }
+
+      for (k = 1; k < s_cur; k++)
+      {
+         /* the intermediate iterates are not formed */
+         if ((pcg_data -> logging) > 0 || print_level > 0)
+         {
+            (pcg_data -> norms)[it + k]     = (pcg_data -> norms)[it];
+            (pcg_data -> rel_norms)[it + k] = (pcg_data -> rel_norms)[it];
+         }
+      }
+      it   += s_cur;
+      s_old = s_cur;
+   }
+
+   if (print_level > 1 && my_id == 0)
+   {
+      hypre_printf("\n\n");
+   }
+
+   if (!(pcg_data -> converged) && it >= max_iter && eps > 0 && (pcg_data -> hybrid) != -1)
+   {
+      char msg[1024];
+      hypre_sprintf(msg, "Reached max iterations %d in PCG before convergence", max_iter);
+      hypre_error_w_msg(HYPRE_ERROR_CONV, msg);
+   }
+
+   (pcg_data -> num_iterations)    = it;
+   (pcg_data -> rel_residual_norm) = hypre_sqrt(i_prod / bi_prod);
+
+   hypre_TFreeF(ys, pcg_functions);
+   hypre_TFreeF(prods, pcg_functions);
+   hypre_TFreeF(W, pcg_functions);
+   hypre_TFreeF(W_old, pcg_functions);
+   hypre_TFreeF(Q, pcg_functions);
+   hypre_TFreeF(B, pcg_functions);
+   hypre_TFreeF(a, pcg_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,140 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BatchPCGCreate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BatchPCGCreate( HYPRE_Solver *solver )
+{
+   if (!solver)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   *solver = (HYPRE_Solver) hypre_BatchPCGCreate( );
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BatchPCGDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BatchPCGDestroy( HYPRE_Solver solver )
+{
+   return ( hypre_BatchPCGDestroy( (void *) solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BatchPCGSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BatchPCGSetup( HYPRE_Solver   solver,
+                     HYPRE_Int      num_systems,
+                     HYPRE_Int      num_rows,
+                     HYPRE_Int     *ia,
+                     HYPRE_Int     *ja,
+                     HYPRE_Complex *values )
+{
+   return ( hypre_BatchPCGSetup( (void *) solver, num_systems, num_rows,
+                                 ia, ja, values ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BatchPCGSetValues
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BatchPCGSetValues( HYPRE_Solver   solver,
+                         HYPRE_Complex *values )
+{
+   return ( hypre_BatchPCGSetValues( (void *) solver, values ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BatchPCGSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BatchPCGSolve( HYPRE_Solver   solver,
+                     HYPRE_Complex *b,
+                     HYPRE_Complex *x )
+{
+   return ( hypre_BatchPCGSolve( (void *) solver, b, x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BatchPCGSetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BatchPCGSetTol( HYPRE_Solver solver,
+                      HYPRE_Real   tol )
+{
+   return ( hypre_BatchPCGSetTol( (void *) solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BatchPCGSetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BatchPCGSetMaxIter( HYPRE_Solver solver,
+                          HYPRE_Int    max_iter )
+{
+   return ( hypre_BatchPCGSetMaxIter( (void *) solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BatchPCGSetPrecondType
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BatchPCGSetPrecondType( HYPRE_Solver solver,
+                              HYPRE_Int    precond_type )
+{
+   return ( hypre_BatchPCGSetPrecondType( (void *) solver, precond_type ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BatchPCGGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BatchPCGGetNumIterations( HYPRE_Solver  solver,
+                                HYPRE_Int    *num_iterations )
+{
+   return ( hypre_BatchPCGGetNumIterations( (void *) solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BatchPCGGetSystemNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BatchPCGGetSystemNumIterations( HYPRE_Solver  solver,
+                                      HYPRE_Int    *num_iterations )
+{
+   return ( hypre_BatchPCGGetSystemNumIterations( (void *) solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BatchPCGGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BatchPCGGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
+                                            HYPRE_Real   *norm )
+{
+   return ( hypre_BatchPCGGetFinalRelativeResidualNorm( (void *) solver, norm ) );
+}
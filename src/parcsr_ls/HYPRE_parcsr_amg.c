@@ -2100,6 +2100,72 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMixedPrecision
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMixedPrecision (HYPRE_Solver solver,
+                                  HYPRE_Int    mixed_precision)
+{
+   return (hypre_BoomerAMGSetMixedPrecision ( (void *) solver, mixed_precision ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetNumericResetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetNumericResetup (HYPRE_Solver solver,
+                                  HYPRE_Int    numeric_resetup)
+{
+   return (hypre_BoomerAMGSetNumericResetup ( (void *) solver, numeric_resetup ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetRelaxOverlap
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetRelaxOverlap (HYPRE_Solver solver,
+                                HYPRE_Int    relax_overlap)
+{
+   return (hypre_BoomerAMGSetRelaxOverlap ( (void *) solver, relax_overlap ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFusedTransfer
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFusedTransfer (HYPRE_Solver solver,
+                                 HYPRE_Int    fused_transfer)
+{
+   return (hypre_BoomerAMGSetFusedTransfer ( (void *) solver, fused_transfer ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetProfile
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetProfile (HYPRE_Solver solver,
+                           HYPRE_Int    profile)
+{
+   return (hypre_BoomerAMGSetProfile ( (void *) solver, profile ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGPrintProfile
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGPrintProfile (HYPRE_Solver  solver,
+                             const char   *filename)
+{
+   return (hypre_BoomerAMGPrintProfile ( (void *) solver, filename ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
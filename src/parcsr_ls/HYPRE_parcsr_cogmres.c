@@ -34,6 +34,9 @@ HYPRE_ParCSRCOGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy, hypre_ParKrylovMassAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_COGMRESFunctionsSetBlockInnerProd( cogmres_functions,
+                                            hypre_ParKrylovBlockInnerProdStart,
+                                            hypre_ParKrylovBlockInnerProdFinish );
    *solver = ( (HYPRE_Solver) hypre_COGMRESCreate( cogmres_functions ) );
 
    return hypre_error_flag;
@@ -114,6 +117,17 @@ HYPRE_ParCSRCOGMRESSetCGS( HYPRE_Solver solver,
    return ( HYPRE_COGMRESSetCGS( solver, cgs ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCOGMRESSetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCOGMRESSetPipelined( HYPRE_Solver solver,
+                                 HYPRE_Int             pipelined )
+{
+   return ( HYPRE_COGMRESSetPipelined( solver, pipelined ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRCOGMRESSetTol
  *--------------------------------------------------------------------------*/
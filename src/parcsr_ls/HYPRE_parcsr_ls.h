@@ -1341,6 +1341,83 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                           HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) If mixed_precision > 0, the operators A of levels
+ * mixed_precision and coarser, and the interpolation and restriction
+ * operators to these levels, are stored in single precision after setup.
+ * Vectors, smoother updates and the outer Krylov method stay in double
+ * precision. The double precision values are released wherever the level's
+ * smoother only needs matvecs (relax types 0, 7 and 18), which roughly halves
+ * the memory of the hierarchy. Host only; the default is 0 (off).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision(HYPRE_Solver solver,
+                                           HYPRE_Int    mixed_precision);
+
+/**
+ * (Optional) If numeric_resetup is not 0, subsequent calls to
+ * HYPRE_BoomerAMGSetup reuse the CF splittings and the sparsity patterns of
+ * the interpolation operators of the previous setup. Only the interpolation
+ * weights (on the stored patterns), the coarse-grid operators and the
+ * smoother data are recomputed. Intended for sequences of matrices that share
+ * the same row partitioning and (approximately) the same sparsity pattern,
+ * e.g., in time stepping. A full setup is done on the first call, or if the
+ * hierarchy cannot be reused (different row partitioning, block or additive
+ * cycles, non-Galerkin coarse grids, interpolation vectors, aggressive
+ * coarsening, nodal coarsening, GSMG, interpolation refinement, block
+ * interpolations, approximate ideal restriction, or matrices on the
+ * device). On the host, the structure of the Galerkin products is cached
+ * after the first resetup, so that later resetups with an unchanged sparsity
+ * pattern only recompute the values of the coarse-grid operators; this keeps
+ * one intermediate product per level in memory. These values are summed in
+ * another order than in a full setup, so they agree with it only up to
+ * rounding errors. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetNumericResetup(HYPRE_Solver solver,
+                                           HYPRE_Int    numeric_resetup);
+
+/**
+ * (Optional) If relax_overlap is not 0, the hybrid Gauss-Seidel smoothers
+ * (relax types 3, 4, 6, 13, 14, 88, 89) relax the rows without off-processor
+ * couplings while the halo exchange is in progress, and the remaining rows
+ * after it has completed. This changes the order in which the local rows are
+ * relaxed. Only used on the host with a single thread. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetRelaxOverlap(HYPRE_Solver solver,
+                                         HYPRE_Int    relax_overlap);
+
+/**
+ * (Optional) If fused_transfer is not 0, the cycle computes the residual and
+ * restricts it with a single pass over the rows of the fine-grid matrix, and
+ * interpolates and adds the correction with a single pass over the rows of
+ * P. Only used on the host with double precision operators and single
+ * vectors; the restriction is fused only if R = P^T (restriction type 0).
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFusedTransfer(HYPRE_Solver solver,
+                                          HYPRE_Int    fused_transfer);
+
+/**
+ * (Optional) If profile is not 0, BoomerAMG records, for each level, the
+ * wall time, the number of calls, and the messages sent through the ParCSR
+ * communication packages (count and bytes) of the setup phases (coarsening, interpolation, RAP,
+ * smoother and coarse solver setup) and of the cycle phases (relaxation,
+ * residual, restriction, interpolation, coarse solve). For the cycle phases,
+ * it also records the flops and the memory traffic modeled from the number
+ * of nonzeros of the operators. Calling it again with a nonzero value clears
+ * the recorded data. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetProfile(HYPRE_Solver solver,
+                                    HYPRE_Int    profile);
+
+/**
+ * Writes the profile recorded since HYPRE_BoomerAMGSetProfile to filename,
+ * with the min, max and average over the ranks of each metric, for each
+ * level and phase. The format is CSV if filename ends with ".csv", and JSON
+ * otherwise. Collective.
+ **/
+HYPRE_Int HYPRE_BoomerAMGPrintProfile(HYPRE_Solver  solver,
+                                      const char   *filename);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -2928,6 +3005,9 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS(HYPRE_Solver solver,
                                     HYPRE_Int    cgs);
 
+HYPRE_Int HYPRE_ParCSRCOGMRESSetPipelined(HYPRE_Solver solver,
+                                          HYPRE_Int    pipelined);
+
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol(HYPRE_Solver solver,
                                     HYPRE_Real   tol);
 
@@ -4505,6 +4585,9 @@ HYPRE_ILUSetMaxIter( HYPRE_Solver solver, HYPRE_Int max_iter );
  *
  *    -  0 : iterative
  *    -  1 : direct (default)
+ *
+ * With OpenMP on the host, direct solves use level schedules of the
+ * factors computed during setup to process independent rows in parallel.
  **/
 HYPRE_Int
 HYPRE_ILUSetTriSolve( HYPRE_Solver solver, HYPRE_Int tri_solve );
@@ -4659,6 +4742,106 @@ HYPRE_ILUGetFinalRelativeResidualNorm(  HYPRE_Solver solver, HYPRE_Real *res_nor
 
 /*@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+/**
+ * @name Batched PCG Solver
+ *
+ * PCG for many small independent systems that share one sparsity pattern,
+ * e.g. one system per material zone.  The systems are stored in one
+ * contiguous block and iterate in lockstep, so every step of the iteration
+ * is a single pass over the whole batch.  Each system has its own step
+ * lengths and stops updating once it has converged.  The systems must be
+ * symmetric positive definite; a system for which the iteration breaks down
+ * (indefinite or singular) is frozen at its current iterate, and the solve
+ * flags HYPRE_ERROR_CONV.  Host memory only; no communication.
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_BatchPCGCreate( HYPRE_Solver *solver );
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int HYPRE_BatchPCGDestroy( HYPRE_Solver solver );
+
+/**
+ * Set up the solver for num_systems systems of num_rows rows with the common
+ * CSR pattern (ia, ja).  Every row must contain its diagonal.  The values
+ * array holds the values of the systems one after the other (num_systems
+ * times ia[num_rows]-ia[0] entries, each ordered as ja).  The data is
+ * copied.
+ **/
+HYPRE_Int HYPRE_BatchPCGSetup( HYPRE_Solver   solver,
+                               HYPRE_Int      num_systems,
+                               HYPRE_Int      num_rows,
+                               HYPRE_Int     *ia,
+                               HYPRE_Int     *ja,
+                               HYPRE_Complex *values );
+
+/**
+ * Replace the values of all systems (same layout as in setup) and update the
+ * preconditioner, reusing the pattern of the last setup.
+ **/
+HYPRE_Int HYPRE_BatchPCGSetValues( HYPRE_Solver   solver,
+                                   HYPRE_Complex *values );
+
+/**
+ * Solve all systems.  The arrays b and x hold the num_rows entries of each
+ * system one after the other; x holds the initial guesses on input.
+ **/
+HYPRE_Int HYPRE_BatchPCGSolve( HYPRE_Solver   solver,
+                               HYPRE_Complex *b,
+                               HYPRE_Complex *x );
+
+/**
+ * (Optional) Set the relative convergence tolerance, applied to each system.
+ * The default is 1.0e-06.
+ **/
+HYPRE_Int HYPRE_BatchPCGSetTol( HYPRE_Solver solver,
+                                HYPRE_Real   tol );
+
+/**
+ * (Optional) Set the maximum number of iterations.  The default is 1000.
+ **/
+HYPRE_Int HYPRE_BatchPCGSetMaxIter( HYPRE_Solver solver,
+                                    HYPRE_Int    max_iter );
+
+/**
+ * (Optional) Set the preconditioner:
+ *
+ *    - 0 : none
+ *    - 1 : Jacobi (default)
+ *    - 2 : ILU(0)
+ **/
+HYPRE_Int HYPRE_BatchPCGSetPrecondType( HYPRE_Solver solver,
+                                        HYPRE_Int    precond_type );
+
+/**
+ * Return the largest number of iterations over the systems.
+ **/
+HYPRE_Int HYPRE_BatchPCGGetNumIterations( HYPRE_Solver  solver,
+                                          HYPRE_Int    *num_iterations );
+
+/**
+ * Return the number of iterations of each system (array of length
+ * num_systems, allocated by the caller).
+ **/
+HYPRE_Int HYPRE_BatchPCGGetSystemNumIterations( HYPRE_Solver  solver,
+                                                HYPRE_Int    *num_iterations );
+
+/**
+ * Return the largest final relative residual norm over the systems.
+ **/
+HYPRE_Int HYPRE_BatchPCGGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
+                                                      HYPRE_Real   *norm );
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -31,6 +31,9 @@ HYPRE_ParCSRPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_PCGFunctionsSetBlockInnerProd( pcg_functions,
+                                        hypre_ParKrylovBlockInnerProdStart,
+                                        hypre_ParKrylovBlockInnerProdFinish );
    *solver = ( (HYPRE_Solver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
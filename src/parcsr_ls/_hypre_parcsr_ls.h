@@ -30,6 +30,26 @@ typedef struct { HYPRE_Int prev; HYPRE_Int next; } Link;
 
 #include "par_csr_block_matrix.h"
 
+/*--------------------------------------------------------------------------
+ * Phases of the per-level profile (see par_amg_profile.c)
+ *--------------------------------------------------------------------------*/
+
+typedef enum hypre_ParAMGProfilePhase_enum
+{
+   HYPRE_AMG_PROFILE_COARSEN = 0,
+   HYPRE_AMG_PROFILE_INTERP_SETUP,
+   HYPRE_AMG_PROFILE_RAP,
+   HYPRE_AMG_PROFILE_SMOOTHER_SETUP,
+   HYPRE_AMG_PROFILE_COARSE_SETUP,
+   HYPRE_AMG_PROFILE_RELAX,
+   HYPRE_AMG_PROFILE_RESIDUAL,
+   HYPRE_AMG_PROFILE_RESTRICT,
+   HYPRE_AMG_PROFILE_INTERP,
+   HYPRE_AMG_PROFILE_COARSE_SOLVE,
+   HYPRE_AMG_PROFILE_NUM_PHASES
+
+} hypre_ParAMGProfilePhase;
+
 /*--------------------------------------------------------------------------
  * hypre_ParAMGData
  *--------------------------------------------------------------------------*/
@@ -278,6 +298,27 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* first level whose operators are stored in single precision (0: off) */
+   HYPRE_Int mixed_precision;
+
+   /* reuse CF splittings and P/R of the previous setup (numeric resetup) */
+   HYPRE_Int numeric_resetup;
+   HYPRE_Int num_rap_plans;
+   hypre_ParCSRRAPPlan **rap_plans;
+
+   /* overlap the halo exchange with interior rows in hybrid GS smoothers:
+    * per level, the local rows ordered interior rows first (see
+    * hypre_ParCSRMatrixOverlapOrderingCreate) */
+   HYPRE_Int relax_overlap;
+   HYPRE_Int **overlap_orderings;
+   HYPRE_Int  *num_interior_rows;
+
+   /* fused residual/restriction and prolongation/correction in the cycle */
+   HYPRE_Int fused_transfer;
+
+   /* per level and phase profile (NULL: off) */
+   hypre_Profiler *profiler;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -544,6 +585,15 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataMixedPrecision(amg_data) ((amg_data)->mixed_precision)
+#define hypre_ParAMGDataNumericResetup(amg_data) ((amg_data)->numeric_resetup)
+#define hypre_ParAMGDataNumRAPPlans(amg_data) ((amg_data)->num_rap_plans)
+#define hypre_ParAMGDataRAPPlans(amg_data) ((amg_data)->rap_plans)
+#define hypre_ParAMGDataRelaxOverlap(amg_data) ((amg_data)->relax_overlap)
+#define hypre_ParAMGDataOverlapOrderings(amg_data) ((amg_data)->overlap_orderings)
+#define hypre_ParAMGDataNumInteriorRows(amg_data) ((amg_data)->num_interior_rows)
+#define hypre_ParAMGDataFusedTransfer(amg_data) ((amg_data)->fused_transfer)
+#define hypre_ParAMGDataProfiler(amg_data) ((amg_data)->profiler)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -1163,6 +1213,14 @@ typedef struct hypre_ParILUData_struct
    HYPRE_Int             nI;
    HYPRE_Int            *u_end; /* used when schur block is formed */
 
+   /* level schedules of L and U for threaded host triangular solves */
+   HYPRE_Int             lower_num_levels;
+   HYPRE_Int            *lower_level_ptr;
+   HYPRE_Int            *lower_level_rows;
+   HYPRE_Int             upper_num_levels;
+   HYPRE_Int            *upper_level_ptr;
+   HYPRE_Int            *upper_level_rows;
+
    /* temp vectors for solve phase */
    hypre_ParVector      *Utemp;
    hypre_ParVector      *Ftemp;
@@ -1291,6 +1349,12 @@ typedef struct hypre_ParILUData_struct
 #define hypre_ParILUDataNLU(ilu_data)                          ((ilu_data) -> nLU)
 #define hypre_ParILUDataNI(ilu_data)                           ((ilu_data) -> nI)
 #define hypre_ParILUDataUEnd(ilu_data)                         ((ilu_data) -> u_end)
+#define hypre_ParILUDataLowerNumLevels(ilu_data)               ((ilu_data) -> lower_num_levels)
+#define hypre_ParILUDataLowerLevelPtr(ilu_data)                ((ilu_data) -> lower_level_ptr)
+#define hypre_ParILUDataLowerLevelRows(ilu_data)               ((ilu_data) -> lower_level_rows)
+#define hypre_ParILUDataUpperNumLevels(ilu_data)               ((ilu_data) -> upper_num_levels)
+#define hypre_ParILUDataUpperLevelPtr(ilu_data)                ((ilu_data) -> upper_level_ptr)
+#define hypre_ParILUDataUpperLevelRows(ilu_data)               ((ilu_data) -> upper_level_rows)
 #define hypre_ParILUDataUTemp(ilu_data)                        ((ilu_data) -> Utemp)
 #define hypre_ParILUDataFTemp(ilu_data)                        ((ilu_data) -> Ftemp)
 #define hypre_ParILUDataXTemp(ilu_data)                        ((ilu_data) -> Xtemp)
@@ -1662,6 +1726,21 @@ HYPRE_Int hypre_exchange_interp_data( HYPRE_Int **CF_marker_offd, HYPRE_Int **do
 void hypre_build_interp_colmap(hypre_ParCSRMatrix *P, HYPRE_Int full_off_procNodes,
                                HYPRE_Int *tmp_CF_marker_offd, HYPRE_BigInt *fine_to_coarse_offd);
 
+/* batch_pcg.c */
+void *hypre_BatchPCGCreate ( void );
+HYPRE_Int hypre_BatchPCGDestroy ( void *pcg_vdata );
+HYPRE_Int hypre_BatchPCGSetValues ( void *pcg_vdata, HYPRE_Complex *values );
+HYPRE_Int hypre_BatchPCGSetup ( void *pcg_vdata, HYPRE_Int num_systems, HYPRE_Int num_rows,
+                                HYPRE_Int *ia, HYPRE_Int *ja, HYPRE_Complex *values );
+HYPRE_Int hypre_BatchPCGSolve ( void *pcg_vdata, HYPRE_Complex *b_data, HYPRE_Complex *x_data );
+HYPRE_Int hypre_BatchPCGSetTol ( void *pcg_vdata, HYPRE_Real tol );
+HYPRE_Int hypre_BatchPCGSetMaxIter ( void *pcg_vdata, HYPRE_Int max_iter );
+HYPRE_Int hypre_BatchPCGSetPrecondType ( void *pcg_vdata, HYPRE_Int precond_type );
+HYPRE_Int hypre_BatchPCGGetNumIterations ( void *pcg_vdata, HYPRE_Int *num_iterations );
+HYPRE_Int hypre_BatchPCGGetSystemNumIterations ( void *pcg_vdata, HYPRE_Int *num_iterations );
+HYPRE_Int hypre_BatchPCGGetFinalRelativeResidualNorm ( void *pcg_vdata,
+                                                       HYPRE_Real *relative_residual_norm );
+
 /* block_tridiag.c */
 void *hypre_BlockTridiagCreate ( void );
 HYPRE_Int hypre_BlockTridiagDestroy ( void *data );
@@ -1795,6 +1874,20 @@ HYPRE_Int HYPRE_AMSFEISetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_P
                               HYPRE_Int numLocalNodes_, HYPRE_Int numNodes_, HYPRE_Real *NodalCoord_ );
 HYPRE_Int HYPRE_AMSFEIDestroy ( HYPRE_Solver solver );
 
+/* HYPRE_batch_pcg.c */
+HYPRE_Int HYPRE_BatchPCGCreate ( HYPRE_Solver *solver );
+HYPRE_Int HYPRE_BatchPCGDestroy ( HYPRE_Solver solver );
+HYPRE_Int HYPRE_BatchPCGSetup ( HYPRE_Solver solver, HYPRE_Int num_systems, HYPRE_Int num_rows,
+                                HYPRE_Int *ia, HYPRE_Int *ja, HYPRE_Complex *values );
+HYPRE_Int HYPRE_BatchPCGSetValues ( HYPRE_Solver solver, HYPRE_Complex *values );
+HYPRE_Int HYPRE_BatchPCGSolve ( HYPRE_Solver solver, HYPRE_Complex *b, HYPRE_Complex *x );
+HYPRE_Int HYPRE_BatchPCGSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
+HYPRE_Int HYPRE_BatchPCGSetMaxIter ( HYPRE_Solver solver, HYPRE_Int max_iter );
+HYPRE_Int HYPRE_BatchPCGSetPrecondType ( HYPRE_Solver solver, HYPRE_Int precond_type );
+HYPRE_Int HYPRE_BatchPCGGetNumIterations ( HYPRE_Solver solver, HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_BatchPCGGetSystemNumIterations ( HYPRE_Solver solver, HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_BatchPCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver, HYPRE_Real *norm );
+
 /* HYPRE_parcsr_amg.c */
 HYPRE_Int HYPRE_BoomerAMGCreate ( HYPRE_Solver *solver );
 HYPRE_Int HYPRE_BoomerAMGDestroy ( HYPRE_Solver solver );
@@ -2007,6 +2100,12 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision ( HYPRE_Solver solver, HYPRE_Int mixed_precision );
+HYPRE_Int HYPRE_BoomerAMGSetNumericResetup ( HYPRE_Solver solver, HYPRE_Int numeric_resetup );
+HYPRE_Int HYPRE_BoomerAMGSetRelaxOverlap ( HYPRE_Solver solver, HYPRE_Int relax_overlap );
+HYPRE_Int HYPRE_BoomerAMGSetFusedTransfer ( HYPRE_Solver solver, HYPRE_Int fused_transfer );
+HYPRE_Int HYPRE_BoomerAMGSetProfile ( HYPRE_Solver solver, HYPRE_Int profile );
+HYPRE_Int HYPRE_BoomerAMGPrintProfile ( HYPRE_Solver solver, const char *filename );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -2173,6 +2272,7 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
                                      HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetKDim ( HYPRE_Solver solver, HYPRE_Int k_dim );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS2 ( HYPRE_Solver solver, HYPRE_Int cgs2 );
+HYPRE_Int HYPRE_ParCSRCOGMRESSetPipelined ( HYPRE_Solver solver, HYPRE_Int pipelined );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetMinIter ( HYPRE_Solver solver, HYPRE_Int min_iter );
@@ -2627,6 +2727,10 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetMixedPrecision ( void *data, HYPRE_Int mixed_precision );
+HYPRE_Int hypre_BoomerAMGSetNumericResetup ( void *data, HYPRE_Int numeric_resetup );
+HYPRE_Int hypre_BoomerAMGSetRelaxOverlap ( void *data, HYPRE_Int relax_overlap );
+HYPRE_Int hypre_BoomerAMGSetFusedTransfer ( void *data, HYPRE_Int fused_transfer );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -2637,6 +2741,19 @@ HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int n
 HYPRE_Int hypre_BoomerAMGSetCumNnzAP ( void *data, HYPRE_Real cum_nnz_AP );
 HYPRE_Int hypre_BoomerAMGGetCumNnzAP ( void *data, HYPRE_Real *cum_nnz_AP );
 
+/* par_amg_profile.c */
+HYPRE_Int hypre_BoomerAMGSetProfile ( void *data, HYPRE_Int profile );
+HYPRE_Int hypre_BoomerAMGPrintProfile ( void *data, const char *filename );
+HYPRE_Int hypre_BoomerAMGProfileAddMatvecWork ( void *data, HYPRE_Int level, HYPRE_Int phase,
+                                                hypre_ParCSRMatrix *A, HYPRE_Int num_passes );
+
+/* par_amg_resetup.c */
+HYPRE_Int hypre_BoomerAMGResetupCheck ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                        HYPRE_Int *reuse );
+HYPRE_Int hypre_BoomerAMGResetupCoarseOperators ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGResetupPlansDestroy ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGResetupGalerkinDiff ( void *amg_vdata, HYPRE_Real *rel_diff );
+
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
@@ -3406,6 +3523,9 @@ HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_I
                                          void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
                                        void *result_x, void *result_y );
+void *hypre_ParKrylovBlockInnerProdStart ( HYPRE_Int kx, void **x, HYPRE_Int ky, void **y,
+                                           HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovBlockInnerProdFinish ( void *handle );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
                                    HYPRE_Int unroll);
 HYPRE_Int hypre_ParKrylovCopyVector ( void *x, void *y );
@@ -3898,6 +4018,9 @@ HYPRE_Int hypre_ILUSetupRAPILU0( hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_I
                                  hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **mLptr,
                                  HYPRE_Real **mDptr, hypre_ParCSRMatrix **mUptr,
                                  HYPRE_Int **u_end );
+HYPRE_Int hypre_ILUSetupLevelSchedule( hypre_CSRMatrix *LU_diag, HYPRE_Int nLU, HYPRE_Int lower,
+                                       HYPRE_Int *num_levels_ptr, HYPRE_Int **level_ptr_ptr,
+                                       HYPRE_Int **level_rows_ptr );
 HYPRE_Int hypre_ILUSetupILU0( hypre_ParCSRMatrix  *A, HYPRE_Int *perm, HYPRE_Int *qperm,
                               HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr,
                               HYPRE_Real **Dptr, hypre_ParCSRMatrix **Uptr,
@@ -3961,7 +4084,10 @@ HYPRE_Int hypre_ILUSolveSchurGMRES( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                     hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S,
                                     hypre_ParVector *ftemp, hypre_ParVector *utemp,
                                     HYPRE_Solver schur_solver, HYPRE_Solver schur_precond,
-                                    hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end );
+                                    hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end,
+                                    HYPRE_Int lower_num_levels, HYPRE_Int *lower_level_ptr,
+                                    HYPRE_Int *lower_level_rows, HYPRE_Int upper_num_levels,
+                                    HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows );
 HYPRE_Int hypre_ILUSolveSchurNSH( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                   hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
                                   hypre_ParCSRMatrix *L, HYPRE_Real *D,
@@ -3969,10 +4095,21 @@ HYPRE_Int hypre_ILUSolveSchurNSH( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                   hypre_ParVector *ftemp, hypre_ParVector *utemp,
                                   HYPRE_Solver schur_solver, hypre_ParVector *rhs,
                                   hypre_ParVector *x, HYPRE_Int *u_end );
+HYPRE_Int hypre_ILUSolveLevelL( HYPRE_Int num_levels, HYPRE_Int *level_ptr,
+                                HYPRE_Int *level_rows, hypre_CSRMatrix *L_diag,
+                                HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Real *f_data,
+                                HYPRE_Real *u_data );
+HYPRE_Int hypre_ILUSolveLevelU( HYPRE_Int num_levels, HYPRE_Int *level_ptr,
+                                HYPRE_Int *level_rows, hypre_CSRMatrix *U_diag,
+                                HYPRE_Int *u_end, HYPRE_Real *D, HYPRE_Int *qperm,
+                                HYPRE_Real *u_data );
 HYPRE_Int hypre_ILUSolveLU( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                             hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
                             hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
-                            hypre_ParVector *ftemp, hypre_ParVector *utemp );
+                            hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                            HYPRE_Int lower_num_levels, HYPRE_Int *lower_level_ptr,
+                            HYPRE_Int *lower_level_rows, HYPRE_Int upper_num_levels,
+                            HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows );
 HYPRE_Int hypre_ILUSolveLUIter( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                 hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
                                 hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
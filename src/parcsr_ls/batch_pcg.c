@@ -0,0 +1,584 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Batched PCG for many small independent systems with a common sparsity
+ * pattern (host only).
+ *
+ * The systems are stored in one hypre_CSRBatchMatrix and the vectors are
+ * multivectors with one component per system, so every kernel of the PCG
+ * iteration is a single pass over the whole batch.  The systems iterate in
+ * lockstep, each with its own step lengths; converged systems are frozen
+ * (zero step length) until the last one has converged.  A system that breaks
+ * down (<p,Ap> <= 0 or <r,z> <= 0) is frozen as well and reported with
+ * HYPRE_ERROR_CONV.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+typedef struct
+{
+   HYPRE_Real             tol;
+   HYPRE_Int              max_iter;
+   HYPRE_Int              precond_type;    /* 0: none, 1: Jacobi, 2: ILU(0) */
+
+   hypre_CSRBatchMatrix  *A;
+   HYPRE_Int             *perm;            /* user position of each sorted entry */
+
+   /* preconditioner */
+   HYPRE_Int              precond_built;   /* type of the current preconditioner data */
+   HYPRE_Complex         *inv_diag;
+   HYPRE_Int              ilu_num_ops;
+   HYPRE_Int             *ilu_ops;
+   HYPRE_Complex         *ilu_data;
+
+   /* work vectors */
+   hypre_Vector          *r;
+   hypre_Vector          *z;
+   hypre_Vector          *p;
+   hypre_Vector          *q;
+
+   /* results */
+   HYPRE_Int              num_iterations;
+   HYPRE_Int             *system_iterations;
+   HYPRE_Real             rel_resid_norm;
+
+} hypre_BatchPCGData;
+
+/*--------------------------------------------------------------------------
+ * hypre_BatchPCGCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_BatchPCGCreate( void )
+{
+   hypre_BatchPCGData *pcg_data;
+
+   pcg_data = hypre_CTAlloc(hypre_BatchPCGData, 1, HYPRE_MEMORY_HOST);
+
+   /* set defaults */
+   (pcg_data -> tol)           = 1.0e-06;
+   (pcg_data -> max_iter)      = 1000;
+   (pcg_data -> precond_type)  = 1;
+   (pcg_data -> precond_built) = -1;
+
+   return (void *) pcg_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BatchPCGDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BatchPCGDestroy( void *pcg_vdata )
+{
+   hypre_BatchPCGData *pcg_data = (hypre_BatchPCGData *) pcg_vdata;
+
+   if (pcg_data)
+   {
+      hypre_CSRBatchMatrixDestroy(pcg_data -> A);
+      hypre_TFree(pcg_data -> perm, HYPRE_MEMORY_HOST);
+      hypre_TFree(pcg_data -> inv_diag, HYPRE_MEMORY_HOST);
+      hypre_TFree(pcg_data -> ilu_ops, HYPRE_MEMORY_HOST);
+      hypre_TFree(pcg_data -> ilu_data, HYPRE_MEMORY_HOST);
+      hypre_SeqVectorDestroy(pcg_data -> r);
+      hypre_SeqVectorDestroy(pcg_data -> z);
+      hypre_SeqVectorDestroy(pcg_data -> p);
+      hypre_SeqVectorDestroy(pcg_data -> q);
+      hypre_TFree(pcg_data -> system_iterations, HYPRE_MEMORY_HOST);
+      hypre_TFree(pcg_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BatchPCGSetupPrecond
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BatchPCGSetupPrecond( hypre_BatchPCGData *pcg_data )
+{
+   hypre_CSRBatchMatrix  *A            = (pcg_data -> A);
+   HYPRE_Int              precond_type = (pcg_data -> precond_type);
+   HYPRE_Int              num_systems  = hypre_CSRBatchMatrixNumSystems(A);
+   HYPRE_Int              num_rows     = hypre_CSRBatchMatrixNumRows(A);
+   HYPRE_Int              num_nonzeros = hypre_CSRBatchMatrixNumNonzeros(A);
+   HYPRE_Int             *A_diag       = hypre_CSRBatchMatrixDiag(A);
+   HYPRE_Complex         *A_data       = hypre_CSRBatchMatrixData(A);
+   HYPRE_Complex         *inv_diag;
+   HYPRE_Int              k, i;
+
+   if (precond_type == 1)
+   {
+      if (!(pcg_data -> inv_diag))
+      {
+         (pcg_data -> inv_diag) = hypre_TAlloc(HYPRE_Complex, (size_t) num_systems * num_rows,
+                                               HYPRE_MEMORY_HOST);
+      }
+      inv_diag = (pcg_data -> inv_diag);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(k, i) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < num_systems; k++)
+      {
+         for (i = 0; i < num_rows; i++)
+         {
+            inv_diag[(size_t) k * num_rows + i] =
+               1.0 / A_data[(size_t) k * num_nonzeros + A_diag[i]];
+         }
+      }
+   }
+   else if (precond_type == 2)
+   {
+      if (!(pcg_data -> ilu_ops))
+      {
+         hypre_CSRBatchMatrixILU0Symbolic(A, &(pcg_data -> ilu_num_ops), &(pcg_data -> ilu_ops));
+      }
+      if (!(pcg_data -> ilu_data))
+      {
+         (pcg_data -> ilu_data) = hypre_TAlloc(HYPRE_Complex, (size_t) num_systems * num_nonzeros,
+                                               HYPRE_MEMORY_HOST);
+      }
+      hypre_CSRBatchMatrixILU0Factor(A, (pcg_data -> ilu_num_ops), (pcg_data -> ilu_ops),
+                                     (pcg_data -> ilu_data));
+   }
+
+   (pcg_data -> precond_built) = precond_type;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BatchPCGSetValues
+ *
+ * Loads new values (same pattern as in setup, user ordering) and updates
+ * the preconditioner.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BatchPCGSetValues( void          *pcg_vdata,
+                         HYPRE_Complex *values )
+{
+   hypre_BatchPCGData    *pcg_data = (hypre_BatchPCGData *) pcg_vdata;
+   hypre_CSRBatchMatrix  *A        = (pcg_data -> A);
+   HYPRE_Int             *perm     = (pcg_data -> perm);
+   HYPRE_Int              num_systems, num_nonzeros, k, jj;
+   HYPRE_Complex         *A_data;
+
+   if (!A)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Batched PCG has not been set up!");
+      return hypre_error_flag;
+   }
+
+   num_systems  = hypre_CSRBatchMatrixNumSystems(A);
+   num_nonzeros = hypre_CSRBatchMatrixNumNonzeros(A);
+   A_data       = hypre_CSRBatchMatrixData(A);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(k, jj) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < num_systems; k++)
+   {
+      for (jj = 0; jj < num_nonzeros; jj++)
+      {
+         A_data[(size_t) k * num_nonzeros + jj] = values[(size_t) k * num_nonzeros + perm[jj]];
+      }
+   }
+
+   return hypre_BatchPCGSetupPrecond(pcg_data);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BatchPCGSetup
+ *
+ * The systems share the CSR pattern (ia, ja) of num_rows rows; values holds
+ * the num_systems value arrays one after the other.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BatchPCGSetup( void          *pcg_vdata,
+                     HYPRE_Int      num_systems,
+                     HYPRE_Int      num_rows,
+                     HYPRE_Int     *ia,
+                     HYPRE_Int     *ja,
+                     HYPRE_Complex *values )
+{
+   hypre_BatchPCGData    *pcg_data = (hypre_BatchPCGData *) pcg_vdata;
+   hypre_CSRBatchMatrix  *A;
+   HYPRE_Int             *A_i, *A_j, *perm;
+   HYPRE_Int              num_nonzeros, i, jj;
+
+   if (num_systems < 0 || num_rows < 0 || !ia || !ja || !values)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   /* free data from a previous setup */
+   hypre_CSRBatchMatrixDestroy(pcg_data -> A);
+   hypre_TFree(pcg_data -> perm, HYPRE_MEMORY_HOST);
+   hypre_TFree(pcg_data -> inv_diag, HYPRE_MEMORY_HOST);
+   hypre_TFree(pcg_data -> ilu_ops, HYPRE_MEMORY_HOST);
+   hypre_TFree(pcg_data -> ilu_data, HYPRE_MEMORY_HOST);
+   hypre_SeqVectorDestroy(pcg_data -> r);
+   hypre_SeqVectorDestroy(pcg_data -> z);
+   hypre_SeqVectorDestroy(pcg_data -> p);
+   hypre_SeqVectorDestroy(pcg_data -> q);
+   hypre_TFree(pcg_data -> system_iterations, HYPRE_MEMORY_HOST);
+
+   /* copy the pattern with sorted rows */
+   num_nonzeros = ia[num_rows] - ia[0];
+   A = hypre_CSRBatchMatrixCreate(num_systems, num_rows, num_nonzeros);
+   hypre_CSRBatchMatrixInitialize(A);
+   A_i  = hypre_CSRBatchMatrixI(A);
+   A_j  = hypre_CSRBatchMatrixJ(A);
+   perm = hypre_TAlloc(HYPRE_Int, num_nonzeros, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i <= num_rows; i++)
+   {
+      A_i[i] = ia[i] - ia[0];
+   }
+   for (jj = 0; jj < num_nonzeros; jj++)
+   {
+      A_j[jj]  = ja[ia[0] + jj];
+      perm[jj] = ia[0] + jj;
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      hypre_qsort2i(A_j, perm, A_i[i], A_i[i + 1] - 1);
+   }
+
+   (pcg_data -> A)             = A;
+   (pcg_data -> perm)          = perm;
+   (pcg_data -> precond_built) = -1;
+
+   if (hypre_CSRBatchMatrixFindDiagonal(A))
+   {
+      return hypre_error_flag;
+   }
+
+   /* work vectors */
+   (pcg_data -> r) = hypre_SeqMultiVectorCreate(num_rows, num_systems);
+   (pcg_data -> z) = hypre_SeqMultiVectorCreate(num_rows, num_systems);
+   (pcg_data -> p) = hypre_SeqMultiVectorCreate(num_rows, num_systems);
+   (pcg_data -> q) = hypre_SeqMultiVectorCreate(num_rows, num_systems);
+   hypre_SeqVectorInitialize_v2(pcg_data -> r, HYPRE_MEMORY_HOST);
+   hypre_SeqVectorInitialize_v2(pcg_data -> z, HYPRE_MEMORY_HOST);
+   hypre_SeqVectorInitialize_v2(pcg_data -> p, HYPRE_MEMORY_HOST);
+   hypre_SeqVectorInitialize_v2(pcg_data -> q, HYPRE_MEMORY_HOST);
+
+   (pcg_data -> system_iterations) = hypre_CTAlloc(HYPRE_Int, num_systems, HYPRE_MEMORY_HOST);
+
+   return hypre_BatchPCGSetValues(pcg_vdata, values);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BatchPCGPrecond: z = M^{-1} r
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BatchPCGPrecond( hypre_BatchPCGData *pcg_data,
+                       hypre_Vector       *r,
+                       hypre_Vector       *z )
+{
+   HYPRE_Int       size     = hypre_VectorSize(r) * hypre_VectorNumVectors(r);
+   HYPRE_Complex  *r_data   = hypre_VectorData(r);
+   HYPRE_Complex  *z_data   = hypre_VectorData(z);
+   HYPRE_Complex  *inv_diag = (pcg_data -> inv_diag);
+   HYPRE_Int       i;
+
+   switch (pcg_data -> precond_type)
+   {
+      case 1:
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < size; i++)
+         {
+            z_data[i] = inv_diag[i] * r_data[i];
+         }
+         break;
+
+      case 2:
+         hypre_CSRBatchMatrixILU0Solve(pcg_data -> A, pcg_data -> ilu_data, r, z);
+         break;
+
+      default:
+         hypre_SeqVectorCopy(r, z);
+         break;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BatchPCGSolve
+ *
+ * b and x hold the right-hand sides and solutions of the systems one after
+ * the other.  x is used as the initial guess.  System k has converged when
+ * ||r_k|| <= tol*||b_k||.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BatchPCGSolve( void          *pcg_vdata,
+                     HYPRE_Complex *b_data,
+                     HYPRE_Complex *x_data )
+{
+   hypre_BatchPCGData    *pcg_data = (hypre_BatchPCGData *) pcg_vdata;
+   hypre_CSRBatchMatrix  *A        = (pcg_data -> A);
+   HYPRE_Real             tol      = (pcg_data -> tol);
+   HYPRE_Int              max_iter = (pcg_data -> max_iter);
+   hypre_Vector          *r        = (pcg_data -> r);
+   hypre_Vector          *z        = (pcg_data -> z);
+   hypre_Vector          *p        = (pcg_data -> p);
+   hypre_Vector          *q        = (pcg_data -> q);
+   HYPRE_Int             *system_iterations;
+
+   hypre_Vector          *b, *x;
+   HYPRE_Int              num_systems, num_rows, num_active, iter, k;
+   HYPRE_Real            *bi_prod, *gamma, *gamma_old, *pq, *ri_prod;
+   HYPRE_Complex         *alpha, *beta, *ones;
+   HYPRE_Real             rel_norm;
+
+   if (!A)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Batched PCG has not been set up!");
+      return hypre_error_flag;
+   }
+
+   num_systems       = hypre_CSRBatchMatrixNumSystems(A);
+   num_rows          = hypre_CSRBatchMatrixNumRows(A);
+   system_iterations = (pcg_data -> system_iterations);
+
+   if ((pcg_data -> precond_built) != (pcg_data -> precond_type))
+   {
+      hypre_BatchPCGSetupPrecond(pcg_data);
+   }
+
+   /* wrap the user arrays */
+   b = hypre_SeqMultiVectorCreate(num_rows, num_systems);
+   x = hypre_SeqMultiVectorCreate(num_rows, num_systems);
+   hypre_VectorData(b)     = b_data;
+   hypre_VectorData(x)     = x_data;
+   hypre_VectorOwnsData(b) = 0;
+   hypre_VectorOwnsData(x) = 0;
+   hypre_SeqVectorInitialize_v2(b, HYPRE_MEMORY_HOST);
+   hypre_SeqVectorInitialize_v2(x, HYPRE_MEMORY_HOST);
+
+   bi_prod   = hypre_CTAlloc(HYPRE_Real, num_systems, HYPRE_MEMORY_HOST);
+   ri_prod   = hypre_CTAlloc(HYPRE_Real, num_systems, HYPRE_MEMORY_HOST);
+   gamma     = hypre_CTAlloc(HYPRE_Real, num_systems, HYPRE_MEMORY_HOST);
+   gamma_old = hypre_CTAlloc(HYPRE_Real, num_systems, HYPRE_MEMORY_HOST);
+   pq        = hypre_CTAlloc(HYPRE_Real, num_systems, HYPRE_MEMORY_HOST);
+   alpha     = hypre_CTAlloc(HYPRE_Complex, num_systems, HYPRE_MEMORY_HOST);
+   beta      = hypre_CTAlloc(HYPRE_Complex, num_systems, HYPRE_MEMORY_HOST);
+   ones      = hypre_CTAlloc(HYPRE_Complex, num_systems, HYPRE_MEMORY_HOST);
+
+   /* r = b - A x, p = z = M^{-1} r, gamma = <r,z> */
+   hypre_SeqVectorCopy(b, r);
+   hypre_CSRBatchMatrixMatvec(-1.0, A, x, 1.0, r);
+   hypre_BatchPCGPrecond(pcg_data, r, z);
+   hypre_SeqVectorCopy(z, p);
+   hypre_SeqVectorBatchInnerProd(b, b, bi_prod);
+   hypre_SeqVectorBatchInnerProd(r, r, ri_prod);
+   hypre_SeqVectorBatchInnerProd(r, z, gamma);
+
+   /* systems with ||r_k|| <= tol*||b_k|| are inactive (system_iterations >= 0) */
+   num_active = 0;
+   for (k = 0; k < num_systems; k++)
+   {
+      ones[k] = 1.0;
+      system_iterations[k] = -1;
+      if (ri_prod[k] <= tol * tol * bi_prod[k])
+      {
+         system_iterations[k] = 0;
+      }
+      else
+      {
+         num_active++;
+      }
+   }
+
+   iter = 0;
+   while (num_active > 0 && iter < max_iter)
+   {
+      iter++;
+
+      /* q = A p, alpha = gamma / <p,q> */
+      hypre_CSRBatchMatrixMatvec(1.0, A, p, 0.0, q);
+      hypre_SeqVectorBatchInnerProd(p, q, pq);
+      for (k = 0; k < num_systems; k++)
+      {
+         alpha[k] = 0.0;
+         if (system_iterations[k] < 0)
+         {
+            if (pq[k] <= 0.0 || gamma[k] <= 0.0)
+            {
+               /* indefinite or singular (A or M): freeze this system.  A zero
+                * <p,Ap> with p != 0 is a breakdown just like a negative one. */
+               system_iterations[k] = iter;
+               num_active--;
+               hypre_error_w_msg(HYPRE_ERROR_CONV,
+                                 "Indefinite or singular system in batched PCG!");
+               continue;
+            }
+            alpha[k] = gamma[k] / pq[k];
+         }
+      }
+
+      /* x += alpha p, r -= alpha q */
+      hypre_SeqVectorBatchAxpby(alpha, p, ones, x);
+      for (k = 0; k < num_systems; k++)
+      {
+         alpha[k] = -alpha[k];
+      }
+      hypre_SeqVectorBatchAxpby(alpha, q, ones, r);
+
+      /* convergence check */
+      hypre_SeqVectorBatchInnerProd(r, r, ri_prod);
+      for (k = 0; k < num_systems; k++)
+      {
+         if (system_iterations[k] < 0 && ri_prod[k] <= tol * tol * bi_prod[k])
+         {
+            system_iterations[k] = iter;
+            num_active--;
+         }
+      }
+      if (num_active == 0)
+      {
+         break;
+      }
+
+      /* z = M^{-1} r, beta = gamma_new / gamma_old, p = z + beta p */
+      hypre_BatchPCGPrecond(pcg_data, r, z);
+      for (k = 0; k < num_systems; k++)
+      {
+         gamma_old[k] = gamma[k];
+      }
+      hypre_SeqVectorBatchInnerProd(r, z, gamma);
+      for (k = 0; k < num_systems; k++)
+      {
+         beta[k] = (system_iterations[k] < 0) ? gamma[k] / gamma_old[k] : 0.0;
+      }
+      hypre_SeqVectorBatchAxpby(ones, z, beta, p);
+   }
+
+   /* statistics */
+   (pcg_data -> num_iterations) = 0;
+   (pcg_data -> rel_resid_norm) = 0.0;
+   for (k = 0; k < num_systems; k++)
+   {
+      if (system_iterations[k] < 0)
+      {
+         system_iterations[k] = iter;
+      }
+      (pcg_data -> num_iterations) = hypre_max((pcg_data -> num_iterations),
+                                               system_iterations[k]);
+      rel_norm = (bi_prod[k] > 0.0) ? hypre_sqrt(ri_prod[k] / bi_prod[k]) : hypre_sqrt(ri_prod[k]);
+      (pcg_data -> rel_resid_norm) = hypre_max((pcg_data -> rel_resid_norm), rel_norm);
+   }
+
+   hypre_SeqVectorDestroy(b);
+   hypre_SeqVectorDestroy(x);
+   hypre_TFree(bi_prod, HYPRE_MEMORY_HOST);
+   hypre_TFree(ri_prod, HYPRE_MEMORY_HOST);
+   hypre_TFree(gamma, HYPRE_MEMORY_HOST);
+   hypre_TFree(gamma_old, HYPRE_MEMORY_HOST);
+   hypre_TFree(pq, HYPRE_MEMORY_HOST);
+   hypre_TFree(alpha, HYPRE_MEMORY_HOST);
+   hypre_TFree(beta, HYPRE_MEMORY_HOST);
+   hypre_TFree(ones, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Set/Get routines
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BatchPCGSetTol( void       *pcg_vdata,
+                      HYPRE_Real  tol )
+{
+   hypre_BatchPCGData *pcg_data = (hypre_BatchPCGData *) pcg_vdata;
+
+   (pcg_data -> tol) = tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BatchPCGSetMaxIter( void      *pcg_vdata,
+                          HYPRE_Int  max_iter )
+{
+   hypre_BatchPCGData *pcg_data = (hypre_BatchPCGData *) pcg_vdata;
+
+   (pcg_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BatchPCGSetPrecondType( void      *pcg_vdata,
+                              HYPRE_Int  precond_type )
+{
+   hypre_BatchPCGData *pcg_data = (hypre_BatchPCGData *) pcg_vdata;
+
+   if (precond_type < 0 || precond_type > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (pcg_data -> precond_type) = precond_type;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BatchPCGGetNumIterations( void      *pcg_vdata,
+                                HYPRE_Int *num_iterations )
+{
+   hypre_BatchPCGData *pcg_data = (hypre_BatchPCGData *) pcg_vdata;
+
+   *num_iterations = (pcg_data -> num_iterations);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BatchPCGGetSystemNumIterations( void      *pcg_vdata,
+                                      HYPRE_Int *num_iterations )
+{
+   hypre_BatchPCGData *pcg_data = (hypre_BatchPCGData *) pcg_vdata;
+   HYPRE_Int           k;
+
+   if (pcg_data -> A)
+   {
+      for (k = 0; k < hypre_CSRBatchMatrixNumSystems(pcg_data -> A); k++)
+      {
+         num_iterations[k] = (pcg_data -> system_iterations)[k];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BatchPCGGetFinalRelativeResidualNorm( void       *pcg_vdata,
+                                            HYPRE_Real *relative_residual_norm )
+{
+   hypre_BatchPCGData *pcg_data = (hypre_BatchPCGData *) pcg_vdata;
+
+   *relative_residual_norm = (pcg_data -> rel_resid_norm);
+
+   return hypre_error_flag;
+}
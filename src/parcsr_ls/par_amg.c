@@ -523,6 +523,15 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataRAP2(amg_data)              = rap2;
    hypre_ParAMGDataKeepTranspose(amg_data)     = keepT;
    hypre_ParAMGDataModularizedMatMat(amg_data) = modu_rap;
+   hypre_ParAMGDataMixedPrecision(amg_data)    = 0;
+   hypre_ParAMGDataNumericResetup(amg_data)    = 0;
+   hypre_ParAMGDataNumRAPPlans(amg_data)       = 0;
+   hypre_ParAMGDataRAPPlans(amg_data)          = NULL;
+   hypre_ParAMGDataRelaxOverlap(amg_data)      = 0;
+   hypre_ParAMGDataOverlapOrderings(amg_data)  = NULL;
+   hypre_ParAMGDataNumInteriorRows(amg_data)   = NULL;
+   hypre_ParAMGDataFusedTransfer(amg_data)     = 0;
+   hypre_ParAMGDataProfiler(amg_data)          = NULL;
 
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
@@ -678,6 +687,9 @@ hypre_BoomerAMGDestroy( void *data )
             }
          }
       }
+      hypre_BoomerAMGResetupPlansDestroy(amg_data);
+      hypre_ProfilerDestroy(hypre_ParAMGDataProfiler(amg_data));
+
       if (hypre_ParAMGDataGridRelaxPoints(amg_data))
       {
          for (i = 0; i < 4; i++)
@@ -710,6 +722,16 @@ hypre_BoomerAMGDestroy( void *data )
          hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
       }
 
+      if (hypre_ParAMGDataOverlapOrderings(amg_data))
+      {
+         for (i = 0; i < num_levels; i++)
+         {
+            hypre_TFree(hypre_ParAMGDataOverlapOrderings(amg_data)[i], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_ParAMGDataOverlapOrderings(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataNumInteriorRows(amg_data), HYPRE_MEMORY_HOST);
+      }
+
       if (hypre_ParAMGDataChebyCoefs(amg_data))
       {
          for (i = 0; i < num_levels; i++)
@@ -4920,6 +4942,76 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetMixedPrecision( void       *data,
+                                  HYPRE_Int   mixed_precision )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (mixed_precision < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataMixedPrecision(amg_data) = mixed_precision;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetNumericResetup( void       *data,
+                                  HYPRE_Int   numeric_resetup )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataNumericResetup(amg_data) = numeric_resetup;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetRelaxOverlap( void       *data,
+                                HYPRE_Int   relax_overlap )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataRelaxOverlap(amg_data) = relax_overlap;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetFusedTransfer( void       *data,
+                                 HYPRE_Int   fused_transfer )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataFusedTransfer(amg_data) = fused_transfer;
+   return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
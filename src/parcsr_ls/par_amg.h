@@ -12,6 +12,26 @@
 
 #include "par_csr_block_matrix.h"
 
+/*--------------------------------------------------------------------------
+ * Phases of the per-level profile (see par_amg_profile.c)
+ *--------------------------------------------------------------------------*/
+
+typedef enum hypre_ParAMGProfilePhase_enum
+{
+   HYPRE_AMG_PROFILE_COARSEN = 0,
+   HYPRE_AMG_PROFILE_INTERP_SETUP,
+   HYPRE_AMG_PROFILE_RAP,
+   HYPRE_AMG_PROFILE_SMOOTHER_SETUP,
+   HYPRE_AMG_PROFILE_COARSE_SETUP,
+   HYPRE_AMG_PROFILE_RELAX,
+   HYPRE_AMG_PROFILE_RESIDUAL,
+   HYPRE_AMG_PROFILE_RESTRICT,
+   HYPRE_AMG_PROFILE_INTERP,
+   HYPRE_AMG_PROFILE_COARSE_SOLVE,
+   HYPRE_AMG_PROFILE_NUM_PHASES
+
+} hypre_ParAMGProfilePhase;
+
 /*--------------------------------------------------------------------------
  * hypre_ParAMGData
  *--------------------------------------------------------------------------*/
@@ -260,6 +280,27 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* first level whose operators are stored in single precision (0: off) */
+   HYPRE_Int mixed_precision;
+
+   /* reuse CF splittings and P/R of the previous setup (numeric resetup) */
+   HYPRE_Int numeric_resetup;
+   HYPRE_Int num_rap_plans;
+   hypre_ParCSRRAPPlan **rap_plans;
+
+   /* overlap the halo exchange with interior rows in hybrid GS smoothers:
+    * per level, the local rows ordered interior rows first (see
+    * hypre_ParCSRMatrixOverlapOrderingCreate) */
+   HYPRE_Int relax_overlap;
+   HYPRE_Int **overlap_orderings;
+   HYPRE_Int  *num_interior_rows;
+
+   /* fused residual/restriction and prolongation/correction in the cycle */
+   HYPRE_Int fused_transfer;
+
+   /* per level and phase profile (NULL: off) */
+   hypre_Profiler *profiler;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -526,6 +567,15 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataMixedPrecision(amg_data) ((amg_data)->mixed_precision)
+#define hypre_ParAMGDataNumericResetup(amg_data) ((amg_data)->numeric_resetup)
+#define hypre_ParAMGDataNumRAPPlans(amg_data) ((amg_data)->num_rap_plans)
+#define hypre_ParAMGDataRAPPlans(amg_data) ((amg_data)->rap_plans)
+#define hypre_ParAMGDataRelaxOverlap(amg_data) ((amg_data)->relax_overlap)
+#define hypre_ParAMGDataOverlapOrderings(amg_data) ((amg_data)->overlap_orderings)
+#define hypre_ParAMGDataNumInteriorRows(amg_data) ((amg_data)->num_interior_rows)
+#define hypre_ParAMGDataFusedTransfer(amg_data) ((amg_data)->fused_transfer)
+#define hypre_ParAMGDataProfiler(amg_data) ((amg_data)->profiler)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Per-level profile of BoomerAMG: setup sub-steps and cycle phases are
+ * recorded for each level with a hypre_Profiler (see utilities/profiler.c).
+ *
+ * Flops and memory traffic are modeled for the cycle phases only, from the
+ * number of nonzeros of the operators, one pass over the matrix per sweep or
+ * product. They are not recorded for the setup phases.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+static const char *hypre_amg_profile_phase_names[HYPRE_AMG_PROFILE_NUM_PHASES] =
+{
+   "coarsen",
+   "interp_setup",
+   "rap",
+   "smoother_setup",
+   "coarse_setup",
+   "relax",
+   "residual",
+   "restrict",
+   "interp",
+   "coarse_solve"
+};
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetProfile
+ *
+ * If profile is not 0, a new profile is started (the data of a previous one
+ * is cleared). If profile is 0, profiling is turned off.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetProfile( void      *data,
+                           HYPRE_Int  profile )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (profile)
+   {
+      if (hypre_ParAMGDataProfiler(amg_data))
+      {
+         hypre_ProfilerReset(hypre_ParAMGDataProfiler(amg_data));
+      }
+      else
+      {
+         hypre_ParAMGDataProfiler(amg_data) =
+            hypre_ProfilerCreate(HYPRE_AMG_PROFILE_NUM_PHASES, hypre_amg_profile_phase_names);
+      }
+   }
+   else
+   {
+      hypre_ProfilerDestroy(hypre_ParAMGDataProfiler(amg_data));
+      hypre_ParAMGDataProfiler(amg_data) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGPrintProfile
+ *
+ * Collective on the communicator of the fine-grid matrix.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGPrintProfile( void       *data,
+                             const char *filename )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (!hypre_ParAMGDataProfiler(amg_data))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Profiling is not enabled (HYPRE_BoomerAMGSetProfile)\n");
+      return hypre_error_flag;
+   }
+   if (!hypre_ParAMGDataAArray(amg_data) || !hypre_ParAMGDataAArray(amg_data)[0])
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "BoomerAMG has not been set up\n");
+      return hypre_error_flag;
+   }
+
+   return hypre_ProfilerPrint(hypre_ParAMGDataProfiler(amg_data),
+                              hypre_ParCSRMatrixComm(hypre_ParAMGDataAArray(amg_data)[0]),
+                              filename);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGProfileAddMatvecWork
+ *
+ * Adds the modeled work of num_passes products with the local part of A to
+ * the entry (level, phase): 2 flops per nonzero, and the matrix, the input
+ * vector (local and external parts) read and the output vector read and
+ * written once per pass.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGProfileAddMatvecWork( void               *data,
+                                     HYPRE_Int           level,
+                                     HYPRE_Int           phase,
+                                     hypre_ParCSRMatrix *A,
+                                     HYPRE_Int           num_passes )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+   hypre_Profiler   *profiler = hypre_ParAMGDataProfiler(amg_data);
+   hypre_CSRMatrix  *A_diag, *A_offd;
+   HYPRE_Real        nnz, num_rows, num_cols, flops, bytes;
+
+   if (!profiler || !A || num_passes < 1)
+   {
+      return hypre_error_flag;
+   }
+
+   A_diag   = hypre_ParCSRMatrixDiag(A);
+   A_offd   = hypre_ParCSRMatrixOffd(A);
+   nnz      = (HYPRE_Real) (hypre_CSRMatrixNumNonzeros(A_diag) + hypre_CSRMatrixNumNonzeros(A_offd));
+   num_rows = (HYPRE_Real) hypre_CSRMatrixNumRows(A_diag);
+   num_cols = (HYPRE_Real) (hypre_CSRMatrixNumCols(A_diag) + hypre_CSRMatrixNumCols(A_offd));
+
+   flops = 2.0 * nnz;
+   bytes = nnz * (HYPRE_Real) (sizeof(HYPRE_Complex) + sizeof(HYPRE_Int)) +
+           2.0 * (num_rows + 1.0) * (HYPRE_Real) sizeof(HYPRE_Int) +
+           (num_cols + 2.0 * num_rows) * (HYPRE_Real) sizeof(HYPRE_Complex);
+
+   hypre_ProfilerAddWork(profiler, level, phase, num_passes * flops, num_passes * bytes);
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,612 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Numeric resetup of BoomerAMG: the CF splittings and the sparsity patterns
+ * of the interpolation operators of a previous setup are kept. For a new
+ * fine-grid matrix, only the interpolation weights (on the fixed patterns)
+ * and the coarse-grid operators are recomputed. The rest of
+ * hypre_BoomerAMGSetup (coarse solver, smoother data) runs as usual.
+ *
+ * On the host, the first resetup also stores a product plan per level (see
+ * par_csr_product_plan.c), so that later resetups with the same sparsity
+ * pattern only recompute the values of the coarse-grid operators in place.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupCheck
+ *
+ * Sets *reuse to 1 if the hierarchy stored in amg_data can be reused with
+ * the fine-grid matrix A and right-hand side f, and to 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupCheck( void               *amg_vdata,
+                             hypre_ParCSRMatrix *A,
+                             hypre_ParVector    *f,
+                             HYPRE_Int          *reuse )
+{
+   hypre_ParAMGData    *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **P_array    = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array    = hypre_ParAMGDataRArray(amg_data);
+   hypre_ParVector    **F_array    = hypre_ParAMGDataFArray(amg_data);
+   hypre_IntArray     **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int            interp_type = hypre_ParAMGDataInterpType(amg_data);
+   hypre_ParCSRMatrix  *P;
+   HYPRE_Int            level;
+
+   *reuse = 0;
+
+   if (!hypre_ParAMGDataNumericResetup(amg_data))
+   {
+      return hypre_error_flag;
+   }
+
+   /* Need a previous multilevel hierarchy */
+   if (num_levels < 2 || !P_array || !P_array[0] || !F_array)
+   {
+      return hypre_error_flag;
+   }
+
+   /* Coarse operators that are not plain Galerkin products of the stored P/R */
+   if (hypre_ParAMGDataBlockMode(amg_data)              ||
+       hypre_ParAMGDataAdditive(amg_data)        > -1   ||
+       hypre_ParAMGDataMultAdditive(amg_data)    > -1   ||
+       hypre_ParAMGDataSimple(amg_data)          > -1   ||
+       hypre_ParAMGDataNonGalerkNumTol(amg_data) >  0   ||
+       hypre_ParAMGDataNonGalTolArray(amg_data)         ||
+       hypre_ParAMGInterpVecVariant(amg_data)    >  0)
+   {
+      return hypre_error_flag;
+   }
+
+   /* Interpolations that hypre_BoomerAMGResetupInterp cannot rebuild on the
+    * stored pattern: aggressive coarsening, nodal/block and smooth-vector
+    * based interpolations, refinement, and approximate ideal restriction */
+   if (hypre_ParAMGDataGSMG(amg_data)              ||
+       hypre_ParAMGDataNodal(amg_data)      != 0   ||
+       hypre_ParAMGDataAggNumLevels(amg_data) > 0  ||
+       hypre_ParAMGInterpRefine(amg_data)    > 0   ||
+       hypre_ParAMGDataRestriction(amg_data) != 0  ||
+       interp_type == 1 || interp_type == 10 || interp_type == 11 ||
+       (interp_type >= 20 && interp_type != 100))
+   {
+      return hypre_error_flag;
+   }
+
+   /* The weights are recomputed on the host only */
+   if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) != HYPRE_EXEC_HOST)
+   {
+      return hypre_error_flag;
+   }
+
+   /* The restriction must be of the same kind */
+   if ((hypre_ParAMGDataRestriction(amg_data) != 0) != (R_array != P_array))
+   {
+      return hypre_error_flag;
+   }
+
+   /* The row partitioning of A must match the stored interpolation */
+   P = P_array[0];
+   if (hypre_ParCSRMatrixGlobalNumRows(P) != hypre_ParCSRMatrixGlobalNumRows(A) ||
+       hypre_ParCSRMatrixFirstRowIndex(P) != hypre_ParCSRMatrixFirstRowIndex(A) ||
+       hypre_ParCSRMatrixNumRows(P)       != hypre_ParCSRMatrixNumRows(A))
+   {
+      return hypre_error_flag;
+   }
+
+   /* The number of vectors of the level vectors must not change */
+   if (!F_array[1] || hypre_ParVectorNumVectors(F_array[1]) != hypre_ParVectorNumVectors(f))
+   {
+      return hypre_error_flag;
+   }
+
+   /* Values of P/R must be available (see HYPRE_BoomerAMGSetMixedPrecision) */
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      if (!P_array[level] ||
+          (hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(P_array[level])) &&
+           !hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(P_array[level]))))
+      {
+         return hypre_error_flag;
+      }
+      if (R_array != P_array && !R_array[level])
+      {
+         return hypre_error_flag;
+      }
+      if (!CF_marker_array || !CF_marker_array[level])
+      {
+         return hypre_error_flag;
+      }
+   }
+
+   *reuse = 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupPlansDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupPlansDestroy( void *amg_vdata )
+{
+   hypre_ParAMGData     *amg_data  = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRRAPPlan **rap_plans = hypre_ParAMGDataRAPPlans(amg_data);
+   HYPRE_Int             level;
+
+   if (rap_plans)
+   {
+      for (level = 0; level < hypre_ParAMGDataNumRAPPlans(amg_data); level++)
+      {
+         hypre_ParCSRRAPPlanDestroy(rap_plans[level]);
+      }
+      hypre_TFree(rap_plans, HYPRE_MEMORY_HOST);
+   }
+   hypre_ParAMGDataRAPPlans(amg_data)    = NULL;
+   hypre_ParAMGDataNumRAPPlans(amg_data) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupInterp
+ *
+ * Recomputes the values of P_array[level] for the current A_array[level] on
+ * the stored CF splitting and the sparsity pattern of P. The interpolation
+ * of the setup is rebuilt from a new strength matrix without truncation,
+ * restricted to the pattern of P, and each row is rescaled to the row sum of
+ * the untruncated interpolation, as in hypre_BoomerAMGInterpTruncation.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupInterp( hypre_ParAMGData *amg_data,
+                              HYPRE_Int         level )
+{
+   hypre_ParCSRMatrix  *A                = hypre_ParAMGDataAArray(amg_data)[level];
+   hypre_ParCSRMatrix  *P                = hypre_ParAMGDataPArray(amg_data)[level];
+   hypre_IntArray      *dof_func         = hypre_ParAMGDataDofFuncArray(amg_data) ?
+                                           hypre_ParAMGDataDofFuncArray(amg_data)[level] : NULL;
+   HYPRE_Int           *CF_marker        = hypre_IntArrayData(
+                                              hypre_ParAMGDataCFMarkerArray(amg_data)[level]);
+   HYPRE_Int            num_functions    = hypre_ParAMGDataNumFunctions(amg_data);
+   HYPRE_Int            interp_type      = hypre_ParAMGDataInterpType(amg_data);
+   HYPRE_Int            sep_weight       = hypre_ParAMGDataSepWeight(amg_data);
+   HYPRE_Real           strong_threshold = hypre_ParAMGDataStrongThreshold(amg_data);
+   HYPRE_Real           max_row_sum      = hypre_ParAMGDataMaxRowSum(amg_data);
+   HYPRE_BigInt        *coarse_pnts_global = hypre_ParCSRMatrixColStarts(P);
+   HYPRE_Int           *dof_func_data    = dof_func ? hypre_IntArrayData(dof_func) : NULL;
+
+   hypre_CSRMatrix     *P_diag           = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int           *P_diag_i         = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int           *P_diag_j         = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Real          *P_diag_data      = hypre_CSRMatrixData(P_diag);
+   hypre_CSRMatrix     *P_offd           = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int           *P_offd_i         = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int           *P_offd_j         = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Real          *P_offd_data      = hypre_CSRMatrixData(P_offd);
+   HYPRE_BigInt        *col_map_offd_P   = hypre_ParCSRMatrixColMapOffd(P);
+   HYPRE_Int            num_rows         = hypre_CSRMatrixNumRows(P_diag);
+   HYPRE_Int            num_cols_P       = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int            num_cols_offd_P  = hypre_CSRMatrixNumCols(P_offd);
+
+   hypre_ParCSRMatrix  *S = NULL;
+   hypre_ParCSRMatrix  *F = NULL;
+   hypre_CSRMatrix     *F_diag, *F_offd;
+   HYPRE_Int           *F_diag_i, *F_diag_j, *F_offd_i, *F_offd_j;
+   HYPRE_Real          *F_diag_data, *F_offd_data;
+   HYPRE_BigInt        *col_map_offd_F;
+   HYPRE_Int            num_cols_offd_F;
+   HYPRE_Int           *map_offd, *pos_diag, *pos_offd;
+   HYPRE_Real           full_sum, kept_sum, scale;
+   HYPRE_Int            i, jj, k;
+
+   /* See hypre_BoomerAMGSetup */
+   if (interp_type == 9)
+   {
+      interp_type = 8;
+      sep_weight  = 1;
+   }
+   else if (interp_type == 5)
+   {
+      interp_type = 4;
+      sep_weight  = 1;
+   }
+
+   if (num_functions > 1 && interp_type == 19)
+   {
+      /* the systems interpolation of the setup uses a scalar strength matrix */
+      hypre_BoomerAMGCreateS(A, strong_threshold, max_row_sum, 1, dof_func_data, &S);
+      num_functions = 1;
+   }
+   else if (hypre_ParAMGDataSabs(amg_data))
+   {
+      hypre_BoomerAMGCreateSabs(A, strong_threshold, 1.0, 1, NULL, &S);
+   }
+   else
+   {
+      hypre_BoomerAMGCreateS(A, strong_threshold, max_row_sum, num_functions,
+                             dof_func_data, &S);
+   }
+
+   switch (interp_type)
+   {
+      case 2:
+         hypre_BoomerAMGBuildInterpHE(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                      dof_func_data, 0, 0.0, 0, &F);
+         break;
+      case 3:
+      case 15:
+         hypre_BoomerAMGBuildDirInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                       dof_func_data, 0, 0.0, 0, interp_type, &F);
+         break;
+      case 4:
+         hypre_BoomerAMGBuildMultipass(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                       dof_func_data, 0, 0.0, 0, sep_weight, &F);
+         break;
+      case 6:
+         hypre_BoomerAMGBuildExtPIInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                         dof_func_data, 0, 0.0, 0, &F);
+         break;
+      case 7:
+         hypre_BoomerAMGBuildExtPICCInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                           dof_func_data, 0, 0.0, 0, &F);
+         break;
+      case 8:
+         hypre_BoomerAMGBuildStdInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                       dof_func_data, 0, 0.0, 0, sep_weight, &F);
+         break;
+      case 12:
+         hypre_BoomerAMGBuildFFInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                      dof_func_data, 0, 0.0, 0, &F);
+         break;
+      case 13:
+         hypre_BoomerAMGBuildFF1Interp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                       dof_func_data, 0, 0.0, 0, &F);
+         break;
+      case 14:
+         hypre_BoomerAMGBuildExtInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                       dof_func_data, 0, 0.0, 0, &F);
+         break;
+      case 16:
+         hypre_BoomerAMGBuildModExtInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                          dof_func_data, 0, 0.0, 0, &F);
+         break;
+      case 17:
+         hypre_BoomerAMGBuildModExtPIInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                            dof_func_data, 0, 0.0, 0, &F);
+         break;
+      case 18:
+         hypre_BoomerAMGBuildModExtPEInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                            dof_func_data, 0, 0.0, 0, &F);
+         break;
+      case 100:
+         hypre_BoomerAMGBuildInterpOnePnt(A, CF_marker, S, coarse_pnts_global, 1, NULL, 0, &F);
+         break;
+      default:
+         hypre_BoomerAMGBuildInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                    dof_func_data, 0, 0.0, 0, &F);
+         break;
+   }
+   hypre_ParCSRMatrixDestroy(S);
+
+   F_diag          = hypre_ParCSRMatrixDiag(F);
+   F_diag_i        = hypre_CSRMatrixI(F_diag);
+   F_diag_j        = hypre_CSRMatrixJ(F_diag);
+   F_diag_data     = hypre_CSRMatrixData(F_diag);
+   F_offd          = hypre_ParCSRMatrixOffd(F);
+   F_offd_i        = hypre_CSRMatrixI(F_offd);
+   F_offd_j        = hypre_CSRMatrixJ(F_offd);
+   F_offd_data     = hypre_CSRMatrixData(F_offd);
+   col_map_offd_F  = hypre_ParCSRMatrixColMapOffd(F);
+   num_cols_offd_F = hypre_CSRMatrixNumCols(F_offd);
+
+   /* Offd columns of F in the offd of P (-1 if P has no such column) */
+   map_offd = hypre_TAlloc(HYPRE_Int, num_cols_offd_F, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_cols_offd_F; k++)
+   {
+      map_offd[k] = hypre_BigBinarySearch(col_map_offd_P, col_map_offd_F[k], num_cols_offd_P);
+   }
+
+   /* Position of each column in the current row of P (-1 if not there) */
+   pos_diag = hypre_TAlloc(HYPRE_Int, num_cols_P, HYPRE_MEMORY_HOST);
+   pos_offd = hypre_TAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_cols_P; k++)
+   {
+      pos_diag[k] = -1;
+   }
+   for (k = 0; k < num_cols_offd_P; k++)
+   {
+      pos_offd[k] = -1;
+   }
+
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = P_diag_i[i]; jj < P_diag_i[i + 1]; jj++)
+      {
+         pos_diag[P_diag_j[jj]] = jj;
+         P_diag_data[jj] = 0.0;
+      }
+      for (jj = P_offd_i[i]; jj < P_offd_i[i + 1]; jj++)
+      {
+         pos_offd[P_offd_j[jj]] = jj;
+         P_offd_data[jj] = 0.0;
+      }
+
+      full_sum = 0.0;
+      kept_sum = 0.0;
+      for (jj = F_diag_i[i]; jj < F_diag_i[i + 1]; jj++)
+      {
+         full_sum += F_diag_data[jj];
+         k = pos_diag[F_diag_j[jj]];
+         if (k > -1)
+         {
+            P_diag_data[k] = F_diag_data[jj];
+            kept_sum += F_diag_data[jj];
+         }
+      }
+      for (jj = F_offd_i[i]; jj < F_offd_i[i + 1]; jj++)
+      {
+         full_sum += F_offd_data[jj];
+         k = map_offd[F_offd_j[jj]];
+         if (k > -1 && pos_offd[k] > -1)
+         {
+            P_offd_data[pos_offd[k]] = F_offd_data[jj];
+            kept_sum += F_offd_data[jj];
+         }
+      }
+
+      scale = (kept_sum != 0.0) ? full_sum / kept_sum : 1.0;
+      for (jj = P_diag_i[i]; jj < P_diag_i[i + 1]; jj++)
+      {
+         P_diag_data[jj] *= scale;
+         pos_diag[P_diag_j[jj]] = -1;
+      }
+      for (jj = P_offd_i[i]; jj < P_offd_i[i + 1]; jj++)
+      {
+         P_offd_data[jj] *= scale;
+         pos_offd[P_offd_j[jj]] = -1;
+      }
+   }
+
+   hypre_TFree(map_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(pos_diag, HYPRE_MEMORY_HOST);
+   hypre_TFree(pos_offd, HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatrixDestroy(F);
+
+   /* The values of P changed in place: drop the data derived from them */
+   hypre_ParCSRMatrixSellDataInvalidate(P);
+   if (hypre_ParCSRMatrixDiagT(P))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(P));
+      hypre_ParCSRMatrixDiagT(P) = NULL;
+   }
+   if (hypre_ParCSRMatrixOffdT(P))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(P));
+      hypre_ParCSRMatrixOffdT(P) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupCoarseOperators
+ *
+ * Recomputes P_array[0..num_levels-2] on their stored patterns (see
+ * hypre_BoomerAMGResetupInterp) and A_array[1..num_levels-1] from
+ * A_array[0], level by level.
+ * On the host and without dropping of small entries, the products are done
+ * through the per-level product plans: a matching plan only recomputes the
+ * values of A_array[level+1], otherwise a new plan is set up. Elsewhere the
+ * same products as in hypre_BoomerAMGSetup are used.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupCoarseOperators( void *amg_vdata )
+{
+   hypre_ParAMGData     *amg_data      = (hypre_ParAMGData*) amg_vdata;
+   hypre_Profiler       *profiler      = hypre_ParAMGDataProfiler(amg_data);
+   HYPRE_Int             num_levels    = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix  **A_array       = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix  **P_array       = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix  **R_array       = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int             restri_type   = hypre_ParAMGDataRestriction(amg_data);
+   HYPRE_Int             rap2          = hypre_ParAMGDataRAP2(amg_data);
+   HYPRE_Int             keepTranspose = hypre_ParAMGDataKeepTranspose(amg_data);
+   HYPRE_Int             modularized   = hypre_ParAMGDataModularizedMatMat(amg_data);
+   HYPRE_Real            drop_tol      = hypre_ParAMGDataADropTol(amg_data);
+   HYPRE_Int             drop_type     = hypre_ParAMGDataADropType(amg_data);
+
+   hypre_ParCSRRAPPlan **rap_plans     = NULL;
+   hypre_ParCSRMatrix   *A_H, *Q;
+   HYPRE_Int             num_procs, level, use_plans;
+
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A_array[0]), &num_procs);
+
+   use_plans = (drop_tol <= 0.0) &&
+               hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A_array[0])) ==
+               HYPRE_EXEC_HOST;
+
+   if (use_plans)
+   {
+      if (hypre_ParAMGDataNumRAPPlans(amg_data) != num_levels - 1)
+      {
+         hypre_BoomerAMGResetupPlansDestroy(amg_data);
+         hypre_ParAMGDataRAPPlans(amg_data)    = hypre_CTAlloc(hypre_ParCSRRAPPlan *,
+                                                               num_levels - 1,
+                                                               HYPRE_MEMORY_HOST);
+         hypre_ParAMGDataNumRAPPlans(amg_data) = num_levels - 1;
+      }
+      rap_plans = hypre_ParAMGDataRAPPlans(amg_data);
+   }
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      HYPRE_ANNOTATE_REGION_BEGIN("%s", "Interpolation");
+      hypre_ProfilerBegin(profiler, level, HYPRE_AMG_PROFILE_INTERP_SETUP);
+      hypre_BoomerAMGResetupInterp(amg_data, level);
+      hypre_ProfilerEnd(profiler, level, HYPRE_AMG_PROFILE_INTERP_SETUP);
+      HYPRE_ANNOTATE_REGION_END("%s", "Interpolation");
+
+      HYPRE_ANNOTATE_REGION_BEGIN("%s", "RAP");
+      hypre_ProfilerBegin(profiler, level, HYPRE_AMG_PROFILE_RAP);
+
+      A_H = NULL;
+      if (use_plans)
+      {
+         if (hypre_ParCSRRAPPlanMatches(rap_plans[level], A_array[level], P_array[level]))
+         {
+            /* Same patterns: only the values of the coarse operator change */
+            hypre_ParCSRMatrixRAPNumericHost(rap_plans[level],
+                                             restri_type ? R_array[level] : P_array[level],
+                                             A_array[level], P_array[level],
+                                             A_array[level + 1]);
+
+            hypre_ProfilerEnd(profiler, level, HYPRE_AMG_PROFILE_RAP);
+            HYPRE_ANNOTATE_REGION_END("%s", "RAP");
+            continue;
+         }
+
+         hypre_ParCSRRAPPlanDestroy(rap_plans[level]);
+         rap_plans[level] = NULL;
+
+         /* R*A*P if R is stored, P^T*A*P otherwise */
+         A_H = hypre_ParCSRMatrixRAPSymbolicHost(restri_type ? R_array[level] : P_array[level],
+                                                 A_array[level], P_array[level],
+                                                 !restri_type, &rap_plans[level]);
+      }
+      else if (restri_type)
+      {
+         /* R is not P^T: two matrix products */
+         if (modularized)
+         {
+            Q   = hypre_ParCSRMatMat(A_array[level], P_array[level]);
+            A_H = hypre_ParCSRMatMat(R_array[level], Q);
+            hypre_CSRMatrixReorder(hypre_ParCSRMatrixDiag(A_H));
+         }
+         else
+         {
+            Q   = hypre_ParMatmul(A_array[level], P_array[level]);
+            A_H = hypre_ParMatmul(R_array[level], Q);
+         }
+         hypre_ParCSRMatrixDestroy(Q);
+      }
+      else if (rap2)
+      {
+         if (modularized)
+         {
+            Q   = hypre_ParCSRMatMat(A_array[level], P_array[level]);
+            A_H = hypre_ParCSRTMatMatKT(P_array[level], Q, keepTranspose);
+         }
+         else
+         {
+            Q   = hypre_ParMatmul(A_array[level], P_array[level]);
+            A_H = hypre_ParTMatmul(P_array[level], Q);
+         }
+         hypre_ParCSRMatrixDestroy(Q);
+      }
+      else if (modularized)
+      {
+         A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
+                                       P_array[level], keepTranspose);
+      }
+      else
+      {
+         hypre_BoomerAMGBuildCoarseOperatorKT(P_array[level], A_array[level],
+                                              P_array[level], keepTranspose, &A_H);
+      }
+
+      hypre_ParCSRMatrixDropSmallEntries(A_H, drop_tol, drop_type);
+      if (num_procs > 1 && !hypre_ParCSRMatrixCommPkg(A_H))
+      {
+         hypre_MatvecCommPkgCreate(A_H);
+      }
+      /* NumNonzeros was set in hypre_ParCSRMatrixDropSmallEntries */
+      if (drop_tol <= 0.0)
+      {
+         hypre_ParCSRMatrixSetNumNonzeros(A_H);
+         hypre_ParCSRMatrixSetDNumNonzeros(A_H);
+      }
+
+      hypre_ParCSRMatrixDestroy(A_array[level + 1]);
+      A_array[level + 1] = A_H;
+
+      hypre_ProfilerEnd(profiler, level, HYPRE_AMG_PROFILE_RAP);
+      HYPRE_ANNOTATE_REGION_END("%s", "RAP");
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupGalerkinDiff
+ *
+ * Recomputes the coarse-grid operators of the stored hierarchy with full
+ * Galerkin products and returns in *rel_diff the largest relative difference
+ * (in the Frobenius norm) to the stored ones. The product plans sum in a
+ * different order than hypre_ParCSRMatrixRAPKT, so the difference is at the
+ * level of rounding errors, not zero. Used for testing.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupGalerkinDiff( void       *amg_vdata,
+                                    HYPRE_Real *rel_diff )
+{
+   hypre_ParAMGData    *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array    = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array    = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int            restri_type = hypre_ParAMGDataRestriction(amg_data);
+
+   hypre_ParCSRMatrix  *A_H, *Q, *D;
+   HYPRE_Real           norm_H, norm_D;
+   HYPRE_Int            level;
+
+   *rel_diff = 0.0;
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      if (!A_array[level + 1] || !P_array[level])
+      {
+         break;
+      }
+
+      if (restri_type)
+      {
+         Q   = hypre_ParCSRMatMat(A_array[level], P_array[level]);
+         A_H = hypre_ParCSRMatMat(R_array[level], Q);
+         hypre_ParCSRMatrixDestroy(Q);
+      }
+      else
+      {
+         A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
+                                       P_array[level], 0);
+      }
+
+      hypre_ParCSRMatrixAdd(1.0, A_array[level + 1], -1.0, A_H, &D);
+      norm_H = hypre_ParCSRMatrixFnorm(A_H);
+      norm_D = hypre_ParCSRMatrixFnorm(D);
+      if (norm_H > 0.0)
+      {
+         *rel_diff = hypre_max(*rel_diff, norm_D / norm_H);
+      }
+
+      hypre_ParCSRMatrixDestroy(D);
+      hypre_ParCSRMatrixDestroy(A_H);
+   }
+
+   return hypre_error_flag;
+}
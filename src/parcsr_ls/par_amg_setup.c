@@ -33,6 +33,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 {
    MPI_Comm            comm = hypre_ParCSRMatrixComm(A);
    hypre_ParAMGData   *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_Profiler     *profiler = hypre_ParAMGDataProfiler(amg_data);
 
    /* Data Structure variables */
    HYPRE_Int            num_vectors;
@@ -106,6 +107,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_ParCSRMatrix  *P1;
    hypre_ParCSRMatrix  *P2;
    hypre_ParCSRMatrix  *Pnew = NULL;
+   HYPRE_Int            numeric_resetup = 0;
    HYPRE_Real          *SmoothVecs = NULL;
    hypre_Vector       **l1_norms = NULL;
    hypre_Vector       **cheby_ds = NULL;
@@ -422,13 +424,20 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    hypre_ParAMGDataBlockMode(amg_data) = block_mode;
 
+   /* numeric resetup: keep CF splittings and P/R of the previous setup */
+   if (!block_mode)
+   {
+      hypre_BoomerAMGResetupCheck(amg_data, A, f, &numeric_resetup);
+   }
+
 
    /* end of systems checks */
 
    /* free up storage in case of new setup without previous destroy */
 
-   if (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
-       dof_func_array || R_array || R_block_array)
+   if (!numeric_resetup &&
+       (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
+        dof_func_array || R_array || R_block_array))
    {
       for (j = 1; j < old_num_levels; j++)
       {
@@ -475,6 +484,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
       }
 
+      /* The product plans of numeric resetups refer to the old hierarchy */
+      hypre_BoomerAMGResetupPlansDestroy(amg_data);
+
       /* Special case use of CF_marker_array when old_num_levels == 1
          requires us to attempt this deallocation every time */
       hypre_IntArrayDestroy(CF_marker_array[0]);
@@ -576,6 +588,16 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
       }
+
+      if (hypre_ParAMGDataOverlapOrderings(amg_data))
+      {
+         for (i = 0; i < old_num_levels; i++)
+         {
+            hypre_TFree(hypre_ParAMGDataOverlapOrderings(amg_data)[i], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_ParAMGDataOverlapOrderings(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataNumInteriorRows(amg_data), HYPRE_MEMORY_HOST);
+      }
       if (smooth_num_levels && smoother)
       {
          if (smooth_num_levels > 1 &&
@@ -912,7 +934,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    F_array = hypre_ParAMGDataFArray(amg_data);
    U_array = hypre_ParAMGDataUArray(amg_data);
 
-   if (F_array != NULL || U_array != NULL)
+   if (!numeric_resetup && (F_array != NULL || U_array != NULL))
    {
       for (j = 1; j < old_num_levels; j++)
       {
@@ -974,6 +996,19 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataSmoother(amg_data) = smoother;
    }
 
+   /*-----------------------------------------------------
+    *  Numeric resetup: only the coarse operators change
+    *-----------------------------------------------------*/
+
+   if (numeric_resetup)
+   {
+      hypre_BoomerAMGResetupCoarseOperators(amg_data);
+
+      level = old_num_levels - 1;
+      coarse_size = hypre_ParCSRMatrixGlobalNumRows(A_array[level]);
+      not_finished_coarsening = 0;
+   }
+
    /*-----------------------------------------------------
     *  Enter Coarsening Loop
     *-----------------------------------------------------*/
@@ -1209,6 +1244,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          /**** Do the appropriate coarsening ****/
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarsening");
+         hypre_ProfilerBegin(profiler, level, HYPRE_AMG_PROFILE_COARSEN);
 
          if (nodal == 0) /* no nodal coarsening */
          {
@@ -1683,6 +1719,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   coarse_dof_func = NULL;
                }
 
+               hypre_ProfilerEnd(profiler, level, HYPRE_AMG_PROFILE_COARSEN);
                HYPRE_ANNOTATE_REGION_END("%s", "Coarsening");
                break;
             }
@@ -1712,6 +1749,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   Sabs = NULL;
                }
 
+               hypre_ProfilerEnd(profiler, level, HYPRE_AMG_PROFILE_COARSEN);
                HYPRE_ANNOTATE_REGION_END("%s", "Coarsening");
                break;
             }
@@ -1720,8 +1758,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_GpuProfilingPopRange();
 
          /*****xxxxxxxxxxxxx changes for min_coarse_size  end */
+         hypre_ProfilerEnd(profiler, level, HYPRE_AMG_PROFILE_COARSEN);
          HYPRE_ANNOTATE_REGION_END("%s", "Coarsening");
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Interpolation");
+         hypre_ProfilerBegin(profiler, level, HYPRE_AMG_PROFILE_INTERP_SETUP);
 
          if (level < agg_num_levels)
          {
@@ -2490,6 +2530,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             dof_func_array[level + 1] = coarse_dof_func;
          }
 
+         hypre_ProfilerEnd(profiler, level, HYPRE_AMG_PROFILE_INTERP_SETUP);
          HYPRE_ANNOTATE_REGION_END("%s", "Interpolation");
       } /* end of if max_levels > 1 */
 
@@ -2761,6 +2802,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             }
 
             HYPRE_ANNOTATE_REGION_BEGIN("%s", "RAP");
+            hypre_ProfilerBegin(profiler, level, HYPRE_AMG_PROFILE_RAP);
             if (ns == 1)
             {
                hypre_ParCSRMatrix *Q = NULL;
@@ -2918,6 +2960,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                P_array[level] = Pnew;
                hypre_ParCSRMatrixDestroy(C);
             } /* if (ns == 1) */
+            hypre_ProfilerEnd(profiler, level, HYPRE_AMG_PROFILE_RAP);
             HYPRE_ANNOTATE_REGION_END("%s", "RAP");
 
             if (add_P_max_elmts || add_trunc_factor)
@@ -2960,6 +3003,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
        *--------------------------------------------------------------*/
 
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "RAP");
+      hypre_ProfilerBegin(profiler, level, HYPRE_AMG_PROFILE_RAP);
       if (debug_flag == 1) { wall_time = time_getWallclockSeconds(); }
 
       if (block_mode)
@@ -3092,6 +3136,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParCSRMatrixPrintIJ(P_array[level], 0, 0, file);
 #endif
 
+      hypre_ProfilerEnd(profiler, level, HYPRE_AMG_PROFILE_RAP);
       HYPRE_ANNOTATE_REGION_END("%s", "RAP");
       if (debug_flag == 1)
       {
@@ -3146,6 +3191,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    }  /* end of coarsening loop: while (not_finished_coarsening) */
 
    HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
+   hypre_ProfilerBegin(profiler, level, HYPRE_AMG_PROFILE_COARSE_SETUP);
 
    /* redundant coarse grid solve */
    if ((seq_threshold >= coarse_threshold) &&
@@ -3181,6 +3227,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          grid_relax_type[3] = grid_relax_type[1];
       }
    }
+   hypre_ProfilerEnd(profiler, level, HYPRE_AMG_PROFILE_COARSE_SETUP);
    HYPRE_ANNOTATE_REGION_END("%s", "Coarse solve");
    HYPRE_ANNOTATE_MGLEVEL_END(level);
    hypre_GpuProfilingPopRange();
@@ -3288,6 +3335,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
       HYPRE_ANNOTATE_MGLEVEL_BEGIN(j);
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "Relaxation");
+      hypre_ProfilerBegin(profiler, j, HYPRE_AMG_PROFILE_SMOOTHER_SETUP);
       hypre_sprintf(nvtx_name, "%s-%d", "AMG Level", level);
       hypre_GpuProfilingPushRange(nvtx_name);
 
@@ -3371,6 +3419,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_SeqVectorInitialize_v2(l1_norms[j], hypre_ParCSRMatrixMemoryLocation(A_array[j]));
       }
 
+      hypre_ProfilerEnd(profiler, j, HYPRE_AMG_PROFILE_SMOOTHER_SETUP);
       HYPRE_ANNOTATE_REGION_END("%s", "Relaxation");
       HYPRE_ANNOTATE_MGLEVEL_END(j);
       hypre_GpuProfilingPopRange();
@@ -3385,6 +3434,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          HYPRE_ANNOTATE_MGLEVEL_BEGIN(j);
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Relaxation");
+         hypre_ProfilerBegin(profiler, j, HYPRE_AMG_PROFILE_SMOOTHER_SETUP);
          hypre_sprintf(nvtx_name, "%s-%d", "AMG Level", level);
          hypre_GpuProfilingPushRange(nvtx_name);
 
@@ -3397,6 +3447,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_VectorData(l1_norms[j]) = l1_norm_data;
          hypre_SeqVectorInitialize_v2(l1_norms[j], hypre_ParCSRMatrixMemoryLocation(A_array[j]));
 
+         hypre_ProfilerEnd(profiler, j, HYPRE_AMG_PROFILE_SMOOTHER_SETUP);
          HYPRE_ANNOTATE_REGION_END("%s", "Relaxation");
          HYPRE_ANNOTATE_MGLEVEL_END(j);
          hypre_GpuProfilingPopRange();
@@ -3410,6 +3461,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
       HYPRE_ANNOTATE_MGLEVEL_BEGIN(j);
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "Relaxation");
+      hypre_ProfilerBegin(profiler, j, HYPRE_AMG_PROFILE_SMOOTHER_SETUP);
       hypre_sprintf(nvtx_name, "%s-%d", "AMG Level", level);
       hypre_GpuProfilingPushRange(nvtx_name);
 
@@ -3460,6 +3512,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_SeqVectorInitialize_v2(l1_norms[j], hypre_ParCSRMatrixMemoryLocation(A_array[j]));
       }
 
+      hypre_ProfilerEnd(profiler, j, HYPRE_AMG_PROFILE_SMOOTHER_SETUP);
       HYPRE_ANNOTATE_REGION_END("%s", "Relaxation");
       HYPRE_ANNOTATE_MGLEVEL_END(j);
       hypre_GpuProfilingPopRange();
@@ -3470,6 +3523,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    {
       HYPRE_ANNOTATE_MGLEVEL_BEGIN(j);
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "Relaxation");
+      hypre_ProfilerBegin(profiler, j, HYPRE_AMG_PROFILE_SMOOTHER_SETUP);
       hypre_sprintf(nvtx_name, "%s-%d", "AMG Level", level);
       hypre_GpuProfilingPushRange(nvtx_name);
 
@@ -3778,6 +3832,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
       }
 
+      hypre_ProfilerEnd(profiler, j, HYPRE_AMG_PROFILE_SMOOTHER_SETUP);
       HYPRE_ANNOTATE_REGION_END("%s", "Relaxation");
       HYPRE_ANNOTATE_MGLEVEL_END(j);
       hypre_GpuProfilingPopRange();
@@ -4018,6 +4073,80 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    }
 #endif
 
+   /*-----------------------------------------------------------------------
+    * Interior/boundary row orderings for overlapping the halo exchange in
+    * the hybrid Gauss-Seidel smoothers (see par_relax.c)
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_ParAMGDataOverlapOrderings(amg_data))
+   {
+      for (level = 0; level < num_levels; level++)
+      {
+         hypre_TFree(hypre_ParAMGDataOverlapOrderings(amg_data)[level], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_ParAMGDataOverlapOrderings(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataNumInteriorRows(amg_data), HYPRE_MEMORY_HOST);
+   }
+
+   if (hypre_ParAMGDataRelaxOverlap(amg_data) && num_procs > 1 && !block_mode &&
+       hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+   {
+      hypre_ParAMGDataOverlapOrderings(amg_data) = hypre_CTAlloc(HYPRE_Int *, num_levels,
+                                                                 HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataNumInteriorRows(amg_data)  = hypre_CTAlloc(HYPRE_Int, num_levels,
+                                                                 HYPRE_MEMORY_HOST);
+      for (level = 0; level < num_levels; level++)
+      {
+         hypre_ParCSRMatrixOverlapOrderingCreate(A_array[level],
+                                                 &hypre_ParAMGDataOverlapOrderings(amg_data)[level],
+                                                 &hypre_ParAMGDataNumInteriorRows(amg_data)[level]);
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Mixed precision: store the operators of the coarse levels in single
+    * precision. The fine grid operator (used by the outer Krylov solver) and
+    * the coarsest grid operator (used by the coarse solver) are left alone.
+    * A level's double values are only released when its smoother needs
+    * nothing but matvecs and the diagonal-based updates in par_relax.c.
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_ParAMGDataMixedPrecision(amg_data) > 0 && !block_mode &&
+       hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+   {
+      HYPRE_Int  mp_level = hypre_ParAMGDataMixedPrecision(amg_data);
+      HYPRE_Int  free_A;
+      /* the double values of P/R (and of the coarse A, updated in place)
+         are needed by a numeric resetup */
+      HYPRE_Int  free_P = !hypre_ParAMGDataNumericResetup(amg_data);
+
+      for (level = hypre_max(mp_level - 1, 0); level < num_levels - 1; level++)
+      {
+         hypre_ParCSRMatrixSPDataSetup(P_array[level], free_P);
+         if (hypre_ParAMGDataRArray(amg_data) != P_array)
+         {
+            hypre_ParCSRMatrixSPDataSetup(hypre_ParAMGDataRArray(amg_data)[level], free_P);
+         }
+      }
+
+      for (level = mp_level; level < num_levels - 1; level++)
+      {
+         free_A = (level >= smooth_num_levels) &&
+                  (addlvl < 0 || level < addlvl) && free_P;
+         for (j = 1; j < 3; j++)
+         {
+            if (grid_relax_type[j] != 0 &&
+                grid_relax_type[j] != 7 &&
+                grid_relax_type[j] != 18)
+            {
+               free_A = 0;
+            }
+         }
+
+         hypre_ParCSRMatrixSPDataSetup(A_array[level], free_A);
+      }
+   }
+
    HYPRE_ANNOTATE_FUNC_END;
 
    return (hypre_error_flag);
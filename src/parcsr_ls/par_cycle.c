@@ -25,6 +25,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                       hypre_ParVector  **U_array   )
 {
    hypre_ParAMGData *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_Profiler   *profiler = hypre_ParAMGDataProfiler(amg_data);
 
    HYPRE_Solver *smoother;
 
@@ -91,6 +92,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    HYPRE_Int       smooth_num_levels;
    HYPRE_Int       my_id;
    HYPRE_Int       restri_type;
+   HYPRE_Int       fused_transfer;
+   HYPRE_Int       profile_phase;
+   HYPRE_Int     **overlap_orderings;
    HYPRE_Real      alpha;
    hypre_Vector  **l1_norms = NULL;
    hypre_Vector   *l1_norms_level;
@@ -139,9 +143,11 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    smooth_type         = hypre_ParAMGDataSmoothType(amg_data);
    smooth_num_levels   = hypre_ParAMGDataSmoothNumLevels(amg_data);
    l1_norms            = hypre_ParAMGDataL1Norms(amg_data);
+   overlap_orderings   = hypre_ParAMGDataOverlapOrderings(amg_data);
    /* smooth_option       = hypre_ParAMGDataSmoothOption(amg_data); */
    /* RL */
    restri_type = hypre_ParAMGDataRestriction(amg_data);
+   fused_transfer = hypre_ParAMGDataFusedTransfer(amg_data) && !block_mode;
 
    partial_cycle_coarsest_level = hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data);
    partial_cycle_control = hypre_ParAMGDataPartialCycleControl(amg_data);
@@ -364,7 +370,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
       {
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
          hypre_GpuProfilingPushRange("Coarse solve");
+         hypre_ProfilerBegin(profiler, level, HYPRE_AMG_PROFILE_COARSE_SOLVE);
          hypre_seqAMGCycle(amg_data, level, F_array, U_array);
+         hypre_ProfilerEnd(profiler, level, HYPRE_AMG_PROFILE_COARSE_SOLVE);
          HYPRE_ANNOTATE_REGION_END("%s", "Coarse solve");
          hypre_GpuProfilingPopRange();
       }
@@ -373,7 +381,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
       {
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
          hypre_GpuProfilingPushRange("Coarse solve");
+         hypre_ProfilerBegin(profiler, level, HYPRE_AMG_PROFILE_COARSE_SOLVE);
          hypre_SLUDistSolve(hypre_ParAMGDataDSLUSolver(amg_data), Aux_F, Aux_U);
+         hypre_ProfilerEnd(profiler, level, HYPRE_AMG_PROFILE_COARSE_SOLVE);
          HYPRE_ANNOTATE_REGION_END("%s", "Coarse solve");
          hypre_GpuProfilingPopRange();
       }
@@ -385,6 +395,18 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          *-----------------------------------------------------------------*/
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Relaxation");
          hypre_GpuProfilingPushRange("Relaxation");
+         profile_phase = (num_levels > 1 && level == num_levels - 1) ?
+                         HYPRE_AMG_PROFILE_COARSE_SOLVE : HYPRE_AMG_PROFILE_RELAX;
+         hypre_ProfilerBegin(profiler, level, profile_phase);
+
+         /* the overlap ordering is kept in amg_data (A_array[0] is the user's
+          * matrix), so hand it to the smoothers for this level only */
+         if (overlap_orderings)
+         {
+            hypre_ParCSRMatrixOverlapOrdering(A_array[level]) = overlap_orderings[level];
+            hypre_ParCSRMatrixNumInteriorRows(A_array[level]) =
+               hypre_ParAMGDataNumInteriorRows(amg_data)[level];
+         }
 
          for (jj = 0; jj < cg_num_sweep; jj++)
          {
@@ -603,6 +625,11 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
                if (Solve_err_flag != 0)
                {
+                  if (overlap_orderings)
+                  {
+                     hypre_ParCSRMatrixOverlapOrdering(A_array[level]) = NULL;
+                     hypre_ParCSRMatrixNumInteriorRows(A_array[level]) = 0;
+                  }
                   HYPRE_ANNOTATE_REGION_END("%s", "Relaxation");
                   HYPRE_ANNOTATE_MGLEVEL_END(level);
                   HYPRE_ANNOTATE_FUNC_END;
@@ -637,6 +664,15 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
             }
          } /* for (jj = 0; jj < cg_num_sweep; jj++) */
 
+         if (overlap_orderings)
+         {
+            hypre_ParCSRMatrixOverlapOrdering(A_array[level]) = NULL;
+            hypre_ParCSRMatrixNumInteriorRows(A_array[level]) = 0;
+         }
+
+         hypre_ProfilerEnd(profiler, level, profile_phase);
+         hypre_BoomerAMGProfileAddMatvecWork(amg_data, level, profile_phase, A_array[level],
+                                             cg_num_sweep * num_sweep);
          HYPRE_ANNOTATE_REGION_END("%s", "Relaxation");
          hypre_GpuProfilingPopRange();
       }
@@ -667,18 +703,34 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Residual");
          hypre_GpuProfilingPushRange("Residual");
+         hypre_ProfilerBegin(profiler, fine_grid, HYPRE_AMG_PROFILE_RESIDUAL);
          if (block_mode)
          {
             hypre_ParVectorCopy(F_array[fine_grid], Vtemp);
             hypre_ParCSRBlockMatrixMatvec(alpha, A_block_array[fine_grid], U_array[fine_grid],
                                           beta, Vtemp);
          }
+         else if (fused_transfer && !restri_type)
+         {
+            /* residual and restriction with one pass over the rows of A */
+            hypre_ParCSRMatrixResidualRestrict(A_array[fine_grid], U_array[fine_grid],
+                                               F_array[fine_grid], R_array[fine_grid],
+                                               Vtemp, F_array[coarse_grid]);
+         }
          else
          {
             // JSP: avoid unnecessary copy using out-of-place version of SpMV
             hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[fine_grid], U_array[fine_grid],
                                                beta, F_array[fine_grid], Vtemp);
          }
+         hypre_ProfilerEnd(profiler, fine_grid, HYPRE_AMG_PROFILE_RESIDUAL);
+         hypre_BoomerAMGProfileAddMatvecWork(amg_data, fine_grid, HYPRE_AMG_PROFILE_RESIDUAL,
+                                             A_array[fine_grid], 1);
+         if (fused_transfer && !restri_type)
+         {
+            hypre_BoomerAMGProfileAddMatvecWork(amg_data, fine_grid, HYPRE_AMG_PROFILE_RESIDUAL,
+                                                R_array[fine_grid], 1);
+         }
          HYPRE_ANNOTATE_REGION_END("%s", "Residual");
          hypre_GpuProfilingPopRange();
 
@@ -687,6 +739,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
          hypre_GpuProfilingPushRange("Restriction");
+         hypre_ProfilerBegin(profiler, fine_grid, HYPRE_AMG_PROFILE_RESTRICT);
          if (block_mode)
          {
             hypre_ParCSRBlockMatrixMatvecT(alpha, R_block_array[fine_grid], Vtemp,
@@ -700,12 +753,18 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                hypre_ParCSRMatrixMatvec(alpha, R_array[fine_grid], Vtemp,
                                         beta, F_array[coarse_grid]);
             }
-            else
+            else if (!fused_transfer)
             {
                hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
                                          beta, F_array[coarse_grid]);
             }
          }
+         hypre_ProfilerEnd(profiler, fine_grid, HYPRE_AMG_PROFILE_RESTRICT);
+         if (!fused_transfer || restri_type)
+         {
+            hypre_BoomerAMGProfileAddMatvecWork(amg_data, fine_grid, HYPRE_AMG_PROFILE_RESTRICT,
+                                                R_array[fine_grid], 1);
+         }
          HYPRE_ANNOTATE_REGION_END("%s", "Restriction");
          HYPRE_ANNOTATE_MGLEVEL_END(level);
          hypre_GpuProfilingPopRange();
@@ -740,6 +799,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Interpolation");
          hypre_GpuProfilingPushRange("Interpolation");
+         hypre_ProfilerBegin(profiler, fine_grid, HYPRE_AMG_PROFILE_INTERP);
          if (block_mode)
          {
             hypre_ParCSRBlockMatrixMatvec(alpha, P_block_array[fine_grid],
@@ -749,14 +809,25 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          else
          {
             /* printf("Proc %d: level %d, n %d, Interpolation\n", my_id, level, local_size); */
-            hypre_ParCSRMatrixMatvec(alpha, P_array[fine_grid],
-                                     U_array[coarse_grid],
-                                     beta, U_array[fine_grid]);
+            if (fused_transfer)
+            {
+               hypre_ParCSRMatrixProlongCorrect(P_array[fine_grid], U_array[coarse_grid],
+                                                U_array[fine_grid]);
+            }
+            else
+            {
+               hypre_ParCSRMatrixMatvec(alpha, P_array[fine_grid],
+                                        U_array[coarse_grid],
+                                        beta, U_array[fine_grid]);
+            }
             /* printf("Proc %d: level %d, n %d, Interpolation done\n", my_id, level, local_size); */
          }
 
          hypre_ParVectorAllZeros(U_array[fine_grid]) = 0;
 
+         hypre_ProfilerEnd(profiler, fine_grid, HYPRE_AMG_PROFILE_INTERP);
+         hypre_BoomerAMGProfileAddMatvecWork(amg_data, fine_grid, HYPRE_AMG_PROFILE_INTERP,
+                                             P_array[fine_grid], 1);
          HYPRE_ANNOTATE_REGION_END("%s", "Interpolation");
          HYPRE_ANNOTATE_MGLEVEL_END(level);
          hypre_GpuProfilingPopRange();
@@ -86,6 +86,12 @@ hypre_ILUCreate( void )
    hypre_ParILUDataNLU(ilu_data)                          = 0;
    hypre_ParILUDataNI(ilu_data)                           = 0;
    hypre_ParILUDataUEnd(ilu_data)                         = NULL;
+   hypre_ParILUDataLowerNumLevels(ilu_data)               = 0;
+   hypre_ParILUDataLowerLevelPtr(ilu_data)                = NULL;
+   hypre_ParILUDataLowerLevelRows(ilu_data)               = NULL;
+   hypre_ParILUDataUpperNumLevels(ilu_data)               = 0;
+   hypre_ParILUDataUpperLevelPtr(ilu_data)                = NULL;
+   hypre_ParILUDataUpperLevelRows(ilu_data)               = NULL;
 
    /* reordering_type default to use local RCM */
    hypre_ParILUDataReorderingType(ilu_data)               = 1;
@@ -192,6 +198,12 @@ hypre_ILUDestroy( void *data )
       /* u_end */
       hypre_TFree( hypre_ParILUDataUEnd(ilu_data), HYPRE_MEMORY_HOST );
 
+      /* level schedules */
+      hypre_TFree( hypre_ParILUDataLowerLevelPtr(ilu_data), HYPRE_MEMORY_HOST );
+      hypre_TFree( hypre_ParILUDataLowerLevelRows(ilu_data), HYPRE_MEMORY_HOST );
+      hypre_TFree( hypre_ParILUDataUpperLevelPtr(ilu_data), HYPRE_MEMORY_HOST );
+      hypre_TFree( hypre_ParILUDataUpperLevelRows(ilu_data), HYPRE_MEMORY_HOST );
+
       /* Factors */
       hypre_ParCSRMatrixDestroy( hypre_ParILUDataMatS(ilu_data) );
       hypre_ParCSRMatrixDestroy( hypre_ParILUDataMatL(ilu_data) );
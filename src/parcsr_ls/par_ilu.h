@@ -51,6 +51,14 @@ typedef struct hypre_ParILUData_struct
    HYPRE_Int             nI;
    HYPRE_Int            *u_end; /* used when schur block is formed */
 
+   /* level schedules of L and U for threaded host triangular solves */
+   HYPRE_Int             lower_num_levels;
+   HYPRE_Int            *lower_level_ptr;
+   HYPRE_Int            *lower_level_rows;
+   HYPRE_Int             upper_num_levels;
+   HYPRE_Int            *upper_level_ptr;
+   HYPRE_Int            *upper_level_rows;
+
    /* temp vectors for solve phase */
    hypre_ParVector      *Utemp;
    hypre_ParVector      *Ftemp;
@@ -179,6 +187,12 @@ typedef struct hypre_ParILUData_struct
 #define hypre_ParILUDataNLU(ilu_data)                          ((ilu_data) -> nLU)
 #define hypre_ParILUDataNI(ilu_data)                           ((ilu_data) -> nI)
 #define hypre_ParILUDataUEnd(ilu_data)                         ((ilu_data) -> u_end)
+#define hypre_ParILUDataLowerNumLevels(ilu_data)               ((ilu_data) -> lower_num_levels)
+#define hypre_ParILUDataLowerLevelPtr(ilu_data)                ((ilu_data) -> lower_level_ptr)
+#define hypre_ParILUDataLowerLevelRows(ilu_data)               ((ilu_data) -> lower_level_rows)
+#define hypre_ParILUDataUpperNumLevels(ilu_data)               ((ilu_data) -> upper_num_levels)
+#define hypre_ParILUDataUpperLevelPtr(ilu_data)                ((ilu_data) -> upper_level_ptr)
+#define hypre_ParILUDataUpperLevelRows(ilu_data)               ((ilu_data) -> upper_level_rows)
 #define hypre_ParILUDataUTemp(ilu_data)                        ((ilu_data) -> Utemp)
 #define hypre_ParILUDataFTemp(ilu_data)                        ((ilu_data) -> Ftemp)
 #define hypre_ParILUDataXTemp(ilu_data)                        ((ilu_data) -> Xtemp)
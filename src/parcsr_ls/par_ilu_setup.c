@@ -190,7 +190,13 @@ hypre_ILUSetup( void               *ilu_vdata,
    hypre_TFree(hypre_ParILUDataUExt(ilu_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParILUDataFExt(ilu_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParILUDataUEnd(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLowerLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLowerLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelRows(ilu_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParILUDataRelResNorms(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_ParILUDataLowerNumLevels(ilu_data) = 0;
+   hypre_ParILUDataUpperNumLevels(ilu_data) = 0;
 
    hypre_ParILUDataUTemp(ilu_data) = NULL;
    hypre_ParILUDataFTemp(ilu_data) = NULL;
@@ -525,6 +531,38 @@ hypre_ILUSetup( void               *ilu_vdata,
       hypre_ParVectorInitialize(Ztemp);
    }
 
+   /* Build level schedules of the local factors for threaded host triangular solves.
+      They are dropped when the levels are too narrow to keep the threads busy */
+   if (matL && matU && hypre_NumThreads() > 1 &&
+       (((ilu_type == 0 || ilu_type == 1) && tri_solve == 1) ||
+        ilu_type == 10 || ilu_type == 11 || ilu_type == 40 || ilu_type == 41))
+   {
+#if defined(HYPRE_USING_GPU)
+      if (exec == HYPRE_EXEC_HOST)
+#endif
+      {
+         hypre_ILUSetupLevelSchedule(hypre_ParCSRMatrixDiag(matL), nLU, 1,
+                                     &hypre_ParILUDataLowerNumLevels(ilu_data),
+                                     &hypre_ParILUDataLowerLevelPtr(ilu_data),
+                                     &hypre_ParILUDataLowerLevelRows(ilu_data));
+         hypre_ILUSetupLevelSchedule(hypre_ParCSRMatrixDiag(matU), nLU, 0,
+                                     &hypre_ParILUDataUpperNumLevels(ilu_data),
+                                     &hypre_ParILUDataUpperLevelPtr(ilu_data),
+                                     &hypre_ParILUDataUpperLevelRows(ilu_data));
+
+         if (hypre_ParILUDataLowerNumLevels(ilu_data) * hypre_NumThreads() > nLU ||
+             hypre_ParILUDataUpperNumLevels(ilu_data) * hypre_NumThreads() > nLU)
+         {
+            hypre_TFree(hypre_ParILUDataLowerLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+            hypre_TFree(hypre_ParILUDataLowerLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+            hypre_TFree(hypre_ParILUDataUpperLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+            hypre_TFree(hypre_ParILUDataUpperLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+            hypre_ParILUDataLowerNumLevels(ilu_data) = 0;
+            hypre_ParILUDataUpperNumLevels(ilu_data) = 0;
+         }
+      }
+   }
+
    /* setup Schur solver - TODO (VPM): merge host and device paths below */
    switch (ilu_type)
    {
@@ -2101,6 +2139,89 @@ hypre_ILUSetupRAPILU0(hypre_ParCSRMatrix  *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ILUSetupLevelSchedule
+ *
+ * Build a level schedule of the local triangular factor LU_diag for
+ * threaded host triangular solves. Rows in the same level do not depend
+ * on each other and can be processed concurrently, levels are processed
+ * in order.
+ *
+ * LU_diag = diagonal block of L (lower = 1) or U (lower = 0), without
+ *           the diagonal entries
+ * nLU = number of rows to schedule. Columns >= nLU are not dependencies.
+ * num_levels = number of levels
+ * level_ptr = start of each level in level_rows (size num_levels + 1)
+ * level_rows = rows sorted by level, in increasing order within a level
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSetupLevelSchedule(hypre_CSRMatrix  *LU_diag,
+                            HYPRE_Int         nLU,
+                            HYPRE_Int         lower,
+                            HYPRE_Int        *num_levels_ptr,
+                            HYPRE_Int       **level_ptr_ptr,
+                            HYPRE_Int       **level_rows_ptr)
+{
+   HYPRE_Int   *LU_diag_i  = hypre_CSRMatrixI(LU_diag);
+   HYPRE_Int   *LU_diag_j  = hypre_CSRMatrixJ(LU_diag);
+   HYPRE_Int    num_levels = 0;
+   HYPRE_Int   *level_ptr;
+   HYPRE_Int   *level_rows;
+   HYPRE_Int   *level;
+   HYPRE_Int    i, ii, j, col, lev;
+
+   level = hypre_TAlloc(HYPRE_Int, nLU, HYPRE_MEMORY_HOST);
+
+   /* The level of a row is one more than the largest level it depends on.
+      L rows depend on smaller rows and U rows on larger ones, so a single
+      sweep in the direction of the solve finds all levels */
+   for (ii = 0; ii < nLU; ii++)
+   {
+      i   = lower ? ii : nLU - 1 - ii;
+      lev = 0;
+      for (j = LU_diag_i[i]; j < LU_diag_i[i + 1]; j++)
+      {
+         col = LU_diag_j[j];
+         if (col != i && col < nLU && level[col] >= lev)
+         {
+            lev = level[col] + 1;
+         }
+      }
+      level[i]   = lev;
+      num_levels = hypre_max(num_levels, lev + 1);
+   }
+
+   /* Bucket rows by level */
+   level_ptr  = hypre_CTAlloc(HYPRE_Int, num_levels + 1, HYPRE_MEMORY_HOST);
+   level_rows = hypre_TAlloc(HYPRE_Int, nLU, HYPRE_MEMORY_HOST);
+   for (i = 0; i < nLU; i++)
+   {
+      level_ptr[level[i] + 1]++;
+   }
+   for (lev = 0; lev < num_levels; lev++)
+   {
+      level_ptr[lev + 1] += level_ptr[lev];
+   }
+   for (i = 0; i < nLU; i++)
+   {
+      level_rows[level_ptr[level[i]]++] = i;
+   }
+   for (lev = num_levels; lev > 0; lev--)
+   {
+      level_ptr[lev] = level_ptr[lev - 1];
+   }
+   level_ptr[0] = 0;
+
+   hypre_TFree(level, HYPRE_MEMORY_HOST);
+
+   *num_levels_ptr = num_levels;
+   *level_ptr_ptr  = level_ptr;
+   *level_rows_ptr = level_rows;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ILUSetupILU0
  *
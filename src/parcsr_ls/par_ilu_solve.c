@@ -55,7 +55,6 @@ hypre_ILUSolve( void               *ilu_vdata,
    hypre_ParCSRMatrix   *Aperm              = hypre_ParILUDataAperm(ilu_data);
    hypre_Vector         *Adiag_diag         = hypre_ParILUDataADiagDiag(ilu_data);
    hypre_Vector         *Sdiag_diag         = hypre_ParILUDataSDiagDiag(ilu_data);
-   hypre_ParVector      *Ztemp              = hypre_ParILUDataZTemp(ilu_data);
    HYPRE_Int             test_opt           = hypre_ParILUDataTestOption(ilu_data);
 #endif
 
@@ -72,6 +71,7 @@ hypre_ILUSolve( void               *ilu_vdata,
    hypre_ParVector      *Utemp              = hypre_ParILUDataUTemp(ilu_data);
    hypre_ParVector      *Xtemp              = hypre_ParILUDataXTemp(ilu_data);
    hypre_ParVector      *Ytemp              = hypre_ParILUDataYTemp(ilu_data);
+   hypre_ParVector      *Ztemp              = hypre_ParILUDataZTemp(ilu_data);
    HYPRE_Real           *fext               = hypre_ParILUDataFExt(ilu_data);
    HYPRE_Real           *uext               = hypre_ParILUDataUExt(ilu_data);
    hypre_ParVector      *residual;
@@ -93,6 +93,14 @@ hypre_ILUSolve( void               *ilu_vdata,
    HYPRE_Int             nLU                = hypre_ParILUDataNLU(ilu_data);
    HYPRE_Int            *u_end              = hypre_ParILUDataUEnd(ilu_data);
 
+   /* Level schedules for threaded host triangular solves */
+   HYPRE_Int             lower_num_levels   = hypre_ParILUDataLowerNumLevels(ilu_data);
+   HYPRE_Int            *lower_level_ptr    = hypre_ParILUDataLowerLevelPtr(ilu_data);
+   HYPRE_Int            *lower_level_rows   = hypre_ParILUDataLowerLevelRows(ilu_data);
+   HYPRE_Int             upper_num_levels   = hypre_ParILUDataUpperNumLevels(ilu_data);
+   HYPRE_Int            *upper_level_ptr    = hypre_ParILUDataUpperLevelPtr(ilu_data);
+   HYPRE_Int            *upper_level_rows   = hypre_ParILUDataUpperLevelRows(ilu_data);
+
    /* Schur system solve */
    HYPRE_Solver          schur_solver       = hypre_ParILUDataSchurSolver(ilu_data);
    HYPRE_Solver          schur_precond      = hypre_ParILUDataSchurPrecond(ilu_data);
@@ -272,12 +280,14 @@ hypre_ILUSolve( void               *ilu_vdata,
                if (tri_solve == 1)
                {
                   hypre_ILUSolveLU(matA, F_array, U_array, perm, n,
-                                   matL, matD, matU, Utemp, Ftemp);
+                                   matL, matD, matU, Utemp, Ftemp,
+                                   lower_num_levels, lower_level_ptr, lower_level_rows,
+                                   upper_num_levels, upper_level_ptr, upper_level_rows);
                }
                else
                {
                   hypre_ILUSolveLUIter(matA, F_array, U_array, perm, n,
-                                       matL, matD, matU, Utemp, Ftemp, Xtemp,
+                                       matL, matD, matU, Utemp, Ftemp, Ztemp,
                                        lower_jacobi_iters, upper_jacobi_iters);
                }
             }
@@ -312,7 +322,9 @@ hypre_ILUSolve( void               *ilu_vdata,
             {
                hypre_ILUSolveSchurGMRES(matA, F_array, U_array, perm, perm, nLU,
                                         matL, matD, matU, matS, Utemp, Ftemp,
-                                        schur_solver, schur_precond, rhs, x, u_end);
+                                        schur_solver, schur_precond, rhs, x, u_end,
+                                        lower_num_levels, lower_level_ptr, lower_level_rows,
+                                        upper_num_levels, upper_level_ptr, upper_level_rows);
             }
             break;
 
@@ -357,7 +369,9 @@ hypre_ILUSolve( void               *ilu_vdata,
             /* ddPQ + GMRES + hypre_ilu[k,t]() */
             hypre_ILUSolveSchurGMRES(matA, F_array, U_array, perm, qperm, nLU,
                                      matL, matD, matU, matS, Utemp, Ftemp,
-                                     schur_solver, schur_precond, rhs, x, u_end);
+                                     schur_solver, schur_precond, rhs, x, u_end,
+                                     lower_num_levels, lower_level_ptr, lower_level_rows,
+                                     upper_num_levels, upper_level_ptr, upper_level_rows);
             break;
 
          case 50:
@@ -509,7 +523,13 @@ hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A,
                          HYPRE_Solver        schur_precond,
                          hypre_ParVector    *rhs,
                          hypre_ParVector    *x,
-                         HYPRE_Int          *u_end)
+                         HYPRE_Int          *u_end,
+                         HYPRE_Int           lower_num_levels,
+                         HYPRE_Int          *lower_level_ptr,
+                         HYPRE_Int          *lower_level_rows,
+                         HYPRE_Int           upper_num_levels,
+                         HYPRE_Int          *upper_level_ptr,
+                         HYPRE_Int          *upper_level_rows)
 {
    /* Data objects for L and U */
    hypre_CSRMatrix   *L_diag      = hypre_ParCSRMatrixDiag(L);
@@ -544,13 +564,21 @@ hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A,
     * L solve, solve xi put in u_temp upper
     */
    /* now update with L to solve */
-   for (i = 0 ; i < nLU ; i ++)
+   if (lower_num_levels > 0)
    {
-      utemp_data[qperm[i]] = ftemp_data[perm[i]];
-      k1 = L_diag_i[i] ; k2 = L_diag_i[i + 1];
-      for (j = k1 ; j < k2 ; j ++)
+      hypre_ILUSolveLevelL(lower_num_levels, lower_level_ptr, lower_level_rows,
+                           L_diag, perm, qperm, ftemp_data, utemp_data);
+   }
+   else
+   {
+      for (i = 0 ; i < nLU ; i ++)
       {
-         utemp_data[qperm[i]] -= L_diag_data[j] * utemp_data[qperm[L_diag_j[j]]];
+         utemp_data[qperm[i]] = ftemp_data[perm[i]];
+         k1 = L_diag_i[i] ; k2 = L_diag_i[i + 1];
+         for (j = k1 ; j < k2 ; j ++)
+         {
+            utemp_data[qperm[i]] -= L_diag_data[j] * utemp_data[qperm[L_diag_j[j]]];
+         }
       }
    }
 
@@ -624,15 +652,23 @@ hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A,
 
    /* 5th need to solve UBi*ui = zi */
    /* put result in u_temp upper */
-   for (i = nLU - 1 ; i >= 0 ; i --)
+   if (upper_num_levels > 0)
    {
-      k1 = U_diag_i[i] ; k2 = u_end[i];
-      for (j = k1 ; j < k2 ; j ++)
+      hypre_ILUSolveLevelU(upper_num_levels, upper_level_ptr, upper_level_rows,
+                           U_diag, u_end, D, qperm, utemp_data);
+   }
+   else
+   {
+      for (i = nLU - 1 ; i >= 0 ; i --)
       {
-         col = U_diag_j[j];
-         utemp_data[qperm[i]] -= U_diag_data[j] * utemp_data[qperm[col]];
+         k1 = U_diag_i[i] ; k2 = u_end[i];
+         for (j = k1 ; j < k2 ; j ++)
+         {
+            col = U_diag_j[j];
+            utemp_data[qperm[i]] -= U_diag_data[j] * utemp_data[qperm[col]];
+         }
+         utemp_data[qperm[i]] *= D[i];
       }
-      utemp_data[qperm[i]] *= D[i];
    }
 
    /* done, now everything are in u_temp, update solution */
@@ -807,6 +843,103 @@ hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------
+ * hypre_ILUSolveLevelL
+ *
+ * Level-scheduled forward solve with the unit lower triangular factor L:
+ *    u[qperm[i]] = f[perm[i]] - sum_j L(i,j) u[qperm[j]]
+ * for the rows in level_rows. Rows of a level are independent and are
+ * distributed among threads, levels are separated by barriers.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSolveLevelL(HYPRE_Int        num_levels,
+                     HYPRE_Int       *level_ptr,
+                     HYPRE_Int       *level_rows,
+                     hypre_CSRMatrix *L_diag,
+                     HYPRE_Int       *perm,
+                     HYPRE_Int       *qperm,
+                     HYPRE_Real      *f_data,
+                     HYPRE_Real      *u_data)
+{
+   HYPRE_Real      *L_diag_data = hypre_CSRMatrixData(L_diag);
+   HYPRE_Int       *L_diag_i    = hypre_CSRMatrixI(L_diag);
+   HYPRE_Int       *L_diag_j    = hypre_CSRMatrixJ(L_diag);
+   HYPRE_Real       sum;
+   HYPRE_Int        lev, ii, i, j;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(lev, ii, i, j, sum)
+#endif
+   for (lev = 0; lev < num_levels; lev++)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = level_ptr[lev]; ii < level_ptr[lev + 1]; ii++)
+      {
+         i   = level_rows[ii];
+         sum = f_data[perm[i]];
+         for (j = L_diag_i[i]; j < L_diag_i[i + 1]; j++)
+         {
+            sum -= L_diag_data[j] * u_data[qperm[L_diag_j[j]]];
+         }
+         u_data[qperm[i]] = sum;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_ILUSolveLevelU
+ *
+ * Level-scheduled backward solve with the upper triangular factor U
+ * (D stores the inverse of the diagonal), in place:
+ *    u[qperm[i]] = D[i] * (u[qperm[i]] - sum_j U(i,j) u[qperm[j]])
+ * Only the entries before u_end[i] are used when u_end is not NULL.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSolveLevelU(HYPRE_Int        num_levels,
+                     HYPRE_Int       *level_ptr,
+                     HYPRE_Int       *level_rows,
+                     hypre_CSRMatrix *U_diag,
+                     HYPRE_Int       *u_end,
+                     HYPRE_Real      *D,
+                     HYPRE_Int       *qperm,
+                     HYPRE_Real      *u_data)
+{
+   HYPRE_Real      *U_diag_data = hypre_CSRMatrixData(U_diag);
+   HYPRE_Int       *U_diag_i    = hypre_CSRMatrixI(U_diag);
+   HYPRE_Int       *U_diag_j    = hypre_CSRMatrixJ(U_diag);
+   HYPRE_Real       sum;
+   HYPRE_Int        lev, ii, i, j, k2;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(lev, ii, i, j, k2, sum)
+#endif
+   for (lev = 0; lev < num_levels; lev++)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = level_ptr[lev]; ii < level_ptr[lev + 1]; ii++)
+      {
+         i   = level_rows[ii];
+         k2  = u_end ? u_end[i] : U_diag_i[i + 1];
+         sum = u_data[qperm[i]];
+         for (j = U_diag_i[i]; j < k2; j++)
+         {
+            sum -= U_diag_data[j] * u_data[qperm[U_diag_j[j]]];
+         }
+         u_data[qperm[i]] = D[i] * sum;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------
  * hypre_ILUSolveLU
  *
@@ -827,7 +960,13 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A,
                  HYPRE_Real         *D,
                  hypre_ParCSRMatrix *U,
                  hypre_ParVector    *ftemp,
-                 hypre_ParVector    *utemp)
+                 hypre_ParVector    *utemp,
+                 HYPRE_Int           lower_num_levels,
+                 HYPRE_Int          *lower_level_ptr,
+                 HYPRE_Int          *lower_level_rows,
+                 HYPRE_Int           upper_num_levels,
+                 HYPRE_Int          *upper_level_ptr,
+                 HYPRE_Int          *upper_level_rows)
 {
    /* data objects for L and U */
    hypre_CSRMatrix *L_diag      = hypre_ParCSRMatrixDiag(L);
@@ -856,6 +995,20 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A,
    /* compute residual */
    hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
 
+   /* Threaded level-scheduled solves */
+   if (lower_num_levels > 0 && upper_num_levels > 0)
+   {
+      hypre_ILUSolveLevelL(lower_num_levels, lower_level_ptr, lower_level_rows,
+                           L_diag, perm, perm, ftemp_data, utemp_data);
+      hypre_ILUSolveLevelU(upper_num_levels, upper_level_ptr, upper_level_rows,
+                           U_diag, NULL, D, perm, utemp_data);
+
+      /* Update solution */
+      hypre_ParVectorAxpy(beta, utemp, u);
+
+      return hypre_error_flag;
+   }
+
    /* L solve - Forward solve */
    /* copy rhs to account for diagonal of L (which is identity) */
    for (i = 0; i < nLU; i++)
@@ -954,6 +1107,9 @@ hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A,
    /* copy rhs to account for diagonal of L (which is identity) */
 
    /* Initialize iteration to 0 */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
    for ( i = 0; i < nLU; i++ )
    {
       utemp_data[perm[i]] = 0.0;
@@ -965,6 +1121,9 @@ hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A,
       /* u^{k+1} = f - Lu^k */
 
       /* Do a SpMV with L and save the results in xtemp */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, j, k1, k2, sum) HYPRE_SMP_SCHEDULE
+#endif
       for ( i = 0; i < nLU; i++ )
       {
          sum = 0.0;
@@ -976,6 +1135,9 @@ hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A,
          xtemp_data[i] = sum;
       }
 
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
       for ( i = 0; i < nLU; i++ )
       {
          utemp_data[perm[i]] = ftemp_data[perm[i]] - xtemp_data[i];
@@ -983,6 +1145,9 @@ hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A,
    } /* end jacobi loop */
 
    /* Initialize iteration to 0 */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
    for ( i = 0; i < nLU; i++ )
    {
       /* this should is doable without the permutation */
@@ -996,6 +1161,9 @@ hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A,
       /* u^{k+1} = f - Uu^k */
 
       /* Do a SpMV with U and save the results in xtemp */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, j, k1, k2, sum) HYPRE_SMP_SCHEDULE
+#endif
       for ( i = 0; i < nLU; ++i )
       {
          sum = 0.0;
@@ -1007,6 +1175,9 @@ hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A,
          xtemp_data[i] = sum;
       }
 
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
       for ( i = 0; i < nLU; ++i )
       {
          ftemp_data[perm[i]] = D[i] * (utemp_data[perm[i]] - xtemp_data[i]);
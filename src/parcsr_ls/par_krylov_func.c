@@ -202,6 +202,53 @@ hypre_ParKrylovMassDotpTwo( void *x, void *y,
                                         unroll, (HYPRE_Real *)result_x, (HYPRE_Real *)result_y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovBlockInnerProdStart, hypre_ParKrylovBlockInnerProdFinish
+ *
+ * The handle holds the pending request and the local products, which must
+ * stay alive until the reduction completes.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_MPI_Request  request;
+   HYPRE_Real        *local_result;
+
+} hypre_ParKrylovBlockInnerProdHandle;
+
+void *
+hypre_ParKrylovBlockInnerProdStart( HYPRE_Int   kx,
+                                    void      **x,
+                                    HYPRE_Int   ky,
+                                    void      **y,
+                                    HYPRE_Real *result )
+{
+   hypre_ParKrylovBlockInnerProdHandle *handle;
+
+   handle = hypre_CTAlloc(hypre_ParKrylovBlockInnerProdHandle, 1, HYPRE_MEMORY_HOST);
+   handle -> local_result = hypre_CTAlloc(HYPRE_Real, kx * ky, HYPRE_MEMORY_HOST);
+
+   hypre_ParVectorBlockInnerProdStart(kx, (hypre_ParVector **) x, ky, (hypre_ParVector **) y,
+                                      handle -> local_result, result, &(handle -> request));
+
+   return (void *) handle;
+}
+
+HYPRE_Int
+hypre_ParKrylovBlockInnerProdFinish( void *vhandle )
+{
+   hypre_ParKrylovBlockInnerProdHandle *handle = (hypre_ParKrylovBlockInnerProdHandle *) vhandle;
+
+   if (handle)
+   {
+      hypre_ParVectorBlockInnerProdFinish(&(handle -> request));
+      hypre_TFree(handle -> local_result, HYPRE_MEMORY_HOST);
+      hypre_TFree(handle, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
 
 
 /*--------------------------------------------------------------------------
@@ -196,6 +196,8 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
    HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
    HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
    HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_float         *A_diag_sp     = hypre_CSRMatrixSPData(A_diag);
+   hypre_float         *A_offd_sp     = hypre_CSRMatrixSPData(A_offd);
    hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
    HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
    HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
@@ -271,7 +273,9 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
 #endif
    for (i = 0; i < num_rows; i++)
    {
-      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] :
+                               (A_diag_sp ? (HYPRE_Complex) A_diag_sp[A_diag_i[i]] :
+                                A_diag_data[A_diag_i[i]]);
 
       /*-----------------------------------------------------------
        * If i is of the right type ( C or F or All ) and diagonal is
@@ -281,15 +285,38 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
       if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
       {
          res = f_data[i];
-         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+         if (A_diag_sp)
          {
-            ii = A_diag_j[jj];
-            res -= A_diag_data[jj] * Vtemp_data[ii];
+            /* Single precision coefficients (mixed-precision AMG) */
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               res -= (HYPRE_Complex) A_diag_sp[jj] * Vtemp_data[ii];
+            }
          }
-         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         else
          {
-            ii = A_offd_j[jj];
-            res -= A_offd_data[jj] * v_ext_data[ii];
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               res -= A_diag_data[jj] * Vtemp_data[ii];
+            }
+         }
+         if (A_offd_sp)
+         {
+            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               res -= (HYPRE_Complex) A_offd_sp[jj] * v_ext_data[ii];
+            }
+         }
+         else
+         {
+            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               res -= A_offd_data[jj] * v_ext_data[ii];
+            }
          }
 
          if (Skip_diag)
@@ -721,12 +748,14 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
 
    const HYPRE_Real     one_minus_omega  = 1.0 - omega;
    HYPRE_Int            num_procs, my_id, num_threads, j, num_sends;
+   HYPRE_Int           *overlap_ordering;
+   HYPRE_Int            overlap;
 
 #if defined(HYPRE_USING_PERSISTENT_COMM)
    // JSP: persistent comm can be similarly used for other smoothers
    hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
 #else
-   hypre_ParCSRCommHandle           *comm_handle;
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
    HYPRE_Int                         num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
 #endif
 
@@ -734,6 +763,11 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    hypre_MPI_Comm_rank(comm, &my_id);
    num_threads = forced_seq ? 1 : hypre_NumThreads();
 
+   /* Relax the interior rows while the halo exchange is in flight, if the
+      matrix carries an interior/boundary ordering (single thread only) */
+   overlap_ordering = hypre_ParCSRMatrixOverlapOrdering(A);
+   overlap = (num_procs > 1) && (num_threads == 1) && !Topo_order && (overlap_ordering != NULL);
+
    /* Sanity check */
    if (hypre_ParVectorNumVectors(f) > 1)
    {
@@ -805,11 +839,14 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
       comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
 #endif
 
+      if (!overlap)
+      {
 #if defined(HYPRE_USING_PERSISTENT_COMM)
-      hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_ext_data);
+         hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_ext_data);
 #else
-      hypre_ParCSRCommHandleDestroy(comm_handle);
+         hypre_ParCSRCommHandleDestroy(comm_handle);
 #endif
+      }
 
 #ifdef HYPRE_PROFILE
       hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
@@ -852,7 +889,47 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
       }
    }
 
-   if (num_threads > 1)
+   if (overlap)
+   {
+      const HYPRE_Int num_interior = hypre_ParCSRMatrixNumInteriorRows(A);
+      HYPRE_Int sweep, part;
+
+      for (sweep = 0; sweep < num_sweeps; sweep++)
+      {
+         const HYPRE_Int iorder = num_sweeps == 1 ? gs_order : sweep == 0 ? 1 : -1;
+
+         /* First sweep: interior rows, then boundary rows once the halo is in.
+            The backward sweep of a symmetric pair is the reverse of the forward one. */
+         for (part = 0; part < 2; part++)
+         {
+            const HYPRE_Int interior = (sweep == 0) == (part == 0);
+            const HYPRE_Int jlo = interior ? 0 : num_interior;
+            const HYPRE_Int jhi = interior ? num_interior : num_rows;
+
+            hypre_HybridGaussSeidelRowList(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
+                                           f_data, cf_marker, relax_points, non_scale, relax_weight, omega,
+                                           one_minus_omega, prod, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                           overlap_ordering, iorder > 0 ? jlo : jhi - 1,
+                                           iorder > 0 ? jhi : jlo - 1, iorder, Skip_diag);
+
+            if (sweep == 0 && part == 0)
+            {
+#ifdef HYPRE_PROFILE
+               hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+               hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_ext_data);
+#else
+               hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
+#ifdef HYPRE_PROFILE
+               hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+            }
+         }
+      } /* for (sweep = 0; sweep < num_sweeps; sweep++) */
+   }
+   else if (num_threads > 1)
    {
 #ifdef HYPRE_USING_OPENMP
       #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
@@ -914,7 +991,7 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
             }
          }
       } /* for (sweep = 0; sweep < num_sweeps; sweep++) */
-   } /* if (num_threads > 1) */
+   } /* if (overlap) */
 
 #ifndef HYPRE_USING_PERSISTENT_COMM
    if (num_procs > 1)
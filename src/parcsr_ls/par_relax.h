@@ -504,5 +504,91 @@ hypre_HybridGaussSeidelOrderedNS( HYPRE_Int     *A_diag_i,
    } /* for ( i = ...) */
 }
 
+/* Row-list version (scaled and non-scaled): relaxes rows[j] for j = jbegin, ..., jend - jorder */
+static inline void
+hypre_HybridGaussSeidelRowList( HYPRE_Int     *A_diag_i,
+                                HYPRE_Int     *A_diag_j,
+                                HYPRE_Complex *A_diag_data,
+                                HYPRE_Int     *A_offd_i,
+                                HYPRE_Int     *A_offd_j,
+                                HYPRE_Complex *A_offd_data,
+                                HYPRE_Complex *f_data,
+                                HYPRE_Int     *cf_marker,
+                                HYPRE_Int      relax_points,
+                                HYPRE_Int      non_scale,
+                                HYPRE_Real     relax_weight,
+                                HYPRE_Real     omega,
+                                HYPRE_Real     one_minus_omega,
+                                HYPRE_Real     prod,
+                                HYPRE_Complex *l1_norms,
+                                HYPRE_Complex *u_data,
+                                HYPRE_Complex *v_tmp_data,
+                                HYPRE_Complex *v_ext_data,
+                                HYPRE_Int     *rows,
+                                HYPRE_Int      jbegin,
+                                HYPRE_Int      jend,
+                                HYPRE_Int      jorder,
+                                HYPRE_Int      Skip_diag )
+{
+   HYPRE_Int j;
+   const HYPRE_Complex zero = 0.0;
+
+   for (j = jbegin; j != jend; j += jorder)
+   {
+      const HYPRE_Int     i    = rows[j];
+      const HYPRE_Complex diag = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && diag != zero )
+      {
+         HYPRE_Int jj;
+         HYPRE_Complex res = f_data[i];
+         HYPRE_Complex res0 = 0.0;
+         HYPRE_Complex res2 = 0.0;
+
+         if (non_scale)
+         {
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+            {
+               res -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+            }
+         }
+         else
+         {
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+            {
+               const HYPRE_Int ii = A_diag_j[jj];
+               res0 -= A_diag_data[jj] * u_data[ii];
+               res2 += A_diag_data[jj] * v_tmp_data[ii];
+            }
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            res -= A_offd_data[jj] * v_ext_data[A_offd_j[jj]];
+         }
+
+         if (non_scale)
+         {
+            if (Skip_diag)
+            {
+               u_data[i] = res / diag;
+            }
+            else
+            {
+               u_data[i] += res / diag;
+            }
+         }
+         else
+         {
+            if (Skip_diag)
+            {
+               u_data[i] *= prod;
+            }
+            u_data[i] += relax_weight * (omega * res + res0 + one_minus_omega * res2) / diag;
+         }
+      }
+   } /* for ( j = ...) */
+}
+
 #endif /* #ifndef HYPRE_PAR_RELAX_HEADER */
 
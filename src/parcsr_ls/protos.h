@@ -245,6 +245,21 @@ HYPRE_Int hypre_exchange_interp_data( HYPRE_Int **CF_marker_offd, HYPRE_Int **do
 void hypre_build_interp_colmap(hypre_ParCSRMatrix *P, HYPRE_Int full_off_procNodes,
                                HYPRE_Int *tmp_CF_marker_offd, HYPRE_BigInt *fine_to_coarse_offd);
 
+/* batch_pcg.c */
+void *hypre_BatchPCGCreate ( void );
+HYPRE_Int hypre_BatchPCGDestroy ( void *pcg_vdata );
+HYPRE_Int hypre_BatchPCGSetValues ( void *pcg_vdata, HYPRE_Complex *values );
+HYPRE_Int hypre_BatchPCGSetup ( void *pcg_vdata, HYPRE_Int num_systems, HYPRE_Int num_rows,
+                                HYPRE_Int *ia, HYPRE_Int *ja, HYPRE_Complex *values );
+HYPRE_Int hypre_BatchPCGSolve ( void *pcg_vdata, HYPRE_Complex *b_data, HYPRE_Complex *x_data );
+HYPRE_Int hypre_BatchPCGSetTol ( void *pcg_vdata, HYPRE_Real tol );
+HYPRE_Int hypre_BatchPCGSetMaxIter ( void *pcg_vdata, HYPRE_Int max_iter );
+HYPRE_Int hypre_BatchPCGSetPrecondType ( void *pcg_vdata, HYPRE_Int precond_type );
+HYPRE_Int hypre_BatchPCGGetNumIterations ( void *pcg_vdata, HYPRE_Int *num_iterations );
+HYPRE_Int hypre_BatchPCGGetSystemNumIterations ( void *pcg_vdata, HYPRE_Int *num_iterations );
+HYPRE_Int hypre_BatchPCGGetFinalRelativeResidualNorm ( void *pcg_vdata,
+                                                       HYPRE_Real *relative_residual_norm );
+
 /* block_tridiag.c */
 void *hypre_BlockTridiagCreate ( void );
 HYPRE_Int hypre_BlockTridiagDestroy ( void *data );
@@ -378,6 +393,20 @@ HYPRE_Int HYPRE_AMSFEISetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_P
                               HYPRE_Int numLocalNodes_, HYPRE_Int numNodes_, HYPRE_Real *NodalCoord_ );
 HYPRE_Int HYPRE_AMSFEIDestroy ( HYPRE_Solver solver );
 
+/* HYPRE_batch_pcg.c */
+HYPRE_Int HYPRE_BatchPCGCreate ( HYPRE_Solver *solver );
+HYPRE_Int HYPRE_BatchPCGDestroy ( HYPRE_Solver solver );
+HYPRE_Int HYPRE_BatchPCGSetup ( HYPRE_Solver solver, HYPRE_Int num_systems, HYPRE_Int num_rows,
+                                HYPRE_Int *ia, HYPRE_Int *ja, HYPRE_Complex *values );
+HYPRE_Int HYPRE_BatchPCGSetValues ( HYPRE_Solver solver, HYPRE_Complex *values );
+HYPRE_Int HYPRE_BatchPCGSolve ( HYPRE_Solver solver, HYPRE_Complex *b, HYPRE_Complex *x );
+HYPRE_Int HYPRE_BatchPCGSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
+HYPRE_Int HYPRE_BatchPCGSetMaxIter ( HYPRE_Solver solver, HYPRE_Int max_iter );
+HYPRE_Int HYPRE_BatchPCGSetPrecondType ( HYPRE_Solver solver, HYPRE_Int precond_type );
+HYPRE_Int HYPRE_BatchPCGGetNumIterations ( HYPRE_Solver solver, HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_BatchPCGGetSystemNumIterations ( HYPRE_Solver solver, HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_BatchPCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver, HYPRE_Real *norm );
+
 /* HYPRE_parcsr_amg.c */
 HYPRE_Int HYPRE_BoomerAMGCreate ( HYPRE_Solver *solver );
 HYPRE_Int HYPRE_BoomerAMGDestroy ( HYPRE_Solver solver );
@@ -590,6 +619,12 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision ( HYPRE_Solver solver, HYPRE_Int mixed_precision );
+HYPRE_Int HYPRE_BoomerAMGSetNumericResetup ( HYPRE_Solver solver, HYPRE_Int numeric_resetup );
+HYPRE_Int HYPRE_BoomerAMGSetRelaxOverlap ( HYPRE_Solver solver, HYPRE_Int relax_overlap );
+HYPRE_Int HYPRE_BoomerAMGSetFusedTransfer ( HYPRE_Solver solver, HYPRE_Int fused_transfer );
+HYPRE_Int HYPRE_BoomerAMGSetProfile ( HYPRE_Solver solver, HYPRE_Int profile );
+HYPRE_Int HYPRE_BoomerAMGPrintProfile ( HYPRE_Solver solver, const char *filename );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -756,6 +791,7 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
                                      HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetKDim ( HYPRE_Solver solver, HYPRE_Int k_dim );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS2 ( HYPRE_Solver solver, HYPRE_Int cgs2 );
+HYPRE_Int HYPRE_ParCSRCOGMRESSetPipelined ( HYPRE_Solver solver, HYPRE_Int pipelined );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetMinIter ( HYPRE_Solver solver, HYPRE_Int min_iter );
@@ -1210,6 +1246,10 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetMixedPrecision ( void *data, HYPRE_Int mixed_precision );
+HYPRE_Int hypre_BoomerAMGSetNumericResetup ( void *data, HYPRE_Int numeric_resetup );
+HYPRE_Int hypre_BoomerAMGSetRelaxOverlap ( void *data, HYPRE_Int relax_overlap );
+HYPRE_Int hypre_BoomerAMGSetFusedTransfer ( void *data, HYPRE_Int fused_transfer );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -1220,6 +1260,19 @@ HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int n
 HYPRE_Int hypre_BoomerAMGSetCumNnzAP ( void *data, HYPRE_Real cum_nnz_AP );
 HYPRE_Int hypre_BoomerAMGGetCumNnzAP ( void *data, HYPRE_Real *cum_nnz_AP );
 
+/* par_amg_profile.c */
+HYPRE_Int hypre_BoomerAMGSetProfile ( void *data, HYPRE_Int profile );
+HYPRE_Int hypre_BoomerAMGPrintProfile ( void *data, const char *filename );
+HYPRE_Int hypre_BoomerAMGProfileAddMatvecWork ( void *data, HYPRE_Int level, HYPRE_Int phase,
+                                                hypre_ParCSRMatrix *A, HYPRE_Int num_passes );
+
+/* par_amg_resetup.c */
+HYPRE_Int hypre_BoomerAMGResetupCheck ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                        HYPRE_Int *reuse );
+HYPRE_Int hypre_BoomerAMGResetupCoarseOperators ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGResetupPlansDestroy ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGResetupGalerkinDiff ( void *amg_vdata, HYPRE_Real *rel_diff );
+
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
@@ -1989,6 +2042,9 @@ HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_I
                                          void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
                                        void *result_x, void *result_y );
+void *hypre_ParKrylovBlockInnerProdStart ( HYPRE_Int kx, void **x, HYPRE_Int ky, void **y,
+                                           HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovBlockInnerProdFinish ( void *handle );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
                                    HYPRE_Int unroll);
 HYPRE_Int hypre_ParKrylovCopyVector ( void *x, void *y );
@@ -2481,6 +2537,9 @@ HYPRE_Int hypre_ILUSetupRAPILU0( hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_I
                                  hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **mLptr,
                                  HYPRE_Real **mDptr, hypre_ParCSRMatrix **mUptr,
                                  HYPRE_Int **u_end );
+HYPRE_Int hypre_ILUSetupLevelSchedule( hypre_CSRMatrix *LU_diag, HYPRE_Int nLU, HYPRE_Int lower,
+                                       HYPRE_Int *num_levels_ptr, HYPRE_Int **level_ptr_ptr,
+                                       HYPRE_Int **level_rows_ptr );
 HYPRE_Int hypre_ILUSetupILU0( hypre_ParCSRMatrix  *A, HYPRE_Int *perm, HYPRE_Int *qperm,
                               HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr,
                               HYPRE_Real **Dptr, hypre_ParCSRMatrix **Uptr,
@@ -2544,7 +2603,10 @@ HYPRE_Int hypre_ILUSolveSchurGMRES( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                     hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S,
                                     hypre_ParVector *ftemp, hypre_ParVector *utemp,
                                     HYPRE_Solver schur_solver, HYPRE_Solver schur_precond,
-                                    hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end );
+                                    hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end,
+                                    HYPRE_Int lower_num_levels, HYPRE_Int *lower_level_ptr,
+                                    HYPRE_Int *lower_level_rows, HYPRE_Int upper_num_levels,
+                                    HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows );
 HYPRE_Int hypre_ILUSolveSchurNSH( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                   hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
                                   hypre_ParCSRMatrix *L, HYPRE_Real *D,
@@ -2552,10 +2614,21 @@ HYPRE_Int hypre_ILUSolveSchurNSH( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                   hypre_ParVector *ftemp, hypre_ParVector *utemp,
                                   HYPRE_Solver schur_solver, hypre_ParVector *rhs,
                                   hypre_ParVector *x, HYPRE_Int *u_end );
+HYPRE_Int hypre_ILUSolveLevelL( HYPRE_Int num_levels, HYPRE_Int *level_ptr,
+                                HYPRE_Int *level_rows, hypre_CSRMatrix *L_diag,
+                                HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Real *f_data,
+                                HYPRE_Real *u_data );
+HYPRE_Int hypre_ILUSolveLevelU( HYPRE_Int num_levels, HYPRE_Int *level_ptr,
+                                HYPRE_Int *level_rows, hypre_CSRMatrix *U_diag,
+                                HYPRE_Int *u_end, HYPRE_Real *D, HYPRE_Int *qperm,
+                                HYPRE_Real *u_data );
 HYPRE_Int hypre_ILUSolveLU( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                             hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
                             hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
-                            hypre_ParVector *ftemp, hypre_ParVector *utemp );
+                            hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                            HYPRE_Int lower_num_levels, HYPRE_Int *lower_level_ptr,
+                            HYPRE_Int *lower_level_rows, HYPRE_Int upper_num_levels,
+                            HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows );
 HYPRE_Int hypre_ILUSolveLUIter( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                 hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
                                 hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
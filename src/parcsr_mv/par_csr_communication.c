@@ -408,7 +408,6 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
     *           datatypes need to point to absolute
     *           addresses, e.g. generated using hypre_MPI_Address .
     *--------------------------------------------------------------------*/
-#ifndef HYPRE_WITH_GPU_AWARE_MPI
    switch (job)
    {
       case 1:
@@ -437,6 +436,10 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
          break;
    }
 
+   /* messages sent and their volume, for hypre_Profiler */
+   hypre_ProfilerAddMessages((job % 10 == 2) ? num_recvs : num_sends, (HYPRE_Real) num_send_bytes);
+
+#ifndef HYPRE_WITH_GPU_AWARE_MPI
    hypre_MemoryLocation act_send_memory_location = hypre_GetActualMemLocation(send_memory_location);
 
    if ( act_send_memory_location == hypre_MEMORY_DEVICE ||
@@ -0,0 +1,453 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Fused grid transfer kernels for hypre_ParCSRMatrix:
+ *
+ *    f_c <- P^T * (f - A * u)     (residual + restriction)
+ *    u_f <- u_f + P * u_c         (prolongation + correction)
+ *
+ * Each local row of A (resp. P) is processed once, combining its diag and
+ * offd parts, instead of a diag pass followed by an offd pass over the fine
+ * vector. Rows without offd entries are processed while the halo exchange is
+ * in progress. With a single thread, the residual is not stored: each entry
+ * is scattered into the coarse vector right after it is computed.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixFusedMatvecUsable
+ *
+ * The fused kernels need double precision data on the host and single
+ * vectors. Returns 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixFusedMatvecUsable( hypre_ParCSRMatrix *A,
+                                     hypre_ParVector    *x )
+{
+   hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(A);
+
+   if (hypre_GetExecPolicy2(hypre_ParCSRMatrixMemoryLocation(A),
+                            hypre_ParVectorMemoryLocation(x)) != HYPRE_EXEC_HOST)
+   {
+      return 0;
+   }
+
+   if (hypre_ParVectorNumVectors(x) != 1)
+   {
+      return 0;
+   }
+
+   if (hypre_CSRMatrixSPData(diag) || hypre_CSRMatrixSPData(offd))
+   {
+      return 0;
+   }
+
+   if ((hypre_CSRMatrixNumNonzeros(diag) && !hypre_CSRMatrixData(diag)) ||
+       (hypre_CSRMatrixNumNonzeros(offd) && !hypre_CSRMatrixData(offd)))
+   {
+      return 0;
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixFusedHaloStart
+ *
+ * Starts the exchange of the off-processor entries of x needed by A.
+ * Returns the buffer receiving them; *x_buf_ptr must be freed after
+ * hypre_ParCSRCommHandleDestroy(*comm_handle_ptr).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Complex *
+hypre_ParCSRMatrixFusedHaloStart( hypre_ParCSRMatrix      *A,
+                                  hypre_ParVector         *x,
+                                  hypre_ParCSRCommHandle **comm_handle_ptr,
+                                  HYPRE_Complex          **x_buf_ptr )
+{
+   hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_Complex       *x_data        = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   HYPRE_Complex       *x_buf_data;
+   HYPRE_Complex       *x_ext_data;
+   HYPRE_Int            num_sends, i;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, x);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   x_ext_data = hypre_TAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+   x_buf_data = hypre_TAlloc(HYPRE_Complex,
+                             hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                             HYPRE_MEMORY_HOST);
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for HYPRE_SMP_SCHEDULE
+#endif
+   for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+        i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+        i++)
+   {
+      x_buf_data[i] = x_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   *comm_handle_ptr = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg,
+                                                      HYPRE_MEMORY_HOST, x_buf_data,
+                                                      HYPRE_MEMORY_HOST, x_ext_data);
+   *x_buf_ptr = x_buf_data;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   return x_ext_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixFusedHaloFinish
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatrixFusedHaloFinish( hypre_ParCSRCommHandle *comm_handle,
+                                   HYPRE_Complex         **x_buf_ptr )
+{
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   hypre_TFree(*x_buf_ptr, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixResidualRestrictHost
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixResidualRestrictHost( hypre_ParCSRMatrix *A,
+                                        hypre_ParVector    *u,
+                                        hypre_ParVector    *f,
+                                        hypre_ParCSRMatrix *P,
+                                        hypre_ParVector    *r,
+                                        hypre_ParVector    *f_c )
+{
+   hypre_CSRMatrix        *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int              *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix        *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int              *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int              *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int               num_rows      = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix        *P_diag        = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int              *P_diag_i      = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int              *P_diag_j      = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Complex          *P_diag_data   = hypre_CSRMatrixData(P_diag);
+   hypre_CSRMatrix        *P_offd        = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int              *P_offd_i      = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int              *P_offd_j      = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Complex          *P_offd_data   = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int               num_cols_P    = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int               num_cols_offd_P = hypre_CSRMatrixNumCols(P_offd);
+
+   HYPRE_Complex          *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Complex          *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex          *r_data        = hypre_VectorData(hypre_ParVectorLocalVector(r));
+   HYPRE_Complex          *f_c_data      = hypre_VectorData(hypre_ParVectorLocalVector(f_c));
+
+   hypre_ParCSRCommPkg    *comm_pkg_P;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Complex          *u_ext_data;
+   HYPRE_Complex          *u_buf_data;
+   HYPRE_Complex          *y_tmp_data;
+   HYPRE_Complex          *y_buf_data;
+   HYPRE_Int               num_procs, num_threads, num_sends, pass, i, jj;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A), &num_procs);
+   num_threads = hypre_NumThreads();
+
+   u_ext_data = hypre_ParCSRMatrixFusedHaloStart(A, u, &comm_handle, &u_buf_data);
+
+   /*-----------------------------------------------------------------------
+    * Threaded: one pass for r = f - A*u, then the transposed product
+    *-----------------------------------------------------------------------*/
+
+   if (num_threads > 1)
+   {
+      for (pass = 0; pass < 2; pass++)
+      {
+         if (pass == 1)
+         {
+            hypre_ParCSRMatrixFusedHaloFinish(comm_handle, &u_buf_data);
+         }
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i, jj) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            HYPRE_Complex res;
+
+            /* pass 0: rows without off-processor couplings */
+            if ((A_offd_i[i + 1] > A_offd_i[i]) != pass)
+            {
+               continue;
+            }
+
+            res = f_data[i];
+            for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+            {
+               res -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+            {
+               res -= A_offd_data[jj] * u_ext_data[A_offd_j[jj]];
+            }
+            r_data[i] = res;
+         }
+      }
+      hypre_TFree(u_ext_data, HYPRE_MEMORY_HOST);
+
+      hypre_ParCSRMatrixMatvecT(1.0, P, r, 0.0, f_c);
+
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Single thread: scatter each residual entry into f_c right away
+    *-----------------------------------------------------------------------*/
+
+   comm_pkg_P = hypre_ParCSRMatrixCommPkg(P);
+   if (num_procs > 1 && !comm_pkg_P)
+   {
+      hypre_MatvecCommPkgCreate(P);
+      comm_pkg_P = hypre_ParCSRMatrixCommPkg(P);
+   }
+
+   y_tmp_data = hypre_CTAlloc(HYPRE_Complex, num_cols_offd_P, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_P; i++)
+   {
+      f_c_data[i] = 0.0;
+   }
+
+   for (pass = 0; pass < 2; pass++)
+   {
+      if (pass == 1)
+      {
+         hypre_ParCSRMatrixFusedHaloFinish(comm_handle, &u_buf_data);
+      }
+
+      for (i = 0; i < num_rows; i++)
+      {
+         HYPRE_Complex res;
+
+         if ((A_offd_i[i + 1] > A_offd_i[i]) != pass)
+         {
+            continue;
+         }
+
+         res = f_data[i];
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            res -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            res -= A_offd_data[jj] * u_ext_data[A_offd_j[jj]];
+         }
+
+         for (jj = P_diag_i[i]; jj < P_diag_i[i + 1]; jj++)
+         {
+            f_c_data[P_diag_j[jj]] += P_diag_data[jj] * res;
+         }
+         for (jj = P_offd_i[i]; jj < P_offd_i[i + 1]; jj++)
+         {
+            y_tmp_data[P_offd_j[jj]] += P_offd_data[jj] * res;
+         }
+      }
+   }
+   hypre_TFree(u_ext_data, HYPRE_MEMORY_HOST);
+
+   /* Send the contributions to the coarse rows owned by other processors */
+   if (comm_pkg_P)
+   {
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+      hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg_P, f_c);
+      num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg_P);
+      y_buf_data = hypre_TAlloc(HYPRE_Complex,
+                                hypre_ParCSRCommPkgSendMapStart(comm_pkg_P, num_sends),
+                                HYPRE_MEMORY_HOST);
+
+      comm_handle = hypre_ParCSRCommHandleCreate_v2(2, comm_pkg_P,
+                                                    HYPRE_MEMORY_HOST, y_tmp_data,
+                                                    HYPRE_MEMORY_HOST, y_buf_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+      for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg_P, 0);
+           i < hypre_ParCSRCommPkgSendMapStart(comm_pkg_P, num_sends);
+           i++)
+      {
+         f_c_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg_P, i)] += y_buf_data[i];
+      }
+      hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(y_tmp_data, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixResidualRestrict
+ *
+ * Performs f_c <- P^T * (f - A * u). The local part of r is used as work
+ * space; its contents are undefined on return.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixResidualRestrict( hypre_ParCSRMatrix *A,
+                                    hypre_ParVector    *u,
+                                    hypre_ParVector    *f,
+                                    hypre_ParCSRMatrix *P,
+                                    hypre_ParVector    *r,
+                                    hypre_ParVector    *f_c )
+{
+   if (!hypre_ParCSRMatrixFusedMatvecUsable(A, u) ||
+       !hypre_ParCSRMatrixFusedMatvecUsable(P, f_c))
+   {
+      hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, r);
+      hypre_ParCSRMatrixMatvecT(1.0, P, r, 0.0, f_c);
+
+      return hypre_error_flag;
+   }
+
+   return hypre_ParCSRMatrixResidualRestrictHost(A, u, f, P, r, f_c);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixProlongCorrectHost
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixProlongCorrectHost( hypre_ParCSRMatrix *P,
+                                      hypre_ParVector    *u_c,
+                                      hypre_ParVector    *u_f )
+{
+   hypre_CSRMatrix        *P_diag      = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int              *P_diag_i    = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int              *P_diag_j    = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Complex          *P_diag_data = hypre_CSRMatrixData(P_diag);
+   hypre_CSRMatrix        *P_offd      = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int              *P_offd_i    = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int              *P_offd_j    = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Complex          *P_offd_data = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int               num_rows    = hypre_CSRMatrixNumRows(P_diag);
+
+   HYPRE_Complex          *u_c_data    = hypre_VectorData(hypre_ParVectorLocalVector(u_c));
+   HYPRE_Complex          *u_f_data    = hypre_VectorData(hypre_ParVectorLocalVector(u_f));
+
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Complex          *u_ext_data;
+   HYPRE_Complex          *u_buf_data;
+   HYPRE_Int               pass, i, jj;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   u_ext_data = hypre_ParCSRMatrixFusedHaloStart(P, u_c, &comm_handle, &u_buf_data);
+
+   for (pass = 0; pass < 2; pass++)
+   {
+      if (pass == 1)
+      {
+         hypre_ParCSRMatrixFusedHaloFinish(comm_handle, &u_buf_data);
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, jj) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         HYPRE_Complex corr = 0.0;
+
+         /* pass 0: rows without off-processor couplings */
+         if ((P_offd_i[i + 1] > P_offd_i[i]) != pass)
+         {
+            continue;
+         }
+
+         for (jj = P_diag_i[i]; jj < P_diag_i[i + 1]; jj++)
+         {
+            corr += P_diag_data[jj] * u_c_data[P_diag_j[jj]];
+         }
+         for (jj = P_offd_i[i]; jj < P_offd_i[i + 1]; jj++)
+         {
+            corr += P_offd_data[jj] * u_ext_data[P_offd_j[jj]];
+         }
+         u_f_data[i] += corr;
+      }
+   }
+   hypre_TFree(u_ext_data, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixProlongCorrect
+ *
+ * Performs u_f <- u_f + P * u_c
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixProlongCorrect( hypre_ParCSRMatrix *P,
+                                  hypre_ParVector    *u_c,
+                                  hypre_ParVector    *u_f )
+{
+   if (!hypre_ParCSRMatrixFusedMatvecUsable(P, u_c))
+   {
+      return hypre_ParCSRMatrixMatvec(1.0, P, u_c, 1.0, u_f);
+   }
+
+   return hypre_ParCSRMatrixProlongCorrectHost(P, u_c, u_f);
+}
@@ -110,6 +110,8 @@ hypre_ParCSRMatrixCreate( MPI_Comm      comm,
    hypre_ParCSRMatrixColMapOffd(matrix)       = NULL;
    hypre_ParCSRMatrixDeviceColMapOffd(matrix) = NULL;
    hypre_ParCSRMatrixProcOrdering(matrix)     = NULL;
+   hypre_ParCSRMatrixOverlapOrdering(matrix)  = NULL;
+   hypre_ParCSRMatrixNumInteriorRows(matrix)  = 0;
 
    hypre_ParCSRMatrixAssumedPartition(matrix) = NULL;
    hypre_ParCSRMatrixOwnsAssumedPartition(matrix) = 1;
@@ -434,6 +436,127 @@ hypre_ParCSRMatrixSetNumRownnz( hypre_ParCSRMatrix *matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSellDataInvalidate
+ *
+ * Marks the SELL-C-sigma companions of the diag and offd blocks as out of
+ * date. Must be called after the values of the matrix are changed in place.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSellDataInvalidate( hypre_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSellDataInvalidate(hypre_ParCSRMatrixDiag(matrix));
+   hypre_CSRMatrixSellDataInvalidate(hypre_ParCSRMatrixOffd(matrix));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixOverlapOrderingCreate
+ *
+ * Computes the ordering of the local rows used by relaxation methods that
+ * overlap the halo exchange with computation: first the interior rows, which
+ * have no entries in the offd block, then the boundary rows, each set in
+ * increasing order. The caller owns the returned array, and must recompute it
+ * if the pattern of the offd block changes. Relaxation uses it while it is
+ * set with hypre_ParCSRMatrixOverlapOrdering/NumInteriorRows.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixOverlapOrderingCreate( hypre_ParCSRMatrix  *matrix,
+                                         HYPRE_Int          **ordering_ptr,
+                                         HYPRE_Int           *num_interior_ptr )
+{
+   hypre_CSRMatrix *offd;
+   HYPRE_Int       *offd_i;
+   HYPRE_Int       *ordering;
+   HYPRE_Int        num_rows, num_interior, i, k;
+
+   *ordering_ptr     = NULL;
+   *num_interior_ptr = 0;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   offd     = hypre_ParCSRMatrixOffd(matrix);
+   offd_i   = hypre_CSRMatrixI(offd);
+   num_rows = hypre_CSRMatrixNumRows(offd);
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(offd)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Overlap ordering is only supported on the host\n");
+      return hypre_error_flag;
+   }
+
+   ordering = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+
+   num_interior = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (offd_i[i + 1] == offd_i[i])
+      {
+         ordering[num_interior++] = i;
+      }
+   }
+
+   k = num_interior;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (offd_i[i + 1] > offd_i[i])
+      {
+         ordering[k++] = i;
+      }
+   }
+
+   *ordering_ptr     = ordering;
+   *num_interior_ptr = num_interior;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSPDataSetup
+ *
+ * Stores the values of the local blocks (including the optional transposed
+ * blocks) in single precision for the host matvec. If free_data is nonzero,
+ * the HYPRE_Complex values are released and the matrix can only be used in
+ * matvec and matvecT afterwards.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSPDataSetup( hypre_ParCSRMatrix *matrix,
+                               HYPRE_Int           free_data )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSPDataSetup(hypre_ParCSRMatrixDiag(matrix), free_data);
+   hypre_CSRMatrixSPDataSetup(hypre_ParCSRMatrixOffd(matrix), free_data);
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixSPDataSetup(hypre_ParCSRMatrixDiagT(matrix), free_data);
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixSPDataSetup(hypre_ParCSRMatrixOffdT(matrix), free_data);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixSetDataOwner
  *--------------------------------------------------------------------------*/
@@ -71,6 +71,11 @@ typedef struct hypre_ParCSRMatrix_struct
    /* Array to store ordering of local diagonal block to relax. In particular,
    used for triangulr matrices that are not ordered to be triangular. */
    HYPRE_Int            *proc_ordering;
+   /* Local rows ordered as interior rows (empty offd row) first, then
+      boundary rows. Used by relaxation to overlap the halo exchange. Not
+      owned by the matrix: the caller sets it around the relaxation. */
+   HYPRE_Int            *overlap_ordering;
+   HYPRE_Int             num_interior_rows;
 
    /* Save block diagonal inverse */
    HYPRE_Int             bdiag_size;
@@ -116,6 +121,8 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixOverlapOrdering(matrix)        ((matrix) -> overlap_ordering)
+#define hypre_ParCSRMatrixNumInteriorRows(matrix)        ((matrix) -> num_interior_rows)
 #if defined(HYPRE_USING_GPU)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -215,4 +222,78 @@ typedef struct
 #define hypre_ParCSRBooleanMatrix_Get_Rowindices(matrix)    ((matrix)->rowindices)
 #define hypre_ParCSRBooleanMatrix_Get_Getrowactive(matrix)  ((matrix)->getrowactive)
 
+/*--------------------------------------------------------------------------
+ * Product plan for C = A * B on the host
+ *
+ * Caches the structure of the product (the pattern of C, the split of the
+ * external rows of B, and a communication package that moves only their
+ * values), so that products with the same sparsity patterns only need the
+ * numeric phase. See hypre_ParCSRMatMatSymbolicHost.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* Sizes used to check that the patterns did not change */
+   HYPRE_Int             num_nnz_A_diag;
+   HYPRE_Int             num_nnz_A_offd;
+   HYPRE_Int             num_nnz_B_diag;
+   HYPRE_Int             num_nnz_B_offd;
+   size_t                pattern_key;
+
+   /* Values-only exchange of the external rows of B */
+   hypre_ParCSRCommPkg  *comm_pkg;
+   HYPRE_Int             num_send_rows;
+   HYPRE_Int            *send_rows;
+   HYPRE_Complex        *send_data;
+   HYPRE_Complex        *recv_data;
+
+   /* recv entry k goes to Bext_diag (ext_map[k] >= 0) or to Bext_offd
+      at position -ext_map[k]-1 */
+   HYPRE_Int            *ext_map;
+   hypre_CSRMatrix      *Bext_diag;
+   hypre_CSRMatrix      *Bext_offd;
+
+   /* map from the offd columns of B to the offd columns of C */
+   HYPRE_Int             num_cols_offd_B;
+   HYPRE_Int            *map_B_to_C;
+
+} hypre_ParCSRMatMatPlan;
+
+#define hypre_ParCSRMatMatPlanNumNnzADiag(plan)   ((plan) -> num_nnz_A_diag)
+#define hypre_ParCSRMatMatPlanNumNnzAOffd(plan)   ((plan) -> num_nnz_A_offd)
+#define hypre_ParCSRMatMatPlanNumNnzBDiag(plan)   ((plan) -> num_nnz_B_diag)
+#define hypre_ParCSRMatMatPlanNumNnzBOffd(plan)   ((plan) -> num_nnz_B_offd)
+#define hypre_ParCSRMatMatPlanPatternKey(plan)    ((plan) -> pattern_key)
+#define hypre_ParCSRMatMatPlanCommPkg(plan)       ((plan) -> comm_pkg)
+#define hypre_ParCSRMatMatPlanNumSendRows(plan)   ((plan) -> num_send_rows)
+#define hypre_ParCSRMatMatPlanSendRows(plan)      ((plan) -> send_rows)
+#define hypre_ParCSRMatMatPlanSendData(plan)      ((plan) -> send_data)
+#define hypre_ParCSRMatMatPlanRecvData(plan)      ((plan) -> recv_data)
+#define hypre_ParCSRMatMatPlanExtMap(plan)        ((plan) -> ext_map)
+#define hypre_ParCSRMatMatPlanBextDiag(plan)      ((plan) -> Bext_diag)
+#define hypre_ParCSRMatMatPlanBextOffd(plan)      ((plan) -> Bext_offd)
+#define hypre_ParCSRMatMatPlanNumColsOffdB(plan)  ((plan) -> num_cols_offd_B)
+#define hypre_ParCSRMatMatPlanMapBToC(plan)       ((plan) -> map_B_to_C)
+
+/*--------------------------------------------------------------------------
+ * Product plan for C = R^T * A * P on the host
+ *
+ * Two hypre_ParCSRMatMatPlan (for A*P and R^T*(A*P)) plus the transpose of
+ * R and the intermediate product, which are kept between numeric phases.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatrix     *RT;
+   hypre_ParCSRMatrix     *AP;
+   hypre_ParCSRMatMatPlan *AP_plan;
+   hypre_ParCSRMatMatPlan *RAP_plan;
+
+} hypre_ParCSRRAPPlan;
+
+#define hypre_ParCSRRAPPlanRT(plan)        ((plan) -> RT)
+#define hypre_ParCSRRAPPlanAP(plan)        ((plan) -> AP)
+#define hypre_ParCSRRAPPlanAPPlan(plan)    ((plan) -> AP_plan)
+#define hypre_ParCSRRAPPlanRAPPlan(plan)   ((plan) -> RAP_plan)
+
 #endif
@@ -0,0 +1,616 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Symbolic/numeric split of the host ParCSR matrix products.
+ *
+ * The symbolic phase computes the product as hypre_ParCSRMatMatHost does and
+ * keeps its structure in a product plan: the sparsity pattern of C, the split
+ * of the external rows of B into diag and offd parts, and a communication
+ * package for the values of these rows. The numeric phase then recomputes the
+ * values of C in place for new values of A and B with the same patterns,
+ * exchanging only the values of the external rows of B and overlapping this
+ * communication with the local products.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatPlanDestroy( hypre_ParCSRMatMatPlan *plan )
+{
+   if (plan)
+   {
+      if (hypre_ParCSRMatMatPlanCommPkg(plan))
+      {
+         hypre_MatvecCommPkgDestroy(hypre_ParCSRMatMatPlanCommPkg(plan));
+      }
+      hypre_TFree(hypre_ParCSRMatMatPlanSendRows(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanSendData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanRecvData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanExtMap(plan), HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatMatPlanBextDiag(plan));
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatMatPlanBextOffd(plan));
+      hypre_TFree(hypre_ParCSRMatMatPlanMapBToC(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPatternKey
+ *
+ * Hash of the sparsity patterns of A and B (including the global indices of
+ * their offd columns), used to detect pattern changes between phases.
+ *--------------------------------------------------------------------------*/
+
+static size_t
+hypre_ParCSRMatMatPatternKey( hypre_ParCSRMatrix *A,
+                              hypre_ParCSRMatrix *B )
+{
+   hypre_ParCSRMatrix *M;
+   hypre_CSRMatrix    *parts[2];
+   HYPRE_BigInt       *col_map_offd;
+   size_t              key = 0;
+   HYPRE_Int           m, p, i, num_rows, num_nnz, num_cols_offd;
+
+   for (m = 0; m < 2; m++)
+   {
+      M = m ? B : A;
+      parts[0] = hypre_ParCSRMatrixDiag(M);
+      parts[1] = hypre_ParCSRMatrixOffd(M);
+      for (p = 0; p < 2; p++)
+      {
+         num_rows = hypre_CSRMatrixNumRows(parts[p]);
+         num_nnz  = hypre_CSRMatrixNumNonzeros(parts[p]);
+         for (i = 0; i <= num_rows && hypre_CSRMatrixI(parts[p]); i++)
+         {
+            key = 31 * key + (size_t) hypre_CSRMatrixI(parts[p])[i];
+         }
+         for (i = 0; i < num_nnz; i++)
+         {
+            key = 31 * key + (size_t) hypre_CSRMatrixJ(parts[p])[i];
+         }
+      }
+
+      col_map_offd  = hypre_ParCSRMatrixColMapOffd(M);
+      num_cols_offd = hypre_CSRMatrixNumCols(parts[1]);
+      for (i = 0; i < num_cols_offd; i++)
+      {
+         key = 31 * key + (size_t) col_map_offd[i];
+      }
+   }
+
+   return key;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanMatches
+ *
+ * Returns 1 if the product plan can be used for the numeric phase of A * B,
+ * i.e., the sparsity patterns of A and B did not change since the symbolic
+ * phase, and 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatPlanMatches( hypre_ParCSRMatMatPlan *plan,
+                               hypre_ParCSRMatrix     *A,
+                               hypre_ParCSRMatrix     *B )
+{
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *B_offd = hypre_ParCSRMatrixOffd(B);
+
+   if (!plan)
+   {
+      return 0;
+   }
+
+   if (hypre_ParCSRMatMatPlanNumNnzADiag(plan) !=
+       hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A)) ||
+       hypre_ParCSRMatMatPlanNumNnzAOffd(plan) != hypre_CSRMatrixNumNonzeros(A_offd) ||
+       hypre_ParCSRMatMatPlanNumNnzBDiag(plan) !=
+       hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(B)) ||
+       hypre_ParCSRMatMatPlanNumNnzBOffd(plan) != hypre_CSRMatrixNumNonzeros(B_offd) ||
+       hypre_ParCSRMatMatPlanNumColsOffdB(plan) != hypre_CSRMatrixNumCols(B_offd))
+   {
+      return 0;
+   }
+
+   if (hypre_ParCSRMatMatPlanBextDiag(plan) &&
+       hypre_CSRMatrixNumRows(hypre_ParCSRMatMatPlanBextDiag(plan)) !=
+       hypre_CSRMatrixNumCols(A_offd))
+   {
+      return 0;
+   }
+
+   if (hypre_ParCSRMatMatPlanPatternKey(plan) != hypre_ParCSRMatMatPatternKey(A, B))
+   {
+      return 0;
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatSymbolicHost
+ *
+ * Computes C = A * B (same result as hypre_ParCSRMatMatHost) and returns in
+ * *plan_ptr the product plan for subsequent calls to
+ * hypre_ParCSRMatMatNumericHost.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRMatMatSymbolicHost( hypre_ParCSRMatrix      *A,
+                                hypre_ParCSRMatrix      *B,
+                                hypre_ParCSRMatMatPlan **plan_ptr )
+{
+   MPI_Comm                comm            = hypre_ParCSRMatrixComm(A);
+
+   hypre_CSRMatrix        *A_diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int               num_rows_diag_A = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int               num_cols_diag_A = hypre_CSRMatrixNumCols(A_diag);
+
+   hypre_CSRMatrix        *B_diag          = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix        *B_offd          = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int              *B_diag_i        = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int              *B_offd_i        = hypre_CSRMatrixI(B_offd);
+   HYPRE_BigInt           *col_map_offd_B  = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_BigInt            first_col_diag_B = hypre_ParCSRMatrixFirstColDiag(B);
+   HYPRE_Int               num_rows_diag_B = hypre_CSRMatrixNumRows(B_diag);
+   HYPRE_Int               num_cols_diag_B = hypre_CSRMatrixNumCols(B_diag);
+   HYPRE_Int               num_cols_offd_B = hypre_CSRMatrixNumCols(B_offd);
+   HYPRE_BigInt            last_col_diag_B = first_col_diag_B + num_cols_diag_B - 1;
+
+   hypre_ParCSRMatMatPlan *plan;
+   hypre_ParCSRCommPkg    *comm_pkg_A;
+   hypre_ParCSRMatrix     *C;
+   hypre_CSRMatrix        *C_diag, *C_offd;
+   HYPRE_BigInt           *col_map_offd_C = NULL;
+   HYPRE_Int               num_cols_offd_C = 0;
+
+   hypre_CSRMatrix        *Bs_ext, *Bext_diag, *Bext_offd;
+   hypre_CSRMatrix        *AB_diag, *AB_offd, *ABext_diag, *ABext_offd;
+   HYPRE_Int              *Bs_ext_i, *ext_map, *map_B_to_C = NULL;
+   HYPRE_BigInt           *Bs_ext_j;
+   HYPRE_Int              *AB_offd_j;
+
+   HYPRE_Int               num_sends, num_recvs, num_send_rows, num_nnz_send, num_nnz_recv;
+   HYPRE_Int              *send_rows, *send_starts, *recv_starts, *send_procs, *recv_procs;
+   HYPRE_Int              *recv_vec_starts;
+   HYPRE_Int               cnt_diag, cnt_offd;
+   HYPRE_Int               num_procs, i, j, k, cnt;
+
+   *plan_ptr = NULL;
+
+   if (hypre_ParCSRMatrixGlobalNumCols(A) != hypre_ParCSRMatrixGlobalNumRows(B) ||
+       num_cols_diag_A != num_rows_diag_B)
+   {
+      hypre_error_in_arg(1);
+      hypre_printf(" Error! Incompatible matrix dimensions!\n");
+      return NULL;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   plan = hypre_CTAlloc(hypre_ParCSRMatMatPlan, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatMatPlanNumNnzADiag(plan)  = hypre_CSRMatrixNumNonzeros(A_diag);
+   hypre_ParCSRMatMatPlanNumNnzAOffd(plan)  = hypre_CSRMatrixNumNonzeros(A_offd);
+   hypre_ParCSRMatMatPlanNumNnzBDiag(plan)  = hypre_CSRMatrixNumNonzeros(B_diag);
+   hypre_ParCSRMatMatPlanNumNnzBOffd(plan)  = hypre_CSRMatrixNumNonzeros(B_offd);
+   hypre_ParCSRMatMatPlanNumColsOffdB(plan) = num_cols_offd_B;
+   hypre_ParCSRMatMatPlanPatternKey(plan)   = hypre_ParCSRMatMatPatternKey(A, B);
+
+   if (num_procs > 1)
+   {
+      if (!hypre_ParCSRMatrixCommPkg(A))
+      {
+         hypre_MatvecCommPkgCreate(A);
+      }
+      comm_pkg_A      = hypre_ParCSRMatrixCommPkg(A);
+      num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+      num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg_A);
+      recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_A);
+      num_send_rows   = hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, num_sends);
+
+      Bs_ext   = hypre_ParCSRMatrixExtractBExt(B, A, 1);
+      Bs_ext_i = hypre_CSRMatrixI(Bs_ext);
+      Bs_ext_j = hypre_CSRMatrixBigJ(Bs_ext);
+      num_nnz_recv = Bs_ext_i[hypre_CSRMatrixNumRows(Bs_ext)];
+
+      /*-----------------------------------------------------------------------
+       * Communication package for the values of the external rows. The rows
+       * are sent as in hypre_ParcsrGetExternalRowsInit: diag entries first,
+       * then offd entries.
+       *-----------------------------------------------------------------------*/
+
+      send_rows   = hypre_TAlloc(HYPRE_Int, num_send_rows, HYPRE_MEMORY_HOST);
+      send_starts = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+      recv_starts = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+      send_procs  = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+      recv_procs  = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+
+      num_nnz_send = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         send_starts[i] = num_nnz_send;
+         send_procs[i]  = hypre_ParCSRCommPkgSendProc(comm_pkg_A, i);
+         for (k = hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, i);
+              k < hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, i + 1); k++)
+         {
+            j = hypre_ParCSRCommPkgSendMapElmt(comm_pkg_A, k);
+            send_rows[k] = j;
+            num_nnz_send += B_diag_i[j + 1] - B_diag_i[j] + B_offd_i[j + 1] - B_offd_i[j];
+         }
+      }
+      send_starts[num_sends] = num_nnz_send;
+
+      for (i = 0; i < num_recvs; i++)
+      {
+         recv_starts[i] = Bs_ext_i[recv_vec_starts[i]];
+         recv_procs[i]  = hypre_ParCSRCommPkgRecvProc(comm_pkg_A, i);
+      }
+      recv_starts[num_recvs] = num_nnz_recv;
+
+      hypre_ParCSRCommPkgCreateAndFill(comm, num_recvs, recv_procs, recv_starts,
+                                       num_sends, send_procs, send_starts, NULL,
+                                       &hypre_ParCSRMatMatPlanCommPkg(plan));
+
+      hypre_ParCSRMatMatPlanNumSendRows(plan) = num_send_rows;
+      hypre_ParCSRMatMatPlanSendRows(plan)    = send_rows;
+      hypre_ParCSRMatMatPlanSendData(plan)    = hypre_TAlloc(HYPRE_Complex, num_nnz_send,
+                                                             HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatMatPlanRecvData(plan)    = hypre_TAlloc(HYPRE_Complex, num_nnz_recv,
+                                                             HYPRE_MEMORY_HOST);
+
+      /*-----------------------------------------------------------------------
+       * Split the external rows and record where each received entry goes
+       *-----------------------------------------------------------------------*/
+
+      hypre_CSRMatrixSplit(Bs_ext, first_col_diag_B, last_col_diag_B, num_cols_offd_B, col_map_offd_B,
+                           &num_cols_offd_C, &col_map_offd_C, &Bext_diag, &Bext_offd);
+
+      ext_map  = hypre_TAlloc(HYPRE_Int, num_nnz_recv, HYPRE_MEMORY_HOST);
+      cnt_diag = 0;
+      cnt_offd = 0;
+      for (k = 0; k < num_nnz_recv; k++)
+      {
+         if (Bs_ext_j[k] < first_col_diag_B || Bs_ext_j[k] > last_col_diag_B)
+         {
+            ext_map[k] = -(cnt_offd++) - 1;
+         }
+         else
+         {
+            ext_map[k] = cnt_diag++;
+         }
+      }
+      hypre_CSRMatrixDestroy(Bs_ext);
+
+      hypre_ParCSRMatMatPlanExtMap(plan)   = ext_map;
+      hypre_ParCSRMatMatPlanBextDiag(plan) = Bext_diag;
+      hypre_ParCSRMatMatPlanBextOffd(plan) = Bext_offd;
+
+      /*-----------------------------------------------------------------------
+       * Compute the product
+       *-----------------------------------------------------------------------*/
+
+      AB_diag    = hypre_CSRMatrixMultiplyHost(A_diag, B_diag);
+      AB_offd    = hypre_CSRMatrixMultiplyHost(A_diag, B_offd);
+      ABext_diag = hypre_CSRMatrixMultiplyHost(A_offd, Bext_diag);
+      ABext_offd = hypre_CSRMatrixMultiplyHost(A_offd, Bext_offd);
+
+      if (num_cols_offd_B)
+      {
+         map_B_to_C = hypre_CTAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+
+         cnt = 0;
+         for (i = 0; i < num_cols_offd_C; i++)
+         {
+            if (col_map_offd_C[i] == col_map_offd_B[cnt])
+            {
+               map_B_to_C[cnt++] = i;
+               if (cnt == num_cols_offd_B)
+               {
+                  break;
+               }
+            }
+         }
+      }
+      hypre_ParCSRMatMatPlanMapBToC(plan) = map_B_to_C;
+
+      AB_offd_j = hypre_CSRMatrixJ(AB_offd);
+      for (i = 0; i < hypre_CSRMatrixNumNonzeros(AB_offd); i++)
+      {
+         AB_offd_j[i] = map_B_to_C[AB_offd_j[i]];
+      }
+
+      hypre_CSRMatrixNumCols(AB_diag)    = num_cols_diag_B;
+      hypre_CSRMatrixNumCols(ABext_diag) = num_cols_diag_B;
+      hypre_CSRMatrixNumCols(AB_offd)    = num_cols_offd_C;
+      hypre_CSRMatrixNumCols(ABext_offd) = num_cols_offd_C;
+      C_diag = hypre_CSRMatrixAdd(1.0, AB_diag, 1.0, ABext_diag);
+      C_offd = hypre_CSRMatrixAdd(1.0, AB_offd, 1.0, ABext_offd);
+
+      hypre_CSRMatrixDestroy(AB_diag);
+      hypre_CSRMatrixDestroy(ABext_diag);
+      hypre_CSRMatrixDestroy(AB_offd);
+      hypre_CSRMatrixDestroy(ABext_offd);
+   }
+   else
+   {
+      C_diag = hypre_CSRMatrixMultiplyHost(A_diag, B_diag);
+      C_offd = hypre_CSRMatrixCreate(num_rows_diag_A, 0, 0);
+      hypre_CSRMatrixInitialize_v2(C_offd, 0, hypre_CSRMatrixMemoryLocation(C_diag));
+   }
+
+   C = hypre_ParCSRMatrixCreate(comm,
+                                hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixGlobalNumCols(B),
+                                hypre_ParCSRMatrixRowStarts(A),
+                                hypre_ParCSRMatrixColStarts(B),
+                                num_cols_offd_C,
+                                hypre_CSRMatrixNumNonzeros(C_diag),
+                                hypre_CSRMatrixNumNonzeros(C_offd));
+
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiag(C));
+   hypre_ParCSRMatrixDiag(C) = C_diag;
+
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffd(C));
+   hypre_ParCSRMatrixOffd(C) = C_offd;
+
+   if (num_cols_offd_C)
+   {
+      hypre_ParCSRMatrixColMapOffd(C) = col_map_offd_C;
+   }
+
+   *plan_ptr = plan;
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatNumericHost
+ *
+ * Recomputes the values of C = A * B, where C and plan come from
+ * hypre_ParCSRMatMatSymbolicHost and A and B have the same sparsity patterns
+ * as in the symbolic phase. The structure of C is not modified. The local
+ * and external contributions are summed in another order than in
+ * hypre_ParCSRMatMatHost, so the values agree with a new product only up to
+ * rounding errors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatNumericHost( hypre_ParCSRMatMatPlan *plan,
+                               hypre_ParCSRMatrix     *A,
+                               hypre_ParCSRMatrix     *B,
+                               hypre_ParCSRMatrix     *C )
+{
+   hypre_ParCSRCommPkg    *comm_pkg  = hypre_ParCSRMatMatPlanCommPkg(plan);
+
+   hypre_CSRMatrix        *A_diag    = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *A_offd    = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix        *B_diag    = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix        *B_offd    = hypre_ParCSRMatrixOffd(B);
+   hypre_CSRMatrix        *C_diag    = hypre_ParCSRMatrixDiag(C);
+   hypre_CSRMatrix        *C_offd    = hypre_ParCSRMatrixOffd(C);
+
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int              *B_diag_i, *B_offd_i, *send_rows, *ext_map;
+   HYPRE_Complex          *B_diag_a, *B_offd_a, *send_data, *recv_data;
+   HYPRE_Complex          *Bext_diag_a, *Bext_offd_a;
+   HYPRE_Int               num_recvs, num_nnz_recv;
+   HYPRE_Int               i, j, k, m, cnt;
+
+   if (!hypre_ParCSRMatMatPlanMatches(plan, A, B))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "The product plan does not match the patterns of A and B!\n");
+      return hypre_error_flag;
+   }
+
+   if (!comm_pkg)
+   {
+      hypre_CSRMatrixMultiplyNumericHost(A_diag, B_diag, NULL, 0.0, C_diag);
+
+      return hypre_error_flag;
+   }
+
+   /* Pack the values of the rows of B needed by the other processes */
+   B_diag_i  = hypre_CSRMatrixI(B_diag);
+   B_diag_a  = hypre_CSRMatrixData(B_diag);
+   B_offd_i  = hypre_CSRMatrixI(B_offd);
+   B_offd_a  = hypre_CSRMatrixData(B_offd);
+   send_rows = hypre_ParCSRMatMatPlanSendRows(plan);
+   send_data = hypre_ParCSRMatMatPlanSendData(plan);
+   recv_data = hypre_ParCSRMatMatPlanRecvData(plan);
+
+   cnt = 0;
+   for (i = 0; i < hypre_ParCSRMatMatPlanNumSendRows(plan); i++)
+   {
+      j = send_rows[i];
+      for (k = B_diag_i[j]; k < B_diag_i[j + 1]; k++)
+      {
+         send_data[cnt++] = B_diag_a[k];
+      }
+      for (k = B_offd_i[j]; k < B_offd_i[j + 1]; k++)
+      {
+         send_data[cnt++] = B_offd_a[k];
+      }
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, send_data, recv_data);
+
+   /* Local products, overlapped with the communication */
+   hypre_CSRMatrixMultiplyNumericHost(A_diag, B_diag, NULL, 0.0, C_diag);
+   hypre_CSRMatrixMultiplyNumericHost(A_diag, B_offd, hypre_ParCSRMatMatPlanMapBToC(plan),
+                                      0.0, C_offd);
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /* Unpack the external rows */
+   ext_map      = hypre_ParCSRMatMatPlanExtMap(plan);
+   Bext_diag_a  = hypre_CSRMatrixData(hypre_ParCSRMatMatPlanBextDiag(plan));
+   Bext_offd_a  = hypre_CSRMatrixData(hypre_ParCSRMatMatPlanBextOffd(plan));
+   num_recvs    = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   num_nnz_recv = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(k, m) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < num_nnz_recv; k++)
+   {
+      m = ext_map[k];
+      if (m >= 0)
+      {
+         Bext_diag_a[m] = recv_data[k];
+      }
+      else
+      {
+         Bext_offd_a[-m - 1] = recv_data[k];
+      }
+   }
+
+   hypre_CSRMatrixMultiplyNumericHost(A_offd, hypre_ParCSRMatMatPlanBextDiag(plan), NULL,
+                                      1.0, C_diag);
+   hypre_CSRMatrixMultiplyNumericHost(A_offd, hypre_ParCSRMatMatPlanBextOffd(plan), NULL,
+                                      1.0, C_offd);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanDestroy( hypre_ParCSRRAPPlan *plan )
+{
+   if (plan)
+   {
+      hypre_ParCSRMatrixDestroy(hypre_ParCSRRAPPlanRT(plan));
+      hypre_ParCSRMatrixDestroy(hypre_ParCSRRAPPlanAP(plan));
+      hypre_ParCSRMatMatPlanDestroy(hypre_ParCSRRAPPlanAPPlan(plan));
+      hypre_ParCSRMatMatPlanDestroy(hypre_ParCSRRAPPlanRAPPlan(plan));
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanMatches
+ *
+ * Returns 1 if the product plan can be used for the numeric phase of the
+ * triple product with A and P, and 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanMatches( hypre_ParCSRRAPPlan *plan,
+                            hypre_ParCSRMatrix  *A,
+                            hypre_ParCSRMatrix  *P )
+{
+   return (plan && hypre_ParCSRMatMatPlanMatches(hypre_ParCSRRAPPlanAPPlan(plan), A, P));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPSymbolicHost
+ *
+ * Computes C = R^T * A * P if transpose_R is not 0, and C = R * A * P
+ * otherwise, as two products A * P and R^T * (A * P), and returns in
+ * *plan_ptr the product plan for hypre_ParCSRMatrixRAPNumericHost.
+ * The transpose of R and the intermediate product are kept in the plan.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRMatrixRAPSymbolicHost( hypre_ParCSRMatrix   *R,
+                                   hypre_ParCSRMatrix   *A,
+                                   hypre_ParCSRMatrix   *P,
+                                   HYPRE_Int             transpose_R,
+                                   hypre_ParCSRRAPPlan **plan_ptr )
+{
+   hypre_ParCSRRAPPlan *plan;
+   hypre_ParCSRMatrix  *RT = NULL;
+   hypre_ParCSRMatrix  *C;
+   hypre_CSRMatrix     *C_diag;
+
+   *plan_ptr = NULL;
+
+   plan = hypre_CTAlloc(hypre_ParCSRRAPPlan, 1, HYPRE_MEMORY_HOST);
+
+   if (transpose_R)
+   {
+      hypre_ParCSRMatrixTranspose(R, &RT, 1);
+      hypre_ParCSRRAPPlanRT(plan) = RT;
+   }
+
+   hypre_ParCSRRAPPlanAP(plan) = hypre_ParCSRMatMatSymbolicHost(A, P,
+                                                                &hypre_ParCSRRAPPlanAPPlan(plan));
+   if (!hypre_ParCSRRAPPlanAP(plan))
+   {
+      hypre_ParCSRRAPPlanDestroy(plan);
+      return NULL;
+   }
+
+   C = hypre_ParCSRMatMatSymbolicHost(RT ? RT : R, hypre_ParCSRRAPPlanAP(plan),
+                                      &hypre_ParCSRRAPPlanRAPPlan(plan));
+   if (!C)
+   {
+      hypre_ParCSRRAPPlanDestroy(plan);
+      return NULL;
+   }
+
+   /* Put the diagonal entries first, as hypre_ParCSRMatrixRAPKT does */
+   C_diag = hypre_ParCSRMatrixDiag(C);
+   if (hypre_CSRMatrixNumRows(C_diag) == hypre_CSRMatrixNumCols(C_diag))
+   {
+      hypre_CSRMatrixReorder(C_diag);
+   }
+
+   *plan_ptr = plan;
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPNumericHost
+ *
+ * Recomputes the values of C from hypre_ParCSRMatrixRAPSymbolicHost for new
+ * values of R, A and P with the same sparsity patterns. When R was transposed
+ * in the symbolic phase, the cached transpose is replaced by the transpose of
+ * the current R, which has the same pattern. The values agree with those of
+ * hypre_ParCSRMatrixRAPKT up to rounding errors, see
+ * hypre_BoomerAMGResetupGalerkinDiff.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRAPNumericHost( hypre_ParCSRRAPPlan *plan,
+                                  hypre_ParCSRMatrix  *R,
+                                  hypre_ParCSRMatrix  *A,
+                                  hypre_ParCSRMatrix  *P,
+                                  hypre_ParCSRMatrix  *C )
+{
+   hypre_ParCSRMatrix *RT = hypre_ParCSRRAPPlanRT(plan);
+   hypre_ParCSRMatrix *AP = hypre_ParCSRRAPPlanAP(plan);
+
+   if (RT)
+   {
+      hypre_ParCSRMatrixDestroy(RT);
+      hypre_ParCSRMatrixTranspose(R, &RT, 1);
+      hypre_ParCSRRAPPlanRT(plan) = RT;
+   }
+
+   hypre_ParCSRMatMatNumericHost(hypre_ParCSRRAPPlanAPPlan(plan), A, P, AP);
+   hypre_ParCSRMatMatNumericHost(hypre_ParCSRRAPPlanRAPPlan(plan), RT ? RT : R, AP, C);
+
+   return hypre_error_flag;
+}
@@ -136,3 +136,66 @@ hypre_ParVectorMassDotpTwo ( hypre_ParVector  *x,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorBlockInnerProdStart
+ *
+ * Starts the computation of result[i*ky + j] = <x[i], y[j]>. The local
+ * products are stored in local_result, which must hold kx*ky values and be
+ * kept, together with result, until hypre_ParVectorBlockInnerProdFinish
+ * has been called on request.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorBlockInnerProdStart( HYPRE_Int           kx,
+                                    hypre_ParVector   **x,
+                                    HYPRE_Int           ky,
+                                    hypre_ParVector   **y,
+                                    HYPRE_Real         *local_result,
+                                    HYPRE_Real         *result,
+                                    hypre_MPI_Request  *request )
+{
+   MPI_Comm   comm = hypre_ParVectorComm(x[0]);
+   HYPRE_Int  i, j;
+
+   for (i = 0; i < kx; i++)
+   {
+      for (j = 0; j < ky; j++)
+      {
+         local_result[i * ky + j] =
+            hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x[i]),
+                                     hypre_ParVectorLocalVector(y[j]));
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Iallreduce(local_result, result, kx * ky, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, request);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorBlockInnerProdFinish
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorBlockInnerProdFinish( hypre_MPI_Request *request )
+{
+   hypre_MPI_Status status;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Wait(request, &status);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
@@ -454,6 +454,11 @@ HYPRE_Int hypre_ParCSRMatrixInitialize ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumRownnz ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixSellDataInvalidate ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixOverlapOrderingCreate ( hypre_ParCSRMatrix *matrix,
+                                                   HYPRE_Int **ordering_ptr,
+                                                   HYPRE_Int *num_interior_ptr );
+HYPRE_Int hypre_ParCSRMatrixSPDataSetup ( hypre_ParCSRMatrix *matrix, HYPRE_Int free_data );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix, HYPRE_Int owns_data );
 HYPRE_Int hypre_ParCSRMatrixSetPatternOnly( hypre_ParCSRMatrix *matrix, HYPRE_Int pattern_only);
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRead ( MPI_Comm comm, const char *file_name );
@@ -524,6 +529,34 @@ HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_ParCSRMatrix
                                         hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y,
                                         HYPRE_Int *CF_marker, HYPRE_Int fpt );
 
+/* par_csr_fused_matvec.c */
+HYPRE_Int hypre_ParCSRMatrixResidualRestrictHost ( hypre_ParCSRMatrix *A, hypre_ParVector *u,
+                                                   hypre_ParVector *f, hypre_ParCSRMatrix *P,
+                                                   hypre_ParVector *r, hypre_ParVector *f_c );
+HYPRE_Int hypre_ParCSRMatrixResidualRestrict ( hypre_ParCSRMatrix *A, hypre_ParVector *u,
+                                               hypre_ParVector *f, hypre_ParCSRMatrix *P,
+                                               hypre_ParVector *r, hypre_ParVector *f_c );
+HYPRE_Int hypre_ParCSRMatrixProlongCorrectHost ( hypre_ParCSRMatrix *P, hypre_ParVector *u_c,
+                                                 hypre_ParVector *u_f );
+HYPRE_Int hypre_ParCSRMatrixProlongCorrect ( hypre_ParCSRMatrix *P, hypre_ParVector *u_c,
+                                             hypre_ParVector *u_f );
+
+/* par_csr_product_plan.c */
+HYPRE_Int hypre_ParCSRMatMatPlanDestroy ( hypre_ParCSRMatMatPlan *plan );
+HYPRE_Int hypre_ParCSRMatMatPlanMatches ( hypre_ParCSRMatMatPlan *plan, hypre_ParCSRMatrix *A,
+                                          hypre_ParCSRMatrix *B );
+hypre_ParCSRMatrix *hypre_ParCSRMatMatSymbolicHost ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                                     hypre_ParCSRMatMatPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRMatMatNumericHost ( hypre_ParCSRMatMatPlan *plan, hypre_ParCSRMatrix *A,
+                                          hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRRAPPlanDestroy ( hypre_ParCSRRAPPlan *plan );
+HYPRE_Int hypre_ParCSRRAPPlanMatches ( hypre_ParCSRRAPPlan *plan, hypre_ParCSRMatrix *A,
+                                       hypre_ParCSRMatrix *P );
+hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPSymbolicHost ( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A,
+                                                        hypre_ParCSRMatrix *P, HYPRE_Int transpose_R, hypre_ParCSRRAPPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRMatrixRAPNumericHost ( hypre_ParCSRRAPPlan *plan, hypre_ParCSRMatrix *R,
+                                             hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, hypre_ParCSRMatrix *C );
+
 /* par_csr_triplemat.c */
 HYPRE_Int hypre_ParCSRTMatMatPartialAddDevice( hypre_ParCSRCommPkg *comm_pkg_A,
                                                HYPRE_Int num_cols_A, HYPRE_Int num_cols_B, HYPRE_BigInt first_col_diag_B,
@@ -591,6 +624,10 @@ HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y
                                          HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
                                        HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x, HYPRE_Real *prod_y );
+HYPRE_Int hypre_ParVectorBlockInnerProdStart ( HYPRE_Int kx, hypre_ParVector **x, HYPRE_Int ky,
+                                               hypre_ParVector **y, HYPRE_Real *local_result,
+                                               HYPRE_Real *result, hypre_MPI_Request *request );
+HYPRE_Int hypre_ParVectorBlockInnerProdFinish ( hypre_MPI_Request *request );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm, hypre_Vector *v,
                                            HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
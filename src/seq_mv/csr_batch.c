@@ -0,0 +1,387 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Member functions for hypre_CSRBatchMatrix class (host only).
+ *
+ * All kernels run over the systems of the batch in one pass; the pattern
+ * arrays are shared, so they stay in cache while the values stream through.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBatchMatrixCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRBatchMatrix *
+hypre_CSRBatchMatrixCreate( HYPRE_Int num_systems,
+                            HYPRE_Int num_rows,
+                            HYPRE_Int num_nonzeros )
+{
+   hypre_CSRBatchMatrix  *matrix;
+
+   matrix = hypre_CTAlloc(hypre_CSRBatchMatrix, 1, HYPRE_MEMORY_HOST);
+
+   hypre_CSRBatchMatrixNumSystems(matrix)     = num_systems;
+   hypre_CSRBatchMatrixNumRows(matrix)        = num_rows;
+   hypre_CSRBatchMatrixNumNonzeros(matrix)    = num_nonzeros;
+   hypre_CSRBatchMatrixI(matrix)              = NULL;
+   hypre_CSRBatchMatrixJ(matrix)              = NULL;
+   hypre_CSRBatchMatrixDiag(matrix)           = NULL;
+   hypre_CSRBatchMatrixData(matrix)           = NULL;
+   hypre_CSRBatchMatrixMemoryLocation(matrix) = HYPRE_MEMORY_HOST;
+
+   return matrix;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBatchMatrixInitialize
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRBatchMatrixInitialize( hypre_CSRBatchMatrix *matrix )
+{
+   HYPRE_Int  num_systems  = hypre_CSRBatchMatrixNumSystems(matrix);
+   HYPRE_Int  num_rows     = hypre_CSRBatchMatrixNumRows(matrix);
+   HYPRE_Int  num_nonzeros = hypre_CSRBatchMatrixNumNonzeros(matrix);
+
+   if (!hypre_CSRBatchMatrixI(matrix))
+   {
+      hypre_CSRBatchMatrixI(matrix) = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   }
+   if (!hypre_CSRBatchMatrixJ(matrix))
+   {
+      hypre_CSRBatchMatrixJ(matrix) = hypre_CTAlloc(HYPRE_Int, num_nonzeros, HYPRE_MEMORY_HOST);
+   }
+   if (!hypre_CSRBatchMatrixDiag(matrix))
+   {
+      hypre_CSRBatchMatrixDiag(matrix) = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   }
+   if (!hypre_CSRBatchMatrixData(matrix))
+   {
+      hypre_CSRBatchMatrixData(matrix) =
+         hypre_CTAlloc(HYPRE_Complex, (size_t) num_systems * num_nonzeros, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBatchMatrixDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRBatchMatrixDestroy( hypre_CSRBatchMatrix *matrix )
+{
+   if (matrix)
+   {
+      hypre_TFree(hypre_CSRBatchMatrixI(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRBatchMatrixJ(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRBatchMatrixDiag(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRBatchMatrixData(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(matrix, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBatchMatrixFindDiagonal
+ *
+ * Sets the diagonal positions of the (sorted) pattern.  Every row must have
+ * a diagonal entry.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRBatchMatrixFindDiagonal( hypre_CSRBatchMatrix *matrix )
+{
+   HYPRE_Int   num_rows = hypre_CSRBatchMatrixNumRows(matrix);
+   HYPRE_Int  *A_i      = hypre_CSRBatchMatrixI(matrix);
+   HYPRE_Int  *A_j      = hypre_CSRBatchMatrixJ(matrix);
+   HYPRE_Int  *A_diag   = hypre_CSRBatchMatrixDiag(matrix);
+   HYPRE_Int   i, jj;
+
+   for (i = 0; i < num_rows; i++)
+   {
+      A_diag[i] = -1;
+      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+      {
+         if (A_j[jj] == i)
+         {
+            A_diag[i] = jj;
+            break;
+         }
+      }
+      if (A_diag[i] < 0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Missing diagonal entry in batched matrix!");
+         return hypre_error_flag;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBatchMatrixMatvec
+ *
+ * y_k = alpha*A_k*x_k + beta*y_k for every system k
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRBatchMatrixMatvec( HYPRE_Complex         alpha,
+                            hypre_CSRBatchMatrix *A,
+                            hypre_Vector         *x,
+                            HYPRE_Complex         beta,
+                            hypre_Vector         *y )
+{
+   HYPRE_Int       num_systems  = hypre_CSRBatchMatrixNumSystems(A);
+   HYPRE_Int       num_rows     = hypre_CSRBatchMatrixNumRows(A);
+   HYPRE_Int       num_nonzeros = hypre_CSRBatchMatrixNumNonzeros(A);
+   HYPRE_Int      *A_i          = hypre_CSRBatchMatrixI(A);
+   HYPRE_Int      *A_j          = hypre_CSRBatchMatrixJ(A);
+   HYPRE_Complex  *A_data       = hypre_CSRBatchMatrixData(A);
+   HYPRE_Int       x_stride     = hypre_VectorVectorStride(x);
+   HYPRE_Int       y_stride     = hypre_VectorVectorStride(y);
+   HYPRE_Int       k;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < num_systems; k++)
+   {
+      HYPRE_Complex  *data   = A_data + (size_t) k * num_nonzeros;
+      HYPRE_Complex  *x_data = hypre_VectorData(x) + (size_t) k * x_stride;
+      HYPRE_Complex  *y_data = hypre_VectorData(y) + (size_t) k * y_stride;
+      HYPRE_Complex   temp;
+      HYPRE_Int       i, jj;
+
+      for (i = 0; i < num_rows; i++)
+      {
+         temp = 0.0;
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            temp += data[jj] * x_data[A_j[jj]];
+         }
+         if (beta == 0.0)
+         {
+            y_data[i] = alpha * temp;
+         }
+         else
+         {
+            y_data[i] = alpha * temp + beta * y_data[i];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBatchMatrixILU0Symbolic
+ *
+ * Records the operations of an ILU(0) factorization of the shared pattern
+ * as triples (t, a, b): b < 0 means LU[t] /= LU[a], otherwise
+ * LU[t] -= LU[a]*LU[b].  The same list factors every system of the batch.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRBatchMatrixILU0Symbolic( hypre_CSRBatchMatrix  *A,
+                                  HYPRE_Int             *num_ops_ptr,
+                                  HYPRE_Int            **ops_ptr )
+{
+   HYPRE_Int   num_rows = hypre_CSRBatchMatrixNumRows(A);
+   HYPRE_Int  *A_i      = hypre_CSRBatchMatrixI(A);
+   HYPRE_Int  *A_j      = hypre_CSRBatchMatrixJ(A);
+   HYPRE_Int  *A_diag   = hypre_CSRBatchMatrixDiag(A);
+
+   HYPRE_Int  *marker, *ops;
+   HYPRE_Int   num_ops, max_ops;
+   HYPRE_Int   i, k, jj, kk;
+
+   marker  = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   max_ops = hypre_CSRBatchMatrixNumNonzeros(A) + 1;
+   ops     = hypre_TAlloc(HYPRE_Int, 3 * max_ops, HYPRE_MEMORY_HOST);
+   num_ops = 0;
+
+   for (i = 0; i < num_rows; i++)
+   {
+      marker[i] = -1;
+   }
+
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+      {
+         marker[A_j[jj]] = jj;
+      }
+
+      /* columns are sorted, so the L part comes first in increasing order */
+      for (jj = A_i[i]; jj < A_diag[i]; jj++)
+      {
+         k = A_j[jj];
+
+         if (num_ops + A_i[k + 1] - A_diag[k] > max_ops)
+         {
+            max_ops = 2 * max_ops + A_i[k + 1] - A_diag[k];
+            ops = hypre_TReAlloc(ops, HYPRE_Int, 3 * max_ops, HYPRE_MEMORY_HOST);
+         }
+
+         ops[3 * num_ops]     = jj;
+         ops[3 * num_ops + 1] = A_diag[k];
+         ops[3 * num_ops + 2] = -1;
+         num_ops++;
+
+         for (kk = A_diag[k] + 1; kk < A_i[k + 1]; kk++)
+         {
+            if (marker[A_j[kk]] >= 0)
+            {
+               ops[3 * num_ops]     = marker[A_j[kk]];
+               ops[3 * num_ops + 1] = jj;
+               ops[3 * num_ops + 2] = kk;
+               num_ops++;
+            }
+         }
+      }
+
+      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+      {
+         marker[A_j[jj]] = -1;
+      }
+   }
+
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+
+   *num_ops_ptr = num_ops;
+   *ops_ptr     = ops;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBatchMatrixILU0Factor
+ *
+ * Computes the ILU(0) factors of all systems into LU_data (same layout as
+ * the matrix values) from the operation list of the symbolic phase.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRBatchMatrixILU0Factor( hypre_CSRBatchMatrix *A,
+                                HYPRE_Int             num_ops,
+                                HYPRE_Int            *ops,
+                                HYPRE_Complex        *LU_data )
+{
+   HYPRE_Int       num_systems  = hypre_CSRBatchMatrixNumSystems(A);
+   HYPRE_Int       num_rows     = hypre_CSRBatchMatrixNumRows(A);
+   HYPRE_Int       num_nonzeros = hypre_CSRBatchMatrixNumNonzeros(A);
+   HYPRE_Int      *A_diag       = hypre_CSRBatchMatrixDiag(A);
+   HYPRE_Complex  *A_data       = hypre_CSRBatchMatrixData(A);
+   HYPRE_Int       zero_pivot   = 0;
+   HYPRE_Int       k;
+
+   hypre_TMemcpy(LU_data, A_data, HYPRE_Complex, (size_t) num_systems * num_nonzeros,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(k) reduction(+:zero_pivot) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < num_systems; k++)
+   {
+      HYPRE_Complex  *LU = LU_data + (size_t) k * num_nonzeros;
+      HYPRE_Int       m, i;
+
+      for (m = 0; m < num_ops; m++)
+      {
+         if (ops[3 * m + 2] < 0)
+         {
+            LU[ops[3 * m]] /= LU[ops[3 * m + 1]];
+         }
+         else
+         {
+            LU[ops[3 * m]] -= LU[ops[3 * m + 1]] * LU[ops[3 * m + 2]];
+         }
+      }
+
+      for (i = 0; i < num_rows; i++)
+      {
+         if (LU[A_diag[i]] == 0.0)
+         {
+            zero_pivot++;
+            break;
+         }
+      }
+   }
+
+   if (zero_pivot)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Zero pivot in batched ILU(0)!");
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBatchMatrixILU0Solve
+ *
+ * z_k = (L_k U_k)^{-1} r_k for every system k
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRBatchMatrixILU0Solve( hypre_CSRBatchMatrix *A,
+                               HYPRE_Complex        *LU_data,
+                               hypre_Vector         *r,
+                               hypre_Vector         *z )
+{
+   HYPRE_Int       num_systems  = hypre_CSRBatchMatrixNumSystems(A);
+   HYPRE_Int       num_rows     = hypre_CSRBatchMatrixNumRows(A);
+   HYPRE_Int       num_nonzeros = hypre_CSRBatchMatrixNumNonzeros(A);
+   HYPRE_Int      *A_i          = hypre_CSRBatchMatrixI(A);
+   HYPRE_Int      *A_j          = hypre_CSRBatchMatrixJ(A);
+   HYPRE_Int      *A_diag       = hypre_CSRBatchMatrixDiag(A);
+   HYPRE_Int       r_stride     = hypre_VectorVectorStride(r);
+   HYPRE_Int       z_stride     = hypre_VectorVectorStride(z);
+   HYPRE_Int       k;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < num_systems; k++)
+   {
+      HYPRE_Complex  *LU     = LU_data + (size_t) k * num_nonzeros;
+      HYPRE_Complex  *r_data = hypre_VectorData(r) + (size_t) k * r_stride;
+      HYPRE_Complex  *z_data = hypre_VectorData(z) + (size_t) k * z_stride;
+      HYPRE_Complex   temp;
+      HYPRE_Int       i, jj;
+
+      /* L (unit diagonal) */
+      for (i = 0; i < num_rows; i++)
+      {
+         temp = r_data[i];
+         for (jj = A_i[i]; jj < A_diag[i]; jj++)
+         {
+            temp -= LU[jj] * z_data[A_j[jj]];
+         }
+         z_data[i] = temp;
+      }
+
+      /* U */
+      for (i = num_rows - 1; i >= 0; i--)
+      {
+         temp = z_data[i];
+         for (jj = A_diag[i] + 1; jj < A_i[i + 1]; jj++)
+         {
+            temp -= LU[jj] * z_data[A_j[jj]];
+         }
+         z_data[i] = temp / LU[A_diag[i]];
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -927,6 +927,142 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
    return C;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyNumericHost
+ *
+ * Numeric phase of hypre_CSRMatrixMultiplyHost: computes
+ *
+ *    C = A * B + beta * C
+ *
+ * on the sparsity pattern already stored in C, which is typically the output
+ * of a previous hypre_CSRMatrixMultiplyHost call with the same patterns of
+ * A and B. Column jb of B maps to column map_B2C[jb] of C (identity when
+ * map_B2C is NULL). Products falling outside the pattern of C are dropped
+ * and an error is flagged.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMultiplyNumericHost( hypre_CSRMatrix *A,
+                                    hypre_CSRMatrix *B,
+                                    HYPRE_Int       *map_B2C,
+                                    HYPRE_Complex    beta,
+                                    hypre_CSRMatrix *C )
+{
+   HYPRE_Complex        *A_data    = hypre_CSRMatrixData(A);
+   HYPRE_Int            *A_i       = hypre_CSRMatrixI(A);
+   HYPRE_Int            *A_j       = hypre_CSRMatrixJ(A);
+   HYPRE_Int             nrows_A   = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int             ncols_A   = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex        *B_data    = hypre_CSRMatrixData(B);
+   HYPRE_Int            *B_i       = hypre_CSRMatrixI(B);
+   HYPRE_Int            *B_j       = hypre_CSRMatrixJ(B);
+   HYPRE_Int             nrows_B   = hypre_CSRMatrixNumRows(B);
+
+   HYPRE_Complex        *C_data    = hypre_CSRMatrixData(C);
+   HYPRE_Int            *C_i       = hypre_CSRMatrixI(C);
+   HYPRE_Int            *C_j       = hypre_CSRMatrixJ(C);
+   HYPRE_Int             nrows_C   = hypre_CSRMatrixNumRows(C);
+   HYPRE_Int             ncols_C   = hypre_CSRMatrixNumCols(C);
+   HYPRE_Int             num_nnz_C = hypre_CSRMatrixNumNonzeros(C);
+
+   HYPRE_Int             num_missed = 0;
+
+   if (ncols_A != nrows_B || nrows_A != nrows_C)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Warning! incompatible matrix dimensions!\n");
+      return hypre_error_flag;
+   }
+
+   if (num_nnz_C == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!C_data)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "The values of C are not available!\n");
+      return hypre_error_flag;
+   }
+
+   /* The values of the SELL and single precision companions become stale */
+   hypre_CSRMatrixSellDataInvalidate(C);
+   hypre_CSRMatrixSPDataDestroy(C);
+
+   if (beta == 0.0)
+   {
+      hypre_Memset(C_data, 0, num_nnz_C * sizeof(HYPRE_Complex), HYPRE_MEMORY_HOST);
+   }
+   else if (beta != 1.0)
+   {
+      hypre_CSRMatrixScale(C, beta);
+   }
+
+   if (hypre_CSRMatrixNumNonzeros(A) == 0 || hypre_CSRMatrixNumNonzeros(B) == 0)
+   {
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel reduction(+:num_missed)
+#endif
+   {
+      HYPRE_Int  *C_marker;
+      HYPRE_Int   ns, ne, ic, ia, ib, ja, jc, kc;
+      HYPRE_Complex a_entry;
+
+      hypre_partition1D(nrows_C, hypre_NumActiveThreads(), hypre_GetThreadNum(), &ns, &ne);
+
+      C_marker = hypre_TAlloc(HYPRE_Int, ncols_C, HYPRE_MEMORY_HOST);
+      for (jc = 0; jc < ncols_C; jc++)
+      {
+         C_marker[jc] = -1;
+      }
+
+      for (ic = ns; ic < ne; ic++)
+      {
+         if (A_i[ic] == A_i[ic + 1])
+         {
+            continue;
+         }
+
+         for (kc = C_i[ic]; kc < C_i[ic + 1]; kc++)
+         {
+            C_marker[C_j[kc]] = kc;
+         }
+
+         for (ia = A_i[ic]; ia < A_i[ic + 1]; ia++)
+         {
+            ja = A_j[ia];
+            a_entry = A_data[ia];
+            for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+            {
+               jc = map_B2C ? map_B2C[B_j[ib]] : B_j[ib];
+               kc = C_marker[jc];
+               if (kc >= C_i[ic])
+               {
+                  C_data[kc] += a_entry * B_data[ib];
+               }
+               else
+               {
+                  num_missed++;
+               }
+            }
+         }
+      }
+
+      hypre_TFree(C_marker, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+   if (num_missed)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Product entries outside of the sparsity pattern of C!\n");
+   }
+
+   return hypre_error_flag;
+}
+
 hypre_CSRMatrix*
 hypre_CSRMatrixMultiply( hypre_CSRMatrix *A,
                          hypre_CSRMatrix *B)
@@ -2002,6 +2138,8 @@ hypre_CSRMatrixScale( hypre_CSRMatrix *A,
    HYPRE_Int      i;
    HYPRE_Int      k = hypre_CSRMatrixNumNonzeros(A);
 
+   hypre_CSRMatrixSellDataInvalidate(A);
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
 
@@ -2130,6 +2268,8 @@ hypre_CSRMatrixDiagScale( hypre_CSRMatrix *A,
       return hypre_error_flag;
    }
 
+   hypre_CSRMatrixSellDataInvalidate(A);
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_ExecutionPolicy exec;
 
@@ -2179,6 +2319,8 @@ hypre_CSRMatrixSetConstantValues( hypre_CSRMatrix *A,
       hypre_CSRMatrixData(A) = hypre_TAlloc(HYPRE_Complex, nnz, hypre_CSRMatrixMemoryLocation(A));
    }
 
+   hypre_CSRMatrixSellDataInvalidate(A);
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
 
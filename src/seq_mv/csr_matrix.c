@@ -40,6 +40,8 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    hypre_CSRMatrixNumCols(matrix)        = num_cols;
    hypre_CSRMatrixNumNonzeros(matrix)    = num_nonzeros;
    hypre_CSRMatrixMemoryLocation(matrix) = hypre_HandleMemoryLocation(hypre_handle());
+   hypre_CSRMatrixSellData(matrix)       = NULL;
+   hypre_CSRMatrixSPData(matrix)         = NULL;
 
    /* set defaults */
    hypre_CSRMatrixOwnsData(matrix)       = 1;
@@ -83,6 +85,9 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
       hypre_GpuMatDataDestroy(hypre_CSRMatrixGPUMatData(matrix));
 #endif
 
+      hypre_CSRSellDataDestroy(hypre_CSRMatrixSellData(matrix));
+      hypre_TFree(hypre_CSRMatrixSPData(matrix), HYPRE_MEMORY_HOST);
+
       hypre_TFree(matrix, HYPRE_MEMORY_HOST);
    }
 
@@ -849,6 +854,9 @@ hypre_CSRMatrixCopy( hypre_CSRMatrix *A, hypre_CSRMatrix *B, HYPRE_Int copy_data
    HYPRE_MemoryLocation memory_location_A = hypre_CSRMatrixMemoryLocation(A);
    HYPRE_MemoryLocation memory_location_B = hypre_CSRMatrixMemoryLocation(B);
 
+   /* The sparsity of B may change: drop its SELL companion */
+   hypre_CSRMatrixSellDataDestroy(B);
+
    hypre_TMemcpy(B_i, A_i, HYPRE_Int, num_rows + 1, memory_location_B, memory_location_A);
 
    if (A_rownnz)
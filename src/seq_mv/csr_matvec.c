@@ -13,6 +13,126 @@
 
 #include "seq_mv.h"
 
+/* Largest number of vectors handled by the specialized SpMM kernels */
+#define HYPRE_SPMM_MAX_NUM_VECTORS 16
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpMMRowMajorHost_core
+ *
+ * y = alpha*A*x + beta*b for a multivector x stored in row-major
+ * (interleaved) order, i.e., the num_vectors entries of a row are
+ * contiguous. Each matrix entry is loaded once and applied to all vectors.
+ * y and b may use either storage order.
+ *
+ * The number of vectors is passed as a compile-time constant by the
+ * wrappers below, so that the inner loops are fully unrolled/vectorized.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_CSRMatrixSpMMRowMajorHost_core( const HYPRE_Int      num_vectors,
+                                      HYPRE_Int            num_rows,
+                                      HYPRE_Complex        alpha,
+                                      const HYPRE_Int     *A_i,
+                                      const HYPRE_Int     *A_j,
+                                      const HYPRE_Complex *A_data,
+                                      const HYPRE_Complex *x_data,
+                                      HYPRE_Complex        beta,
+                                      const HYPRE_Complex *b_data,
+                                      HYPRE_Complex       *y_data,
+                                      HYPRE_Int            idxstride_y,
+                                      HYPRE_Int            vecstride_y )
+{
+   HYPRE_Int i, jj, v;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,jj,v) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Complex  tmp[HYPRE_SPMM_MAX_NUM_VECTORS];
+      HYPRE_Int      yidx = i * idxstride_y;
+
+      for (v = 0; v < num_vectors; v++)
+      {
+         tmp[v] = 0.0;
+      }
+
+      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+      {
+         const HYPRE_Complex  coef = A_data[jj];
+         const HYPRE_Complex *xrow = x_data + A_j[jj] * num_vectors;
+
+         for (v = 0; v < num_vectors; v++)
+         {
+            tmp[v] += coef * xrow[v];
+         }
+      }
+
+      if (beta == 0.0)
+      {
+         for (v = 0; v < num_vectors; v++)
+         {
+            y_data[yidx + v * vecstride_y] = alpha * tmp[v];
+         }
+      }
+      else
+      {
+         for (v = 0; v < num_vectors; v++)
+         {
+            y_data[yidx + v * vecstride_y] = alpha * tmp[v] + beta * b_data[yidx + v * vecstride_y];
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpMMRowMajorHost
+ *
+ * Dispatches to the specializations of hypre_CSRMatrixSpMMRowMajorHost_core.
+ * Returns 0 if num_vectors has no specialization.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CSRMatrixSpMMRowMajorHost( HYPRE_Int            num_vectors,
+                                 HYPRE_Int            num_rows,
+                                 HYPRE_Complex        alpha,
+                                 const HYPRE_Int     *A_i,
+                                 const HYPRE_Int     *A_j,
+                                 const HYPRE_Complex *A_data,
+                                 const HYPRE_Complex *x_data,
+                                 HYPRE_Complex        beta,
+                                 const HYPRE_Complex *b_data,
+                                 HYPRE_Complex       *y_data,
+                                 HYPRE_Int            idxstride_y,
+                                 HYPRE_Int            vecstride_y )
+{
+   switch (num_vectors)
+   {
+      case 2:
+         hypre_CSRMatrixSpMMRowMajorHost_core(2, num_rows, alpha, A_i, A_j, A_data, x_data,
+                                              beta, b_data, y_data, idxstride_y, vecstride_y);
+         return 1;
+
+      case 4:
+         hypre_CSRMatrixSpMMRowMajorHost_core(4, num_rows, alpha, A_i, A_j, A_data, x_data,
+                                              beta, b_data, y_data, idxstride_y, vecstride_y);
+         return 1;
+
+      case 8:
+         hypre_CSRMatrixSpMMRowMajorHost_core(8, num_rows, alpha, A_i, A_j, A_data, x_data,
+                                              beta, b_data, y_data, idxstride_y, vecstride_y);
+         return 1;
+
+      case 16:
+         hypre_CSRMatrixSpMMRowMajorHost_core(16, num_rows, alpha, A_i, A_j, A_data, x_data,
+                                              beta, b_data, y_data, idxstride_y, vecstride_y);
+         return 1;
+
+      default:
+         return 0;
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -114,7 +234,14 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
 
    temp = beta / alpha;
 
-   if (num_vectors > 1)
+   if (num_vectors > 1 &&
+       idxstride_x == num_vectors && vecstride_x == 1 &&
+       hypre_CSRMatrixSpMMRowMajorHost(num_vectors, num_rows, alpha, A_i, A_j, A_data, x_data,
+                                       beta, b_data, y_data, idxstride_y, vecstride_y))
+   {
+      /* Interleaved multivector x: done by the specialized SpMM kernels */
+   }
+   else if (num_vectors > 1)
    {
       /*-----------------------------------------------------------------------
        * y = (beta/alpha)*b
@@ -879,6 +1006,20 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if (hypre_CSRMatrixSPData(A))
+   {
+      /* Values stored in single precision (mixed-precision AMG) */
+      ierr = hypre_CSRMatrixMatvecSPHost(alpha, A, x, beta, b, y, offset);
+   }
+   else if (hypre_HandleSpMVUseSell(hypre_handle()) &&
+       offset == 0 && x != y &&
+       hypre_VectorNumVectors(x) == 1 &&
+       hypre_CSRMatrixNumRownnz(A) >= 0.7 * hypre_CSRMatrixNumRows(A))
+   {
+      /* SELL-C-sigma path; rows compressed with rownnz stay on the CSR path */
+      ierr = hypre_CSRMatrixMatvecSellHost(alpha, A, x, beta, b, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecOutOfPlaceHost(alpha, A, x, beta, b, y, offset);
    }
@@ -1159,6 +1300,11 @@ hypre_CSRMatrixMatvecT( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if (hypre_CSRMatrixSPData(A))
+   {
+      ierr = hypre_CSRMatrixMatvecTSPHost(alpha, A, x, beta, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecTHost(alpha, A, x, beta, y);
    }
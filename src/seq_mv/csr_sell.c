@@ -0,0 +1,356 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * SELL-C-sigma (sliced ELLPACK) companion storage for hypre_CSRMatrix.
+ *
+ * The companion is only used by the host matvec. It is built lazily from the
+ * CSR arrays the first time it is needed and rebuilt whenever the CSR arrays
+ * are reallocated. Routines that modify the CSR values in place must call
+ * hypre_CSRMatrixSellDataInvalidate so that the values are refreshed before
+ * the next matvec.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRSellDataDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRSellDataDestroy( hypre_CSRSellData *sell )
+{
+   if (sell)
+   {
+      hypre_TFree(hypre_CSRSellDataChunkPtr(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataChunkLen(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataRowPerm(sell),  HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataJ(sell),        HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataData(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(sell, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRSellDataSetValues
+ *
+ * Copies the values of A into the (already built) SELL layout. Rows keep
+ * their entry order, so entry k of a row lands in column k of its chunk.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRSellDataSetValues( hypre_CSRSellData *sell,
+                            hypre_CSRMatrix   *A )
+{
+   HYPRE_Int      *A_i        = hypre_CSRMatrixI(A);
+   HYPRE_Complex  *A_data     = hypre_CSRMatrixData(A);
+   HYPRE_Int       num_chunks = hypre_CSRSellDataNumChunks(sell);
+   HYPRE_Int      *chunk_ptr  = hypre_CSRSellDataChunkPtr(sell);
+   HYPRE_Int      *row_perm   = hypre_CSRSellDataRowPerm(sell);
+   HYPRE_Complex  *sell_data  = hypre_CSRSellDataData(sell);
+   HYPRE_Int       c, r, k, row, pos;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(c, r, k, row, pos) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+      {
+         row = row_perm[c * HYPRE_SELL_CHUNK_SIZE + r];
+         if (row < 0)
+         {
+            continue;
+         }
+
+         pos = chunk_ptr[c] + r;
+         for (k = A_i[row]; k < A_i[row + 1]; k++)
+         {
+            sell_data[pos] = A_data[k];
+            pos += HYPRE_SELL_CHUNK_SIZE;
+         }
+      }
+   }
+
+   hypre_CSRSellDataCSRData(sell) = A_data;
+   hypre_CSRSellDataStale(sell)   = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRSellDataCreate
+ *
+ * Builds the SELL-C-sigma layout of a host CSR matrix.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRSellData *
+hypre_CSRSellDataCreate( hypre_CSRMatrix *A,
+                         HYPRE_Int        sigma )
+{
+   HYPRE_Int          *A_i        = hypre_CSRMatrixI(A);
+   HYPRE_Int          *A_j        = hypre_CSRMatrixJ(A);
+   HYPRE_Int           num_rows   = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int           num_chunks = (num_rows + HYPRE_SELL_CHUNK_SIZE - 1) / HYPRE_SELL_CHUNK_SIZE;
+   HYPRE_Int           num_slots  = num_chunks * HYPRE_SELL_CHUNK_SIZE;
+
+   hypre_CSRSellData  *sell;
+   HYPRE_Int          *chunk_ptr;
+   HYPRE_Int          *chunk_len;
+   HYPRE_Int          *row_perm;
+   HYPRE_Int          *row_len;
+   HYPRE_Int          *sell_j;
+   HYPRE_Int           c, r, k, row, pos, len, start, end;
+
+   /* sigma must be a multiple of the chunk size */
+   sigma = hypre_max(sigma, HYPRE_SELL_CHUNK_SIZE);
+   sigma = (sigma / HYPRE_SELL_CHUNK_SIZE) * HYPRE_SELL_CHUNK_SIZE;
+
+   sell      = hypre_CTAlloc(hypre_CSRSellData, 1, HYPRE_MEMORY_HOST);
+   chunk_ptr = hypre_CTAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   chunk_len = hypre_CTAlloc(HYPRE_Int, num_chunks, HYPRE_MEMORY_HOST);
+   row_perm  = hypre_TAlloc(HYPRE_Int, num_slots, HYPRE_MEMORY_HOST);
+   row_len   = hypre_TAlloc(HYPRE_Int, num_slots, HYPRE_MEMORY_HOST);
+
+   /* Sort rows by decreasing length inside each sigma window */
+   for (row = 0; row < num_rows; row++)
+   {
+      row_perm[row] = row;
+      row_len[row]  = A_i[row] - A_i[row + 1];
+   }
+   for (row = num_rows; row < num_slots; row++)
+   {
+      row_perm[row] = -1;
+      row_len[row]  = 0;
+   }
+
+   for (start = 0; start < num_rows; start += sigma)
+   {
+      end = hypre_min(start + sigma, num_rows);
+      hypre_qsort2i(row_len, row_perm, start, end - 1);
+   }
+
+   /* Compute chunk lengths and offsets */
+   for (c = 0; c < num_chunks; c++)
+   {
+      len = 0;
+      for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+      {
+         len = hypre_max(len, -row_len[c * HYPRE_SELL_CHUNK_SIZE + r]);
+      }
+      chunk_len[c]     = len;
+      chunk_ptr[c + 1] = chunk_ptr[c] + len * HYPRE_SELL_CHUNK_SIZE;
+   }
+   hypre_TFree(row_len, HYPRE_MEMORY_HOST);
+
+   /* Fill column indices. Padding entries point to column 0 with a zero value */
+   sell_j = hypre_CTAlloc(HYPRE_Int, chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(c, r, k, row, pos) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+      {
+         row = row_perm[c * HYPRE_SELL_CHUNK_SIZE + r];
+         if (row < 0)
+         {
+            continue;
+         }
+
+         pos = chunk_ptr[c] + r;
+         for (k = A_i[row]; k < A_i[row + 1]; k++)
+         {
+            sell_j[pos] = A_j[k];
+            pos += HYPRE_SELL_CHUNK_SIZE;
+         }
+      }
+   }
+
+   hypre_CSRSellDataNumRows(sell)         = num_rows;
+   hypre_CSRSellDataNumChunks(sell)       = num_chunks;
+   hypre_CSRSellDataSigma(sell)           = sigma;
+   hypre_CSRSellDataChunkPtr(sell)        = chunk_ptr;
+   hypre_CSRSellDataChunkLen(sell)        = chunk_len;
+   hypre_CSRSellDataRowPerm(sell)         = row_perm;
+   hypre_CSRSellDataJ(sell)               = sell_j;
+   hypre_CSRSellDataData(sell)            = hypre_CTAlloc(HYPRE_Complex, chunk_ptr[num_chunks],
+                                                          HYPRE_MEMORY_HOST);
+   hypre_CSRSellDataCSRI(sell)            = A_i;
+   hypre_CSRSellDataCSRJ(sell)            = A_j;
+   hypre_CSRSellDataCSRNumNonzeros(sell)  = hypre_CSRMatrixNumNonzeros(A);
+
+   hypre_CSRSellDataSetValues(sell, A);
+
+   return sell;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellDataSetup
+ *
+ * Makes sure the SELL companion of A is consistent with its CSR arrays.
+ * The layout is rebuilt if the sparsity arrays changed, and the values are
+ * refreshed if they were invalidated or reallocated.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellDataSetup( hypre_CSRMatrix *A )
+{
+   hypre_CSRSellData *sell = hypre_CSRMatrixSellData(A);
+
+   if (sell)
+   {
+      if (hypre_CSRSellDataCSRI(sell)           != hypre_CSRMatrixI(A) ||
+          hypre_CSRSellDataCSRJ(sell)           != hypre_CSRMatrixJ(A) ||
+          hypre_CSRSellDataCSRNumNonzeros(sell) != hypre_CSRMatrixNumNonzeros(A) ||
+          hypre_CSRSellDataNumRows(sell)        != hypre_CSRMatrixNumRows(A))
+      {
+         hypre_CSRSellDataDestroy(sell);
+         sell = NULL;
+      }
+      else if (hypre_CSRSellDataStale(sell) ||
+               hypre_CSRSellDataCSRData(sell) != hypre_CSRMatrixData(A))
+      {
+         hypre_CSRSellDataSetValues(sell, A);
+      }
+   }
+
+   if (!sell)
+   {
+      sell = hypre_CSRSellDataCreate(A, HYPRE_SELL_SIGMA);
+   }
+
+   hypre_CSRMatrixSellData(A) = sell;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellDataInvalidate
+ *
+ * Marks the values of the SELL companion (if any) as out of date.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellDataInvalidate( hypre_CSRMatrix *A )
+{
+   if (A && hypre_CSRMatrixSellData(A))
+   {
+      hypre_CSRSellDataStale(hypre_CSRMatrixSellData(A)) = 1;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellDataDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellDataDestroy( hypre_CSRMatrix *A )
+{
+   if (A)
+   {
+      hypre_CSRSellDataDestroy(hypre_CSRMatrixSellData(A));
+      hypre_CSRMatrixSellData(A) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSellHost
+ *
+ * y = alpha*A*x + beta*b using the SELL companion of A. Only single vectors
+ * are supported, and x must not alias y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSellHost( HYPRE_Complex    alpha,
+                               hypre_CSRMatrix *A,
+                               hypre_Vector    *x,
+                               HYPRE_Complex    beta,
+                               hypre_Vector    *b,
+                               hypre_Vector    *y )
+{
+   hypre_CSRSellData *sell;
+   HYPRE_Int         *chunk_ptr;
+   HYPRE_Int         *chunk_len;
+   HYPRE_Int         *row_perm;
+   HYPRE_Int         *sell_j;
+   HYPRE_Complex     *sell_data;
+   HYPRE_Int          num_chunks;
+
+   HYPRE_Complex     *x_data = hypre_VectorData(x);
+   HYPRE_Complex     *b_data = hypre_VectorData(b);
+   HYPRE_Complex     *y_data = hypre_VectorData(y);
+   HYPRE_Int          c, r, k, row;
+
+   hypre_assert(hypre_VectorNumVectors(x) == 1);
+   hypre_assert(x != y);
+
+   hypre_CSRMatrixSellDataSetup(A);
+
+   sell       = hypre_CSRMatrixSellData(A);
+   num_chunks = hypre_CSRSellDataNumChunks(sell);
+   chunk_ptr  = hypre_CSRSellDataChunkPtr(sell);
+   chunk_len  = hypre_CSRSellDataChunkLen(sell);
+   row_perm   = hypre_CSRSellDataRowPerm(sell);
+   sell_j     = hypre_CSRSellDataJ(sell);
+   sell_data  = hypre_CSRSellDataData(sell);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(c, r, k, row) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      HYPRE_Complex        tmp[HYPRE_SELL_CHUNK_SIZE] = {0.0};
+      const HYPRE_Int     *cj = sell_j    + chunk_ptr[c];
+      const HYPRE_Complex *ca = sell_data + chunk_ptr[c];
+      const HYPRE_Int     *cp = row_perm  + c * HYPRE_SELL_CHUNK_SIZE;
+
+      for (k = 0; k < chunk_len[c]; k++)
+      {
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+         {
+            tmp[r] += ca[r] * x_data[cj[r]];
+         }
+         cj += HYPRE_SELL_CHUNK_SIZE;
+         ca += HYPRE_SELL_CHUNK_SIZE;
+      }
+
+      if (beta == 0.0)
+      {
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+         {
+            row = cp[r];
+            if (row >= 0)
+            {
+               y_data[row] = alpha * tmp[r];
+            }
+         }
+      }
+      else
+      {
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+         {
+            row = cp[r];
+            if (row >= 0)
+            {
+               y_data[row] = alpha * tmp[r] + beta * b_data[row];
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
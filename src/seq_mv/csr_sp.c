@@ -0,0 +1,336 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Single precision value storage for hypre_CSRMatrix.
+ *
+ * The coefficients of a matrix can be stored in hypre_float next to (or
+ * instead of) the HYPRE_Complex values. When present, the host matvec
+ * routines read the single precision copy, while vectors and accumulations
+ * stay in HYPRE_Complex. This halves the bytes moved per nonzero and is used
+ * by the mixed-precision BoomerAMG hierarchy.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSPDataSetup
+ *
+ * Creates (or refreshes) the single precision copy of the values of A.
+ * If free_data is nonzero, the HYPRE_Complex values are released afterwards
+ * and A can only be used in matvec and matvecT from then on.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSPDataSetup( hypre_CSRMatrix *A,
+                            HYPRE_Int        free_data )
+{
+   HYPRE_Int       num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+   HYPRE_Complex  *A_data       = hypre_CSRMatrixData(A);
+   hypre_float    *A_sp_data;
+   HYPRE_Int       i;
+
+#if defined(HYPRE_COMPLEX)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                     "Single precision matrix values are not supported for complex matrices\n");
+   return hypre_error_flag;
+#endif
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Single precision matrix values are only supported on the host\n");
+      return hypre_error_flag;
+   }
+
+   /* Nothing to convert, or values were already released */
+   if (num_nonzeros == 0 || !A_data)
+   {
+      return hypre_error_flag;
+   }
+
+   A_sp_data = hypre_CSRMatrixSPData(A);
+   if (!A_sp_data)
+   {
+      A_sp_data = hypre_TAlloc(hypre_float, num_nonzeros, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixSPData(A) = A_sp_data;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      A_sp_data[i] = (hypre_float) A_data[i];
+   }
+
+   /* The SELL companion would hold a second (double) copy of the values */
+   hypre_CSRMatrixSellDataDestroy(A);
+
+   if (free_data && hypre_CSRMatrixOwnsData(A))
+   {
+      hypre_TFree(hypre_CSRMatrixData(A), hypre_CSRMatrixMemoryLocation(A));
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSPDataDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSPDataDestroy( hypre_CSRMatrix *A )
+{
+   if (A)
+   {
+      hypre_TFree(hypre_CSRMatrixSPData(A), HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSPHost
+ *
+ * y = alpha*A*x + beta*b, with the values of A read from the single
+ * precision copy. Same semantics as hypre_CSRMatrixMatvecOutOfPlaceHost.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSPHost( HYPRE_Complex    alpha,
+                             hypre_CSRMatrix *A,
+                             hypre_Vector    *x,
+                             HYPRE_Complex    beta,
+                             hypre_Vector    *b,
+                             hypre_Vector    *y,
+                             HYPRE_Int        offset )
+{
+   hypre_float      *A_data      = hypre_CSRMatrixSPData(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A) + offset;
+   HYPRE_Int        *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A) - offset;
+   HYPRE_Int        *A_rownnz    = hypre_CSRMatrixRownnz(A);
+   HYPRE_Int         num_rownnz  = hypre_CSRMatrixNumRownnz(A);
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *b_data      = hypre_VectorData(b) + offset;
+   HYPRE_Complex    *y_data      = hypre_VectorData(y) + offset;
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+
+   hypre_Vector     *x_tmp = NULL;
+   HYPRE_Complex     tempx;
+   HYPRE_Int         i, ii, jj, jv;
+
+   hypre_assert(num_vectors == hypre_VectorNumVectors(y));
+   hypre_assert(num_vectors == hypre_VectorNumVectors(b));
+
+   if (x == y)
+   {
+      x_tmp  = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   /* y = beta*b */
+   if (beta == 0.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows * num_vectors; i++)
+      {
+         y_data[i] = 0.0;
+      }
+   }
+   else if (y_data != b_data || beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows * num_vectors; i++)
+      {
+         y_data[i] = beta * b_data[i];
+      }
+   }
+
+   if (alpha != 0.0)
+   {
+      /* Only visit nonzero rows when the row compression is worthwhile */
+      if (offset || !A_rownnz || num_rownnz >= 0.7 * num_rows)
+      {
+         A_rownnz   = NULL;
+         num_rownnz = num_rows;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i,ii,jj,jv,tempx) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = 0; ii < num_rownnz; ii++)
+      {
+         i = A_rownnz ? A_rownnz[ii] : ii;
+
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx += (HYPRE_Complex) A_data[jj] *
+                        x_data[A_j[jj] * idxstride_x + jv * vecstride_x];
+            }
+            y_data[i * idxstride_y + jv * vecstride_y] += alpha * tempx;
+         }
+      }
+   }
+
+   if (x_tmp)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSPHost
+ *
+ * y = alpha*A^T*x + beta*y, with the values of A read from the single
+ * precision copy. Threads accumulate into private copies of y, as in
+ * hypre_CSRMatrixMatvecTHost.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTSPHost( HYPRE_Complex    alpha,
+                              hypre_CSRMatrix *A,
+                              hypre_Vector    *x,
+                              HYPRE_Complex    beta,
+                              hypre_Vector    *y )
+{
+   hypre_float      *A_data      = hypre_CSRMatrixSPData(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols    = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *y_data      = hypre_VectorData(y);
+   HYPRE_Int         y_size      = hypre_VectorSize(y);
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+
+   hypre_Vector     *x_tmp = NULL;
+   HYPRE_Complex    *y_data_expand;
+   HYPRE_Complex     tempx;
+   HYPRE_Int         num_threads = hypre_NumThreads();
+   HYPRE_Int         my_thread_num, t;
+   HYPRE_Int         i, jj, jv;
+
+   hypre_assert(num_vectors == hypre_VectorNumVectors(y));
+
+   if (x == y)
+   {
+      x_tmp  = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   /* y = beta*y */
+   if (beta == 0.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols * num_vectors; i++)
+      {
+         y_data[i] = 0.0;
+      }
+   }
+   else if (beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols * num_vectors; i++)
+      {
+         y_data[i] *= beta;
+      }
+   }
+
+   if (alpha == 0.0)
+   {
+      /* nothing to accumulate */
+   }
+   else if (num_threads > 1 && num_vectors == 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads * y_size, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel private(i,jj,t,my_thread_num,tempx)
+#endif
+      {
+         HYPRE_Complex *y_thread;
+
+         my_thread_num = hypre_GetThreadNum();
+         y_thread      = y_data_expand + y_size * my_thread_num;
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            tempx = alpha * x_data[i];
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               y_thread[A_j[jj]] += (HYPRE_Complex) A_data[jj] * tempx;
+            }
+         }
+
+         /* implied barrier */
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_size; i++)
+         {
+            for (t = 0; t < num_threads; t++)
+            {
+               y_data[i] += y_data_expand[t * y_size + i];
+            }
+         }
+      }
+
+      hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      /* multiple vector case is not threaded */
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            tempx = alpha * x_data[i * idxstride_x + jv * vecstride_x];
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               y_data[A_j[jj] * idxstride_y + jv * vecstride_y] += (HYPRE_Complex) A_data[jj] * tempx;
+            }
+         }
+      }
+   }
+
+   if (x_tmp)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return hypre_error_flag;
+}
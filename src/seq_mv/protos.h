@@ -5,6 +5,21 @@
  * SPDX-License-Identifier: (Apache-2.0 OR MIT)
  ******************************************************************************/
 
+/* csr_batch.c */
+hypre_CSRBatchMatrix *hypre_CSRBatchMatrixCreate ( HYPRE_Int num_systems, HYPRE_Int num_rows,
+                                                   HYPRE_Int num_nonzeros );
+HYPRE_Int hypre_CSRBatchMatrixInitialize ( hypre_CSRBatchMatrix *matrix );
+HYPRE_Int hypre_CSRBatchMatrixDestroy ( hypre_CSRBatchMatrix *matrix );
+HYPRE_Int hypre_CSRBatchMatrixFindDiagonal ( hypre_CSRBatchMatrix *matrix );
+HYPRE_Int hypre_CSRBatchMatrixMatvec ( HYPRE_Complex alpha, hypre_CSRBatchMatrix *A,
+                                       hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+HYPRE_Int hypre_CSRBatchMatrixILU0Symbolic ( hypre_CSRBatchMatrix *A, HYPRE_Int *num_ops_ptr,
+                                             HYPRE_Int **ops_ptr );
+HYPRE_Int hypre_CSRBatchMatrixILU0Factor ( hypre_CSRBatchMatrix *A, HYPRE_Int num_ops,
+                                           HYPRE_Int *ops, HYPRE_Complex *LU_data );
+HYPRE_Int hypre_CSRBatchMatrixILU0Solve ( hypre_CSRBatchMatrix *A, HYPRE_Complex *LU_data,
+                                          hypre_Vector *r, hypre_Vector *z );
+
 /* csr_matop.c */
 HYPRE_Int hypre_CSRMatrixAddFirstPass ( HYPRE_Int firstrow, HYPRE_Int lastrow, HYPRE_Int *marker,
                                         HYPRE_Int *twspace, HYPRE_Int *map_A2C, HYPRE_Int *map_B2C, hypre_CSRMatrix *A, hypre_CSRMatrix *B,
@@ -20,6 +35,8 @@ hypre_CSRMatrix *hypre_CSRMatrixAdd ( HYPRE_Complex alpha, hypre_CSRMatrix *A, H
                                       hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixBigAdd ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
+HYPRE_Int hypre_CSRMatrixMultiplyNumericHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                              HYPRE_Int *map_B2C, HYPRE_Complex beta, hypre_CSRMatrix *C );
 hypre_CSRMatrix *hypre_CSRMatrixMultiply ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixDeleteZeros ( hypre_CSRMatrix *A, HYPRE_Real tol );
 HYPRE_Int hypre_CSRMatrixTransposeHost ( hypre_CSRMatrix *A, hypre_CSRMatrix **AT, HYPRE_Int data );
@@ -145,6 +162,25 @@ HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows,
                                  HYPRE_Int new_num_cols, HYPRE_Int new_num_nonzeros );
 
+/* csr_sp.c */
+HYPRE_Int hypre_CSRMatrixSPDataSetup ( hypre_CSRMatrix *A, HYPRE_Int free_data );
+HYPRE_Int hypre_CSRMatrixSPDataDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSPHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                        HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y,
+                                        HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTSPHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                         HYPRE_Complex beta, hypre_Vector *y );
+
+/* csr_sell.c */
+HYPRE_Int hypre_CSRSellDataDestroy ( hypre_CSRSellData *sell );
+HYPRE_Int hypre_CSRSellDataSetValues ( hypre_CSRSellData *sell, hypre_CSRMatrix *A );
+hypre_CSRSellData *hypre_CSRSellDataCreate ( hypre_CSRMatrix *A, HYPRE_Int sigma );
+HYPRE_Int hypre_CSRMatrixSellDataSetup ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellDataInvalidate ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellDataDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                          hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+
 /* csr_matvec.c */
 // y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end]
 HYPRE_Int hypre_CSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
@@ -303,6 +339,9 @@ HYPRE_Int hypre_SeqVectorMassAxpy4(HYPRE_Complex *alpha, hypre_Vector **x, hypre
                                    HYPRE_Int k);
 HYPRE_Int hypre_SeqVectorMassAxpy8(HYPRE_Complex *alpha, hypre_Vector **x, hypre_Vector *y,
                                    HYPRE_Int k);
+HYPRE_Int hypre_SeqVectorBatchInnerProd(hypre_Vector *x, hypre_Vector *y, HYPRE_Real *result);
+HYPRE_Int hypre_SeqVectorBatchAxpby(HYPRE_Complex *alpha, hypre_Vector *x, HYPRE_Complex *beta,
+                                    hypre_Vector *y);
 HYPRE_Complex hypre_SeqVectorSumElts ( hypre_Vector *vector );
 HYPRE_Complex hypre_SeqVectorSumEltsHost ( hypre_Vector *vector );
 HYPRE_Complex hypre_SeqVectorSumEltsDevice ( hypre_Vector *vector );
@@ -46,6 +46,56 @@ struct hypre_GpuMatData;
 typedef struct hypre_GpuMatData hypre_GpuMatData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma companion storage (host SpMV)
+ *
+ * Rows are sorted by decreasing length inside windows of `sigma' rows and
+ * grouped into chunks of HYPRE_SELL_CHUNK_SIZE rows. Each chunk is stored
+ * column-major and padded to the length of its longest row, so that the
+ * inner matvec loop runs over HYPRE_SELL_CHUNK_SIZE independent rows.
+ *--------------------------------------------------------------------------*/
+
+#ifndef HYPRE_SELL_CHUNK_SIZE
+#define HYPRE_SELL_CHUNK_SIZE 8
+#endif
+
+#ifndef HYPRE_SELL_SIGMA
+#define HYPRE_SELL_SIGMA (32 * HYPRE_SELL_CHUNK_SIZE)
+#endif
+
+typedef struct
+{
+   HYPRE_Int             num_rows;
+   HYPRE_Int             num_chunks;
+   HYPRE_Int             sigma;
+   HYPRE_Int            *chunk_ptr;       /* chunk offsets into j/data (size num_chunks + 1) */
+   HYPRE_Int            *chunk_len;       /* padded row length of each chunk */
+   HYPRE_Int            *row_perm;        /* original row of each chunk slot (-1 for padding) */
+   HYPRE_Int            *j;
+   HYPRE_Complex        *data;
+   HYPRE_Int             stale;           /* 1: values must be refreshed from the CSR arrays */
+
+   /* CSR arrays the companion was built from */
+   HYPRE_Int            *csr_i;
+   HYPRE_Int            *csr_j;
+   HYPRE_Complex        *csr_data;
+   HYPRE_Int             csr_num_nonzeros;
+} hypre_CSRSellData;
+
+#define hypre_CSRSellDataNumRows(sell)              ((sell) -> num_rows)
+#define hypre_CSRSellDataNumChunks(sell)            ((sell) -> num_chunks)
+#define hypre_CSRSellDataSigma(sell)                ((sell) -> sigma)
+#define hypre_CSRSellDataChunkPtr(sell)             ((sell) -> chunk_ptr)
+#define hypre_CSRSellDataChunkLen(sell)             ((sell) -> chunk_len)
+#define hypre_CSRSellDataRowPerm(sell)              ((sell) -> row_perm)
+#define hypre_CSRSellDataJ(sell)                    ((sell) -> j)
+#define hypre_CSRSellDataData(sell)                 ((sell) -> data)
+#define hypre_CSRSellDataStale(sell)                ((sell) -> stale)
+#define hypre_CSRSellDataCSRI(sell)                 ((sell) -> csr_i)
+#define hypre_CSRSellDataCSRJ(sell)                 ((sell) -> csr_j)
+#define hypre_CSRSellDataCSRData(sell)              ((sell) -> csr_data)
+#define hypre_CSRSellDataCSRNumNonzeros(sell)       ((sell) -> csr_num_nonzeros)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -66,6 +116,8 @@ typedef struct
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   hypre_CSRSellData    *sell_data;       /* SELL-C-sigma companion for host SpMV (built lazily) */
+   hypre_float          *sp_data;         /* single precision copy of `data' for host SpMV */
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
@@ -93,6 +145,8 @@ typedef struct
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixPatternOnly(matrix)          ((matrix) -> pattern_only)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixSellData(matrix)             ((matrix) -> sell_data)
+#define hypre_CSRMatrixSPData(matrix)               ((matrix) -> sp_data)
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
@@ -106,6 +160,37 @@ typedef struct
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionBegin( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionEnd( hypre_CSRMatrix *A );
 
+/*--------------------------------------------------------------------------
+ * Batched CSR Matrix
+ *
+ * num_systems matrices that share one sparsity pattern.  The pattern (i, j)
+ * is stored once, with the columns of each row sorted, and the values of
+ * the systems are stored one after the other, so that system k owns
+ * data[k*num_nonzeros, ..., (k+1)*num_nonzeros-1].  Batched vectors are
+ * multivectors with one (column-wise stored) component per system.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             num_systems;
+   HYPRE_Int             num_rows;
+   HYPRE_Int             num_nonzeros;
+   HYPRE_Int            *i;
+   HYPRE_Int            *j;
+   HYPRE_Int            *diag;            /* position of the diagonal in each row */
+   HYPRE_Complex        *data;
+   HYPRE_MemoryLocation  memory_location;
+} hypre_CSRBatchMatrix;
+
+#define hypre_CSRBatchMatrixNumSystems(matrix)      ((matrix) -> num_systems)
+#define hypre_CSRBatchMatrixNumRows(matrix)         ((matrix) -> num_rows)
+#define hypre_CSRBatchMatrixNumNonzeros(matrix)     ((matrix) -> num_nonzeros)
+#define hypre_CSRBatchMatrixI(matrix)               ((matrix) -> i)
+#define hypre_CSRBatchMatrixJ(matrix)               ((matrix) -> j)
+#define hypre_CSRBatchMatrixDiag(matrix)            ((matrix) -> diag)
+#define hypre_CSRBatchMatrixData(matrix)            ((matrix) -> data)
+#define hypre_CSRBatchMatrixMemoryLocation(matrix)  ((matrix) -> memory_location)
+
 /*--------------------------------------------------------------------------
  * CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -281,6 +366,21 @@ typedef struct
  * SPDX-License-Identifier: (Apache-2.0 OR MIT)
  ******************************************************************************/
 
+/* csr_batch.c */
+hypre_CSRBatchMatrix *hypre_CSRBatchMatrixCreate ( HYPRE_Int num_systems, HYPRE_Int num_rows,
+                                                   HYPRE_Int num_nonzeros );
+HYPRE_Int hypre_CSRBatchMatrixInitialize ( hypre_CSRBatchMatrix *matrix );
+HYPRE_Int hypre_CSRBatchMatrixDestroy ( hypre_CSRBatchMatrix *matrix );
+HYPRE_Int hypre_CSRBatchMatrixFindDiagonal ( hypre_CSRBatchMatrix *matrix );
+HYPRE_Int hypre_CSRBatchMatrixMatvec ( HYPRE_Complex alpha, hypre_CSRBatchMatrix *A,
+                                       hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+HYPRE_Int hypre_CSRBatchMatrixILU0Symbolic ( hypre_CSRBatchMatrix *A, HYPRE_Int *num_ops_ptr,
+                                             HYPRE_Int **ops_ptr );
+HYPRE_Int hypre_CSRBatchMatrixILU0Factor ( hypre_CSRBatchMatrix *A, HYPRE_Int num_ops,
+                                           HYPRE_Int *ops, HYPRE_Complex *LU_data );
+HYPRE_Int hypre_CSRBatchMatrixILU0Solve ( hypre_CSRBatchMatrix *A, HYPRE_Complex *LU_data,
+                                          hypre_Vector *r, hypre_Vector *z );
+
 /* csr_matop.c */
 HYPRE_Int hypre_CSRMatrixAddFirstPass ( HYPRE_Int firstrow, HYPRE_Int lastrow, HYPRE_Int *marker,
                                         HYPRE_Int *twspace, HYPRE_Int *map_A2C, HYPRE_Int *map_B2C, hypre_CSRMatrix *A, hypre_CSRMatrix *B,
@@ -296,6 +396,8 @@ hypre_CSRMatrix *hypre_CSRMatrixAdd ( HYPRE_Complex alpha, hypre_CSRMatrix *A, H
                                       hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixBigAdd ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
+HYPRE_Int hypre_CSRMatrixMultiplyNumericHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                              HYPRE_Int *map_B2C, HYPRE_Complex beta, hypre_CSRMatrix *C );
 hypre_CSRMatrix *hypre_CSRMatrixMultiply ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixDeleteZeros ( hypre_CSRMatrix *A, HYPRE_Real tol );
 HYPRE_Int hypre_CSRMatrixTransposeHost ( hypre_CSRMatrix *A, hypre_CSRMatrix **AT, HYPRE_Int data );
@@ -421,6 +523,25 @@ HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows,
                                  HYPRE_Int new_num_cols, HYPRE_Int new_num_nonzeros );
 
+/* csr_sp.c */
+HYPRE_Int hypre_CSRMatrixSPDataSetup ( hypre_CSRMatrix *A, HYPRE_Int free_data );
+HYPRE_Int hypre_CSRMatrixSPDataDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSPHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                        HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y,
+                                        HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTSPHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                         HYPRE_Complex beta, hypre_Vector *y );
+
+/* csr_sell.c */
+HYPRE_Int hypre_CSRSellDataDestroy ( hypre_CSRSellData *sell );
+HYPRE_Int hypre_CSRSellDataSetValues ( hypre_CSRSellData *sell, hypre_CSRMatrix *A );
+hypre_CSRSellData *hypre_CSRSellDataCreate ( hypre_CSRMatrix *A, HYPRE_Int sigma );
+HYPRE_Int hypre_CSRMatrixSellDataSetup ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellDataInvalidate ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellDataDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                          hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+
 /* csr_matvec.c */
 // y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end]
 HYPRE_Int hypre_CSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
@@ -579,6 +700,9 @@ HYPRE_Int hypre_SeqVectorMassAxpy4(HYPRE_Complex *alpha, hypre_Vector **x, hypre
                                    HYPRE_Int k);
 HYPRE_Int hypre_SeqVectorMassAxpy8(HYPRE_Complex *alpha, hypre_Vector **x, hypre_Vector *y,
                                    HYPRE_Int k);
+HYPRE_Int hypre_SeqVectorBatchInnerProd(hypre_Vector *x, hypre_Vector *y, HYPRE_Real *result);
+HYPRE_Int hypre_SeqVectorBatchAxpby(HYPRE_Complex *alpha, hypre_Vector *x, HYPRE_Complex *beta,
+                                    hypre_Vector *y);
 HYPRE_Complex hypre_SeqVectorSumElts ( hypre_Vector *vector );
 HYPRE_Complex hypre_SeqVectorSumEltsHost ( hypre_Vector *vector );
 HYPRE_Complex hypre_SeqVectorSumEltsDevice ( hypre_Vector *vector );
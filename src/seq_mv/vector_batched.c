@@ -1207,3 +1207,78 @@ HYPRE_Int hypre_SeqVectorMassDotpTwo( hypre_Vector *x, hypre_Vector *y,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorBatchInnerProd
+ *
+ * Component-wise inner products of two multivectors:
+ * result[j] = <x_j, y_j> for each of the num_vectors components.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_SeqVectorBatchInnerProd( hypre_Vector *x, hypre_Vector *y,
+                                         HYPRE_Real *result )
+{
+   HYPRE_Complex *x_data   = hypre_VectorData(x);
+   HYPRE_Complex *y_data   = hypre_VectorData(y);
+   HYPRE_Int      size     = hypre_VectorSize(x);
+   HYPRE_Int      k        = hypre_VectorNumVectors(x);
+   HYPRE_Int      x_stride = hypre_VectorVectorStride(x);
+   HYPRE_Int      y_stride = hypre_VectorVectorStride(y);
+
+   HYPRE_Int      i, j;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i,j) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < k; j++)
+   {
+      HYPRE_Complex *xj = x_data + (size_t) j * x_stride;
+      HYPRE_Complex *yj = y_data + (size_t) j * y_stride;
+      HYPRE_Real     res = 0;
+
+      for (i = 0; i < size; i++)
+      {
+         res += hypre_conj(yj[i]) * xj[i];
+      }
+      result[j] = res;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorBatchAxpby
+ *
+ * Component-wise y_j = alpha[j]*x_j + beta[j]*y_j for two multivectors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_SeqVectorBatchAxpby( HYPRE_Complex *alpha, hypre_Vector *x,
+                                     HYPRE_Complex *beta, hypre_Vector *y )
+{
+   HYPRE_Complex *x_data   = hypre_VectorData(x);
+   HYPRE_Complex *y_data   = hypre_VectorData(y);
+   HYPRE_Int      size     = hypre_VectorSize(x);
+   HYPRE_Int      k        = hypre_VectorNumVectors(x);
+   HYPRE_Int      x_stride = hypre_VectorVectorStride(x);
+   HYPRE_Int      y_stride = hypre_VectorVectorStride(y);
+
+   HYPRE_Int      i, j;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i,j) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < k; j++)
+   {
+      HYPRE_Complex *xj = x_data + (size_t) j * x_stride;
+      HYPRE_Complex *yj = y_data + (size_t) j * y_stride;
+      HYPRE_Complex  a  = alpha[j];
+      HYPRE_Complex  b  = beta[j];
+
+      for (i = 0; i < size; i++)
+      {
+         yj[i] = a * xj[i] + b * yj[i];
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -201,6 +201,21 @@ HYPRE_Int
 HYPRE_SStructSysPFMGSetSkipRelax(HYPRE_SStructSolver solver,
                                  HYPRE_Int           skip_relax);
 
+/**
+ * (Optional) Store the matrix of every level node-interleaved: at each cell,
+ * the nvars x nvars coupling blocks of all stencil offsets are contiguous.
+ * Relaxation and residual computations then work on small dense blocks,
+ * which pays off for systems with several strongly coupled variables.  This
+ * keeps a second copy of the coefficients, including those of the input
+ * matrix; that copy belongs to the solver and is freed by Destroy, and the
+ * input matrix itself is left unchanged.
+ * Only variables of the same type and at most 8 of them are supported;
+ * otherwise the setting is ignored.  The default is 0 (off).
+ **/
+HYPRE_Int
+HYPRE_SStructSysPFMGSetInterleaved(HYPRE_SStructSolver solver,
+                                   HYPRE_Int           interleaved);
+
 /*
  * RE-VISIT
  **/
@@ -155,6 +155,16 @@ HYPRE_SStructSysPFMGSetSkipRelax( HYPRE_SStructSolver solver,
    return ( hypre_SysPFMGSetSkipRelax( (void *) solver, skip_relax) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructSysPFMGSetInterleaved( HYPRE_SStructSolver solver,
+                                    HYPRE_Int          interleaved )
+{
+   return ( hypre_SysPFMGSetInterleaved( (void *) solver, interleaved) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -9,10 +9,72 @@
 #include "_hypre_parcsr_ls.h"
 #include "_hypre_struct_mv.hpp"
 
-#include "gselim.h"
+/*--------------------------------------------------------------------------
+ * Factor the nxn intra-nodal block A in place, doing the same elimination as
+ * hypre_gselim.  The multipliers are stored below the diagonal (zero for a
+ * column with a zero pivot, which hypre_gselim skips).
+ *--------------------------------------------------------------------------*/
 
-/* TODO consider adding it to semistruct header files */
-#define HYPRE_MAXVARS 4
+#define hypre_NodeRelaxFactor(A, n)                    \
+{                                                      \
+   HYPRE_Int    j, k, m;                               \
+   HYPRE_Real   factor;                                \
+   HYPRE_Real   divA;                                  \
+   for (k = 0; k < n - 1; k++)                         \
+   {                                                   \
+      if (A[k*n+k] != 0.0)                             \
+      {                                                \
+         divA = 1.0 / A[k*n+k];                        \
+         for (j = k + 1; j < n; j++)                   \
+         {                                             \
+            if (A[j*n+k] != 0.0)                       \
+            {                                          \
+               factor = A[j*n+k] * divA;               \
+               for (m = k + 1; m < n; m++)             \
+               {                                       \
+                  A[j*n+m] -= factor * A[k*n+m];       \
+               }                                       \
+               A[j*n+k] = factor;                      \
+            }                                          \
+         }                                             \
+      }                                                \
+      else                                             \
+      {                                                \
+         for (j = k + 1; j < n; j++)                   \
+         {                                             \
+            A[j*n+k] = 0.0;                            \
+         }                                             \
+      }                                                \
+   }                                                   \
+}
+
+/*--------------------------------------------------------------------------
+ * Solve with a block factored by hypre_NodeRelaxFactor, overwriting x
+ *--------------------------------------------------------------------------*/
+
+#define hypre_NodeRelaxSolve(A, x, n)                  \
+{                                                      \
+   HYPRE_Int    j, k;                                  \
+   for (k = 0; k < n - 1; k++)                         \
+   {                                                   \
+      for (j = k + 1; j < n; j++)                      \
+      {                                                \
+         x[j] -= A[j*n+k] * x[k];                      \
+      }                                                \
+   }                                                   \
+   for (k = n - 1; k > 0; --k)                         \
+   {                                                   \
+      if (A[k*n+k] != 0.0)                             \
+      {                                                \
+         x[k] /= A[k*n+k];                             \
+         for (j = 0; j < k; j++)                       \
+         {                                             \
+            x[j] -= x[k] * A[j*n+k];                   \
+         }                                             \
+      }                                                \
+   }                                                   \
+   if (A[0] != 0.0) x[0] /= A[0];                      \
+}
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -41,6 +103,14 @@ typedef struct
 
    HYPRE_Int             **diag_rank;
 
+   /* factored intra-nodal blocks, stored node by node for each box */
+   HYPRE_Int               num_diag_boxes;
+   HYPRE_Real            **diag_lu;
+
+   /* x offsets of the node-interleaved matrix coefficients, if A has them */
+   HYPRE_Int               num_ioffsets;
+   HYPRE_Int              *xoffsets;
+
    /* defines sends and recieves for each struct_vector */
    hypre_ComputePkg     ***svec_compute_pkgs;
    hypre_CommHandle      **comm_handle;
@@ -96,6 +166,10 @@ hypre_NodeRelaxCreate( MPI_Comm  comm )
    (relax_data -> nodeset_strides)  = NULL;
    (relax_data -> nodeset_indices)  = NULL;
    (relax_data -> diag_rank)        = NULL;
+   (relax_data -> num_diag_boxes)   = 0;
+   (relax_data -> diag_lu)          = NULL;
+   (relax_data -> num_ioffsets)     = 0;
+   (relax_data -> xoffsets)         = NULL;
    (relax_data -> t)                = NULL;
    /*
    (relax_data -> A_loc)            = NULL;
@@ -167,6 +241,12 @@ hypre_NodeRelaxDestroy( void *relax_vdata )
          hypre_TFree((relax_data -> diag_rank)[vi], HYPRE_MEMORY_HOST);
       }
       hypre_TFree(relax_data -> diag_rank, HYPRE_MEMORY_HOST);
+      for (i = 0; i < (relax_data -> num_diag_boxes); i++)
+      {
+         hypre_TFree((relax_data -> diag_lu)[i], memory_location);
+      }
+      hypre_TFree(relax_data -> diag_lu, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> xoffsets, memory_location);
 
       hypre_FinalizeTiming(relax_data -> time_index);
       hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
@@ -194,6 +274,13 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
 
    hypre_SStructPVector  *t;
    HYPRE_Int            **diag_rank;
+   HYPRE_Int              num_diag_boxes;
+   HYPRE_Real           **diag_lu;
+   HYPRE_Real            *Dp;
+   hypre_BoxArray        *A_data_space;
+   hypre_Box             *A_data_box;
+   hypre_Index            unit_stride;
+   hypre_Index            loop_size;
    /*
    HYPRE_Real            *A_loc;
    HYPRE_Real            *x_loc;
@@ -202,6 +289,8 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
    HYPRE_Real           **bp;
    HYPRE_Real           **xp;
    HYPRE_Real           **tp;
+   HYPRE_Real            *_h_Ap[HYPRE_MAXVARS * HYPRE_MAXVARS];
+   HYPRE_Real           **h_Ap;
 
    hypre_ComputeInfo     *compute_info;
    hypre_ComputePkg     **compute_pkgs;
@@ -301,6 +390,71 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
    xp = hypre_TAlloc(HYPRE_Real *, nvars, memory_location);
    tp = hypre_TAlloc(HYPRE_Real *, nvars, memory_location);
    Ap = hypre_TAlloc(HYPRE_Real *, nvars * nvars, memory_location);
+   h_Ap = (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_DEVICE) ? _h_Ap : Ap;
+
+   /*----------------------------------------------------------
+    * Factor the intra-nodal blocks once.  The factors of each
+    * node are stored contiguously, so the relaxation sweeps
+    * read one dense nvars x nvars block per node instead of
+    * gathering it from nvars*nvars separate arrays.
+    *----------------------------------------------------------*/
+
+   A_data_space = hypre_StructMatrixDataSpace(hypre_SStructPMatrixSMatrix(A, 0, 0));
+   num_diag_boxes = hypre_BoxArraySize(A_data_space);
+   diag_lu = hypre_TAlloc(HYPRE_Real *, num_diag_boxes, HYPRE_MEMORY_HOST);
+   hypre_SetIndex(unit_stride, 1);
+   hypre_ForBoxI(i, A_data_space)
+   {
+      A_data_box = hypre_BoxArrayBox(A_data_space, i);
+      box = hypre_BoxArrayBox(hypre_StructGridBoxes(
+                                 hypre_StructMatrixGrid(hypre_SStructPMatrixSMatrix(A, 0, 0))), i);
+
+      diag_lu[i] = hypre_TAlloc(HYPRE_Real, nvars * nvars * hypre_BoxVolume(A_data_box),
+                                memory_location);
+      Dp = diag_lu[i];
+
+      for (vi = 0; vi < nvars; vi++)
+      {
+         for (vj = 0; vj < nvars; vj++)
+         {
+            if (hypre_SStructPMatrixSMatrix(A, vi, vj) != NULL)
+            {
+               h_Ap[vi * nvars + vj] = hypre_StructMatrixBoxData(hypre_SStructPMatrixSMatrix(A, vi, vj),
+                                                                 i, diag_rank[vi][vj]);
+            }
+            else
+            {
+               h_Ap[vi * nvars + vj] = NULL;
+            }
+         }
+      }
+      if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_DEVICE)
+      {
+         hypre_TMemcpy(Ap, h_Ap, HYPRE_Real *, nvars * nvars, memory_location, HYPRE_MEMORY_HOST);
+      }
+
+      hypre_BoxGetSize(box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(Ap,Dp)
+      hypre_BoxLoop1Begin(ndim, loop_size,
+                          A_data_box, hypre_BoxIMin(box), unit_stride, Ai);
+      {
+         HYPRE_Int   vi, vj;
+         HYPRE_Real *D = Dp + Ai * nvars * nvars;
+
+         for (vi = 0; vi < nvars; vi++)
+         {
+            for (vj = 0; vj < nvars; vj++)
+            {
+               HYPRE_Real *Apij = Ap[vi * nvars + vj];
+               D[vi * nvars + vj] = Apij ? Apij[Ai] : 0.0;
+            }
+         }
+         hypre_NodeRelaxFactor(D, nvars);
+      }
+      hypre_BoxLoop1End(Ai);
+#undef DEVICE_VAR
+   }
 
    /*----------------------------------------------------------
     * Set up the compute packages for each nodeset
@@ -506,6 +660,16 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
    hypre_SStructPVectorRef(b, &(relax_data -> b));
 
    (relax_data -> diag_rank) = diag_rank;
+   (relax_data -> num_diag_boxes) = num_diag_boxes;
+   (relax_data -> diag_lu)   = diag_lu;
+   hypre_TFree(relax_data -> xoffsets, memory_location);
+   (relax_data -> num_ioffsets) = 0;
+   if (hypre_SStructPMatrixIData(A) != NULL)
+   {
+      (relax_data -> num_ioffsets) = hypre_SStructPMatrixNumIOffsets(A);
+      (relax_data -> xoffsets) = hypre_TAlloc(HYPRE_Int, hypre_SStructPMatrixNumIOffsets(A),
+                                              memory_location);
+   }
    /*
    (relax_data -> A_loc)     = A_loc;
    (relax_data -> x_loc)     = x_loc;
@@ -540,6 +704,184 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_NodeRelaxBoxInterleaved
+ *
+ * One sweep over the compute boxes of grid box i using the node-interleaved
+ * coefficients of A: t = D^{-1} (b - (A - D) x) at each node, with the
+ * off-diagonal coupling blocks read contiguously.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_NodeRelaxBoxInterleaved( hypre_NodeRelaxData  *relax_data,
+                               hypre_SStructPMatrix *A,
+                               hypre_SStructPVector *b,
+                               hypre_SStructPVector *x,
+                               hypre_SStructPVector *t,
+                               HYPRE_Int             i,
+                               hypre_BoxArray       *compute_box_a,
+                               hypre_IndexRef        stride )
+{
+   HYPRE_Int             ndim            = hypre_SStructPMatrixNDim(A);
+   HYPRE_Int             nvars           = hypre_SStructPMatrixNVars(A);
+   HYPRE_Int             num_ioffsets    = (relax_data -> num_ioffsets);
+   hypre_Index          *ioffsets        = hypre_SStructPMatrixIOffsets(A);
+   HYPRE_Int            *xoffsets        = (relax_data -> xoffsets);
+   HYPRE_Real          **bp              = (relax_data -> bp);
+   HYPRE_Real          **xp              = (relax_data -> xp);
+   HYPRE_Real          **tp              = (relax_data -> tp);
+   HYPRE_Real           *Dp              = (relax_data -> diag_lu)[i];
+   HYPRE_Real           *Mp              = hypre_SStructPMatrixIBoxData(A, i);
+   HYPRE_MemoryLocation  memory_location = (relax_data -> memory_location);
+   HYPRE_Int             on_device;
+
+   HYPRE_Real           *_h_bp[HYPRE_MAXVARS];
+   HYPRE_Real           *_h_xp[HYPRE_MAXVARS];
+   HYPRE_Real           *_h_tp[HYPRE_MAXVARS];
+   HYPRE_Int            *_h_xoffsets = NULL;
+   HYPRE_Real          **h_bp;
+   HYPRE_Real          **h_xp;
+   HYPRE_Real          **h_tp;
+   HYPRE_Int            *h_xoffsets;
+
+   hypre_Box            *M_box;
+   hypre_Box            *A_data_box;
+   hypre_Box            *b_data_box;
+   hypre_Box            *x_data_box;
+   hypre_Box            *t_data_box;
+   hypre_Box            *compute_box;
+   hypre_IndexRef        start;
+   hypre_Index           loop_size;
+   HYPRE_Int             u0, u, vi, j;
+
+   on_device = (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_DEVICE);
+   if (on_device)
+   {
+      _h_xoffsets = hypre_TAlloc(HYPRE_Int, num_ioffsets, HYPRE_MEMORY_HOST);
+      h_bp = _h_bp;
+      h_xp = _h_xp;
+      h_tp = _h_tp;
+      h_xoffsets = _h_xoffsets;
+   }
+   else
+   {
+      h_bp = bp;
+      h_xp = xp;
+      h_tp = tp;
+      h_xoffsets = xoffsets;
+   }
+
+   M_box = hypre_BoxArrayBox(hypre_StructGridBoxes(
+                                hypre_StructVectorGrid(hypre_SStructPVectorSVector(x, 0))), i);
+   A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(
+                                     hypre_SStructPMatrixSMatrix(A, 0, 0)), i);
+   b_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(
+                                     hypre_SStructPVectorSVector(b, 0)), i);
+   x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(
+                                     hypre_SStructPVectorSVector(x, 0)), i);
+   t_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(
+                                     hypre_SStructPVectorSVector(t, 0)), i);
+
+   for (vi = 0; vi < nvars; vi++)
+   {
+      h_bp[vi] = hypre_StructVectorBoxData(hypre_SStructPVectorSVector(b, vi), i);
+      h_xp[vi] = hypre_StructVectorBoxData(hypre_SStructPVectorSVector(x, vi), i);
+      h_tp[vi] = hypre_StructVectorBoxData(hypre_SStructPVectorSVector(t, vi), i);
+   }
+
+   /* The zero offset holds the intra-nodal blocks, which are in Dp */
+   u0 = -1;
+   for (u = 0; u < num_ioffsets; u++)
+   {
+      h_xoffsets[u] = hypre_BoxOffsetDistance(x_data_box, ioffsets[u]);
+      if (hypre_IndexEqual(ioffsets[u], 0, ndim))
+      {
+         u0 = u;
+      }
+   }
+
+   if (on_device)
+   {
+      hypre_TMemcpy(bp, h_bp, HYPRE_Real *, nvars, memory_location, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(xp, h_xp, HYPRE_Real *, nvars, memory_location, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(tp, h_tp, HYPRE_Real *, nvars, memory_location, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(xoffsets, h_xoffsets, HYPRE_Int, num_ioffsets,
+                    memory_location, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_ForBoxI(j, compute_box_a)
+   {
+      compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+      start = hypre_BoxIMin(compute_box);
+      hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+
+#define DEVICE_VAR is_device_ptr(tp,bp)
+      hypre_BoxLoop2Begin(ndim, loop_size,
+                          b_data_box, start, stride, bi,
+                          t_data_box, start, stride, ti);
+      {
+         HYPRE_Int vi;
+         for (vi = 0; vi < nvars; vi++)
+         {
+            tp[vi][ti] = bp[vi][bi];
+         }
+      }
+      hypre_BoxLoop2End(bi, ti);
+#undef DEVICE_VAR
+
+#define DEVICE_VAR is_device_ptr(Mp,Dp,xp,tp,xoffsets)
+      hypre_BoxLoop4Begin(ndim, loop_size,
+                          M_box, start, stride, Mi,
+                          A_data_box, start, stride, Ai,
+                          x_data_box, start, stride, xi,
+                          t_data_box, start, stride, ti);
+      {
+         HYPRE_Int         u, vi, vj;
+         HYPRE_Real        x_loc[HYPRE_MAXVARS];
+         HYPRE_Real        t_loc[HYPRE_MAXVARS];
+         const HYPRE_Real *M = Mp + Mi * num_ioffsets * nvars * nvars;
+         HYPRE_Real       *D = Dp + Ai * nvars * nvars;
+
+         for (vi = 0; vi < nvars; vi++)
+         {
+            t_loc[vi] = tp[vi][ti];
+         }
+         for (u = 0; u < num_ioffsets; u++, M += nvars * nvars)
+         {
+            if (u == u0)
+            {
+               continue;
+            }
+            for (vj = 0; vj < nvars; vj++)
+            {
+               x_loc[vj] = xp[vj][xi + xoffsets[u]];
+            }
+            for (vi = 0; vi < nvars; vi++)
+            {
+               for (vj = 0; vj < nvars; vj++)
+               {
+                  t_loc[vi] -= M[vi * nvars + vj] * x_loc[vj];
+               }
+            }
+         }
+
+         hypre_NodeRelaxSolve(D, t_loc, nvars);
+
+         for (vi = 0; vi < nvars; vi++)
+         {
+            tp[vi][ti] = t_loc[vi];
+         }
+      }
+      hypre_BoxLoop4End(Mi, Ai, xi, ti);
+#undef DEVICE_VAR
+   }
+
+   hypre_TFree(_h_xoffsets, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -562,6 +904,8 @@ hypre_NodeRelax(  void                 *relax_vdata,
    hypre_ComputePkg    **compute_pkgs      = (relax_data -> compute_pkgs);
    hypre_ComputePkg   ***svec_compute_pkgs = (relax_data ->svec_compute_pkgs);
    hypre_CommHandle    **comm_handle       = (relax_data -> comm_handle);
+   HYPRE_Real          **diag_lu           = (relax_data -> diag_lu);
+   HYPRE_Real           *Dp;
 
    hypre_ComputePkg     *compute_pkg;
    hypre_ComputePkg     *svec_compute_pkg;
@@ -574,36 +918,27 @@ hypre_NodeRelax(  void                 *relax_vdata,
    hypre_Box            *x_data_box;
    hypre_Box            *t_data_box;
 
-   /*
-   HYPRE_Real           *tA_loc = (relax_data -> A_loc);
-   HYPRE_Real           *tx_loc = (relax_data -> x_loc);
-   */
-   HYPRE_Real          **Ap = (relax_data -> Ap);
    HYPRE_Real          **bp = (relax_data -> bp);
    HYPRE_Real          **xp = (relax_data -> xp);
    HYPRE_Real          **tp = (relax_data -> tp);
-   HYPRE_Real           *_h_Ap[HYPRE_MAXVARS * HYPRE_MAXVARS];
    HYPRE_Real           *_h_bp[HYPRE_MAXVARS];
    HYPRE_Real           *_h_xp[HYPRE_MAXVARS];
    HYPRE_Real           *_h_tp[HYPRE_MAXVARS];
-   HYPRE_Real          **h_Ap;
    HYPRE_Real          **h_bp;
    HYPRE_Real          **h_xp;
    HYPRE_Real          **h_tp;
 
    HYPRE_MemoryLocation  memory_location = relax_data -> memory_location;
 
-   /* Ap, bp, xp, tp are device pointers */
+   /* bp, xp, tp are device pointers */
    if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_DEVICE)
    {
-      h_Ap = _h_Ap;
       h_bp = _h_bp;
       h_xp = _h_xp;
       h_tp = _h_tp;
    }
    else
    {
-      h_Ap = Ap;
       h_bp = bp;
       h_xp = xp;
       h_tp = tp;
@@ -702,27 +1037,15 @@ hypre_NodeRelax(  void                 *relax_vdata,
             x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(
                                               hypre_SStructPVectorSVector(x, 0)), i);
 
+            Dp = diag_lu[i];
             for (vi = 0; vi < nvars; vi++)
             {
-               for (vj = 0; vj < nvars; vj++)
-               {
-                  if (hypre_SStructPMatrixSMatrix(A, vi, vj) != NULL)
-                  {
-                     h_Ap[vi * nvars + vj] = hypre_StructMatrixBoxData( hypre_SStructPMatrixSMatrix(A, vi, vj),
-                                                                        i, diag_rank[vi][vj] );
-                  }
-                  else
-                  {
-                     h_Ap[vi * nvars + vj] = NULL;
-                  }
-               }
                h_bp[vi] = hypre_StructVectorBoxData( hypre_SStructPVectorSVector(b, vi), i );
                h_xp[vi] = hypre_StructVectorBoxData( hypre_SStructPVectorSVector(x, vi), i );
             }
 
             if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_DEVICE)
             {
-               hypre_TMemcpy(Ap, h_Ap, HYPRE_Real *, nvars * nvars, memory_location, HYPRE_MEMORY_HOST);
                hypre_TMemcpy(bp, h_bp, HYPRE_Real *, nvars, memory_location, HYPRE_MEMORY_HOST);
                hypre_TMemcpy(xp, h_xp, HYPRE_Real *, nvars, memory_location, HYPRE_MEMORY_HOST);
             }
@@ -734,38 +1057,28 @@ hypre_NodeRelax(  void                 *relax_vdata,
                start = hypre_BoxIMin(compute_box);
                hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
-#define DEVICE_VAR is_device_ptr(bp,Ap,xp)
+#define DEVICE_VAR is_device_ptr(bp,Dp,xp)
                hypre_BoxLoop3Begin(ndim, loop_size,
                                    A_data_box, start, stride, Ai,
                                    b_data_box, start, stride, bi,
                                    x_data_box, start, stride, xi);
                {
-                  HYPRE_Int vi, vj, err;
-                  //HYPRE_Real *A_loc = tA_loc + hypre_BoxLoopBlock() * nvars * nvars;
-                  //HYPRE_Real *x_loc = tx_loc + hypre_BoxLoopBlock() * nvars;
-                  HYPRE_Real A_loc[HYPRE_MAXVARS * HYPRE_MAXVARS];
+                  HYPRE_Int vi;
+                  HYPRE_Real *D = Dp + Ai * nvars * nvars;
                   HYPRE_Real x_loc[HYPRE_MAXVARS];
                   /*------------------------------------------------
-                   * Copy rhs and matrix for diagonal coupling
-                   * (intra-nodal) into local storage.
+                   * Copy rhs into local storage.
                    *----------------------------------------------*/
                   for (vi = 0; vi < nvars; vi++)
                   {
                      HYPRE_Real *bpi = bp[vi];
                      x_loc[vi] = bpi[bi];
-                     for (vj = 0; vj < nvars; vj++)
-                     {
-                        HYPRE_Real *Apij = Ap[vi * nvars + vj];
-                        A_loc[vi * nvars + vj] = Apij ? Apij[Ai] : 0.0;
-                     }
                   }
 
                   /*------------------------------------------------
                    * Invert intra-nodal coupling
                    *----------------------------------------------*/
-                  hypre_gselim(A_loc, x_loc, nvars, err);
-                  (void) err;
-                  /* TODO (VPM): need a way to check error codes on device */
+                  hypre_NodeRelaxSolve(D, x_loc, nvars);
 
                   /*------------------------------------------------
                    * Copy solution from local storage.
@@ -836,6 +1149,13 @@ hypre_NodeRelax(  void                 *relax_vdata,
          {
             compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
 
+            if ((relax_data -> xoffsets) && hypre_SStructPMatrixIData(A) &&
+                hypre_SStructPMatrixNumIOffsets(A) == (relax_data -> num_ioffsets))
+            {
+               hypre_NodeRelaxBoxInterleaved(relax_data, A, b, x, t, i, compute_box_a, stride);
+               continue;
+            }
+
             A_data_box = hypre_BoxArrayBox( hypre_StructMatrixDataSpace(
                                                hypre_SStructPMatrixSMatrix(A, 0, 0)), i );
             b_data_box = hypre_BoxArrayBox( hypre_StructVectorDataSpace(
@@ -917,60 +1237,30 @@ hypre_NodeRelax(  void                 *relax_vdata,
                   }
                }
 
-               for (vi = 0; vi < nvars; vi++)
-               {
-                  for (vj = 0; vj < nvars; vj++)
-                  {
-                     if (hypre_SStructPMatrixSMatrix(A, vi, vj) != NULL)
-                     {
-                        h_Ap[vi * nvars + vj] = hypre_StructMatrixBoxData( hypre_SStructPMatrixSMatrix(A, vi, vj),
-                                                                           i, diag_rank[vi][vj]);
-                     }
-                     else
-                     {
-                        h_Ap[vi * nvars + vj] = NULL;
-                     }
-                  }
-               }
-
-               if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_DEVICE)
-               {
-                  hypre_TMemcpy(Ap, h_Ap, HYPRE_Real *, nvars * nvars, memory_location, HYPRE_MEMORY_HOST);
-               }
+               Dp = diag_lu[i];
 
-#define DEVICE_VAR is_device_ptr(tp,Ap)
+#define DEVICE_VAR is_device_ptr(tp,Dp)
                hypre_BoxLoop2Begin(ndim, loop_size,
                                    A_data_box, start, stride, Ai,
                                    t_data_box, start, stride, ti);
                {
-                  HYPRE_Int vi, vj, err;
-                  /*
-                  HYPRE_Real *A_loc = tA_loc + hypre_BoxLoopBlock() * nvars * nvars;
-                  HYPRE_Real *x_loc = tx_loc + hypre_BoxLoopBlock() * nvars;
-                  */
-                  HYPRE_Real A_loc[HYPRE_MAXVARS * HYPRE_MAXVARS];
+                  HYPRE_Int vi;
+                  HYPRE_Real *D = Dp + Ai * nvars * nvars;
                   HYPRE_Real x_loc[HYPRE_MAXVARS];
 
                   /*------------------------------------------------
-                   * Copy rhs and matrix for diagonal coupling
-                   * (intra-nodal) into local storage.
+                   * Copy rhs into local storage.
                    *----------------------------------------------*/
                   for (vi = 0; vi < nvars; vi++)
                   {
                      HYPRE_Real *tpi = tp[vi];
                      x_loc[vi] = tpi[ti];
-                     for (vj = 0; vj < nvars; vj++)
-                     {
-                        HYPRE_Real *Apij = Ap[vi * nvars + vj];
-                        A_loc[vi * nvars + vj] = Apij ? Apij[Ai] : 0.0;
-                     }
                   }
 
                   /*------------------------------------------------
                    * Invert intra-nodal coupling
                    *----------------------------------------------*/
-                  hypre_gselim(A_loc, x_loc, nvars, err);
-                  (void) err;
+                  hypre_NodeRelaxSolve(D, x_loc, nvars);
 
                   /*------------------------------------------------
                    * Copy solution from local storage.
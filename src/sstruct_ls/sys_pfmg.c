@@ -36,6 +36,7 @@ hypre_SysPFMGCreate( MPI_Comm  comm )
    (sys_pfmg_data -> num_pre_relax)    = 1;
    (sys_pfmg_data -> num_post_relax)   = 1;
    (sys_pfmg_data -> skip_relax)       = 1;
+   (sys_pfmg_data -> interleaved)      = 0;
    (sys_pfmg_data -> logging)          = 0;
    (sys_pfmg_data -> print_level)      = 0;
 
@@ -241,6 +242,20 @@ hypre_SysPFMGSetSkipRelax( void *sys_pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SysPFMGSetInterleaved( void *sys_pfmg_vdata,
+                             HYPRE_Int  interleaved )
+{
+   hypre_SysPFMGData *sys_pfmg_data = (hypre_SysPFMGData *)sys_pfmg_vdata;
+
+   (sys_pfmg_data -> interleaved) = interleaved;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -49,6 +49,7 @@ hypre_SysPFMGSetup( void                 *sys_pfmg_vdata,
    HYPRE_Int             usr_jacobi_weight = (sys_pfmg_data -> usr_jacobi_weight);
    HYPRE_Real            jacobi_weight    = (sys_pfmg_data -> jacobi_weight);
    HYPRE_Int             skip_relax = (sys_pfmg_data -> skip_relax);
+   HYPRE_Int             interleaved = (sys_pfmg_data -> interleaved);
    HYPRE_Real           *dxyz       = (sys_pfmg_data -> dxyz);
 
    HYPRE_Int             max_iter;
@@ -453,6 +454,19 @@ hypre_SysPFMGSetup( void                 *sys_pfmg_vdata,
                                  cindex, findex, stride);
    }
 
+   /* keep node-interleaved copies of the level matrices for the relaxation
+    * and residual kernels; A belongs to the user, so level 0 gets a private
+    * pmatrix that shares its coefficients */
+   if (interleaved)
+   {
+      hypre_SStructPMatrixDestroy(A_l[0]);
+      hypre_SStructPMatrixCreateShared(A, &A_l[0]);
+      for (l = 0; l < num_levels; l++)
+      {
+         hypre_SStructPMatrixSetInterleaved(A_l[l], 1);
+      }
+   }
+
    /* set up fine grid relaxation */
    relax_data_l[0] = hypre_SysPFMGRelaxCreate(comm);
    hypre_SysPFMGRelaxSetTol(relax_data_l[0], 0.0);
@@ -72,11 +72,15 @@ hypre_SysPFMGSolve( void                 *sys_pfmg_vdata,
    hypre_SStructPVectorRef(hypre_SStructVectorPVector(b_in, 0), &b);
    hypre_SStructPVectorRef(hypre_SStructVectorPVector(x_in, 0), &x);
 
-
-   hypre_SStructPMatrixDestroy(A_l[0]);
+   /* with interleaved storage, A_l[0] is the private pmatrix that shares the
+    * coefficients of A (see SysPFMGSetup) */
+   if (!(sys_pfmg_data -> interleaved))
+   {
+      hypre_SStructPMatrixDestroy(A_l[0]);
+      hypre_SStructPMatrixRef(A, &A_l[0]);
+   }
    hypre_SStructPVectorDestroy(b_l[0]);
    hypre_SStructPVectorDestroy(x_l[0]);
-   hypre_SStructPMatrixRef(A, &A_l[0]);
    hypre_SStructPVectorRef(b, &b_l[0]);
    hypre_SStructPVectorRef(x, &x_l[0]);
 
@@ -141,6 +141,8 @@ HYPRE_SStructMatrixCreate( MPI_Comm              comm,
    /* GEC0902 setting the default of the object_type to HYPRE_SSTRUCT */
 
    hypre_SStructMatrixObjectType(matrix) = HYPRE_SSTRUCT;
+   hypre_SStructMatrixDirectParCSR(matrix) = 0;
+   hypre_SStructMatrixParCSRMap(matrix)    = NULL;
 
    *matrix_ptr = matrix;
 
@@ -189,6 +191,14 @@ HYPRE_SStructMatrixDestroy( HYPRE_SStructMatrix matrix )
             hypre_SStructPMatrixDestroy(pmatrices[part]);
          }
          HYPRE_SStructGraphDestroy(graph);
+         if (hypre_SStructMatrixDirectParCSR(matrix) &&
+             hypre_SStructMatrixIJMatrix(matrix) &&
+             hypre_SStructMatrixParCSRMatrix(matrix) != (hypre_ParCSRMatrix *)
+             hypre_IJMatrixObject(hypre_SStructMatrixIJMatrix(matrix)))
+         {
+            hypre_ParCSRMatrixDestroy(hypre_SStructMatrixParCSRMatrix(matrix));
+         }
+         hypre_SStructParCSRMapDestroy(hypre_SStructMatrixParCSRMap(matrix));
          hypre_TFree(splits, HYPRE_MEMORY_HOST);
          hypre_TFree(pmatrices, HYPRE_MEMORY_HOST);
          hypre_TFree(symmetric, HYPRE_MEMORY_HOST);
@@ -239,6 +249,53 @@ HYPRE_SStructMatrixInitialize( HYPRE_SStructMatrix matrix )
    hypre_SStructGrid      *grid, *domain_grid;
    HYPRE_Int               ilower, iupper, jlower, jupper;
    HYPRE_Int               matrix_type = hypre_SStructMatrixObjectType(matrix);
+   HYPRE_Int               vi, vj;
+
+   /* S/U-matrix split.  Unless the ParCSR object is to be built directly from
+    * the S- and U-matrices, put all coefficients in the U-matrix for object
+    * types other than HYPRE_SSTRUCT and HYPRE_STRUCT.  The direct build does
+    * not expand symmetric S-matrix storage and runs on the host only. */
+   if (matrix_type != HYPRE_SSTRUCT && matrix_type != HYPRE_STRUCT)
+   {
+#if defined(HYPRE_USING_GPU)
+      hypre_SStructMatrixDirectParCSR(matrix) = 0;
+#endif
+      for (part = 0; part < nparts; part++)
+      {
+         nvars = hypre_SStructPGridNVars(hypre_SStructGraphPGrid(graph, part));
+         for (vi = 0; vi < nvars; vi++)
+         {
+            for (vj = 0; vj < nvars; vj++)
+            {
+               if (symmetric[part][vi][vj])
+               {
+                  hypre_SStructMatrixDirectParCSR(matrix) = 0;
+               }
+            }
+         }
+      }
+
+      if (!hypre_SStructMatrixDirectParCSR(matrix))
+      {
+         for (part = 0; part < nparts; part++)
+         {
+            nvars = hypre_SStructPGridNVars(hypre_SStructGraphPGrid(graph, part));
+            for (var = 0; var < nvars; var++)
+            {
+               split = hypre_SStructMatrixSplit(matrix, part, var);
+               stencil_size = hypre_SStructStencilSize(stencils[part][var]);
+               for (i = 0; i < stencil_size; i++)
+               {
+                  split[i] = -1;
+               }
+            }
+         }
+      }
+   }
+   else
+   {
+      hypre_SStructMatrixDirectParCSR(matrix) = 0;
+   }
 
    /* S-matrix */
    for (part = 0; part < nparts; part++)
@@ -846,6 +903,22 @@ HYPRE_SStructMatrixAssemble( HYPRE_SStructMatrix matrix )
    /* U-matrix */
    hypre_SStructUMatrixAssemble(matrix);
 
+   /* ParCSR object built directly from the S- and U-matrices.  After the
+    * first build, its values are refilled in place as long as the U-matrix
+    * pattern is unchanged, so references to the object stay valid. */
+   if (hypre_SStructMatrixDirectParCSR(matrix))
+   {
+      hypre_ParCSRMatrix *parcsr_A = hypre_SStructMatrixParCSRMatrix(matrix);
+
+      if (parcsr_A == (hypre_ParCSRMatrix *)
+          hypre_IJMatrixObject(hypre_SStructMatrixIJMatrix(matrix)))
+      {
+         parcsr_A = NULL;
+      }
+      hypre_SStructMatrixToParCSR(matrix, &parcsr_A);
+      hypre_SStructMatrixParCSRMatrix(matrix) = parcsr_A;
+   }
+
    return hypre_error_flag;
 }
 
@@ -925,36 +998,20 @@ HYPRE_Int
 HYPRE_SStructMatrixSetObjectType( HYPRE_SStructMatrix  matrix,
                                   HYPRE_Int            type )
 {
-   hypre_SStructGraph     *graph    = hypre_SStructMatrixGraph(matrix);
-   HYPRE_Int            ***splits   = hypre_SStructMatrixSplits(matrix);
-   HYPRE_Int               nparts   = hypre_SStructMatrixNParts(matrix);
-   hypre_SStructStencil ***stencils = hypre_SStructGraphStencils(graph);
+   /* The S/U-matrix split for this object type is set in Initialize */
+   hypre_SStructMatrixObjectType(matrix) = type ;
 
-   hypre_SStructPGrid     *pgrid;
-   HYPRE_Int               nvars;
-   HYPRE_Int               stencil_size;
-   HYPRE_Int               part, var, i;
+   return hypre_error_flag;
+}
 
-   hypre_SStructMatrixObjectType(matrix) = type ;
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
 
-   /* RDF: This and all other modifications to 'split' really belong
-    * in the Initialize routine */
-   if (type != HYPRE_SSTRUCT && type != HYPRE_STRUCT)
-   {
-      for (part = 0; part < nparts; part++)
-      {
-         pgrid = hypre_SStructGraphPGrid(graph, part);
-         nvars = hypre_SStructPGridNVars(pgrid);
-         for (var = 0; var < nvars; var++)
-         {
-            stencil_size = hypre_SStructStencilSize(stencils[part][var]);
-            for (i = 0; i < stencil_size; i++)
-            {
-               splits[part][var][i] = -1;
-            }
-         }
-      }
-   }
+HYPRE_Int
+HYPRE_SStructMatrixSetDirectParCSR( HYPRE_SStructMatrix  matrix,
+                                    HYPRE_Int            direct )
+{
+   hypre_SStructMatrixDirectParCSR(matrix) = direct;
 
    return hypre_error_flag;
 }
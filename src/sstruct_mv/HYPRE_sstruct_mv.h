@@ -798,6 +798,23 @@ HYPRE_Int
 HYPRE_SStructMatrixSetObjectType(HYPRE_SStructMatrix  matrix,
                                  HYPRE_Int            type);
 
+/**
+ * (Optional) Build the \c HYPRE_PARCSR object directly from the grid and
+ * graph instead of through IJ assembly.  Stencil coefficients are then stored
+ * in structured form until \c HYPRE_SStructMatrixAssemble, which computes the
+ * ParCSR row sizes and column maps from the stencils and fills the ParCSR
+ * arrays in one pass.  The ParCSR object should then be modified only through
+ * the SStruct interface.  Later calls to \c HYPRE_SStructMatrixAssemble
+ * refill the values of the same ParCSR object in place, so references to it
+ * stay valid; it is rebuilt only if the nonzero pattern of the non-stencil
+ * couplings changed.  Ignored for other object types, for matrices with
+ * symmetric stencil storage, and in GPU builds.  Must be called before
+ * \c HYPRE_SStructMatrixInitialize.  The default is 0 (off).
+ **/
+HYPRE_Int
+HYPRE_SStructMatrixSetDirectParCSR(HYPRE_SStructMatrix  matrix,
+                                   HYPRE_Int            direct);
+
 /**
  * Get a reference to the constructed matrix object.
  *
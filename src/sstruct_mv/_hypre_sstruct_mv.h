@@ -548,6 +548,9 @@ typedef struct hypre_SStructGraph_struct
 #ifndef hypre_SSTRUCT_MATRIX_HEADER
 #define hypre_SSTRUCT_MATRIX_HEADER
 
+/* Maximum number of variables for the node-interleaved kernels */
+#define HYPRE_MAXVARS 8
+
 /*--------------------------------------------------------------------------
  * hypre_SStructMatrix:
  *--------------------------------------------------------------------------*/
@@ -571,10 +574,41 @@ typedef struct
 
    HYPRE_Int               accumulated;  /* AddTo values accumulated? */
 
+   /* Node-interleaved copy of the coefficients (optional).  For every cell of
+    * the grid boxes, the nvars x nvars coupling blocks of all stencil offsets
+    * are stored contiguously, one block after the other (row-major). */
+   HYPRE_Int               interleaved;  /* keep the interleaved copy? */
+   HYPRE_Int               num_ioffsets; /* union of the stencil offsets */
+   hypre_Index            *ioffsets;
+   HYPRE_Int               num_iboxes;
+   HYPRE_Complex         **idata;        /* one array per grid box */
+
    HYPRE_Int               ref_count;
 
 } hypre_SStructPMatrix;
 
+/*--------------------------------------------------------------------------
+ * hypre_SStructParCSRMap:
+ *   Where each coefficient of a directly built ParCSR object came from, so
+ *   that a later Assemble can refill the diag and offd values in place
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatrix     *umatrix;      /* U-matrix the object was built from */
+   HYPRE_Int               u_diag_nnz;
+   HYPRE_Int               u_offd_nnz;
+
+   HYPRE_Int               nrows;
+   HYPRE_Int              *diag_starts;  /* first S-matrix slot of each row */
+   HYPRE_Int              *offd_starts;
+   HYPRE_Int              *diag_map;     /* S-matrix slot -> diag entry */
+   HYPRE_Int              *offd_map;     /* S-matrix slot -> offd entry */
+   HYPRE_Int              *u_diag_map;   /* U-matrix diag entry -> diag entry */
+   HYPRE_Int              *u_offd_map;   /* U-matrix offd entry -> offd entry */
+
+} hypre_SStructParCSRMap;
+
 typedef struct hypre_SStructMatrix_struct
 {
    MPI_Comm                comm;
@@ -613,6 +647,10 @@ typedef struct hypre_SStructMatrix_struct
    /* GEC0902   adding an object type to the matrix  */
    HYPRE_Int               object_type;
 
+   HYPRE_Int               direct_parcsr; /* Build ParCSR object directly
+                                           * from the S- and U-matrices? */
+   hypre_SStructParCSRMap *parcsr_map;
+
 } hypre_SStructMatrix;
 
 /*--------------------------------------------------------------------------
@@ -644,6 +682,23 @@ typedef struct hypre_SStructMatrix_struct
 #define hypre_SStructMatrixGlobalSize(mat)           ((mat) -> global_size)
 #define hypre_SStructMatrixRefCount(mat)             ((mat) -> ref_count)
 #define hypre_SStructMatrixObjectType(mat)           ((mat) -> object_type)
+#define hypre_SStructMatrixDirectParCSR(mat)         ((mat) -> direct_parcsr)
+#define hypre_SStructMatrixParCSRMap(mat)            ((mat) -> parcsr_map)
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_SStructParCSRMap
+ *--------------------------------------------------------------------------*/
+
+#define hypre_SStructParCSRMapUMatrix(map)           ((map) -> umatrix)
+#define hypre_SStructParCSRMapUDiagNNZ(map)          ((map) -> u_diag_nnz)
+#define hypre_SStructParCSRMapUOffdNNZ(map)          ((map) -> u_offd_nnz)
+#define hypre_SStructParCSRMapNRows(map)             ((map) -> nrows)
+#define hypre_SStructParCSRMapDiagStarts(map)        ((map) -> diag_starts)
+#define hypre_SStructParCSRMapOffdStarts(map)        ((map) -> offd_starts)
+#define hypre_SStructParCSRMapDiagMap(map)           ((map) -> diag_map)
+#define hypre_SStructParCSRMapOffdMap(map)           ((map) -> offd_map)
+#define hypre_SStructParCSRMapUDiagMap(map)          ((map) -> u_diag_map)
+#define hypre_SStructParCSRMapUOffdMap(map)          ((map) -> u_offd_map)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_SStructPMatrix
@@ -668,6 +723,12 @@ hypre_SStructPGridNDim(hypre_SStructPMatrixPGrid(pmat))
 #define hypre_SStructPMatrixSEntriesSize(pmat)      ((pmat) -> sentries_size)
 #define hypre_SStructPMatrixSEntries(pmat)          ((pmat) -> sentries)
 #define hypre_SStructPMatrixAccumulated(pmat)       ((pmat) -> accumulated)
+#define hypre_SStructPMatrixInterleaved(pmat)       ((pmat) -> interleaved)
+#define hypre_SStructPMatrixNumIOffsets(pmat)       ((pmat) -> num_ioffsets)
+#define hypre_SStructPMatrixIOffsets(pmat)          ((pmat) -> ioffsets)
+#define hypre_SStructPMatrixNumIBoxes(pmat)         ((pmat) -> num_iboxes)
+#define hypre_SStructPMatrixIData(pmat)             ((pmat) -> idata)
+#define hypre_SStructPMatrixIBoxData(pmat, b)       ((pmat) -> idata[b])
 #define hypre_SStructPMatrixRefCount(pmat)          ((pmat) -> ref_count)
 
 #endif
@@ -859,6 +920,7 @@ HYPRE_Int HYPRE_SStructMatrixSetSymmetric ( HYPRE_SStructMatrix matrix, HYPRE_In
                                             HYPRE_Int var, HYPRE_Int to_var, HYPRE_Int symmetric );
 HYPRE_Int HYPRE_SStructMatrixSetNSSymmetric ( HYPRE_SStructMatrix matrix, HYPRE_Int symmetric );
 HYPRE_Int HYPRE_SStructMatrixSetObjectType ( HYPRE_SStructMatrix matrix, HYPRE_Int type );
+HYPRE_Int HYPRE_SStructMatrixSetDirectParCSR ( HYPRE_SStructMatrix matrix, HYPRE_Int direct );
 HYPRE_Int HYPRE_SStructMatrixGetObject ( HYPRE_SStructMatrix matrix, void **object );
 HYPRE_Int HYPRE_SStructMatrixPrint ( const char *filename, HYPRE_SStructMatrix matrix,
                                      HYPRE_Int all );
@@ -1005,6 +1067,8 @@ HYPRE_Int hypre_SStructInnerProd ( hypre_SStructVector *x, hypre_SStructVector *
 /* sstruct_matrix.c */
 HYPRE_Int hypre_SStructPMatrixRef ( hypre_SStructPMatrix *matrix,
                                     hypre_SStructPMatrix **matrix_ref );
+HYPRE_Int hypre_SStructPMatrixCreateShared ( hypre_SStructPMatrix *pmatrix,
+                                             hypre_SStructPMatrix **shared_ptr );
 HYPRE_Int hypre_SStructPMatrixCreate ( MPI_Comm comm, hypre_SStructPGrid *pgrid,
                                        hypre_SStructStencil **stencils, hypre_SStructPMatrix **pmatrix_ptr );
 HYPRE_Int hypre_SStructPMatrixDestroy ( hypre_SStructPMatrix *pmatrix );
@@ -1020,6 +1084,9 @@ HYPRE_Int hypre_SStructPMatrixSetSymmetric ( hypre_SStructPMatrix *pmatrix, HYPR
                                              HYPRE_Int to_var, HYPRE_Int symmetric );
 HYPRE_Int hypre_SStructPMatrixPrint ( const char *filename, hypre_SStructPMatrix *pmatrix,
                                       HYPRE_Int all );
+HYPRE_Int hypre_SStructPMatrixSetInterleaved ( hypre_SStructPMatrix *pmatrix,
+                                               HYPRE_Int interleaved );
+HYPRE_Int hypre_SStructPMatrixInterleave ( hypre_SStructPMatrix *pmatrix );
 HYPRE_Int hypre_SStructUMatrixInitialize ( hypre_SStructMatrix *matrix );
 HYPRE_Int hypre_SStructUMatrixSetValues ( hypre_SStructMatrix *matrix, HYPRE_Int part,
                                           hypre_Index index, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, HYPRE_Complex *values,
@@ -1028,6 +1095,9 @@ HYPRE_Int hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix, HYPRE_I
                                             hypre_Box *set_box, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, hypre_Box *value_box,
                                             HYPRE_Complex *values, HYPRE_Int action );
 HYPRE_Int hypre_SStructUMatrixAssemble ( hypre_SStructMatrix *matrix );
+HYPRE_Int hypre_SStructMatrixToParCSR ( hypre_SStructMatrix *matrix,
+                                        hypre_ParCSRMatrix **parcsr_ptr );
+HYPRE_Int hypre_SStructParCSRMapDestroy ( hypre_SStructParCSRMap *map );
 HYPRE_Int hypre_SStructMatrixRef ( hypre_SStructMatrix *matrix, hypre_SStructMatrix **matrix_ref );
 HYPRE_Int hypre_SStructMatrixSplitEntries ( hypre_SStructMatrix *matrix, HYPRE_Int part,
                                             HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, HYPRE_Int *nSentries_ptr,
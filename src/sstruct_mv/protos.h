@@ -79,6 +79,7 @@ HYPRE_Int HYPRE_SStructMatrixSetSymmetric ( HYPRE_SStructMatrix matrix, HYPRE_In
                                             HYPRE_Int var, HYPRE_Int to_var, HYPRE_Int symmetric );
 HYPRE_Int HYPRE_SStructMatrixSetNSSymmetric ( HYPRE_SStructMatrix matrix, HYPRE_Int symmetric );
 HYPRE_Int HYPRE_SStructMatrixSetObjectType ( HYPRE_SStructMatrix matrix, HYPRE_Int type );
+HYPRE_Int HYPRE_SStructMatrixSetDirectParCSR ( HYPRE_SStructMatrix matrix, HYPRE_Int direct );
 HYPRE_Int HYPRE_SStructMatrixGetObject ( HYPRE_SStructMatrix matrix, void **object );
 HYPRE_Int HYPRE_SStructMatrixPrint ( const char *filename, HYPRE_SStructMatrix matrix,
                                      HYPRE_Int all );
@@ -225,6 +226,8 @@ HYPRE_Int hypre_SStructInnerProd ( hypre_SStructVector *x, hypre_SStructVector *
 /* sstruct_matrix.c */
 HYPRE_Int hypre_SStructPMatrixRef ( hypre_SStructPMatrix *matrix,
                                     hypre_SStructPMatrix **matrix_ref );
+HYPRE_Int hypre_SStructPMatrixCreateShared ( hypre_SStructPMatrix *pmatrix,
+                                             hypre_SStructPMatrix **shared_ptr );
 HYPRE_Int hypre_SStructPMatrixCreate ( MPI_Comm comm, hypre_SStructPGrid *pgrid,
                                        hypre_SStructStencil **stencils, hypre_SStructPMatrix **pmatrix_ptr );
 HYPRE_Int hypre_SStructPMatrixDestroy ( hypre_SStructPMatrix *pmatrix );
@@ -240,6 +243,9 @@ HYPRE_Int hypre_SStructPMatrixSetSymmetric ( hypre_SStructPMatrix *pmatrix, HYPR
                                              HYPRE_Int to_var, HYPRE_Int symmetric );
 HYPRE_Int hypre_SStructPMatrixPrint ( const char *filename, hypre_SStructPMatrix *pmatrix,
                                       HYPRE_Int all );
+HYPRE_Int hypre_SStructPMatrixSetInterleaved ( hypre_SStructPMatrix *pmatrix,
+                                               HYPRE_Int interleaved );
+HYPRE_Int hypre_SStructPMatrixInterleave ( hypre_SStructPMatrix *pmatrix );
 HYPRE_Int hypre_SStructUMatrixInitialize ( hypre_SStructMatrix *matrix );
 HYPRE_Int hypre_SStructUMatrixSetValues ( hypre_SStructMatrix *matrix, HYPRE_Int part,
                                           hypre_Index index, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, HYPRE_Complex *values,
@@ -248,6 +254,9 @@ HYPRE_Int hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix, HYPRE_I
                                             hypre_Box *set_box, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, hypre_Box *value_box,
                                             HYPRE_Complex *values, HYPRE_Int action );
 HYPRE_Int hypre_SStructUMatrixAssemble ( hypre_SStructMatrix *matrix );
+HYPRE_Int hypre_SStructMatrixToParCSR ( hypre_SStructMatrix *matrix,
+                                        hypre_ParCSRMatrix **parcsr_ptr );
+HYPRE_Int hypre_SStructParCSRMapDestroy ( hypre_SStructParCSRMap *map );
 HYPRE_Int hypre_SStructMatrixRef ( hypre_SStructMatrix *matrix, hypre_SStructMatrix **matrix_ref );
 HYPRE_Int hypre_SStructMatrixSplitEntries ( hypre_SStructMatrix *matrix, HYPRE_Int part,
                                             HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, HYPRE_Int *nSentries_ptr,
@@ -18,6 +18,47 @@
  * SStructPMatrix routines
  *==========================================================================*/
 
+/*--------------------------------------------------------------------------
+ * Frees the node-interleaved copy of the coefficients, if any
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructPMatrixInterleavedDestroy( hypre_SStructPMatrix *pmatrix )
+{
+   HYPRE_Complex        **idata = hypre_SStructPMatrixIData(pmatrix);
+   HYPRE_MemoryLocation   memory_location;
+   HYPRE_Int              nvars = hypre_SStructPMatrixNVars(pmatrix);
+   HYPRE_Int              b, vi, vj;
+
+   if (idata)
+   {
+      memory_location = HYPRE_MEMORY_HOST;
+      for (vi = 0; vi < nvars; vi++)
+      {
+         for (vj = 0; vj < nvars; vj++)
+         {
+            if (hypre_SStructPMatrixSMatrix(pmatrix, vi, vj) != NULL)
+            {
+               memory_location = hypre_StructMatrixMemoryLocation(
+                                    hypre_SStructPMatrixSMatrix(pmatrix, vi, vj));
+            }
+         }
+      }
+      for (b = 0; b < hypre_SStructPMatrixNumIBoxes(pmatrix); b++)
+      {
+         hypre_TFree(idata[b], memory_location);
+      }
+      hypre_TFree(idata, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(hypre_SStructPMatrixIOffsets(pmatrix), HYPRE_MEMORY_HOST);
+
+   hypre_SStructPMatrixNumIOffsets(pmatrix) = 0;
+   hypre_SStructPMatrixNumIBoxes(pmatrix)   = 0;
+   hypre_SStructPMatrixIData(pmatrix)       = NULL;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -31,6 +72,53 @@ hypre_SStructPMatrixRef( hypre_SStructPMatrix  *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SStructPMatrixCreateShared
+ *
+ * Creates a pmatrix that shares the StructMatrix coefficients of pmatrix, but
+ * has its own node-interleaved copy (off until SetInterleaved is called).
+ * Solvers use it to interleave a matrix they do not own.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructPMatrixCreateShared( hypre_SStructPMatrix  *pmatrix,
+                                  hypre_SStructPMatrix **shared_ptr )
+{
+   hypre_SStructPMatrix   *shared;
+   hypre_SStructStencil  **stencils;
+   HYPRE_Int               nvars = hypre_SStructPMatrixNVars(pmatrix);
+   HYPRE_Int               vi, vj;
+
+   stencils = hypre_TAlloc(hypre_SStructStencil *, nvars, HYPRE_MEMORY_HOST);
+   for (vi = 0; vi < nvars; vi++)
+   {
+      hypre_SStructStencilRef(hypre_SStructPMatrixStencil(pmatrix, vi), &stencils[vi]);
+   }
+   hypre_SStructPMatrixCreate(hypre_SStructPMatrixComm(pmatrix),
+                              hypre_SStructPMatrixPGrid(pmatrix), stencils, &shared);
+
+   for (vi = 0; vi < nvars; vi++)
+   {
+      for (vj = 0; vj < nvars; vj++)
+      {
+         hypre_StructMatrixDestroy(hypre_SStructPMatrixSMatrix(shared, vi, vj));
+         hypre_SStructPMatrixSMatrix(shared, vi, vj) = NULL;
+         if (hypre_SStructPMatrixSMatrix(pmatrix, vi, vj) != NULL)
+         {
+            hypre_SStructPMatrixSMatrix(shared, vi, vj) =
+               hypre_StructMatrixRef(hypre_SStructPMatrixSMatrix(pmatrix, vi, vj));
+         }
+         hypre_SStructPMatrixSymmetric(shared)[vi][vj] =
+            hypre_SStructPMatrixSymmetric(pmatrix)[vi][vj];
+      }
+   }
+   hypre_SStructPMatrixAccumulated(shared) = hypre_SStructPMatrixAccumulated(pmatrix);
+
+   *shared_ptr = shared;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -159,6 +247,12 @@ hypre_SStructPMatrixCreate( MPI_Comm               comm,
    hypre_SStructPMatrixSEntriesSize(pmatrix) = size;
    hypre_SStructPMatrixSEntries(pmatrix) = hypre_TAlloc(HYPRE_Int,  size, HYPRE_MEMORY_HOST);
 
+   hypre_SStructPMatrixInterleaved(pmatrix) = 0;
+   hypre_SStructPMatrixNumIOffsets(pmatrix) = 0;
+   hypre_SStructPMatrixIOffsets(pmatrix)    = NULL;
+   hypre_SStructPMatrixNumIBoxes(pmatrix)   = 0;
+   hypre_SStructPMatrixIData(pmatrix)       = NULL;
+
    hypre_SStructPMatrixRefCount(pmatrix) = 1;
 
    *pmatrix_ptr = pmatrix;
@@ -191,6 +285,7 @@ hypre_SStructPMatrixDestroy( hypre_SStructPMatrix *pmatrix )
          sstencils = hypre_SStructPMatrixSStencils(pmatrix);
          smatrices = hypre_SStructPMatrixSMatrices(pmatrix);
          symmetric = hypre_SStructPMatrixSymmetric(pmatrix);
+         hypre_SStructPMatrixInterleavedDestroy(pmatrix);
          for (vi = 0; vi < nvars; vi++)
          {
             HYPRE_SStructStencilDestroy(stencils[vi]);
@@ -561,6 +656,12 @@ hypre_SStructPMatrixAssemble( hypre_SStructPMatrix *pmatrix )
       }
    }
 
+   /* Refresh the node-interleaved copy */
+   if (hypre_SStructPMatrixInterleaved(pmatrix))
+   {
+      hypre_SStructPMatrixInterleave(pmatrix);
+   }
+
    return hypre_error_flag;
 }
 
@@ -603,6 +704,197 @@ hypre_SStructPMatrixSetSymmetric( hypre_SStructPMatrix *pmatrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SStructPMatrixSetInterleaved
+ *
+ * Turns the node-interleaved copy of the coefficients on or off.  When it is
+ * on, the copy is built right away and refreshed by every assemble, and the
+ * PMatvec and nodal relaxation kernels use it instead of the nvars x nvars
+ * separate StructMatrix arrays.  This doubles the coefficient storage.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructPMatrixSetInterleaved( hypre_SStructPMatrix *pmatrix,
+                                    HYPRE_Int             interleaved )
+{
+   hypre_SStructPMatrixInterleaved(pmatrix) = interleaved;
+   if (interleaved)
+   {
+      hypre_SStructPMatrixInterleave(pmatrix);
+   }
+   else
+   {
+      hypre_SStructPMatrixInterleavedDestroy(pmatrix);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructPMatrixInterleave
+ *
+ * (Re)builds the node-interleaved copy of the assembled coefficients.  Entry
+ * (vi,vj) of the block for offset u at the cell with rank Mi in its grid box
+ * is idata[(Mi * num_ioffsets + u) * nvars * nvars + vi * nvars + vj].
+ *
+ * Only variables that live on the same grid can be interleaved, so nothing
+ * is built (and the kernels keep using the StructMatrix arrays) when the
+ * variable types differ or there are more than HYPRE_MAXVARS variables.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructPMatrixInterleave( hypre_SStructPMatrix *pmatrix )
+{
+   hypre_SStructPGrid    *pgrid = hypre_SStructPMatrixPGrid(pmatrix);
+   HYPRE_Int              ndim  = hypre_SStructPMatrixNDim(pmatrix);
+   HYPRE_Int              nvars = hypre_SStructPMatrixNVars(pmatrix);
+
+   hypre_StructGrid      *sgrid;
+   hypre_BoxArray        *boxes;
+   hypre_Box             *box;
+   hypre_Box             *A_data_box;
+   hypre_StructMatrix    *smatrix;
+   hypre_StructStencil   *sstencil;
+   hypre_Index           *sstencil_shape;
+   hypre_Index           *ioffsets;
+   hypre_Index            unit_stride;
+   hypre_Index            loop_size;
+   HYPRE_Int              num_ioffsets, max_ioffsets;
+   HYPRE_Int            **smaps;
+   HYPRE_Complex        **idata;
+   HYPRE_Complex         *Mp, *Ap;
+   HYPRE_MemoryLocation   memory_location = HYPRE_MEMORY_HOST;
+   HYPRE_Int              i, s, u, vi, vj;
+
+   hypre_SStructPMatrixInterleavedDestroy(pmatrix);
+
+   if (nvars == 0 || nvars > HYPRE_MAXVARS)
+   {
+      return hypre_error_flag;
+   }
+   for (vi = 1; vi < nvars; vi++)
+   {
+      if (hypre_SStructPGridVarType(pgrid, vi) != hypre_SStructPGridVarType(pgrid, 0))
+      {
+         return hypre_error_flag;
+      }
+   }
+
+   /* Collect the union of the stencil offsets */
+   max_ioffsets = 0;
+   for (vi = 0; vi < nvars; vi++)
+   {
+      for (vj = 0; vj < nvars; vj++)
+      {
+         smatrix = hypre_SStructPMatrixSMatrix(pmatrix, vi, vj);
+         if (smatrix != NULL)
+         {
+            if (hypre_StructMatrixConstantCoefficient(smatrix))
+            {
+               return hypre_error_flag;
+            }
+            memory_location = hypre_StructMatrixMemoryLocation(smatrix);
+            max_ioffsets += hypre_StructStencilSize(hypre_StructMatrixStencil(smatrix));
+         }
+      }
+   }
+
+   ioffsets = hypre_TAlloc(hypre_Index, max_ioffsets, HYPRE_MEMORY_HOST);
+   smaps    = hypre_TAlloc(HYPRE_Int *, nvars * nvars, HYPRE_MEMORY_HOST);
+   num_ioffsets = 0;
+   for (vi = 0; vi < nvars; vi++)
+   {
+      for (vj = 0; vj < nvars; vj++)
+      {
+         smatrix = hypre_SStructPMatrixSMatrix(pmatrix, vi, vj);
+         smaps[vi * nvars + vj] = NULL;
+         if (smatrix != NULL)
+         {
+            sstencil = hypre_StructMatrixStencil(smatrix);
+            sstencil_shape = hypre_StructStencilShape(sstencil);
+            smaps[vi * nvars + vj] = hypre_TAlloc(HYPRE_Int, hypre_StructStencilSize(sstencil),
+                                                  HYPRE_MEMORY_HOST);
+            for (s = 0; s < hypre_StructStencilSize(sstencil); s++)
+            {
+               for (u = 0; u < num_ioffsets; u++)
+               {
+                  if (hypre_IndexesEqual(ioffsets[u], sstencil_shape[s], ndim))
+                  {
+                     break;
+                  }
+               }
+               if (u == num_ioffsets)
+               {
+                  hypre_CopyIndex(sstencil_shape[s], ioffsets[u]);
+                  num_ioffsets++;
+               }
+               smaps[vi * nvars + vj][s] = u;
+            }
+         }
+      }
+   }
+
+   /* Copy the coefficients box by box */
+   sgrid = hypre_SStructPGridSGrid(pgrid, 0);
+   boxes = hypre_StructGridBoxes(sgrid);
+   idata = hypre_TAlloc(HYPRE_Complex *, hypre_BoxArraySize(boxes), HYPRE_MEMORY_HOST);
+   hypre_SetIndex(unit_stride, 1);
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      hypre_BoxGetSize(box, loop_size);
+
+      idata[i] = hypre_CTAlloc(HYPRE_Complex,
+                               hypre_BoxVolume(box) * num_ioffsets * nvars * nvars,
+                               memory_location);
+      Mp = idata[i];
+
+      for (vi = 0; vi < nvars; vi++)
+      {
+         for (vj = 0; vj < nvars; vj++)
+         {
+            smatrix = hypre_SStructPMatrixSMatrix(pmatrix, vi, vj);
+            if (smatrix == NULL)
+            {
+               continue;
+            }
+            A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(smatrix), i);
+            sstencil = hypre_StructMatrixStencil(smatrix);
+            for (s = 0; s < hypre_StructStencilSize(sstencil); s++)
+            {
+               HYPRE_Int  k = smaps[vi * nvars + vj][s] * nvars * nvars + vi * nvars + vj;
+               HYPRE_Int  m = num_ioffsets * nvars * nvars;
+
+               Ap = hypre_StructMatrixBoxData(smatrix, i, s);
+
+#define DEVICE_VAR is_device_ptr(Mp,Ap)
+               hypre_BoxLoop2Begin(ndim, loop_size,
+                                   box, hypre_BoxIMin(box), unit_stride, Mi,
+                                   A_data_box, hypre_BoxIMin(box), unit_stride, Ai);
+               {
+                  Mp[Mi * m + k] = Ap[Ai];
+               }
+               hypre_BoxLoop2End(Mi, Ai);
+#undef DEVICE_VAR
+            }
+         }
+      }
+   }
+
+   for (i = 0; i < nvars * nvars; i++)
+   {
+      hypre_TFree(smaps[i], HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(smaps, HYPRE_MEMORY_HOST);
+
+   hypre_SStructPMatrixNumIOffsets(pmatrix) = num_ioffsets;
+   hypre_SStructPMatrixIOffsets(pmatrix)    = ioffsets;
+   hypre_SStructPMatrixNumIBoxes(pmatrix)   = hypre_BoxArraySize(boxes);
+   hypre_SStructPMatrixIData(pmatrix)       = idata;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1303,6 +1595,594 @@ hypre_SStructUMatrixAssemble( hypre_SStructMatrix *matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructParCSRMapDestroy( hypre_SStructParCSRMap *map )
+{
+   if (map)
+   {
+      hypre_TFree(hypre_SStructParCSRMapDiagStarts(map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SStructParCSRMapOffdStarts(map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SStructParCSRMapDiagMap(map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SStructParCSRMapOffdMap(map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SStructParCSRMapUDiagMap(map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SStructParCSRMapUOffdMap(map), HYPRE_MEMORY_HOST);
+      hypre_TFree(map, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Build the ParCSR form of a HYPRE_PARCSR matrix whose stencil coefficients
+ * were kept in the S-matrix (see HYPRE_SStructMatrixSetDirectParCSR).
+ *
+ * Row sizes and column ranks are computed from the graph stencils and the
+ * box managers, the S-matrix coefficients are copied straight into the diag
+ * and offd arrays with threaded box loops, and the rows of the assembled
+ * U-matrix (non-stencil and inter-part couplings) are merged in last.  This
+ * avoids pushing every stencil coefficient through IJ assembly.
+ *
+ * The row and column partitionings are those of the U-matrix.  As in IJ
+ * assembly, the diagonal is stored first in each diag row and U-matrix
+ * coefficients that duplicate an S-matrix coupling are added to it.
+ *
+ * If *parcsr_ptr is a matrix built here earlier, its nonzero pattern is fixed
+ * by the graph and by the pattern of the U-matrix.  When the latter is
+ * unchanged, only the diag and offd values are refilled in place, using the
+ * coefficient map saved by the previous build; otherwise *parcsr_ptr is
+ * destroyed and rebuilt.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructMatrixToParCSR( hypre_SStructMatrix  *matrix,
+                             hypre_ParCSRMatrix  **parcsr_ptr )
+{
+   MPI_Comm                comm      = hypre_SStructMatrixComm(matrix);
+   HYPRE_Int               ndim      = hypre_SStructMatrixNDim(matrix);
+   hypre_SStructGraph     *graph     = hypre_SStructMatrixGraph(matrix);
+   hypre_SStructGrid      *dom_grid  = hypre_SStructGraphDomainGrid(graph);
+   HYPRE_Int               nparts    = hypre_SStructMatrixNParts(matrix);
+   HYPRE_Int               matrix_type = hypre_SStructMatrixObjectType(matrix);
+   hypre_SStructParCSRMap *map       = hypre_SStructMatrixParCSRMap(matrix);
+   hypre_ParCSRMatrix     *U = (hypre_ParCSRMatrix *)
+                               hypre_IJMatrixObject(hypre_SStructMatrixIJMatrix(matrix));
+   hypre_CSRMatrix        *U_diag    = hypre_ParCSRMatrixDiag(U);
+   HYPRE_Int              *U_diag_i  = hypre_CSRMatrixI(U_diag);
+   HYPRE_Int              *U_diag_j  = hypre_CSRMatrixJ(U_diag);
+   HYPRE_Complex          *U_diag_a  = hypre_CSRMatrixData(U_diag);
+   hypre_CSRMatrix        *U_offd    = hypre_ParCSRMatrixOffd(U);
+   HYPRE_Int              *U_offd_i  = hypre_CSRMatrixI(U_offd);
+   HYPRE_Int              *U_offd_j  = hypre_CSRMatrixJ(U_offd);
+   HYPRE_Complex          *U_offd_a  = hypre_CSRMatrixData(U_offd);
+   HYPRE_BigInt           *U_col_map = hypre_ParCSRMatrixColMapOffd(U);
+   HYPRE_Int               nrows     = hypre_CSRMatrixNumRows(U_diag);
+   HYPRE_Int               U_nnz_diag = U_diag_i[nrows];
+   HYPRE_Int               U_nnz_offd = U_offd_i[nrows];
+   HYPRE_BigInt            first_row = hypre_ParCSRMatrixFirstRowIndex(U);
+   HYPRE_BigInt            first_col = hypre_ParCSRMatrixFirstColDiag(U);
+   HYPRE_BigInt            last_col  = hypre_ParCSRMatrixLastColDiag(U);
+
+   hypre_ParCSRMatrix     *A = *parcsr_ptr;
+   HYPRE_Int              *diag_i, *diag_j, *diag_pos;
+   HYPRE_Complex          *diag_a;
+   HYPRE_Int              *offd_i, *offd_j, *offd_pos;
+   HYPRE_BigInt           *offd_big_j;
+   HYPRE_Complex          *offd_a;
+   HYPRE_BigInt           *col_map_offd;
+   HYPRE_Int              *diag_map, *offd_map, *u_diag_map, *u_offd_map;
+   HYPRE_Int               nnz_diag, nnz_offd, num_cols_offd, refill;
+
+   hypre_SStructPGrid     *pgrid;
+   hypre_SStructPMatrix   *pmatrix;
+   hypre_SStructStencil   *stencil;
+   hypre_StructMatrix     *smatrix;
+   hypre_BoxArray         *boxes;
+   hypre_Box              *box, *to_box, *map_box, *int_box, *data_box;
+   hypre_BoxManEntry     **boxman_entries;
+   HYPRE_Int               nboxman_entries;
+   hypre_Index            *shape;
+   HYPRE_Int              *vars, *split, *smap;
+   hypre_IndexRef          offset, start;
+   hypre_Index             index, cs, stride, loop_size;
+   HYPRE_BigInt            col_base;
+   HYPRE_Complex          *Ap;
+   HYPRE_Int               pass, part, nvars, var, b, e, jj, i, m;
+
+   /* Refill in place if the pattern is the one the map was built for */
+   refill = (A != NULL && map != NULL &&
+             hypre_SStructParCSRMapUMatrix(map) == U &&
+             hypre_SStructParCSRMapUDiagNNZ(map) == U_nnz_diag &&
+             hypre_SStructParCSRMapUOffdNNZ(map) == U_nnz_offd &&
+             hypre_SStructParCSRMapNRows(map) == nrows);
+   if (!refill)
+   {
+      hypre_ParCSRMatrixDestroy(A);
+      hypre_SStructParCSRMapDestroy(map);
+      map = NULL;
+   }
+
+   hypre_SetIndex(stride, 1);
+   to_box  = hypre_BoxCreate(ndim);
+   map_box = hypre_BoxCreate(ndim);
+   int_box = hypre_BoxCreate(ndim);
+
+   diag_pos = hypre_CTAlloc(HYPRE_Int, nrows, HYPRE_MEMORY_HOST);
+   offd_pos = hypre_CTAlloc(HYPRE_Int, nrows, HYPRE_MEMORY_HOST);
+   if (refill)
+   {
+      diag_i     = hypre_SStructParCSRMapDiagStarts(map);
+      offd_i     = hypre_SStructParCSRMapOffdStarts(map);
+      diag_map   = hypre_SStructParCSRMapDiagMap(map);
+      offd_map   = hypre_SStructParCSRMapOffdMap(map);
+      diag_j     = NULL;
+      offd_big_j = NULL;
+      diag_a     = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(A));
+      offd_a     = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(A));
+      nnz_diag   = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A));
+      nnz_offd   = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A));
+
+      hypre_LoopBeginHost(nrows, i)
+      {
+         diag_pos[i] = diag_i[i];
+         offd_pos[i] = offd_i[i];
+      }
+      hypre_LoopEndHost()
+      hypre_LoopBeginHost(nnz_diag, i)
+      {
+         diag_a[i] = 0.0;
+      }
+      hypre_LoopEndHost()
+      hypre_LoopBeginHost(nnz_offd, i)
+      {
+         offd_a[i] = 0.0;
+      }
+      hypre_LoopEndHost()
+   }
+   else
+   {
+      diag_i   = hypre_CTAlloc(HYPRE_Int, nrows + 1, HYPRE_MEMORY_HOST);
+      offd_i   = hypre_CTAlloc(HYPRE_Int, nrows + 1, HYPRE_MEMORY_HOST);
+      diag_map = NULL;  offd_map = NULL;
+      diag_j = NULL;  diag_a = NULL;
+      offd_big_j = NULL;  offd_a = NULL;
+   }
+
+   /*------------------------------------------------------
+    * Pass 0 counts the S-matrix couplings of each row and
+    * pass 1 copies their coefficients.  Rows are numbered
+    * by part, variable, and box as in the U-matrix.  When
+    * refilling, the slot of each coupling is mapped to its
+    * place in the existing matrix.
+    *------------------------------------------------------*/
+
+   for (pass = (refill ? 1 : 0); pass < 2; pass++)
+   {
+      m = 0;
+      for (part = 0; part < nparts; part++)
+      {
+         pgrid   = hypre_SStructGraphPGrid(graph, part);
+         nvars   = hypre_SStructPGridNVars(pgrid);
+         pmatrix = hypre_SStructMatrixPMatrix(matrix, part);
+         for (var = 0; var < nvars; var++)
+         {
+            stencil = hypre_SStructGraphStencil(graph, part, var);
+            shape   = hypre_SStructStencilShape(stencil);
+            vars    = hypre_SStructStencilVars(stencil);
+            split   = hypre_SStructMatrixSplit(matrix, part, var);
+            smap    = hypre_SStructPMatrixSMap(pmatrix, var);
+            boxes   = hypre_StructGridBoxes(hypre_SStructPGridSGrid(pgrid, var));
+
+            hypre_ForBoxI(b, boxes)
+            {
+               box = hypre_BoxArrayBox(boxes, b);
+
+               for (e = 0; e < hypre_SStructStencilSize(stencil); e++)
+               {
+                  if (split[e] < 0)
+                  {
+                     continue;
+                  }
+
+                  smatrix  = hypre_SStructPMatrixSMatrix(pmatrix, var, vars[e]);
+                  data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(smatrix), b);
+                  Ap       = hypre_StructMatrixBoxData(smatrix, b, smap[split[e]]);
+
+                  offset = shape[e];
+                  hypre_CopyBox(box, to_box);
+                  hypre_BoxShiftPos(to_box, offset);
+
+                  /* Include neighbor boxes (periodic images and other parts);
+                   * inter-part coefficients were moved to the U-matrix and
+                   * their zeroed S-matrix entries are merged with them below */
+                  hypre_SStructGridIntersect(dom_grid, part, vars[e], to_box, -1,
+                                             &boxman_entries, &nboxman_entries);
+
+                  for (jj = 0; jj < nboxman_entries; jj++)
+                  {
+                     hypre_SStructBoxManEntryGetStrides(boxman_entries[jj], cs, matrix_type);
+                     hypre_BoxManEntryGetExtents(boxman_entries[jj],
+                                                 hypre_BoxIMin(map_box), hypre_BoxIMax(map_box));
+                     hypre_IntersectBoxes(to_box, map_box, int_box);
+                     if (hypre_BoxVolume(int_box) == 0)
+                     {
+                        continue;
+                     }
+
+                     hypre_CopyIndex(hypre_BoxIMin(int_box), index);
+                     hypre_SStructBoxManEntryGetGlobalRank(boxman_entries[jj], index,
+                                                           &col_base, matrix_type);
+                     hypre_BoxShiftNeg(int_box, offset);
+
+                     start = hypre_BoxIMin(int_box);
+                     hypre_BoxGetSize(int_box, loop_size);
+
+                     if (pass == 0)
+                     {
+                        hypre_BoxLoop1BeginHost(ndim, loop_size,
+                                                box, start, stride, mi);
+                        {
+                           hypre_Index  lindex;
+                           HYPRE_BigInt col = col_base;
+                           HYPRE_Int    d;
+
+                           zypre_BoxLoopGetIndex(lindex);
+                           for (d = 0; d < ndim; d++)
+                           {
+                              col += lindex[d] * cs[d];
+                           }
+                           if (col >= first_col && col <= last_col)
+                           {
+                              diag_i[m + mi + 1]++;
+                           }
+                           else
+                           {
+                              offd_i[m + mi + 1]++;
+                           }
+                        }
+                        hypre_BoxLoop1EndHost(mi);
+                     }
+                     else if (refill)
+                     {
+                        hypre_BoxLoop2BeginHost(ndim, loop_size,
+                                                box,      start, stride, mi,
+                                                data_box, start, stride, Ai);
+                        {
+                           hypre_Index  lindex;
+                           HYPRE_BigInt col = col_base;
+                           HYPRE_Int    d;
+
+                           zypre_BoxLoopGetIndex(lindex);
+                           for (d = 0; d < ndim; d++)
+                           {
+                              col += lindex[d] * cs[d];
+                           }
+                           if (col >= first_col && col <= last_col)
+                           {
+                              diag_a[diag_map[diag_pos[m + mi]++]] = Ap[Ai];
+                           }
+                           else
+                           {
+                              offd_a[offd_map[offd_pos[m + mi]++]] = Ap[Ai];
+                           }
+                        }
+                        hypre_BoxLoop2EndHost(mi, Ai);
+                     }
+                     else
+                     {
+                        hypre_BoxLoop2BeginHost(ndim, loop_size,
+                                                box,      start, stride, mi,
+                                                data_box, start, stride, Ai);
+                        {
+                           hypre_Index  lindex;
+                           HYPRE_BigInt col = col_base;
+                           HYPRE_Int    d, k;
+
+                           zypre_BoxLoopGetIndex(lindex);
+                           for (d = 0; d < ndim; d++)
+                           {
+                              col += lindex[d] * cs[d];
+                           }
+                           if (col >= first_col && col <= last_col)
+                           {
+                              k = diag_pos[m + mi]++;
+                              diag_j[k] = (HYPRE_Int) (col - first_col);
+                              diag_a[k] = Ap[Ai];
+                           }
+                           else
+                           {
+                              k = offd_pos[m + mi]++;
+                              offd_big_j[k] = col;
+                              offd_a[k] = Ap[Ai];
+                           }
+                        }
+                        hypre_BoxLoop2EndHost(mi, Ai);
+                     }
+                  }
+
+                  hypre_TFree(boxman_entries, HYPRE_MEMORY_HOST);
+               }
+
+               m += hypre_BoxVolume(box);
+            }
+         }
+      }
+
+      if (pass == 0)
+      {
+         /* Reserve room for the U-matrix rows and set up the row pointers */
+         for (i = 0; i < nrows; i++)
+         {
+            diag_i[i + 1] += diag_i[i] + U_diag_i[i + 1] - U_diag_i[i];
+            offd_i[i + 1] += offd_i[i] + U_offd_i[i + 1] - U_offd_i[i];
+         }
+         nnz_diag = diag_i[nrows];
+         nnz_offd = offd_i[nrows];
+
+         diag_j     = hypre_TAlloc(HYPRE_Int,     nnz_diag, HYPRE_MEMORY_HOST);
+         diag_a     = hypre_TAlloc(HYPRE_Complex, nnz_diag, HYPRE_MEMORY_HOST);
+         offd_big_j = hypre_TAlloc(HYPRE_BigInt,  nnz_offd, HYPRE_MEMORY_HOST);
+         offd_a     = hypre_TAlloc(HYPRE_Complex, nnz_offd, HYPRE_MEMORY_HOST);
+         diag_map   = hypre_TAlloc(HYPRE_Int,     nnz_diag, HYPRE_MEMORY_HOST);
+         offd_map   = hypre_TAlloc(HYPRE_Int,     nnz_offd, HYPRE_MEMORY_HOST);
+
+         hypre_LoopBeginHost(nrows, i)
+         {
+            diag_pos[i] = diag_i[i];
+            offd_pos[i] = offd_i[i];
+         }
+         hypre_LoopEndHost()
+      }
+   }
+
+   hypre_BoxDestroy(to_box);
+   hypre_BoxDestroy(map_box);
+   hypre_BoxDestroy(int_box);
+
+   if (refill)
+   {
+      /* Add the U-matrix coefficients where they were merged before */
+      u_diag_map = hypre_SStructParCSRMapUDiagMap(map);
+      u_offd_map = hypre_SStructParCSRMapUOffdMap(map);
+      hypre_LoopBeginHost(nrows, i)
+      {
+         HYPRE_Int j;
+
+         for (j = U_diag_i[i]; j < U_diag_i[i + 1]; j++)
+         {
+            diag_a[u_diag_map[j]] += U_diag_a[j];
+         }
+         for (j = U_offd_i[i]; j < U_offd_i[i + 1]; j++)
+         {
+            offd_a[u_offd_map[j]] += U_offd_a[j];
+         }
+      }
+      hypre_LoopEndHost()
+
+      hypre_TFree(diag_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(offd_pos, HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatrixSellDataInvalidate(A);
+
+      return hypre_error_flag;
+   }
+
+   /*------------------------------------------------------
+    * Merge in the U-matrix rows and move the diagonal to
+    * the front of each diag row.  The maps record where
+    * each slot ends up: first within its row, then after
+    * the squeeze below.
+    *------------------------------------------------------*/
+
+   u_diag_map = hypre_TAlloc(HYPRE_Int, U_nnz_diag, HYPRE_MEMORY_HOST);
+   u_offd_map = hypre_TAlloc(HYPRE_Int, U_nnz_offd, HYPRE_MEMORY_HOST);
+
+   hypre_LoopBeginHost(nrows, i)
+   {
+      HYPRE_BigInt  col;
+      HYPRE_Int     j, k, jcol;
+      HYPRE_Complex tmp;
+
+      for (k = diag_i[i]; k < diag_i[i + 1]; k++)
+      {
+         diag_map[k] = k;
+      }
+      for (k = offd_i[i]; k < offd_i[i + 1]; k++)
+      {
+         offd_map[k] = k;
+      }
+
+      for (j = U_diag_i[i]; j < U_diag_i[i + 1]; j++)
+      {
+         jcol = U_diag_j[j];
+         for (k = diag_i[i]; k < diag_pos[i]; k++)
+         {
+            if (diag_j[k] == jcol)
+            {
+               break;
+            }
+         }
+         if (k < diag_pos[i])
+         {
+            diag_a[k] += U_diag_a[j];
+         }
+         else
+         {
+            diag_j[k] = jcol;
+            diag_a[k] = U_diag_a[j];
+            diag_pos[i]++;
+         }
+         u_diag_map[j] = k;
+      }
+      for (j = U_offd_i[i]; j < U_offd_i[i + 1]; j++)
+      {
+         col = U_col_map[U_offd_j[j]];
+         for (k = offd_i[i]; k < offd_pos[i]; k++)
+         {
+            if (offd_big_j[k] == col)
+            {
+               break;
+            }
+         }
+         if (k < offd_pos[i])
+         {
+            offd_a[k] += U_offd_a[j];
+         }
+         else
+         {
+            offd_big_j[k] = col;
+            offd_a[k] = U_offd_a[j];
+            offd_pos[i]++;
+         }
+         u_offd_map[j] = k;
+      }
+
+      col = first_row + i;
+      if (col >= first_col && col <= last_col)
+      {
+         jcol = (HYPRE_Int) (col - first_col);
+         for (k = diag_i[i] + 1; k < diag_pos[i]; k++)
+         {
+            if (diag_j[k] == jcol)
+            {
+               diag_j[k] = diag_j[diag_i[i]];
+               diag_j[diag_i[i]] = jcol;
+               tmp = diag_a[k];
+               diag_a[k] = diag_a[diag_i[i]];
+               diag_a[diag_i[i]] = tmp;
+               diag_map[k] = diag_i[i];
+               diag_map[diag_i[i]] = k;
+               break;
+            }
+         }
+      }
+   }
+   hypre_LoopEndHost()
+
+   /* The S-matrix slots keep the unsqueezed row pointers */
+   map = hypre_CTAlloc(hypre_SStructParCSRMap, 1, HYPRE_MEMORY_HOST);
+   hypre_SStructParCSRMapUMatrix(map)    = U;
+   hypre_SStructParCSRMapUDiagNNZ(map)   = U_nnz_diag;
+   hypre_SStructParCSRMapUOffdNNZ(map)   = U_nnz_offd;
+   hypre_SStructParCSRMapNRows(map)      = nrows;
+   hypre_SStructParCSRMapDiagStarts(map) = hypre_TAlloc(HYPRE_Int, nrows + 1, HYPRE_MEMORY_HOST);
+   hypre_SStructParCSRMapOffdStarts(map) = hypre_TAlloc(HYPRE_Int, nrows + 1, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_SStructParCSRMapDiagStarts(map), diag_i, HYPRE_Int, nrows + 1,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_SStructParCSRMapOffdStarts(map), offd_i, HYPRE_Int, nrows + 1,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   /* Squeeze out the room left by merged duplicates (rare) */
+   for (i = 0; i < nrows; i++)
+   {
+      if (diag_pos[i] < diag_i[i + 1] || offd_pos[i] < offd_i[i + 1])
+      {
+         break;
+      }
+   }
+   if (i < nrows)
+   {
+      HYPRE_Int dk = 0, ok = 0, dstart = 0, ostart = 0, k;
+
+      for (i = 0; i < nrows; i++)
+      {
+         for (k = dstart; k < diag_pos[i]; k++)
+         {
+            diag_map[k] += diag_i[i] - dstart;
+         }
+         for (k = ostart; k < offd_pos[i]; k++)
+         {
+            offd_map[k] += offd_i[i] - ostart;
+         }
+         for (k = dstart; k < diag_pos[i]; k++, dk++)
+         {
+            diag_j[dk] = diag_j[k];
+            diag_a[dk] = diag_a[k];
+         }
+         for (k = ostart; k < offd_pos[i]; k++, ok++)
+         {
+            offd_big_j[ok] = offd_big_j[k];
+            offd_a[ok] = offd_a[k];
+         }
+         dstart = diag_i[i + 1];
+         ostart = offd_i[i + 1];
+         diag_i[i + 1] = dk;
+         offd_i[i + 1] = ok;
+      }
+      nnz_diag = dk;
+      nnz_offd = ok;
+   }
+   hypre_TFree(diag_pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_pos, HYPRE_MEMORY_HOST);
+
+   hypre_LoopBeginHost(U_nnz_diag, i)
+   {
+      u_diag_map[i] = diag_map[u_diag_map[i]];
+   }
+   hypre_LoopEndHost()
+   hypre_LoopBeginHost(U_nnz_offd, i)
+   {
+      u_offd_map[i] = offd_map[u_offd_map[i]];
+   }
+   hypre_LoopEndHost()
+   hypre_SStructParCSRMapDiagMap(map)  = diag_map;
+   hypre_SStructParCSRMapOffdMap(map)  = offd_map;
+   hypre_SStructParCSRMapUDiagMap(map) = u_diag_map;
+   hypre_SStructParCSRMapUOffdMap(map) = u_offd_map;
+   hypre_SStructMatrixParCSRMap(matrix) = map;
+
+   /*------------------------------------------------------
+    * Build the offd column map
+    *------------------------------------------------------*/
+
+   col_map_offd = hypre_TAlloc(HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(col_map_offd, offd_big_j, HYPRE_BigInt, nnz_offd,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   num_cols_offd = 0;
+   if (nnz_offd > 0)
+   {
+      hypre_BigQsort0(col_map_offd, 0, nnz_offd - 1);
+      num_cols_offd = 1;
+      for (i = 1; i < nnz_offd; i++)
+      {
+         if (col_map_offd[i] > col_map_offd[num_cols_offd - 1])
+         {
+            col_map_offd[num_cols_offd++] = col_map_offd[i];
+         }
+      }
+   }
+
+   offd_j = hypre_TAlloc(HYPRE_Int, nnz_offd, HYPRE_MEMORY_HOST);
+   hypre_LoopBeginHost(nnz_offd, i)
+   {
+      offd_j[i] = hypre_BigBinarySearch(col_map_offd, offd_big_j[i], num_cols_offd);
+   }
+   hypre_LoopEndHost()
+   hypre_TFree(offd_big_j, HYPRE_MEMORY_HOST);
+
+   A = hypre_ParCSRMatrixCreate(comm,
+                                hypre_ParCSRMatrixGlobalNumRows(U),
+                                hypre_ParCSRMatrixGlobalNumCols(U),
+                                hypre_ParCSRMatrixRowStarts(U),
+                                hypre_ParCSRMatrixColStarts(U),
+                                num_cols_offd, nnz_diag, nnz_offd);
+
+   hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(A))    = diag_i;
+   hypre_CSRMatrixJ(hypre_ParCSRMatrixDiag(A))    = diag_j;
+   hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(A)) = diag_a;
+   hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(A))    = offd_i;
+   hypre_CSRMatrixJ(hypre_ParCSRMatrixOffd(A))    = offd_j;
+   hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(A)) = offd_a;
+   hypre_CSRMatrixMemoryLocation(hypre_ParCSRMatrixDiag(A)) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixMemoryLocation(hypre_ParCSRMatrixOffd(A)) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRMatrixColMapOffd(A) = col_map_offd;
+
+   *parcsr_ptr = A;
+
+   return hypre_error_flag;
+}
+
 /*==========================================================================
  * SStructMatrix routines
  *==========================================================================*/
@@ -14,6 +14,9 @@
 #ifndef hypre_SSTRUCT_MATRIX_HEADER
 #define hypre_SSTRUCT_MATRIX_HEADER
 
+/* Maximum number of variables for the node-interleaved kernels */
+#define HYPRE_MAXVARS 8
+
 /*--------------------------------------------------------------------------
  * hypre_SStructMatrix:
  *--------------------------------------------------------------------------*/
@@ -37,10 +40,41 @@ typedef struct
 
    HYPRE_Int               accumulated;  /* AddTo values accumulated? */
 
+   /* Node-interleaved copy of the coefficients (optional).  For every cell of
+    * the grid boxes, the nvars x nvars coupling blocks of all stencil offsets
+    * are stored contiguously, one block after the other (row-major). */
+   HYPRE_Int               interleaved;  /* keep the interleaved copy? */
+   HYPRE_Int               num_ioffsets; /* union of the stencil offsets */
+   hypre_Index            *ioffsets;
+   HYPRE_Int               num_iboxes;
+   HYPRE_Complex         **idata;        /* one array per grid box */
+
    HYPRE_Int               ref_count;
 
 } hypre_SStructPMatrix;
 
+/*--------------------------------------------------------------------------
+ * hypre_SStructParCSRMap:
+ *   Where each coefficient of a directly built ParCSR object came from, so
+ *   that a later Assemble can refill the diag and offd values in place
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatrix     *umatrix;      /* U-matrix the object was built from */
+   HYPRE_Int               u_diag_nnz;
+   HYPRE_Int               u_offd_nnz;
+
+   HYPRE_Int               nrows;
+   HYPRE_Int              *diag_starts;  /* first S-matrix slot of each row */
+   HYPRE_Int              *offd_starts;
+   HYPRE_Int              *diag_map;     /* S-matrix slot -> diag entry */
+   HYPRE_Int              *offd_map;     /* S-matrix slot -> offd entry */
+   HYPRE_Int              *u_diag_map;   /* U-matrix diag entry -> diag entry */
+   HYPRE_Int              *u_offd_map;   /* U-matrix offd entry -> offd entry */
+
+} hypre_SStructParCSRMap;
+
 typedef struct hypre_SStructMatrix_struct
 {
    MPI_Comm                comm;
@@ -79,6 +113,10 @@ typedef struct hypre_SStructMatrix_struct
    /* GEC0902   adding an object type to the matrix  */
    HYPRE_Int               object_type;
 
+   HYPRE_Int               direct_parcsr; /* Build ParCSR object directly
+                                           * from the S- and U-matrices? */
+   hypre_SStructParCSRMap *parcsr_map;
+
 } hypre_SStructMatrix;
 
 /*--------------------------------------------------------------------------
@@ -110,6 +148,23 @@ typedef struct hypre_SStructMatrix_struct
 #define hypre_SStructMatrixGlobalSize(mat)           ((mat) -> global_size)
 #define hypre_SStructMatrixRefCount(mat)             ((mat) -> ref_count)
 #define hypre_SStructMatrixObjectType(mat)           ((mat) -> object_type)
+#define hypre_SStructMatrixDirectParCSR(mat)         ((mat) -> direct_parcsr)
+#define hypre_SStructMatrixParCSRMap(mat)            ((mat) -> parcsr_map)
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_SStructParCSRMap
+ *--------------------------------------------------------------------------*/
+
+#define hypre_SStructParCSRMapUMatrix(map)           ((map) -> umatrix)
+#define hypre_SStructParCSRMapUDiagNNZ(map)          ((map) -> u_diag_nnz)
+#define hypre_SStructParCSRMapUOffdNNZ(map)          ((map) -> u_offd_nnz)
+#define hypre_SStructParCSRMapNRows(map)             ((map) -> nrows)
+#define hypre_SStructParCSRMapDiagStarts(map)        ((map) -> diag_starts)
+#define hypre_SStructParCSRMapOffdStarts(map)        ((map) -> offd_starts)
+#define hypre_SStructParCSRMapDiagMap(map)           ((map) -> diag_map)
+#define hypre_SStructParCSRMapOffdMap(map)           ((map) -> offd_map)
+#define hypre_SStructParCSRMapUDiagMap(map)          ((map) -> u_diag_map)
+#define hypre_SStructParCSRMapUOffdMap(map)          ((map) -> u_offd_map)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_SStructPMatrix
@@ -134,6 +189,12 @@ hypre_SStructPGridNDim(hypre_SStructPMatrixPGrid(pmat))
 #define hypre_SStructPMatrixSEntriesSize(pmat)      ((pmat) -> sentries_size)
 #define hypre_SStructPMatrixSEntries(pmat)          ((pmat) -> sentries)
 #define hypre_SStructPMatrixAccumulated(pmat)       ((pmat) -> accumulated)
+#define hypre_SStructPMatrixInterleaved(pmat)       ((pmat) -> interleaved)
+#define hypre_SStructPMatrixNumIOffsets(pmat)       ((pmat) -> num_ioffsets)
+#define hypre_SStructPMatrixIOffsets(pmat)          ((pmat) -> ioffsets)
+#define hypre_SStructPMatrixNumIBoxes(pmat)         ((pmat) -> num_iboxes)
+#define hypre_SStructPMatrixIData(pmat)             ((pmat) -> idata)
+#define hypre_SStructPMatrixIBoxData(pmat, b)       ((pmat) -> idata[b])
 #define hypre_SStructPMatrixRefCount(pmat)          ((pmat) -> ref_count)
 
 #endif
@@ -26,6 +26,14 @@ typedef struct
    HYPRE_Int     nvars;
    void ***smatvec_data;
 
+   /* node-interleaved matrices (see hypre_SStructPMatrixInterleave) */
+   hypre_ComputePkg     **icompute_pkgs;
+   hypre_CommHandle     **icomm_handles;
+   HYPRE_MemoryLocation   memory_location;
+   HYPRE_Complex        **xp;
+   HYPRE_Complex        **yp;
+   HYPRE_Int             *xoffsets;
+
 } hypre_SStructPMatvecData;
 
 /*--------------------------------------------------------------------------
@@ -43,6 +51,278 @@ hypre_SStructPMatvecCreate( void **pmatvec_vdata_ptr )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SStructPMatvecSetupInterleaved
+ *
+ * Sets up the matvec with the node-interleaved copy of pA, if it has one and
+ * the variables of px share one data space.  Returns 1 if this was done.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructPMatvecSetupInterleaved( hypre_SStructPMatvecData *pmatvec_data,
+                                      hypre_SStructPMatrix     *pA,
+                                      hypre_SStructPVector     *px )
+{
+   HYPRE_Int              nvars = hypre_SStructPMatrixNVars(pA);
+   HYPRE_Int              ndim  = hypre_SStructPMatrixNDim(pA);
+   HYPRE_Int              num_ioffsets = hypre_SStructPMatrixNumIOffsets(pA);
+   hypre_Index           *ioffsets = hypre_SStructPMatrixIOffsets(pA);
+
+   hypre_StructVector    *sx0;
+   hypre_StructGrid      *sgrid;
+   hypre_BoxArray        *data_space;
+   hypre_BoxArray        *vdata_space;
+   hypre_StructStencil   *stencil;
+   hypre_Index           *stencil_shape;
+   hypre_ComputeInfo     *compute_info;
+   HYPRE_MemoryLocation   memory_location;
+   HYPRE_Int              i, u, vj;
+
+   if (hypre_SStructPMatrixIData(pA) == NULL)
+   {
+      return 0;
+   }
+
+   sx0        = hypre_SStructPVectorSVector(px, 0);
+   sgrid      = hypre_StructVectorGrid(sx0);
+   data_space = hypre_StructVectorDataSpace(sx0);
+   for (vj = 1; vj < nvars; vj++)
+   {
+      vdata_space = hypre_StructVectorDataSpace(hypre_SStructPVectorSVector(px, vj));
+      if (hypre_BoxArraySize(vdata_space) != hypre_BoxArraySize(data_space))
+      {
+         return 0;
+      }
+      hypre_ForBoxI(i, data_space)
+      {
+         if (!hypre_IndexesEqual(hypre_BoxIMin(hypre_BoxArrayBox(vdata_space, i)),
+                                 hypre_BoxIMin(hypre_BoxArrayBox(data_space, i)), ndim) ||
+             !hypre_IndexesEqual(hypre_BoxIMax(hypre_BoxArrayBox(vdata_space, i)),
+                                 hypre_BoxIMax(hypre_BoxArrayBox(data_space, i)), ndim))
+         {
+            return 0;
+         }
+      }
+   }
+
+   /* All variables share the data space and the union stencil, but each needs
+    * its own compute package since their ghost exchanges are in flight together */
+   (pmatvec_data -> icompute_pkgs) = hypre_CTAlloc(hypre_ComputePkg *, nvars,
+                                                   HYPRE_MEMORY_HOST);
+   for (vj = 0; vj < nvars; vj++)
+   {
+      stencil_shape = hypre_CTAlloc(hypre_Index, num_ioffsets, HYPRE_MEMORY_HOST);
+      for (u = 0; u < num_ioffsets; u++)
+      {
+         hypre_CopyIndex(ioffsets[u], stencil_shape[u]);
+      }
+      stencil = hypre_StructStencilCreate(ndim, num_ioffsets, stencil_shape);
+      hypre_CreateComputeInfo(sgrid, stencil, &compute_info);
+      hypre_ComputePkgCreate(compute_info, data_space, 1, sgrid,
+                             &(pmatvec_data -> icompute_pkgs)[vj]);
+      hypre_StructStencilDestroy(stencil);
+   }
+
+   memory_location = hypre_StructVectorMemoryLocation(sx0);
+   (pmatvec_data -> memory_location) = memory_location;
+   (pmatvec_data -> icomm_handles)   = hypre_CTAlloc(hypre_CommHandle *, nvars,
+                                                     HYPRE_MEMORY_HOST);
+   (pmatvec_data -> xp)       = hypre_TAlloc(HYPRE_Complex *, nvars, memory_location);
+   (pmatvec_data -> yp)       = hypre_TAlloc(HYPRE_Complex *, nvars, memory_location);
+   (pmatvec_data -> xoffsets) = hypre_TAlloc(HYPRE_Int, num_ioffsets, memory_location);
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructPMatvecComputeInterleaved
+ *
+ * y = alpha*A*x + beta*y with the node-interleaved coefficients: at each cell,
+ * the x values of all variables at one offset are gathered and multiplied by
+ * the contiguous nvars x nvars coupling block of that offset.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructPMatvecComputeInterleaved( hypre_SStructPMatvecData *pmatvec_data,
+                                        HYPRE_Complex             alpha,
+                                        hypre_SStructPMatrix     *pA,
+                                        hypre_SStructPVector     *px,
+                                        HYPRE_Complex             beta,
+                                        hypre_SStructPVector     *py )
+{
+   HYPRE_Int              nvars           = (pmatvec_data -> nvars);
+   hypre_ComputePkg     **compute_pkgs    = (pmatvec_data -> icompute_pkgs);
+   hypre_CommHandle     **comm_handles    = (pmatvec_data -> icomm_handles);
+   HYPRE_MemoryLocation   memory_location = (pmatvec_data -> memory_location);
+   HYPRE_Complex        **xp              = (pmatvec_data -> xp);
+   HYPRE_Complex        **yp              = (pmatvec_data -> yp);
+   HYPRE_Int             *xoffsets        = (pmatvec_data -> xoffsets);
+   HYPRE_Int              ndim            = hypre_SStructPMatrixNDim(pA);
+   HYPRE_Int              num_ioffsets    = hypre_SStructPMatrixNumIOffsets(pA);
+   hypre_Index           *ioffsets        = hypre_SStructPMatrixIOffsets(pA);
+
+   HYPRE_Complex         *_h_xp[HYPRE_MAXVARS];
+   HYPRE_Complex         *_h_yp[HYPRE_MAXVARS];
+   HYPRE_Int             *_h_xoffsets = NULL;
+   HYPRE_Complex        **h_xp;
+   HYPRE_Complex        **h_yp;
+   HYPRE_Int             *h_xoffsets;
+   HYPRE_Int              on_device;
+
+   hypre_StructGrid      *sgrid;
+   hypre_BoxArrayArray   *compute_box_aa;
+   hypre_BoxArray        *compute_box_a;
+   hypre_Box             *compute_box;
+   hypre_Box             *M_box;
+   hypre_Box             *x_data_box;
+   hypre_Box             *y_data_box;
+   hypre_IndexRef         start;
+   hypre_Index            unit_stride;
+   hypre_Index            loop_size;
+   HYPRE_Complex         *Mp;
+   HYPRE_Int              compute_i, i, j, u, vi, vj;
+
+   if (alpha == 0.0)
+   {
+      hypre_SStructPScale(beta, py);
+      return hypre_error_flag;
+   }
+
+   on_device = (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_DEVICE);
+   if (on_device)
+   {
+      _h_xoffsets = hypre_TAlloc(HYPRE_Int, num_ioffsets, HYPRE_MEMORY_HOST);
+      h_xp = _h_xp;
+      h_yp = _h_yp;
+      h_xoffsets = _h_xoffsets;
+   }
+   else
+   {
+      h_xp = xp;
+      h_yp = yp;
+      h_xoffsets = xoffsets;
+   }
+
+   sgrid = hypre_StructVectorGrid(hypre_SStructPVectorSVector(px, 0));
+   hypre_SetIndex(unit_stride, 1);
+
+   for (compute_i = 0; compute_i < 2; compute_i++)
+   {
+      switch (compute_i)
+      {
+         case 0:
+         {
+            for (vj = 0; vj < nvars; vj++)
+            {
+               hypre_InitializeIndtComputations(
+                  compute_pkgs[vj], hypre_StructVectorData(hypre_SStructPVectorSVector(px, vj)),
+                  &comm_handles[vj]);
+            }
+            compute_box_aa = hypre_ComputePkgIndtBoxes(compute_pkgs[0]);
+         }
+         break;
+
+         case 1:
+         {
+            for (vj = 0; vj < nvars; vj++)
+            {
+               hypre_FinalizeIndtComputations(comm_handles[vj]);
+            }
+            compute_box_aa = hypre_ComputePkgDeptBoxes(compute_pkgs[0]);
+         }
+         break;
+      }
+
+      hypre_ForBoxArrayI(i, compute_box_aa)
+      {
+         compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+         M_box = hypre_BoxArrayBox(hypre_StructGridBoxes(sgrid), i);
+         x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(
+                                           hypre_SStructPVectorSVector(px, 0)), i);
+         y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(
+                                           hypre_SStructPVectorSVector(py, 0)), i);
+         Mp = hypre_SStructPMatrixIBoxData(pA, i);
+
+         for (vi = 0; vi < nvars; vi++)
+         {
+            h_xp[vi] = hypre_StructVectorBoxData(hypre_SStructPVectorSVector(px, vi), i);
+            h_yp[vi] = hypre_StructVectorBoxData(hypre_SStructPVectorSVector(py, vi), i);
+         }
+         for (u = 0; u < num_ioffsets; u++)
+         {
+            h_xoffsets[u] = hypre_BoxOffsetDistance(x_data_box, ioffsets[u]);
+         }
+         if (on_device)
+         {
+            hypre_TMemcpy(xp, h_xp, HYPRE_Complex *, nvars, memory_location, HYPRE_MEMORY_HOST);
+            hypre_TMemcpy(yp, h_yp, HYPRE_Complex *, nvars, memory_location, HYPRE_MEMORY_HOST);
+            hypre_TMemcpy(xoffsets, h_xoffsets, HYPRE_Int, num_ioffsets,
+                          memory_location, HYPRE_MEMORY_HOST);
+         }
+
+         hypre_ForBoxI(j, compute_box_a)
+         {
+            compute_box = hypre_BoxArrayBox(compute_box_a, j);
+            start = hypre_BoxIMin(compute_box);
+            hypre_BoxGetSize(compute_box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(Mp,xp,yp,xoffsets)
+            hypre_BoxLoop3Begin(ndim, loop_size,
+                                M_box, start, unit_stride, Mi,
+                                x_data_box, start, unit_stride, xi,
+                                y_data_box, start, unit_stride, yi);
+            {
+               HYPRE_Int            u, vi, vj;
+               HYPRE_Complex        x_loc[HYPRE_MAXVARS];
+               HYPRE_Complex        y_loc[HYPRE_MAXVARS];
+               const HYPRE_Complex *M = Mp + Mi * num_ioffsets * nvars * nvars;
+
+               for (vi = 0; vi < nvars; vi++)
+               {
+                  y_loc[vi] = 0.0;
+               }
+               for (u = 0; u < num_ioffsets; u++)
+               {
+                  for (vj = 0; vj < nvars; vj++)
+                  {
+                     x_loc[vj] = xp[vj][xi + xoffsets[u]];
+                  }
+                  for (vi = 0; vi < nvars; vi++)
+                  {
+                     for (vj = 0; vj < nvars; vj++)
+                     {
+                        y_loc[vi] += M[vj] * x_loc[vj];
+                     }
+                     M += nvars;
+                  }
+               }
+               if (beta == 0.0)
+               {
+                  for (vi = 0; vi < nvars; vi++)
+                  {
+                     yp[vi][yi] = alpha * y_loc[vi];
+                  }
+               }
+               else
+               {
+                  for (vi = 0; vi < nvars; vi++)
+                  {
+                     yp[vi][yi] = alpha * y_loc[vi] + beta * yp[vi][yi];
+                  }
+               }
+            }
+            hypre_BoxLoop3End(Mi, xi, yi);
+#undef DEVICE_VAR
+         }
+      }
+   }
+
+   hypre_TFree(_h_xoffsets, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_SStructPMatvecSetup
  *--------------------------------------------------------------------------*/
@@ -60,6 +340,13 @@ hypre_SStructPMatvecSetup( void                 *pmatvec_vdata,
    HYPRE_Int                   vi, vj;
 
    nvars = hypre_SStructPMatrixNVars(pA);
+   (pmatvec_data -> nvars) = nvars;
+
+   if (hypre_SStructPMatvecSetupInterleaved(pmatvec_data, pA, px))
+   {
+      return hypre_error_flag;
+   }
+
    smatvec_data = hypre_TAlloc(void **,  nvars, HYPRE_MEMORY_HOST);
    for (vi = 0; vi < nvars; vi++)
    {
@@ -76,7 +363,6 @@ hypre_SStructPMatvecSetup( void                 *pmatvec_vdata,
          }
       }
    }
-   (pmatvec_data -> nvars)        = nvars;
    (pmatvec_data -> smatvec_data) = smatvec_data;
 
    return hypre_error_flag;
@@ -105,6 +391,11 @@ hypre_SStructPMatvecCompute( void                 *pmatvec_vdata,
 
    HYPRE_Int                  vi, vj;
 
+   if (pmatvec_data -> icompute_pkgs)
+   {
+      return hypre_SStructPMatvecComputeInterleaved(pmatvec_data, alpha, pA, px, beta, py);
+   }
+
    for (vi = 0; vi < nvars; vi++)
    {
       sy = hypre_SStructPVectorSVector(py, vi);
@@ -154,18 +445,33 @@ hypre_SStructPMatvecDestroy( void *pmatvec_vdata )
    {
       nvars        = (pmatvec_data -> nvars);
       smatvec_data = (pmatvec_data -> smatvec_data);
-      for (vi = 0; vi < nvars; vi++)
+      if (smatvec_data)
       {
-         for (vj = 0; vj < nvars; vj++)
+         for (vi = 0; vi < nvars; vi++)
          {
-            if (smatvec_data[vi][vj] != NULL)
+            for (vj = 0; vj < nvars; vj++)
             {
-               hypre_StructMatvecDestroy(smatvec_data[vi][vj]);
+               if (smatvec_data[vi][vj] != NULL)
+               {
+                  hypre_StructMatvecDestroy(smatvec_data[vi][vj]);
+               }
             }
+            hypre_TFree(smatvec_data[vi], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(smatvec_data, HYPRE_MEMORY_HOST);
+      }
+      if (pmatvec_data -> icompute_pkgs)
+      {
+         for (vj = 0; vj < nvars; vj++)
+         {
+            hypre_ComputePkgDestroy((pmatvec_data -> icompute_pkgs)[vj]);
          }
-         hypre_TFree(smatvec_data[vi], HYPRE_MEMORY_HOST);
+         hypre_TFree(pmatvec_data -> icompute_pkgs, HYPRE_MEMORY_HOST);
+         hypre_TFree(pmatvec_data -> icomm_handles, HYPRE_MEMORY_HOST);
+         hypre_TFree(pmatvec_data -> xp, pmatvec_data -> memory_location);
+         hypre_TFree(pmatvec_data -> yp, pmatvec_data -> memory_location);
+         hypre_TFree(pmatvec_data -> xoffsets, pmatvec_data -> memory_location);
       }
-      hypre_TFree(smatvec_data, HYPRE_MEMORY_HOST);
       hypre_TFree(pmatvec_data, HYPRE_MEMORY_HOST);
    }
 
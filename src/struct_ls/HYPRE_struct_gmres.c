@@ -24,6 +24,7 @@ HYPRE_StructGMRESCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_GMRESFunctionsSetAxpyInnerProd(gmres_functions, hypre_StructKrylovAxpyInnerProd);
 
    *solver = ( (HYPRE_StructSolver) hypre_GMRESCreate( gmres_functions ) );
 
@@ -136,6 +137,20 @@ HYPRE_StructGMRESSetPrintLevel( HYPRE_StructSolver solver,
 
 /*==========================================================================*/
 
+HYPRE_Int
+HYPRE_StructGMRESSetFusedOps( HYPRE_StructSolver solver,
+                              HYPRE_Int          fused )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *) solver;
+
+   hypre_GMRESFunctionsSetAxpyInnerProd((gmres_data -> functions),
+                                        fused ? hypre_StructKrylovAxpyInnerProd : NULL);
+
+   return hypre_error_flag;
+}
+
+/*==========================================================================*/
+
 HYPRE_Int
 HYPRE_StructGMRESGetNumIterations( HYPRE_StructSolver  solver,
                                    HYPRE_Int          *num_iterations )
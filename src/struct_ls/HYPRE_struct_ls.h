@@ -263,6 +263,14 @@ HYPRE_Int HYPRE_StructPFMGSetNonZeroGuess(HYPRE_StructSolver solver);
  *    - 1 : Weighted Jacobi (default)
  *    - 2 : Red/Black Gauss-Seidel (symmetric: RB pre-relaxation, BR post-relaxation)
  *    - 3 : Red/Black Gauss-Seidel (nonsymmetric: RB pre- and post-relaxation)
+ *    - 4 : Weighted line Jacobi
+ *    - 5 : Zebra line Gauss-Seidel (symmetric)
+ *
+ * Line relaxation solves for all unknowns on a grid line at once, with lines
+ * in the direction of strongest coupling.  When the coupling across the lines
+ * is much weaker, the grid is coarsened across the lines only, which needs
+ * fewer levels on strongly anisotropic problems such as stretched grids.
+ * Lines split between boxes or processes are solved with cyclic reduction.
  **/
 HYPRE_Int HYPRE_StructPFMGSetRelaxType(HYPRE_StructSolver solver,
                                        HYPRE_Int          relax_type);
@@ -326,6 +334,39 @@ HYPRE_Int HYPRE_StructPFMGSetSkipRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPFMGGetSkipRelax(HYPRE_StructSolver solver,
                                        HYPRE_Int *skip_relax);
 
+/**
+ * (Optional) Do up to {\tt temporal\_blocking} relaxation sweeps per ghost
+ * exchange.  The sweeps are done tile by tile on a copy of the matrix with a
+ * deeper ghost layer, trading some redundant computation near the tile
+ * boundaries for fewer messages and less memory traffic.  The results are the
+ * same as without temporal blocking.  This is available on the host for
+ * matrices with variable coefficients (and 3-pt, 5-pt, or 7-pt stencils for
+ * red/black Gauss-Seidel).  It is ignored on levels where it is not available,
+ * and the number of sweeps is reduced where the grid does not allow a ghost
+ * layer that deep.  The default is 0 (no temporal blocking).
+ **/
+HYPRE_Int HYPRE_StructPFMGSetTemporalBlocking(HYPRE_StructSolver solver,
+                                              HYPRE_Int          temporal_blocking);
+
+HYPRE_Int HYPRE_StructPFMGGetTemporalBlocking(HYPRE_StructSolver solver,
+                                              HYPRE_Int *temporal_blocking);
+
+/**
+ * (Optional) Stop coarsening once the coarse grid has at most
+ * {\tt max\_coarse\_size} points, and solve the coarsest grid problem with a
+ * direct method instead of relaxation.  The coarse grid is agglomerated on the
+ * processes that own part of it, and each of them factors the dense coarse
+ * matrix, so that a coarse solve needs a single collective on these processes.
+ * The dense factors take {\tt max\_coarse\_size}$^2$ values of memory per
+ * process, so values of a few thousand at most are practical.  The default is
+ * 0 (coarse grid relaxation).
+ **/
+HYPRE_Int HYPRE_StructPFMGSetMaxCoarseSize(HYPRE_StructSolver solver,
+                                           HYPRE_Int          max_coarse_size);
+
+HYPRE_Int HYPRE_StructPFMGGetMaxCoarseSize(HYPRE_StructSolver solver,
+                                           HYPRE_Int *max_coarse_size);
+
 /*
  * RE-VISIT
  **/
@@ -639,6 +680,14 @@ HYPRE_Int HYPRE_StructPCGSetLogging(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPCGSetPrintLevel(HYPRE_StructSolver solver,
                                        HYPRE_Int          level);
 
+/**
+ * (Optional) If fused is not 0, the updates of x, r and p are done with fused
+ * vector kernels that sweep the vectors fewer times. The results are the
+ * same. The default is 1 (on).
+ **/
+HYPRE_Int HYPRE_StructPCGSetFusedOps(HYPRE_StructSolver solver,
+                                     HYPRE_Int          fused);
+
 HYPRE_Int HYPRE_StructPCGGetNumIterations(HYPRE_StructSolver  solver,
                                           HYPRE_Int          *num_iterations);
 
@@ -723,6 +772,14 @@ HYPRE_Int HYPRE_StructGMRESSetLogging(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructGMRESSetPrintLevel(HYPRE_StructSolver solver,
                                          HYPRE_Int          level);
 
+/**
+ * (Optional) If fused is not 0, each axpy of the modified Gram-Schmidt loop
+ * is fused with the next inner product. The results are the same. The default
+ * is 1 (on).
+ **/
+HYPRE_Int HYPRE_StructGMRESSetFusedOps(HYPRE_StructSolver solver,
+                                       HYPRE_Int          fused);
+
 HYPRE_Int HYPRE_StructGMRESGetNumIterations(HYPRE_StructSolver  solver,
                                             HYPRE_Int          *num_iterations);
 
@@ -29,6 +29,8 @@ HYPRE_StructPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_PCGFunctionsSetFusedOps(pcg_functions,
+                                 hypre_StructKrylovAxpby, hypre_StructKrylovAxpy2);
 
    *solver = ( (HYPRE_StructSolver) hypre_PCGCreate( pcg_functions ) );
 
@@ -150,6 +152,27 @@ HYPRE_StructPCGSetPrintLevel( HYPRE_StructSolver solver,
 
 /*==========================================================================*/
 
+HYPRE_Int
+HYPRE_StructPCGSetFusedOps( HYPRE_StructSolver solver,
+                            HYPRE_Int          fused )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *) solver;
+
+   if (fused)
+   {
+      hypre_PCGFunctionsSetFusedOps((pcg_data -> functions),
+                                    hypre_StructKrylovAxpby, hypre_StructKrylovAxpy2);
+   }
+   else
+   {
+      hypre_PCGFunctionsSetFusedOps((pcg_data -> functions), NULL, NULL);
+   }
+
+   return hypre_error_flag;
+}
+
+/*==========================================================================*/
+
 HYPRE_Int
 HYPRE_StructPCGGetNumIterations( HYPRE_StructSolver  solver,
                                  HYPRE_Int          *num_iterations )
@@ -250,6 +250,40 @@ HYPRE_StructPFMGGetSkipRelax( HYPRE_StructSolver solver,
    return ( hypre_PFMGGetSkipRelax( (void *) solver, skip_relax) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetTemporalBlocking( HYPRE_StructSolver solver,
+                                     HYPRE_Int          temporal_blocking )
+{
+   return ( hypre_PFMGSetTemporalBlocking( (void *) solver, temporal_blocking) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetTemporalBlocking( HYPRE_StructSolver solver,
+                                     HYPRE_Int        * temporal_blocking )
+{
+   return ( hypre_PFMGGetTemporalBlocking( (void *) solver, temporal_blocking) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetMaxCoarseSize( HYPRE_StructSolver solver,
+                                  HYPRE_Int          max_coarse_size )
+{
+   return ( hypre_PFMGSetMaxCoarseSize( (void *) solver, max_coarse_size) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetMaxCoarseSize( HYPRE_StructSolver solver,
+                                  HYPRE_Int        * max_coarse_size )
+{
+   return ( hypre_PFMGGetMaxCoarseSize( (void *) solver, max_coarse_size) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -0,0 +1,1068 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Line relaxation: all unknowns on a grid line in direction line_dir are
+ * updated together by solving the tridiagonal system formed by the center
+ * coefficient and the two neighbors along the line.  All other couplings are
+ * moved to the right-hand side.
+ *
+ * The lines are either updated all at once (weighted line Jacobi), or in zebra
+ * order: the lines are colored by the parity of the sum of their indices in
+ * the other directions, and the ghost layer is exchanged between colors (line
+ * Gauss-Seidel).  With a 3-pt, 5-pt, or 7-pt stencil, the lines of one color
+ * are coupled only to lines of the other color.  If the stencil also couples
+ * lines diagonally across the line direction (e.g. 27-pt coarse operators),
+ * two lines of one color may be coupled, and each parity is then relaxed as a
+ * color of its own so that the result does not depend on the box layout.
+ *
+ * The right-hand side of the line systems is first computed into a temporary
+ * vector.  If no line is split between boxes, the Thomas algorithm is then
+ * applied on each line of a box in a BoxLoop over the first point of the lines.
+ * Otherwise, the lines are solved with cyclic reduction, which works across
+ * box and process boundaries, on a copy of the tridiagonal part of A.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "_hypre_struct_mv.hpp"
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm                comm;
+
+   HYPRE_Int               max_iter;
+   HYPRE_Int               zero_guess;
+   HYPRE_Real              weight;
+   HYPRE_Int               line_dir;
+   HYPRE_Int               zebra;       /* 0 = line Jacobi, 1 = zebra line GS */
+   HYPRE_Int               start_color;
+
+   hypre_StructMatrix     *A;
+   hypre_StructVector     *b;
+   hypre_StructVector     *x;
+   hypre_StructVector     *t;           /* right-hand side and solution of lines */
+   hypre_StructVector     *c;           /* modified upper coefficients of lines */
+
+   HYPRE_Int               diag_rank;
+   HYPRE_Int               lo_rank;     /* -1 if not in the stencil */
+   HYPRE_Int               up_rank;
+
+   hypre_ComputePkg       *compute_pkg;
+
+   /* cyclic reduction for lines that are split between boxes */
+   HYPRE_Int               use_cr;
+   hypre_StructMatrix     *A_sol;       /* copy of the tridiagonal part of A */
+   HYPRE_Int               num_cr;      /* one per parity of the lines */
+   void                  **cr_data;
+
+   /* log info (always logged) */
+   HYPRE_Int               num_iterations;
+   HYPRE_Int               time_index;
+
+} hypre_LineRelaxData;
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_LineRelaxCreate( MPI_Comm  comm )
+{
+   hypre_LineRelaxData *relax_data;
+
+   relax_data = hypre_CTAlloc(hypre_LineRelaxData, 1, HYPRE_MEMORY_HOST);
+
+   (relax_data -> comm)       = comm;
+   (relax_data -> time_index) = hypre_InitializeTiming("LineRelax");
+
+   /* set defaults */
+   (relax_data -> max_iter)    = 1000;
+   (relax_data -> zero_guess)  = 0;
+   (relax_data -> weight)      = 1.0;
+   (relax_data -> line_dir)    = 0;
+   (relax_data -> zebra)       = 1;
+   (relax_data -> start_color) = 0;
+   (relax_data -> lo_rank)     = -1;
+   (relax_data -> up_rank)     = -1;
+
+   return (void *) relax_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_LineRelaxDestroyCR( hypre_LineRelaxData *relax_data )
+{
+   HYPRE_Int  p;
+
+   for (p = 0; p < (relax_data -> num_cr); p++)
+   {
+      hypre_CyclicReductionDestroy(relax_data -> cr_data[p]);
+   }
+   hypre_TFree(relax_data -> cr_data, HYPRE_MEMORY_HOST);
+   hypre_StructMatrixDestroy(relax_data -> A_sol);
+
+   (relax_data -> use_cr)  = 0;
+   (relax_data -> A_sol)   = NULL;
+   (relax_data -> num_cr)  = 0;
+   (relax_data -> cr_data) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxDestroy( void *relax_vdata )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   if (relax_data)
+   {
+      hypre_StructMatrixDestroy(relax_data -> A);
+      hypre_StructVectorDestroy(relax_data -> b);
+      hypre_StructVectorDestroy(relax_data -> x);
+      hypre_StructVectorDestroy(relax_data -> t);
+      hypre_StructVectorDestroy(relax_data -> c);
+      hypre_ComputePkgDestroy(relax_data -> compute_pkg);
+      hypre_LineRelaxDestroyCR(relax_data);
+
+      hypre_FinalizeTiming(relax_data -> time_index);
+      hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns the directions other than line_dir in dirs, and the number of line
+ * parities (combinations of even/odd indices in these directions) that are
+ * relaxed separately.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_LineRelaxGetParities( hypre_LineRelaxData *relax_data,
+                            HYPRE_Int            ndim,
+                            HYPRE_Int           *dirs,
+                            HYPRE_Int           *num_dirs_ptr )
+{
+   HYPRE_Int  num_dirs = 0;
+   HYPRE_Int  d;
+
+   for (d = 0; d < ndim; d++)
+   {
+      if (d != (relax_data -> line_dir))
+      {
+         dirs[num_dirs++] = d;
+      }
+   }
+   *num_dirs_ptr = num_dirs;
+
+   return (relax_data -> zebra) ? (1 << num_dirs) : 1;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns the number of colors for zebra relaxation: two, unless the stencil
+ * of A couples lines that differ in more than one of the directions dirs, in
+ * which case there is one color per parity.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_LineRelaxNumColors( hypre_StructMatrix *A,
+                          HYPRE_Int          *dirs,
+                          HYPRE_Int           num_dirs,
+                          HYPRE_Int           num_parities )
+{
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int             si, e, n;
+
+   for (si = 0; si < stencil_size; si++)
+   {
+      n = 0;
+      for (e = 0; e < num_dirs; e++)
+      {
+         if (hypre_IndexD(stencil_shape[si], dirs[e]) != 0)
+         {
+            n++;
+         }
+      }
+      if (n > 1)
+      {
+         return num_parities;
+      }
+   }
+
+   return 2;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if the lines with the given parity are relaxed with the given
+ * color (counted from the first color relaxed).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_LineRelaxParityInColor( HYPRE_Int  parity,
+                              HYPRE_Int  color,
+                              HYPRE_Int  num_colors,
+                              HYPRE_Int  start_color,
+                              HYPRE_Int  num_dirs )
+{
+   HYPRE_Int  e, p = 0;
+
+   if (num_colors > 2)
+   {
+      /* one color per parity, in reverse order if start_color is 1 */
+      return (parity == (start_color ? (num_colors - 1 - color) : color));
+   }
+
+   for (e = 0; e < num_dirs; e++)
+   {
+      p += (parity >> e) & 1;
+   }
+
+   return ((p % 2) == (color + start_color) % 2);
+}
+
+/*--------------------------------------------------------------------------
+ * Restricts color_box (a copy of a grid box) to the lines with the given
+ * parity.  Returns 1 if there are no such lines in the box.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_LineRelaxParityBox( hypre_Box  *color_box,
+                          HYPRE_Int   parity,
+                          HYPRE_Int  *dirs,
+                          HYPRE_Int   num_dirs )
+{
+   HYPRE_Int  e, d, empty = 0;
+
+   for (e = 0; e < num_dirs; e++)
+   {
+      d = dirs[e];
+      if (((hypre_BoxIMinD(color_box, d) % 2) + 2) % 2 != ((parity >> e) & 1))
+      {
+         hypre_BoxIMinD(color_box, d) += 1;
+      }
+      if (hypre_BoxIMinD(color_box, d) > hypre_BoxIMaxD(color_box, d))
+      {
+         empty = 1;
+      }
+   }
+
+   return empty;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if no grid line in direction line_dir is split between boxes
+ * (on any process) and the direction is not periodic, and 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxLinesAreWhole( hypre_StructGrid *grid,
+                              HYPRE_Int         line_dir )
+{
+   hypre_BoxArray  *boxes = hypre_StructGridBoxes(grid);
+   hypre_Box       *bbox  = hypre_StructGridBoundingBox(grid);
+   hypre_Box       *box;
+   HYPRE_Int        whole, local_whole, i;
+
+   local_whole = (hypre_IndexD(hypre_StructGridPeriodic(grid), line_dir) == 0);
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if ((hypre_BoxIMinD(box, line_dir) != hypre_BoxIMinD(bbox, line_dir)) ||
+          (hypre_BoxIMaxD(box, line_dir) != hypre_BoxIMaxD(bbox, line_dir)))
+      {
+         local_whole = 0;
+      }
+   }
+
+   hypre_MPI_Allreduce(&local_whole, &whole, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_StructGridComm(grid));
+
+   return whole;
+}
+
+/*--------------------------------------------------------------------------
+ * Copies the tridiagonal part of A along the lines into a matrix with variable
+ * coefficients, as needed by cyclic reduction.
+ *--------------------------------------------------------------------------*/
+
+static hypre_StructMatrix *
+hypre_LineRelaxCreateASol( hypre_LineRelaxData *relax_data,
+                           hypre_StructMatrix  *A )
+{
+   HYPRE_Int              line_dir  = (relax_data -> line_dir);
+   HYPRE_Int              ndim      = hypre_StructMatrixNDim(A);
+   HYPRE_Int              constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   hypre_StructGrid      *grid      = hypre_StructMatrixGrid(A);
+   hypre_BoxArray        *boxes     = hypre_StructGridBoxes(grid);
+
+   hypre_StructMatrix    *A_sol;
+   hypre_StructStencil   *sol_stencil;
+   hypre_Index           *sol_shape;
+   HYPRE_Int              ranks[3];
+   hypre_Box             *box, *A_dbox, *S_dbox;
+   hypre_IndexRef         start;
+   hypre_Index            loop_size, ustride;
+   HYPRE_Real            *Ap, *Sp, Aval;
+   HYPRE_Int              i, k;
+
+   ranks[0] = (relax_data -> lo_rank);
+   ranks[1] = (relax_data -> diag_rank);
+   ranks[2] = (relax_data -> up_rank);
+
+   sol_shape = hypre_CTAlloc(hypre_Index, 3, HYPRE_MEMORY_HOST);
+   for (k = 0; k < 3; k++)
+   {
+      hypre_SetIndex(sol_shape[k], 0);
+      hypre_IndexD(sol_shape[k], line_dir) = k - 1;
+   }
+   sol_stencil = hypre_StructStencilCreate(ndim, 3, sol_shape);
+   A_sol = hypre_StructMatrixCreate(hypre_StructMatrixComm(A), grid, sol_stencil);
+   hypre_StructStencilDestroy(sol_stencil);
+   hypre_StructMatrixInitialize(A_sol);
+
+   hypre_SetIndex(ustride, 1);
+   hypre_ForBoxI(i, boxes)
+   {
+      box    = hypre_BoxArrayBox(boxes, i);
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      S_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A_sol), i);
+      start  = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+      for (k = 0; k < 3; k++)
+      {
+         Sp = hypre_StructMatrixBoxData(A_sol, i, k);
+         if (ranks[k] < 0)
+         {
+            Aval = 0.0;
+         }
+         else if (constant_coefficient == 1 || (constant_coefficient == 2 && k != 1))
+         {
+            Ap   = hypre_StructMatrixBoxData(A, i, ranks[k]);
+            Aval = Ap[hypre_CCBoxIndexRank(A_dbox, start)];
+         }
+         else
+         {
+            Ap = hypre_StructMatrixBoxData(A, i, ranks[k]);
+
+#define DEVICE_VAR is_device_ptr(Sp,Ap)
+            hypre_BoxLoop2Begin(ndim, loop_size,
+                                A_dbox, start, ustride, Ai,
+                                S_dbox, start, ustride, Si);
+            {
+               Sp[Si] = Ap[Ai];
+            }
+            hypre_BoxLoop2End(Ai, Si);
+#undef DEVICE_VAR
+
+            continue;
+         }
+
+#define DEVICE_VAR is_device_ptr(Sp)
+         hypre_BoxLoop1Begin(ndim, loop_size,
+                             S_dbox, start, ustride, Si);
+         {
+            Sp[Si] = Aval;
+         }
+         hypre_BoxLoop1End(Si);
+#undef DEVICE_VAR
+      }
+   }
+
+   hypre_StructMatrixAssemble(A_sol);
+
+   return A_sol;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetup( void               *relax_vdata,
+                      hypre_StructMatrix *A,
+                      hypre_StructVector *b,
+                      hypre_StructVector *x )
+{
+   hypre_LineRelaxData   *relax_data = (hypre_LineRelaxData *)relax_vdata;
+   HYPRE_Int              line_dir   = (relax_data -> line_dir);
+
+   hypre_StructGrid      *grid;
+   hypre_StructStencil   *stencil;
+   hypre_Index            index;
+   hypre_ComputeInfo     *compute_info;
+   hypre_ComputePkg      *compute_pkg;
+   hypre_StructVector    *t, *c;
+   hypre_StructMatrix    *A_sol;
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+   HYPRE_Int              dirs[HYPRE_MAXDIM];
+   hypre_Index            base_index, base_stride;
+   HYPRE_Int              num_dirs, num_cr, p, e;
+   void                 **cr_data;
+
+   if (line_dir < 0 || line_dir >= hypre_StructMatrixNDim(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Invalid line direction!");
+      return hypre_error_flag;
+   }
+
+   grid    = hypre_StructMatrixGrid(A);
+   stencil = hypre_StructMatrixStencil(A);
+
+   /*----------------------------------------------------------
+    * Find the diagonal and the neighbors along the line
+    *----------------------------------------------------------*/
+
+   hypre_SetIndex(index, 0);
+   (relax_data -> diag_rank) = hypre_StructStencilElementRank(stencil, index);
+   hypre_IndexD(index, line_dir) = -1;
+   (relax_data -> lo_rank) = hypre_StructStencilElementRank(stencil, index);
+   hypre_IndexD(index, line_dir) = 1;
+   (relax_data -> up_rank) = hypre_StructStencilElementRank(stencil, index);
+
+   /*----------------------------------------------------------
+    * Set up the temp vectors and the communication package
+    *----------------------------------------------------------*/
+
+   hypre_StructVectorDestroy(relax_data -> t);
+   hypre_StructVectorDestroy(relax_data -> c);
+   t = hypre_StructVectorCreate(hypre_StructVectorComm(x), grid);
+   c = hypre_StructVectorCreate(hypre_StructVectorComm(x), grid);
+   hypre_StructVectorInitialize(t);
+   hypre_StructVectorInitialize(c);
+   hypre_StructVectorAssemble(t);
+   hypre_StructVectorAssemble(c);
+
+   hypre_ComputePkgDestroy(relax_data -> compute_pkg);
+   hypre_CreateComputeInfo(grid, stencil, &compute_info);
+   hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
+                          grid, &compute_pkg);
+
+   /*----------------------------------------------------------
+    * Set up cyclic reduction if lines are split between boxes
+    *----------------------------------------------------------*/
+
+   hypre_LineRelaxDestroyCR(relax_data);
+   if (!hypre_LineRelaxLinesAreWhole(grid, line_dir))
+   {
+      A_sol = hypre_LineRelaxCreateASol(relax_data, A);
+
+      num_cr  = hypre_LineRelaxGetParities(relax_data, ndim, dirs, &num_dirs);
+      cr_data = hypre_TAlloc(void *, num_cr, HYPRE_MEMORY_HOST);
+      for (p = 0; p < num_cr; p++)
+      {
+         hypre_SetIndex(base_index, 0);
+         hypre_SetIndex(base_stride, 1);
+         if (relax_data -> zebra)
+         {
+            for (e = 0; e < num_dirs; e++)
+            {
+               hypre_IndexD(base_index, dirs[e])  = (p >> e) & 1;
+               hypre_IndexD(base_stride, dirs[e]) = 2;
+            }
+         }
+
+         cr_data[p] = hypre_CyclicReductionCreate(hypre_StructMatrixComm(A));
+         hypre_CyclicReductionSetCDir(cr_data[p], line_dir);
+         hypre_CyclicReductionSetBase(cr_data[p], base_index, base_stride);
+         hypre_CyclicReductionSetup(cr_data[p], A_sol, t, c);
+      }
+
+      (relax_data -> use_cr)  = 1;
+      (relax_data -> A_sol)   = A_sol;
+      (relax_data -> num_cr)  = num_cr;
+      (relax_data -> cr_data) = cr_data;
+   }
+
+   /*----------------------------------------------------------
+    * Set up the relax data structure
+    *----------------------------------------------------------*/
+
+   hypre_StructMatrixDestroy(relax_data -> A);
+   hypre_StructVectorDestroy(relax_data -> b);
+   hypre_StructVectorDestroy(relax_data -> x);
+   (relax_data -> A) = hypre_StructMatrixRef(A);
+   (relax_data -> b) = hypre_StructVectorRef(b);
+   (relax_data -> x) = hypre_StructVectorRef(x);
+   (relax_data -> t) = t;
+   (relax_data -> c) = c;
+   (relax_data -> compute_pkg) = compute_pkg;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Computes t = b - (A - L) x on the points of box i given by start and stride,
+ * where L is the tridiagonal part of A along the lines.  If use_x is zero, x
+ * is taken to be zero.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_LineRelaxRHS( hypre_LineRelaxData *relax_data,
+                    HYPRE_Int            i,
+                    hypre_Index          loop_size,
+                    hypre_IndexRef       start,
+                    hypre_Index          stride,
+                    HYPRE_Int            use_x )
+{
+   hypre_StructMatrix    *A         = (relax_data -> A);
+   hypre_StructVector    *b         = (relax_data -> b);
+   hypre_StructVector    *x         = (relax_data -> x);
+   hypre_StructVector    *t         = (relax_data -> t);
+   HYPRE_Int              diag_rank = (relax_data -> diag_rank);
+   HYPRE_Int              lo_rank   = (relax_data -> lo_rank);
+   HYPRE_Int              up_rank   = (relax_data -> up_rank);
+   HYPRE_Int              ndim      = hypre_StructMatrixNDim(A);
+   HYPRE_Int              constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+
+   hypre_StructStencil   *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+
+   hypre_Box             *A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+   hypre_Box             *b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+   hypre_Box             *x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+   hypre_Box             *t_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(t), i);
+
+   HYPRE_Real            *bp = hypre_StructVectorBoxData(b, i);
+   HYPRE_Real            *xp = hypre_StructVectorBoxData(x, i);
+   HYPRE_Real            *tp = hypre_StructVectorBoxData(t, i);
+   HYPRE_Real            *Ap;
+   HYPRE_Real             Aval;
+   HYPRE_Int              xoff, si;
+
+#define DEVICE_VAR is_device_ptr(tp,bp)
+   hypre_BoxLoop2Begin(ndim, loop_size,
+                       b_dbox, start, stride, bi,
+                       t_dbox, start, stride, ti);
+   {
+      tp[ti] = bp[bi];
+   }
+   hypre_BoxLoop2End(bi, ti);
+#undef DEVICE_VAR
+
+   if (!use_x)
+   {
+      return hypre_error_flag;
+   }
+
+   for (si = 0; si < stencil_size; si++)
+   {
+      if (si == diag_rank || si == lo_rank || si == up_rank)
+      {
+         continue;
+      }
+
+      Ap   = hypre_StructMatrixBoxData(A, i, si);
+      xoff = hypre_BoxOffsetDistance(x_dbox, stencil_shape[si]);
+
+      if (constant_coefficient)
+      {
+         Aval = Ap[hypre_CCBoxIndexRank(A_dbox, start)];
+
+#define DEVICE_VAR is_device_ptr(tp,xp)
+         hypre_BoxLoop2Begin(ndim, loop_size,
+                             x_dbox, start, stride, xi,
+                             t_dbox, start, stride, ti);
+         {
+            tp[ti] -= Aval * xp[xi + xoff];
+         }
+         hypre_BoxLoop2End(xi, ti);
+#undef DEVICE_VAR
+      }
+      else
+      {
+#define DEVICE_VAR is_device_ptr(tp,Ap,xp)
+         hypre_BoxLoop3Begin(ndim, loop_size,
+                             A_dbox, start, stride, Ai,
+                             x_dbox, start, stride, xi,
+                             t_dbox, start, stride, ti);
+         {
+            tp[ti] -= Ap[Ai] * xp[xi + xoff];
+         }
+         hypre_BoxLoop3End(Ai, xi, ti);
+#undef DEVICE_VAR
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Solves the line systems of box i that start at the points given by start
+ * and stride (the loop has size 1 in the line direction).  The right-hand
+ * side is in t on input, and the solution is written to x, weighted by
+ * 'weight'.  Couplings to points beyond the ends of the lines are moved to the
+ * right-hand side here, unless use_x is zero.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_LineRelaxSolve( hypre_LineRelaxData *relax_data,
+                      HYPRE_Int            i,
+                      hypre_Index          loop_size,
+                      hypre_IndexRef       start,
+                      hypre_Index          stride,
+                      HYPRE_Int            line_size,
+                      HYPRE_Int            use_x )
+{
+   hypre_StructMatrix    *A         = (relax_data -> A);
+   hypre_StructVector    *x         = (relax_data -> x);
+   hypre_StructVector    *t         = (relax_data -> t);
+   hypre_StructVector    *c         = (relax_data -> c);
+   HYPRE_Real             weight    = (relax_data -> weight);
+   HYPRE_Int              line_dir  = (relax_data -> line_dir);
+   HYPRE_Int              diag_rank = (relax_data -> diag_rank);
+   HYPRE_Int              lo_rank   = (relax_data -> lo_rank);
+   HYPRE_Int              up_rank   = (relax_data -> up_rank);
+   HYPRE_Int              ndim      = hypre_StructMatrixNDim(A);
+   HYPRE_Int              constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+
+   hypre_Box             *A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+   hypre_Box             *x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+   hypre_Box             *t_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(t), i);
+   hypre_Box             *c_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(c), i);
+
+   HYPRE_Real            *xp = hypre_StructVectorBoxData(x, i);
+   HYPRE_Real            *tp = hypre_StructVectorBoxData(t, i);
+   HYPRE_Real            *cp = hypre_StructVectorBoxData(c, i);
+   HYPRE_Real            *Adp, *Alp, *Aup;
+   HYPRE_Real             zero = 0.0;
+   HYPRE_Int              Ad_s, Al_s, Au_s, xs, ts, cs;
+   HYPRE_Int              n = line_size;
+   hypre_Index            unit;
+
+   hypre_SetIndex(unit, 0);
+   hypre_IndexD(unit, line_dir) = 1;
+
+   xs = hypre_BoxOffsetDistance(x_dbox, unit);
+   ts = hypre_BoxOffsetDistance(t_dbox, unit);
+   cs = hypre_BoxOffsetDistance(c_dbox, unit);
+
+   /* Constant coefficients are addressed with stride zero, and a missing
+    * neighbor along the line is addressed as a constant zero */
+   Ad_s = (constant_coefficient == 1) ? 0 : hypre_BoxOffsetDistance(A_dbox, unit);
+   Al_s = (constant_coefficient) ? 0 : hypre_BoxOffsetDistance(A_dbox, unit);
+   Au_s = Al_s;
+   Adp  = hypre_StructMatrixBoxData(A, i, diag_rank);
+   if (lo_rank > -1)
+   {
+      Alp = hypre_StructMatrixBoxData(A, i, lo_rank);
+   }
+   else
+   {
+      Alp = &zero;
+      Al_s = 0;
+   }
+   if (up_rank > -1)
+   {
+      Aup = hypre_StructMatrixBoxData(A, i, up_rank);
+   }
+   else
+   {
+      Aup = &zero;
+      Au_s = 0;
+   }
+   if (constant_coefficient == 1)
+   {
+      Adp += hypre_CCBoxIndexRank(A_dbox, start);
+   }
+   if (constant_coefficient)
+   {
+      Alp += (lo_rank > -1) ? hypre_CCBoxIndexRank(A_dbox, start) : 0;
+      Aup += (up_rank > -1) ? hypre_CCBoxIndexRank(A_dbox, start) : 0;
+   }
+
+#define DEVICE_VAR is_device_ptr(xp,tp,cp,Adp,Alp,Aup)
+   hypre_BoxLoop4Begin(ndim, loop_size,
+                       A_dbox, start, stride, Ai,
+                       x_dbox, start, stride, xi,
+                       t_dbox, start, stride, ti,
+                       c_dbox, start, stride, ci);
+   {
+      HYPRE_Int  k;
+      HYPRE_Int  Adi = (constant_coefficient == 1) ? 0 : Ai;
+      HYPRE_Int  Aoi = (constant_coefficient) ? 0 : Ai;
+      HYPRE_Real lo, up, denom;
+      HYPRE_Real c_prev = 0.0, t_prev = 0.0;
+
+      /* forward elimination */
+      for (k = 0; k < n; k++)
+      {
+         lo = Alp[Aoi + k * Al_s];
+         up = Aup[Aoi + k * Au_s];
+         if (k == 0)
+         {
+            if (use_x)
+            {
+               tp[ti] -= lo * xp[xi - xs];
+            }
+            lo = 0.0;
+         }
+         if (k == n - 1)
+         {
+            if (use_x)
+            {
+               tp[ti + k * ts] -= up * xp[xi + n * xs];
+            }
+            up = 0.0;
+         }
+         denom  = Adp[Adi + k * Ad_s] - lo * c_prev;
+         c_prev = up / denom;
+         t_prev = (tp[ti + k * ts] - lo * t_prev) / denom;
+         cp[ci + k * cs] = c_prev;
+         tp[ti + k * ts] = t_prev;
+      }
+
+      /* back substitution */
+      for (k = n - 2; k > -1; k--)
+      {
+         t_prev = tp[ti + k * ts] - cp[ci + k * cs] * t_prev;
+         tp[ti + k * ts] = t_prev;
+      }
+
+      if (weight == 1.0)
+      {
+         for (k = 0; k < n; k++)
+         {
+            xp[xi + k * xs] = tp[ti + k * ts];
+         }
+      }
+      else if (use_x)
+      {
+         for (k = 0; k < n; k++)
+         {
+            xp[xi + k * xs] = (1.0 - weight) * xp[xi + k * xs] + weight * tp[ti + k * ts];
+         }
+      }
+      else
+      {
+         for (k = 0; k < n; k++)
+         {
+            xp[xi + k * xs] = weight * tp[ti + k * ts];
+         }
+      }
+   }
+   hypre_BoxLoop4End(Ai, xi, ti, ci);
+#undef DEVICE_VAR
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Sets x = (1 - weight) x + weight c on the points of box i given by start and
+ * stride, where c holds the line solutions computed by cyclic reduction.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_LineRelaxUpdate( hypre_LineRelaxData *relax_data,
+                       HYPRE_Int            i,
+                       hypre_Index          loop_size,
+                       hypre_IndexRef       start,
+                       hypre_Index          stride )
+{
+   hypre_StructVector    *x      = (relax_data -> x);
+   hypre_StructVector    *c      = (relax_data -> c);
+   HYPRE_Real             weight = (relax_data -> weight);
+
+   hypre_Box             *x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+   hypre_Box             *c_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(c), i);
+
+   HYPRE_Real            *xp = hypre_StructVectorBoxData(x, i);
+   HYPRE_Real            *cp = hypre_StructVectorBoxData(c, i);
+
+#define DEVICE_VAR is_device_ptr(xp,cp)
+   hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
+                       x_dbox, start, stride, xi,
+                       c_dbox, start, stride, ci);
+   {
+      xp[xi] = (1.0 - weight) * xp[xi] + weight * cp[ci];
+   }
+   hypre_BoxLoop2End(xi, ci);
+#undef DEVICE_VAR
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelax( void               *relax_vdata,
+                 hypre_StructMatrix *A,
+                 hypre_StructVector *b,
+                 hypre_StructVector *x )
+{
+   hypre_LineRelaxData   *relax_data  = (hypre_LineRelaxData *)relax_vdata;
+
+   HYPRE_Int              max_iter    = (relax_data -> max_iter);
+   HYPRE_Int              zero_guess  = (relax_data -> zero_guess);
+   HYPRE_Int              line_dir    = (relax_data -> line_dir);
+   HYPRE_Int              zebra       = (relax_data -> zebra);
+   HYPRE_Int              start_color = (relax_data -> start_color);
+   hypre_ComputePkg      *compute_pkg = (relax_data -> compute_pkg);
+   HYPRE_Int              use_cr      = (relax_data -> use_cr);
+   void                 **cr_data     = (relax_data -> cr_data);
+   HYPRE_Int              ndim        = hypre_StructMatrixNDim(A);
+
+   hypre_CommHandle      *comm_handle;
+   hypre_BoxArray        *boxes;
+   hypre_Box             *box;
+   hypre_Box             *color_box;
+   hypre_Index            stride, loop_size, line_loop_size;
+
+   HYPRE_Int              dirs[HYPRE_MAXDIM];
+   HYPRE_Int              num_dirs, num_colors, num_parities;
+   HYPRE_Int              iter, color, parity, use_x;
+   HYPRE_Int              i, e;
+
+   /*----------------------------------------------------------
+    * Initialize some things and deal with special cases
+    *----------------------------------------------------------*/
+
+   hypre_BeginTiming(relax_data -> time_index);
+
+   hypre_StructMatrixDestroy(relax_data -> A);
+   hypre_StructVectorDestroy(relax_data -> b);
+   hypre_StructVectorDestroy(relax_data -> x);
+   (relax_data -> A) = hypre_StructMatrixRef(A);
+   (relax_data -> x) = hypre_StructVectorRef(x);
+   (relax_data -> b) = hypre_StructVectorRef(b);
+
+   (relax_data -> num_iterations) = 0;
+
+   /* if max_iter is zero, return */
+   if (max_iter == 0)
+   {
+      /* if using a zero initial guess, return zero */
+      if (zero_guess)
+      {
+         hypre_StructVectorSetConstantValues(x, 0.0);
+      }
+
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
+   num_parities = hypre_LineRelaxGetParities(relax_data, ndim, dirs, &num_dirs);
+   num_colors   = (zebra) ? hypre_LineRelaxNumColors(A, dirs, num_dirs, num_parities) : 1;
+
+   hypre_SetIndex(stride, 1);
+   if (zebra)
+   {
+      for (e = 0; e < num_dirs; e++)
+      {
+         hypre_IndexD(stride, dirs[e]) = 2;
+      }
+   }
+
+   boxes     = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+   color_box = hypre_BoxCreate(ndim);
+
+   /*----------------------------------------------------------
+    * Do the iterations
+    *----------------------------------------------------------*/
+
+   /* with a zero guess, x is not used until the first color has been done */
+   use_x = !zero_guess;
+   if (zero_guess)
+   {
+      hypre_StructVectorSetConstantValues(x, 0.0);
+   }
+
+   for (iter = 0; iter < max_iter; iter++)
+   {
+      for (color = 0; color < num_colors; color++)
+      {
+         if (use_x)
+         {
+            hypre_InitializeIndtComputations(compute_pkg, hypre_StructVectorData(x),
+                                             &comm_handle);
+            hypre_FinalizeIndtComputations(comm_handle);
+         }
+
+         /* compute the right-hand sides, and solve lines within boxes */
+         hypre_ForBoxI(i, boxes)
+         {
+            box = hypre_BoxArrayBox(boxes, i);
+
+            for (parity = 0; parity < num_parities; parity++)
+            {
+               hypre_CopyBox(box, color_box);
+               if (zebra &&
+                   (!hypre_LineRelaxParityInColor(parity, color, num_colors, start_color, num_dirs) ||
+                    hypre_LineRelaxParityBox(color_box, parity, dirs, num_dirs)))
+               {
+                  continue;
+               }
+
+               hypre_BoxGetStrideSize(color_box, stride, loop_size);
+               hypre_LineRelaxRHS(relax_data, i, loop_size, hypre_BoxIMin(color_box),
+                                  stride, use_x);
+
+               if (!use_cr)
+               {
+                  hypre_CopyIndex(loop_size, line_loop_size);
+                  hypre_IndexD(line_loop_size, line_dir) = 1;
+                  hypre_LineRelaxSolve(relax_data, i, line_loop_size, hypre_BoxIMin(color_box),
+                                       stride, hypre_BoxSizeD(box, line_dir), use_x);
+               }
+            }
+         }
+
+         /* solve lines that are split between boxes */
+         if (use_cr)
+         {
+            for (parity = 0; parity < num_parities; parity++)
+            {
+               if (zebra &&
+                   !hypre_LineRelaxParityInColor(parity, color, num_colors, start_color, num_dirs))
+               {
+                  continue;
+               }
+
+               hypre_CyclicReduction(cr_data[parity], (relax_data -> A_sol),
+                                     (relax_data -> t), (relax_data -> c));
+
+               hypre_ForBoxI(i, boxes)
+               {
+                  hypre_CopyBox(hypre_BoxArrayBox(boxes, i), color_box);
+                  if (zebra && hypre_LineRelaxParityBox(color_box, parity, dirs, num_dirs))
+                  {
+                     continue;
+                  }
+
+                  hypre_BoxGetStrideSize(color_box, stride, loop_size);
+                  hypre_LineRelaxUpdate(relax_data, i, loop_size, hypre_BoxIMin(color_box),
+                                        stride);
+               }
+            }
+         }
+
+         use_x = 1;
+      }
+
+      (relax_data -> num_iterations) = iter + 1;
+   }
+
+   hypre_BoxDestroy(color_box);
+
+   hypre_EndTiming(relax_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetMaxIter( void      *relax_vdata,
+                           HYPRE_Int  max_iter )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetZeroGuess( void      *relax_vdata,
+                             HYPRE_Int  zero_guess )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> zero_guess) = zero_guess;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetWeight( void       *relax_vdata,
+                          HYPRE_Real  weight )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> weight) = weight;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Direction of the lines.  This must be set before Setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetLineDir( void      *relax_vdata,
+                           HYPRE_Int  line_dir )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> line_dir) = line_dir;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Zebra (1) or simultaneous (0) update of the lines.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetZebra( void      *relax_vdata,
+                         HYPRE_Int  zebra )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> zebra) = zebra;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Color of the lines that are updated first in zebra order (0 or 1).  With one
+ * color per parity, 1 runs through the parities in reverse order.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetStartColor( void      *relax_vdata,
+                              HYPRE_Int  start_color )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> start_color) = start_color;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxGetNumIterations( void      *relax_vdata,
+                                 HYPRE_Int *num_iterations )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   *num_iterations = (relax_data -> num_iterations);
+
+   return hypre_error_flag;
+}
@@ -37,6 +37,8 @@ hypre_PFMGCreate( MPI_Comm  comm )
    (pfmg_data -> num_pre_relax)     = 1;
    (pfmg_data -> num_post_relax)    = 1;
    (pfmg_data -> skip_relax)        = 1;
+   (pfmg_data -> temporal_blocking) = 0;
+   (pfmg_data -> max_coarse_size)   = 0;
    (pfmg_data -> logging)           = 0;
    (pfmg_data -> print_level)       = 0;
 
@@ -85,6 +87,7 @@ hypre_PFMGDestroy( void *pfmg_vdata )
             hypre_SemiRestrictDestroy(pfmg_data -> restrict_data_l[l]);
             hypre_SemiInterpDestroy(pfmg_data -> interp_data_l[l]);
          }
+         hypre_PFMGCoarseSolveDestroy(pfmg_data -> coarse_solve_data);
          hypre_TFree(pfmg_data -> relax_data_l, HYPRE_MEMORY_HOST);
          hypre_TFree(pfmg_data -> matvec_data_l, HYPRE_MEMORY_HOST);
          hypre_TFree(pfmg_data -> restrict_data_l, HYPRE_MEMORY_HOST);
@@ -406,6 +409,56 @@ hypre_PFMGGetSkipRelax( void *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetTemporalBlocking( void *pfmg_vdata,
+                               HYPRE_Int  temporal_blocking )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> temporal_blocking) = temporal_blocking;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetTemporalBlocking( void *pfmg_vdata,
+                               HYPRE_Int *temporal_blocking )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *temporal_blocking = (pfmg_data -> temporal_blocking);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetMaxCoarseSize( void *pfmg_vdata,
+                            HYPRE_Int  max_coarse_size )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> max_coarse_size) = max_coarse_size;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetMaxCoarseSize( void *pfmg_vdata,
+                            HYPRE_Int *max_coarse_size )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *max_coarse_size = (pfmg_data -> max_coarse_size);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
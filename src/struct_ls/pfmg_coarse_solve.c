@@ -0,0 +1,587 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Direct solve of the PFMG coarsest grid problem.
+ *
+ * The coarse grid is agglomerated on the processes that own part of it, which
+ * are gathered in a sub-communicator.  In setup, each of these processes sends
+ * its rows of A (in sparse form) to all the others, and every one of them
+ * assembles and factors the dense coarse matrix with LU and partial pivoting.
+ * A solve then takes one Allgatherv of the right-hand side on the
+ * sub-communicator, instead of the ghost exchanges of many relaxation sweeps.
+ *
+ * Unknowns are numbered by process, then by box, then lexicographically in
+ * each box, which is the order used by the BoxLoops below.  Couplings are
+ * matched to columns through the global bounding box index of the points.
+ *
+ * Zero pivots, as with a singular (e.g., pure Neumann) coarse problem, are
+ * skipped, and the corresponding solution entries are set to zero.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "_hypre_struct_mv.hpp"
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm                comm;
+   MPI_Comm                sub_comm;   /* processes that own coarse points */
+
+   HYPRE_Int               num_rows;   /* global number of coarse points */
+   HYPRE_Int               local_size;
+   HYPRE_Int              *counts;     /* local sizes on sub_comm */
+   HYPRE_Int              *displs;     /* offsets on sub_comm */
+
+   HYPRE_Real             *lu;         /* dense LU factors (column major) */
+   HYPRE_Int              *piv;        /* row pivots (-1 for zero pivots) */
+   HYPRE_Real             *rhs;        /* global right-hand side and solution */
+   HYPRE_Real             *local;      /* local values on the host */
+   HYPRE_Real             *buffer;     /* local values, in the memory of x */
+   HYPRE_MemoryLocation    memory_location;
+
+   HYPRE_Int               time_index;
+
+} hypre_PFMGCoarseSolveData;
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_PFMGCoarseSolveCreate( MPI_Comm  comm )
+{
+   hypre_PFMGCoarseSolveData *solve_data;
+
+   solve_data = hypre_CTAlloc(hypre_PFMGCoarseSolveData, 1, HYPRE_MEMORY_HOST);
+
+   (solve_data -> comm)       = comm;
+   (solve_data -> sub_comm)   = hypre_MPI_COMM_NULL;
+   (solve_data -> time_index) = hypre_InitializeTiming("PFMGCoarseSolve");
+
+   return (void *) solve_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGCoarseSolveDestroy( void *solve_vdata )
+{
+   hypre_PFMGCoarseSolveData *solve_data = (hypre_PFMGCoarseSolveData *)solve_vdata;
+
+   if (solve_data)
+   {
+      if ((solve_data -> sub_comm) != hypre_MPI_COMM_NULL)
+      {
+         hypre_MPI_Comm_free(&(solve_data -> sub_comm));
+      }
+      hypre_TFree(solve_data -> counts, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> displs, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> lu, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> piv, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> rhs, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> local, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> buffer, solve_data -> memory_location);
+      hypre_FinalizeTiming(solve_data -> time_index);
+      hypre_TFree(solve_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns the index of 'index' in the bounding box 'bbox', after mapping it
+ * into the first period in periodic directions, or -1 if it is outside.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_BigInt
+hypre_PFMGCoarseSolveKey( HYPRE_Int    ndim,
+                          hypre_Box   *bbox,
+                          hypre_Index  periodic,
+                          hypre_Index  index )
+{
+   HYPRE_BigInt  key = 0;
+   HYPRE_Int     d, i, p;
+
+   for (d = ndim - 1; d >= 0; d--)
+   {
+      i = hypre_IndexD(index, d) - hypre_BoxIMinD(bbox, d);
+      p = hypre_IndexD(periodic, d);
+      if (p > 0)
+      {
+         i = ((i % p) + p) % p;
+      }
+      if (i < 0 || i >= hypre_BoxSizeD(bbox, d))
+      {
+         return -1;
+      }
+      key = key * (HYPRE_BigInt) hypre_BoxSizeD(bbox, d) + i;
+   }
+
+   return key;
+}
+
+/*--------------------------------------------------------------------------
+ * Factors the n x n column major matrix lu in place, with partial pivoting.
+ * Columns without a nonzero pivot are skipped and get piv = -1.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGCoarseSolveFactor( HYPRE_Int   n,
+                             HYPRE_Real *lu,
+                             HYPRE_Int  *piv )
+{
+   HYPRE_Real  amax, tol, val;
+   HYPRE_Int   i, j, k, p;
+
+   /* pivots below tol are treated as zero */
+   amax = 0.0;
+   for (i = 0; i < n * n; i++)
+   {
+      amax = hypre_max(amax, hypre_abs(lu[i]));
+   }
+   tol = amax * n * HYPRE_REAL_EPSILON;
+
+   for (k = 0; k < n; k++)
+   {
+      p = k;
+      for (i = k + 1; i < n; i++)
+      {
+         if (hypre_abs(lu[i + k * n]) > hypre_abs(lu[p + k * n]))
+         {
+            p = i;
+         }
+      }
+      if (!(hypre_abs(lu[p + k * n]) > tol))
+      {
+         piv[k] = -1;
+         continue;
+      }
+
+      piv[k] = p;
+      if (p != k)
+      {
+         for (j = 0; j < n; j++)
+         {
+            val = lu[k + j * n];
+            lu[k + j * n] = lu[p + j * n];
+            lu[p + j * n] = val;
+         }
+      }
+
+      for (i = k + 1; i < n; i++)
+      {
+         lu[i + k * n] /= lu[k + k * n];
+      }
+      for (j = k + 1; j < n; j++)
+      {
+         val = lu[k + j * n];
+         if (val != 0.0)
+         {
+            for (i = k + 1; i < n; i++)
+            {
+               lu[i + j * n] -= lu[i + k * n] * val;
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Solves with the factors from hypre_PFMGCoarseSolveFactor, in place.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGCoarseSolveSubstitute( HYPRE_Int   n,
+                                 HYPRE_Real *lu,
+                                 HYPRE_Int  *piv,
+                                 HYPRE_Real *x )
+{
+   HYPRE_Real  val;
+   HYPRE_Int   i, k;
+
+   /* forward substitution with the unit lower triangular factor */
+   for (k = 0; k < n; k++)
+   {
+      if (piv[k] < 0)
+      {
+         continue;
+      }
+      if (piv[k] != k)
+      {
+         val = x[k];
+         x[k] = x[piv[k]];
+         x[piv[k]] = val;
+      }
+      for (i = k + 1; i < n; i++)
+      {
+         x[i] -= lu[i + k * n] * x[k];
+      }
+   }
+
+   /* back substitution with the upper triangular factor */
+   for (k = n - 1; k >= 0; k--)
+   {
+      if (piv[k] < 0)
+      {
+         x[k] = 0.0;
+         continue;
+      }
+      x[k] /= lu[k + k * n];
+      for (i = 0; i < k; i++)
+      {
+         x[i] -= lu[i + k * n] * x[k];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGCoarseSolveSetup( void               *solve_vdata,
+                            hypre_StructMatrix *A,
+                            hypre_StructVector *b,
+                            hypre_StructVector *x )
+{
+   hypre_PFMGCoarseSolveData *solve_data = (hypre_PFMGCoarseSolveData *)solve_vdata;
+
+   MPI_Comm               comm = (solve_data -> comm);
+   MPI_Comm               sub_comm;
+   hypre_StructGrid      *grid = hypre_StructMatrixGrid(A);
+   hypre_BoxArray        *boxes = hypre_StructGridBoxes(grid);
+   hypre_Box             *bbox = hypre_StructGridBoundingBox(grid);
+   hypre_IndexRef         periodic = hypre_StructGridPeriodic(grid);
+   hypre_StructStencil   *stencil = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size = hypre_StructStencilSize(stencil);
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+   HYPRE_Int              constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   HYPRE_MemoryLocation   memory_location = hypre_StructMatrixMemoryLocation(A);
+
+   hypre_Box             *box, *A_dbox;
+   hypre_Index            loop_size, stride, index;
+   HYPRE_Int             *counts, *displs, *row_counts, *row_displs;
+   HYPRE_Int             *cols, *all_cols, *ids;
+   HYPRE_BigInt          *keys, *all_keys, key;
+   HYPRE_Real            *vals, *all_vals, *vals_host, *Ap, *lu;
+   HYPRE_Int              num_procs, num_rows, local_size, offset, size;
+   HYPRE_Int              myid, i, j, k, s, d, ii;
+
+   hypre_BeginTiming(solve_data -> time_index);
+
+   local_size = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      local_size += hypre_BoxVolume(hypre_BoxArrayBox(boxes, i));
+   }
+
+   /*----------------------------------------------------------
+    * Gather the processes that own part of the grid
+    *----------------------------------------------------------*/
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_split(comm, (local_size > 0) ? 0 : hypre_MPI_UNDEFINED, myid, &sub_comm);
+   (solve_data -> sub_comm)   = sub_comm;
+   (solve_data -> local_size) = local_size;
+   if (local_size == 0)
+   {
+      hypre_EndTiming(solve_data -> time_index);
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(sub_comm, &num_procs);
+   counts = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   displs = hypre_TAlloc(HYPRE_Int, num_procs + 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&local_size, 1, HYPRE_MPI_INT, counts, 1, HYPRE_MPI_INT, sub_comm);
+   displs[0] = 0;
+   for (i = 0; i < num_procs; i++)
+   {
+      displs[i + 1] = displs[i] + counts[i];
+   }
+   num_rows = displs[num_procs];
+
+   /*----------------------------------------------------------
+    * Number the local points and exchange their keys
+    *----------------------------------------------------------*/
+
+   keys = hypre_TAlloc(HYPRE_BigInt, local_size, HYPRE_MEMORY_HOST);
+   cols = hypre_TAlloc(HYPRE_Int, local_size * stencil_size, HYPRE_MEMORY_HOST);
+   offset = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box  = hypre_BoxArrayBox(boxes, i);
+      size = hypre_BoxVolume(box);
+      hypre_BoxGetSize(box, loop_size);
+      for (ii = 0; ii < size; ii++)
+      {
+         k = ii;
+         for (d = 0; d < ndim; d++)
+         {
+            hypre_IndexD(index, d) = hypre_BoxIMinD(box, d) + k % hypre_IndexD(loop_size, d);
+            k /= hypre_IndexD(loop_size, d);
+         }
+         keys[offset + ii] = hypre_PFMGCoarseSolveKey(ndim, bbox, periodic, index);
+      }
+      offset += size;
+   }
+
+   all_keys = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgatherv(keys, local_size, HYPRE_MPI_BIG_INT,
+                        all_keys, counts, displs, HYPRE_MPI_BIG_INT, sub_comm);
+   ids = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      ids[i] = i;
+   }
+   hypre_BigQsortbi(all_keys, ids, 0, num_rows - 1);
+
+   /*----------------------------------------------------------
+    * Find the columns of the local couplings
+    *----------------------------------------------------------*/
+
+   offset = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box  = hypre_BoxArrayBox(boxes, i);
+      size = hypre_BoxVolume(box);
+      hypre_BoxGetSize(box, loop_size);
+      for (ii = 0; ii < size; ii++)
+      {
+         for (s = 0; s < stencil_size; s++)
+         {
+            k = ii;
+            for (d = 0; d < ndim; d++)
+            {
+               hypre_IndexD(index, d) = hypre_BoxIMinD(box, d) + k % hypre_IndexD(loop_size, d) +
+                                        hypre_IndexD(stencil_shape[s], d);
+               k /= hypre_IndexD(loop_size, d);
+            }
+            key = hypre_PFMGCoarseSolveKey(ndim, bbox, periodic, index);
+            j = (key < 0) ? -1 : hypre_BigBinarySearch(all_keys, key, num_rows);
+            cols[s * local_size + offset + ii] = (j < 0) ? -1 : ids[j];
+         }
+      }
+      offset += size;
+   }
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+   hypre_TFree(all_keys, HYPRE_MEMORY_HOST);
+   hypre_TFree(ids, HYPRE_MEMORY_HOST);
+
+   /*----------------------------------------------------------
+    * Copy the local coefficients
+    *----------------------------------------------------------*/
+
+   vals = hypre_TAlloc(HYPRE_Real, local_size * stencil_size, memory_location);
+   hypre_SetIndex(stride, 1);
+   offset = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box    = hypre_BoxArrayBox(boxes, i);
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      hypre_BoxGetSize(box, loop_size);
+
+      for (s = 0; s < stencil_size; s++)
+      {
+         HYPRE_Real *vp = vals + s * local_size + offset;
+
+         Ap = hypre_StructMatrixBoxData(A, i, s);
+         if (constant_coefficient == 1 ||
+             (constant_coefficient == 2 && hypre_IndexEqual(stencil_shape[s], 0, ndim) == 0))
+         {
+            HYPRE_Int Ai = hypre_CCBoxIndexRank(A_dbox, hypre_BoxIMin(box));
+            Ap += Ai;
+#define DEVICE_VAR is_device_ptr(vp,Ap)
+            hypre_BoxLoop1Begin(ndim, loop_size,
+                                box, hypre_BoxIMin(box), stride, vi);
+            {
+               vp[vi] = Ap[0];
+            }
+            hypre_BoxLoop1End(vi);
+#undef DEVICE_VAR
+         }
+         else
+         {
+#define DEVICE_VAR is_device_ptr(vp,Ap)
+            hypre_BoxLoop2Begin(ndim, loop_size,
+                                A_dbox, hypre_BoxIMin(box), stride, Ai,
+                                box, hypre_BoxIMin(box), stride, vi);
+            {
+               vp[vi] = Ap[Ai];
+            }
+            hypre_BoxLoop2End(Ai, vi);
+#undef DEVICE_VAR
+         }
+      }
+      offset += hypre_BoxVolume(box);
+   }
+   vals_host = hypre_TAlloc(HYPRE_Real, local_size * stencil_size, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(vals_host, vals, HYPRE_Real, local_size * stencil_size,
+                 HYPRE_MEMORY_HOST, memory_location);
+   hypre_TFree(vals, memory_location);
+
+   /*----------------------------------------------------------
+    * Exchange the rows, and assemble and factor the matrix
+    *----------------------------------------------------------*/
+
+   row_counts = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   row_displs = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_procs; i++)
+   {
+      row_counts[i] = counts[i] * stencil_size;
+      row_displs[i] = displs[i] * stencil_size;
+   }
+   all_cols = hypre_TAlloc(HYPRE_Int, num_rows * stencil_size, HYPRE_MEMORY_HOST);
+   all_vals = hypre_TAlloc(HYPRE_Real, num_rows * stencil_size, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgatherv(cols, local_size * stencil_size, HYPRE_MPI_INT,
+                        all_cols, row_counts, row_displs, HYPRE_MPI_INT, sub_comm);
+   hypre_MPI_Allgatherv(vals_host, local_size * stencil_size, HYPRE_MPI_REAL,
+                        all_vals, row_counts, row_displs, HYPRE_MPI_REAL, sub_comm);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(vals_host, HYPRE_MEMORY_HOST);
+
+   lu = hypre_CTAlloc(HYPRE_Real, num_rows * num_rows, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_procs; k++)
+   {
+      for (s = 0; s < stencil_size; s++)
+      {
+         for (ii = 0; ii < counts[k]; ii++)
+         {
+            i = displs[k] + ii;
+            j = all_cols[row_displs[k] + s * counts[k] + ii];
+            if (j > -1)
+            {
+               lu[i + j * num_rows] += all_vals[row_displs[k] + s * counts[k] + ii];
+            }
+         }
+      }
+   }
+   hypre_TFree(row_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_displs, HYPRE_MEMORY_HOST);
+   hypre_TFree(all_cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(all_vals, HYPRE_MEMORY_HOST);
+
+   (solve_data -> piv) = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   hypre_PFMGCoarseSolveFactor(num_rows, lu, (solve_data -> piv));
+
+   (solve_data -> num_rows) = num_rows;
+   (solve_data -> counts)   = counts;
+   (solve_data -> displs)   = displs;
+   (solve_data -> lu)       = lu;
+   (solve_data -> rhs)      = hypre_TAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+   (solve_data -> local)    = hypre_TAlloc(HYPRE_Real, local_size, HYPRE_MEMORY_HOST);
+   (solve_data -> buffer)   = hypre_TAlloc(HYPRE_Real, local_size,
+                                           hypre_StructVectorMemoryLocation(x));
+   (solve_data -> memory_location) = hypre_StructVectorMemoryLocation(x);
+
+   hypre_EndTiming(solve_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGCoarseSolve( void               *solve_vdata,
+                       hypre_StructMatrix *A,
+                       hypre_StructVector *b,
+                       hypre_StructVector *x )
+{
+   hypre_PFMGCoarseSolveData *solve_data = (hypre_PFMGCoarseSolveData *)solve_vdata;
+
+   HYPRE_Int              local_size = (solve_data -> local_size);
+   HYPRE_Int              num_rows   = (solve_data -> num_rows);
+   HYPRE_Real            *rhs        = (solve_data -> rhs);
+   HYPRE_Real            *local      = (solve_data -> local);
+   HYPRE_Real            *buffer     = (solve_data -> buffer);
+   HYPRE_Int              ndim       = hypre_StructVectorNDim(x);
+   HYPRE_MemoryLocation   memory_location = hypre_StructVectorMemoryLocation(x);
+   hypre_BoxArray        *boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(x));
+
+   hypre_Box             *box, *b_dbox, *x_dbox;
+   hypre_Index            loop_size, stride;
+   HYPRE_Real            *bp, *xp, *vp;
+   HYPRE_Int              myid, offset, i;
+
+   if (local_size == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_BeginTiming(solve_data -> time_index);
+
+   hypre_SetIndex(stride, 1);
+   hypre_MPI_Comm_rank(solve_data -> sub_comm, &myid);
+
+   /* gather the right-hand side */
+   offset = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box    = hypre_BoxArrayBox(boxes, i);
+      b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+      bp     = hypre_StructVectorBoxData(b, i);
+      vp     = buffer + offset;
+      hypre_BoxGetSize(box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(vp,bp)
+      hypre_BoxLoop2Begin(ndim, loop_size,
+                          b_dbox, hypre_BoxIMin(box), stride, bi,
+                          box, hypre_BoxIMin(box), stride, vi);
+      {
+         vp[vi] = bp[bi];
+      }
+      hypre_BoxLoop2End(bi, vi);
+#undef DEVICE_VAR
+
+      offset += hypre_BoxVolume(box);
+   }
+   hypre_TMemcpy(local, buffer, HYPRE_Real, local_size, HYPRE_MEMORY_HOST, memory_location);
+   hypre_MPI_Allgatherv(local, local_size, HYPRE_MPI_REAL,
+                        rhs, (solve_data -> counts), (solve_data -> displs),
+                        HYPRE_MPI_REAL, solve_data -> sub_comm);
+
+   /* solve redundantly and keep the local part */
+   hypre_PFMGCoarseSolveSubstitute(num_rows, (solve_data -> lu), (solve_data -> piv), rhs);
+   hypre_TMemcpy(buffer, rhs + (solve_data -> displs)[myid], HYPRE_Real, local_size,
+                 memory_location, HYPRE_MEMORY_HOST);
+
+   offset = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box    = hypre_BoxArrayBox(boxes, i);
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      xp     = hypre_StructVectorBoxData(x, i);
+      vp     = buffer + offset;
+      hypre_BoxGetSize(box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(xp,vp)
+      hypre_BoxLoop2Begin(ndim, loop_size,
+                          x_dbox, hypre_BoxIMin(box), stride, xi,
+                          box, hypre_BoxIMin(box), stride, vi);
+      {
+         xp[xi] = vp[vi];
+      }
+      hypre_BoxLoop2End(xi, vi);
+#undef DEVICE_VAR
+
+      offset += hypre_BoxVolume(box);
+   }
+
+   hypre_IncFLOPCount(2 * num_rows * num_rows);
+   hypre_EndTiming(solve_data -> time_index);
+
+   return hypre_error_flag;
+}
@@ -17,6 +17,15 @@ typedef struct
    HYPRE_Int               relax_type;
    HYPRE_Real              jacobi_weight;
 
+   void                   *tb_relax_data;
+   HYPRE_Int               temporal_blocking;  /* sweeps per ghost exchange */
+   HYPRE_Int               use_temporal;
+
+   void                   *line_relax_data;
+   HYPRE_Int               line_dir;
+
+   hypre_StructMatrix     *A_stored;  /* stored copy of generated coefficients */
+
 } hypre_PFMGRelaxData;
 
 /*--------------------------------------------------------------------------
@@ -32,6 +41,11 @@ hypre_PFMGRelaxCreate( MPI_Comm  comm )
    (pfmg_relax_data -> rb_relax_data) = hypre_RedBlackGSCreate(comm);
    (pfmg_relax_data -> relax_type) = 0;        /* Weighted Jacobi */
    (pfmg_relax_data -> jacobi_weight) = 0.0;
+   (pfmg_relax_data -> tb_relax_data) = hypre_TemporalRelaxCreate(comm);
+   (pfmg_relax_data -> temporal_blocking) = 0;
+   (pfmg_relax_data -> use_temporal) = 0;
+   (pfmg_relax_data -> line_relax_data) = hypre_LineRelaxCreate(comm);
+   (pfmg_relax_data -> line_dir) = 0;
 
    return (void *) pfmg_relax_data;
 }
@@ -48,6 +62,9 @@ hypre_PFMGRelaxDestroy( void *pfmg_relax_vdata )
    {
       hypre_PointRelaxDestroy(pfmg_relax_data -> relax_data);
       hypre_RedBlackGSDestroy(pfmg_relax_data -> rb_relax_data);
+      hypre_TemporalRelaxDestroy(pfmg_relax_data -> tb_relax_data);
+      hypre_LineRelaxDestroy(pfmg_relax_data -> line_relax_data);
+      hypre_StructMatrixDestroy(pfmg_relax_data -> A_stored);
       hypre_TFree(pfmg_relax_data, HYPRE_MEMORY_HOST);
    }
 
@@ -67,6 +84,18 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
    HYPRE_Int    relax_type = (pfmg_relax_data -> relax_type);
    HYPRE_Int    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
 
+   if (pfmg_relax_data -> A_stored)
+   {
+      A = (pfmg_relax_data -> A_stored);
+   }
+
+   if (pfmg_relax_data -> use_temporal)
+   {
+      hypre_TemporalRelax((pfmg_relax_data -> tb_relax_data), A, b, x);
+
+      return hypre_error_flag;
+   }
+
    switch (relax_type)
    {
       case 0:
@@ -85,6 +114,10 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
             hypre_RedBlackGS((pfmg_relax_data -> rb_relax_data), A, b, x);
          }
 
+         break;
+      case 4:
+      case 5:
+         hypre_LineRelax((pfmg_relax_data -> line_relax_data), A, b, x);
          break;
    }
 
@@ -103,6 +136,41 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
    hypre_PFMGRelaxData *pfmg_relax_data  = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
    HYPRE_Int            relax_type       = (pfmg_relax_data -> relax_type);
    HYPRE_Real           jacobi_weight    = (pfmg_relax_data -> jacobi_weight);
+   HYPRE_Int            temporal_blocking = (pfmg_relax_data -> temporal_blocking);
+   void                *tb_relax_data    = (pfmg_relax_data -> tb_relax_data);
+   HYPRE_Int            tb_type          = (relax_type > 1) ? 1 : 0;
+
+   /* Only Jacobi works with generated coefficients, so store them otherwise */
+   hypre_StructMatrixDestroy(pfmg_relax_data -> A_stored);
+   (pfmg_relax_data -> A_stored) = NULL;
+   if (relax_type > 1 && hypre_StructMatrixCoeffFcn(A))
+   {
+      (pfmg_relax_data -> A_stored) = hypre_StructMatrixGenerateCopy(A);
+      A = (pfmg_relax_data -> A_stored);
+   }
+
+   /* Use temporal blocking if it was requested and is available for A and
+    * the relaxation type (not for line relaxation) */
+   (pfmg_relax_data -> use_temporal) = 0;
+   if (relax_type > 3)
+   {
+      temporal_blocking = 0;
+   }
+   if (temporal_blocking > 0)
+   {
+      temporal_blocking = hypre_min(temporal_blocking,
+                                    hypre_TemporalRelaxMaxSweeps(A, tb_type));
+   }
+   if (temporal_blocking > 0)
+   {
+      hypre_TemporalRelaxSetType(tb_relax_data, tb_type);
+      hypre_TemporalRelaxSetWeight(tb_relax_data, (relax_type == 1) ? jacobi_weight : 1.0);
+      hypre_TemporalRelaxSetNumSweeps(tb_relax_data, temporal_blocking);
+      hypre_TemporalRelaxSetup(tb_relax_data, A, b, x);
+      (pfmg_relax_data -> use_temporal) = 1;
+
+      return hypre_error_flag;
+   }
 
    switch (relax_type)
    {
@@ -114,12 +182,22 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
       case 3:
          hypre_RedBlackGSSetup((pfmg_relax_data -> rb_relax_data), A, b, x);
          break;
+      case 4:
+      case 5:
+         hypre_LineRelaxSetLineDir((pfmg_relax_data -> line_relax_data),
+                                   (pfmg_relax_data -> line_dir));
+         hypre_LineRelaxSetup((pfmg_relax_data -> line_relax_data), A, b, x);
+         break;
    }
 
    if (relax_type == 1)
    {
       hypre_PointRelaxSetWeight(pfmg_relax_data -> relax_data, jacobi_weight);
    }
+   else if (relax_type == 4)
+   {
+      hypre_LineRelaxSetWeight(pfmg_relax_data -> line_relax_data, jacobi_weight);
+   }
 
    return hypre_error_flag;
 }
@@ -155,6 +233,15 @@ hypre_PFMGRelaxSetType( void  *pfmg_relax_vdata,
       case 2: /* Red-Black Gauss-Seidel */
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
          break;
+
+      case 4: /* Weighted line Jacobi */
+         hypre_LineRelaxSetZebra((pfmg_relax_data -> line_relax_data), 0);
+         break;
+
+      case 5: /* Zebra line Gauss-Seidel */
+         hypre_LineRelaxSetZebra((pfmg_relax_data -> line_relax_data), 1);
+         hypre_LineRelaxSetWeight((pfmg_relax_data -> line_relax_data), 1.0);
+         break;
    }
 
    return hypre_error_flag;
@@ -191,10 +278,19 @@ hypre_PFMGRelaxSetPreRelax( void  *pfmg_relax_vdata )
 
       case 2: /* Red-Black Gauss-Seidel */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
+         hypre_TemporalRelaxSetStartRed((pfmg_relax_data -> tb_relax_data));
          break;
 
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
+         hypre_TemporalRelaxSetStartRed((pfmg_relax_data -> tb_relax_data));
+         break;
+
+      case 4: /* Weighted line Jacobi */
+         break;
+
+      case 5: /* Zebra line Gauss-Seidel */
+         hypre_LineRelaxSetStartColor((pfmg_relax_data -> line_relax_data), 0);
          break;
    }
 
@@ -218,10 +314,19 @@ hypre_PFMGRelaxSetPostRelax( void  *pfmg_relax_vdata )
 
       case 2: /* Red-Black Gauss-Seidel */
          hypre_RedBlackGSSetStartBlack((pfmg_relax_data -> rb_relax_data));
+         hypre_TemporalRelaxSetStartBlack((pfmg_relax_data -> tb_relax_data));
          break;
 
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
+         hypre_TemporalRelaxSetStartRed((pfmg_relax_data -> tb_relax_data));
+         break;
+
+      case 4: /* Weighted line Jacobi */
+         break;
+
+      case 5: /* Zebra line Gauss-Seidel (symmetric) */
+         hypre_LineRelaxSetStartColor((pfmg_relax_data -> line_relax_data), 1);
          break;
    }
 
@@ -254,6 +359,8 @@ hypre_PFMGRelaxSetMaxIter( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetMaxIter((pfmg_relax_data -> relax_data), max_iter);
    hypre_RedBlackGSSetMaxIter((pfmg_relax_data -> rb_relax_data), max_iter);
+   hypre_TemporalRelaxSetMaxIter((pfmg_relax_data -> tb_relax_data), max_iter);
+   hypre_LineRelaxSetMaxIter((pfmg_relax_data -> line_relax_data), max_iter);
 
    return hypre_error_flag;
 }
@@ -269,6 +376,8 @@ hypre_PFMGRelaxSetZeroGuess( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetZeroGuess((pfmg_relax_data -> relax_data), zero_guess);
    hypre_RedBlackGSSetZeroGuess((pfmg_relax_data -> rb_relax_data), zero_guess);
+   hypre_TemporalRelaxSetZeroGuess((pfmg_relax_data -> tb_relax_data), zero_guess);
+   hypre_LineRelaxSetZeroGuess((pfmg_relax_data -> line_relax_data), zero_guess);
 
    return hypre_error_flag;
 }
@@ -287,3 +396,34 @@ hypre_PFMGRelaxSetTempVec( void               *pfmg_relax_vdata,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * Number of sweeps done per ghost exchange with temporal blocking (0 = off).
+ * This is reduced in Setup to what the matrix allows.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetTemporalBlocking( void      *pfmg_relax_vdata,
+                                    HYPRE_Int  temporal_blocking )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   (pfmg_relax_data -> temporal_blocking) = temporal_blocking;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Direction of the lines for line relaxation (relax types 4 and 5).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetLineDir( void      *pfmg_relax_vdata,
+                           HYPRE_Int  line_dir )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   (pfmg_relax_data -> line_dir) = line_dir;
+
+   return hypre_error_flag;
+}
@@ -73,6 +73,9 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             usr_jacobi_weight = (pfmg_data -> usr_jacobi_weight);
    HYPRE_Real            jacobi_weight    = (pfmg_data -> jacobi_weight);
    HYPRE_Int             skip_relax =       (pfmg_data -> skip_relax);
+   HYPRE_Int             temporal_blocking = (pfmg_data -> temporal_blocking);
+   HYPRE_Int             max_coarse_size = (pfmg_data -> max_coarse_size);
+   HYPRE_BigInt          local_size, coarse_size = 0;
    HYPRE_Real           *dxyz       =       (pfmg_data -> dxyz);
    HYPRE_Int             rap_type;
 
@@ -89,6 +92,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
    HYPRE_Int            *cdir_l;
    HYPRE_Int            *active_l;
+   HYPRE_Int            *line_dir_l = NULL;
    hypre_StructGrid    **grid_l;
    hypre_StructGrid    **P_grid_l;
 
@@ -100,6 +104,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Real           *mean, *deviation;
    HYPRE_Real            alpha, beta;
 
+   hypre_StructMatrix   *A_stored;
    hypre_StructMatrix  **A_l;
    hypre_StructMatrix  **P_l;
    hypre_StructMatrix  **RT_l;
@@ -115,6 +120,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    void                **matvec_data_l;
    void                **restrict_data_l;
    void                **interp_data_l;
+   void                 *coarse_solve_data = NULL;
 
    hypre_StructGrid     *grid;
    HYPRE_Int             ndim;
@@ -125,6 +131,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             cdir, periodic, cmaxsize;
    HYPRE_Int             d, l;
    HYPRE_Int             dxyz_flag;
+   HYPRE_Int             line_relax, line_dir, exact_lines;
 
    HYPRE_Int             b_num_ghost[]  = {0, 0, 0, 0, 0, 0};
    HYPRE_Int             x_num_ghost[]  = {1, 1, 1, 1, 1, 1};
@@ -144,6 +151,16 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    grid  = hypre_StructMatrixGrid(A);
    ndim  = hypre_StructGridNDim(grid);
 
+   /* The coarse grid operators need stored coefficients of A */
+   if (hypre_StructMatrixCoeffFcn(A))
+   {
+      A_stored = hypre_StructMatrixGenerateCopy(A);
+   }
+   else
+   {
+      A_stored = hypre_StructMatrixRef(A);
+   }
+
    /* Compute a new max_levels value based on the grid */
    cbox = hypre_BoxDuplicate(hypre_StructGridBoundingBox(grid));
    max_levels = 1;
@@ -164,7 +181,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    {
       mean = hypre_CTAlloc(HYPRE_Real, 3, HYPRE_MEMORY_HOST);
       deviation = hypre_CTAlloc(HYPRE_Real, 3, HYPRE_MEMORY_HOST);
-      hypre_PFMGComputeDxyz(A, dxyz, mean, deviation);
+      hypre_PFMGComputeDxyz(A_stored, dxyz, mean, deviation);
 
       for (d = 0; d < ndim; d++)
       {
@@ -198,6 +215,16 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    relax_weights = hypre_CTAlloc(HYPRE_Real, max_levels, HYPRE_MEMORY_HOST);
    hypre_SetIndex3(coarsen, 1, 1, 1); /* forces relaxation on finest grid */
 
+   /* With line relaxation, the lines are in the direction of strongest
+    * coupling, and strongly anisotropic grids are coarsened across the lines */
+   line_relax  = (relax_type == 4 || relax_type == 5);
+   line_dir    = -1;
+   exact_lines = 0;
+   if (line_relax)
+   {
+      line_dir_l = hypre_TAlloc(HYPRE_Int, max_levels, HYPRE_MEMORY_HOST);
+   }
+
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    data_location = hypre_StructGridDataLocation(grid);
    if (data_location != HYPRE_MEMORY_HOST)
@@ -225,7 +252,56 @@ hypre_PFMGSetup( void               *pfmg_vdata,
             min_dxyz = dxyz[d];
             cdir = d;
          }
-         alpha += 1.0 / (dxyz[d] * dxyz[d]);
+      }
+
+      if (line_relax)
+      {
+         HYPRE_Int  ldir = -1;
+
+         line_dir = (cdir > -1) ? cdir : 0;
+         line_dir_l[l] = line_dir;
+
+         /* Find the strongest direction across the lines */
+         min_dxyz = dxyz[0] + dxyz[1] + dxyz[2] + 1;
+         for (d = 0; d < ndim; d++)
+         {
+            if ((d != line_dir) &&
+                (hypre_BoxIMaxD(cbox, d) > hypre_BoxIMinD(cbox, d)) &&
+                (dxyz[d] < min_dxyz))
+            {
+               min_dxyz = dxyz[d];
+               ldir = d;
+            }
+         }
+
+         /* If the couplings across the lines are much weaker than along them,
+          * line relaxation smooths in the line direction, so coarsen across
+          * the lines.  Otherwise, semicoarsen as usual. */
+         if (ldir > -1 && dxyz[ldir] > 2 * dxyz[line_dir])
+         {
+            cdir = ldir;
+         }
+
+         /* Only the line direction is left.  Stop there, since line relaxation
+          * is then an exact solve, unless the lines are periodic. */
+         else if (ldir == -1 && cdir == line_dir)
+         {
+            periodic = hypre_IndexD(hypre_StructGridPeriodic(grid_l[l]), line_dir);
+            exact_lines = !periodic;
+            if (exact_lines)
+            {
+               cdir = -1;
+            }
+         }
+      }
+
+      /* the Jacobi weights only depend on the directions relaxed pointwise */
+      for (d = 0; d < ndim; d++)
+      {
+         if (d != line_dir)
+         {
+            alpha += 1.0 / (dxyz[d] * dxyz[d]);
+         }
       }
       relax_weights[l] = 1.0;
 
@@ -242,7 +318,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
          {
             for (d = 0; d < ndim; d++)
             {
-               if (d != cdir)
+               if (d != cdir && d != line_dir)
                {
                   beta += 1.0 / (dxyz[d] * dxyz[d]);
                }
@@ -257,7 +333,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
             }
 
             /* determine level Jacobi weights */
-            if (ndim > 1)
+            if (ndim > 1 + line_relax)
             {
                relax_weights[l] = 2.0 / (3.0 - alpha);
             }
@@ -268,6 +344,14 @@ hypre_PFMGSetup( void               *pfmg_vdata,
          }
       }
 
+      /* the global size of coarse grids is not set by hypre_StructCoarsen */
+      if (max_coarse_size > 0)
+      {
+         local_size = (HYPRE_BigInt) hypre_StructGridLocalSize(grid_l[l]);
+         hypre_MPI_Allreduce(&local_size, &coarse_size, 1, HYPRE_MPI_BIG_INT,
+                             hypre_MPI_SUM, comm);
+      }
+
       if (cdir != -1)
       {
          /* don't coarsen if a periodic direction and not divisible by 2 */
@@ -282,6 +366,12 @@ hypre_PFMGSetup( void               *pfmg_vdata,
          {
             cdir = -1;
          }
+
+         /* don't coarsen if the grid is small enough for the direct solve */
+         if ((l > 0) && (max_coarse_size > 0) && (coarse_size <= max_coarse_size))
+         {
+            cdir = -1;
+         }
       }
 
       /* stop coarsening */
@@ -357,8 +447,8 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    /* free up some things */
    hypre_BoxDestroy(cbox);
 
-   /* set all levels active if skip_relax = 0 */
-   if (!skip_relax)
+   /* set all levels active if skip_relax = 0 or with line relaxation */
+   if (!skip_relax || line_relax)
    {
       for (l = 0; l < num_levels; l++)
       {
@@ -386,6 +476,13 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    }
    rap_type = (pfmg_data -> rap_type);
 
+   /* the optimized Galerkin code needs stencil offsets within one grid
+      point; use the general purpose code otherwise */
+   if (rap_type == 0 && !hypre_PFMGStencilIsCompact(hypre_StructMatrixStencil(A)))
+   {
+      rap_type = 2;
+   }
+
    A_l  = hypre_TAlloc(hypre_StructMatrix *, num_levels, HYPRE_MEMORY_HOST);
    P_l  = hypre_TAlloc(hypre_StructMatrix *, num_levels - 1, HYPRE_MEMORY_HOST);
    RT_l = hypre_TAlloc(hypre_StructMatrix *, num_levels - 1, HYPRE_MEMORY_HOST);
@@ -395,7 +492,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    r_l  = tx_l;
    e_l  = tx_l;
 
-   A_l[0] = hypre_StructMatrixRef(A);
+   A_l[0] = hypre_StructMatrixRef(A_stored);
    b_l[0] = hypre_StructVectorRef(b);
    x_l[0] = hypre_StructVectorRef(x);
 
@@ -642,6 +739,11 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       active_l[l] = 0;
    }
 
+   /* the fine grid relaxation and residual use the generated coefficients */
+   hypre_StructMatrixDestroy(A_l[0]);
+   A_l[0] = hypre_StructMatrixRef(A);
+   hypre_StructMatrixDestroy(A_stored);
+
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    if (hypre_StructGridDataLocation(grid) != HYPRE_MEMORY_HOST)
    {
@@ -661,6 +763,11 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
+   hypre_PFMGRelaxSetTemporalBlocking(relax_data_l[0], temporal_blocking);
+   if (line_relax)
+   {
+      hypre_PFMGRelaxSetLineDir(relax_data_l[0], line_dir_l[0]);
+   }
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
    {
@@ -681,6 +788,11 @@ hypre_PFMGSetup( void               *pfmg_vdata,
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
+            hypre_PFMGRelaxSetTemporalBlocking(relax_data_l[l], temporal_blocking);
+            if (line_relax)
+            {
+               hypre_PFMGRelaxSetLineDir(relax_data_l[l], line_dir_l[l]);
+            }
          }
       }
 
@@ -689,12 +801,17 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       if (active_l[l])
       {
          HYPRE_Int maxwork, maxiter;
-         hypre_PFMGRelaxSetType(relax_data_l[l], 0);
+         hypre_PFMGRelaxSetType(relax_data_l[l], (line_relax) ? 5 : 0);
          /* do no more work on the coarsest grid than the cost of a V-cycle
           * (estimating roughly 4 communications per V-cycle level) */
          maxwork = 4 * num_levels;
          /* do sweeps proportional to the coarsest grid size */
          maxiter = hypre_min(maxwork, cmaxsize);
+         /* one sweep solves exactly if the coarsest grid is one line */
+         if (exact_lines)
+         {
+            maxiter = 1;
+         }
 #if 0
          hypre_printf("maxwork = %d, cmaxsize = %d, maxiter = %d\n",
                       maxwork, cmaxsize, maxiter);
@@ -712,6 +829,15 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       }
    }
    hypre_TFree(relax_weights, HYPRE_MEMORY_HOST);
+   hypre_TFree(line_dir_l, HYPRE_MEMORY_HOST);
+
+   /* set up the direct solve on the coarsest grid */
+   l = num_levels - 1;
+   if ((l > 0) && (max_coarse_size > 0) && (coarse_size <= max_coarse_size))
+   {
+      coarse_solve_data = hypre_PFMGCoarseSolveCreate(comm);
+      hypre_PFMGCoarseSolveSetup(coarse_solve_data, A_l[l], b_l[l], x_l[l]);
+   }
 
    for (l = 0; l < num_levels; l++)
    {
@@ -725,6 +851,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    (pfmg_data -> matvec_data_l)   = matvec_data_l;
    (pfmg_data -> restrict_data_l) = restrict_data_l;
    (pfmg_data -> interp_data_l)   = interp_data_l;
+   (pfmg_data -> coarse_solve_data) = coarse_solve_data;
 
    /*-----------------------------------------------------
     * Allocate space for log info
@@ -798,6 +925,10 @@ hypre_PFMGComputeDxyz( hypre_StructMatrix *A,
          hypre_PFMGComputeDxyz_CS(i, A, cxyz, sqcxyz);
       }
       /* constant_coefficient==0, all coefficients vary with space */
+      else if (!hypre_PFMGStencilIsStandard(stencil))
+      {
+         hypre_PFMGComputeDxyz_SSN(i, A, cxyz, sqcxyz);
+      }
       else
       {
          switch (stencil_size)
@@ -817,9 +948,6 @@ hypre_PFMGComputeDxyz( hypre_StructMatrix *A,
             case 27:
                hypre_PFMGComputeDxyz_SS27(i, A, cxyz, sqcxyz);
                break;
-            default:
-               hypre_printf("hypre error: unsupported stencil size %d\n", stencil_size);
-               hypre_MPI_Abort(hypre_MPI_COMM_WORLD, 1);
          }
       }
    }
@@ -2146,6 +2274,127 @@ hypre_PFMGComputeDxyz_SS27( HYPRE_Int           bi,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Stencils without a hand-coded routine: tc[d] is minus the sum of the
+ * coefficients with a nonzero offset in direction d, times the sign of the
+ * diagonal.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGComputeDxyz_SSN( HYPRE_Int           bi,
+                           hypre_StructMatrix *A,
+                           HYPRE_Real         *cxyz,
+                           HYPRE_Real         *sqcxyz)
+{
+   HYPRE_Int              ndim          = hypre_StructMatrixNDim(A);
+   hypre_StructStencil   *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_MemoryLocation   memory_location = hypre_StructMatrixMemoryLocation(A);
+   hypre_BoxArray        *compute_boxes;
+   hypre_Box             *compute_box;
+   hypre_Box             *A_dbox;
+   hypre_Index            loop_size;
+   hypre_IndexRef         start;
+   hypre_Index            stride;
+   hypre_Index            index;
+   HYPRE_Real            *a_cc;
+   HYPRE_Real           **a_d, **a_d_h;
+   HYPRE_Int              nd, si, d, sq;
+
+   hypre_SetIndex(stride, 1);
+   compute_boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+   compute_box = hypre_BoxArrayBox(compute_boxes, bi);
+   A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), bi);
+   start  = hypre_BoxIMin(compute_box);
+   hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+
+   hypre_SetIndex(index, 0);
+   a_cc = hypre_StructMatrixExtractPointerByIndex(A, bi, index);
+
+   a_d_h = hypre_TAlloc(HYPRE_Real *, stencil_size, HYPRE_MEMORY_HOST);
+   a_d   = a_d_h;
+   if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_DEVICE)
+   {
+      a_d = hypre_TAlloc(HYPRE_Real *, stencil_size, memory_location);
+   }
+
+   for (d = 0; d < ndim; d++)
+   {
+      /* coefficients with a nonzero offset in direction d */
+      nd = 0;
+      for (si = 0; si < stencil_size; si++)
+      {
+         if (hypre_IndexD(stencil_shape[si], d) != 0)
+         {
+            a_d_h[nd++] = hypre_StructMatrixBoxData(A, bi, si);
+         }
+      }
+      if (a_d != a_d_h)
+      {
+         hypre_TMemcpy(a_d, a_d_h, HYPRE_Real *, nd, memory_location, HYPRE_MEMORY_HOST);
+      }
+
+      for (sq = 0; sq < 2; sq++)
+      {
+#if defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_SYCL)
+         HYPRE_Real box_sum = 0.0;
+#elif defined(HYPRE_USING_RAJA)
+         ReduceSum<hypre_raja_reduce_policy, HYPRE_Real> box_sum(0.0);
+#elif defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+         ReduceSum<HYPRE_Real> box_sum(0.0);
+#else
+         HYPRE_Real box_sum = 0.0;
+#endif
+
+#ifdef HYPRE_BOX_REDUCTION
+#undef HYPRE_BOX_REDUCTION
+#endif
+
+#if defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_BOX_REDUCTION map(tofrom: box_sum) reduction(+:box_sum)
+#else
+#define HYPRE_BOX_REDUCTION reduction(+:box_sum)
+#endif
+
+#define DEVICE_VAR is_device_ptr(a_cc,a_d)
+         hypre_BoxLoop1ReductionBegin(ndim, loop_size,
+                                      A_dbox, start, stride, Ai, box_sum)
+         {
+            HYPRE_Int  k;
+            HYPRE_Real diag = a_cc[Ai] < 0.0 ? -1.0 : 1.0;
+            HYPRE_Real tc = 0.0;
+
+            for (k = 0; k < nd; k++)
+            {
+               tc += a_d[k][Ai];
+            }
+            tc = -diag * tc;
+            box_sum += sq ? tc * tc : tc;
+         }
+         hypre_BoxLoop1ReductionEnd(Ai, box_sum)
+#undef DEVICE_VAR
+
+         if (sq)
+         {
+            sqcxyz[d] += (HYPRE_Real) box_sum;
+         }
+         else
+         {
+            cxyz[d] += (HYPRE_Real) box_sum;
+         }
+      }
+   }
+
+   if (a_d != a_d_h)
+   {
+      hypre_TFree(a_d, memory_location);
+   }
+   hypre_TFree(a_d_h, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Returns 1 if there is a diagonal coefficient that is zero,
  * otherwise returns 0.
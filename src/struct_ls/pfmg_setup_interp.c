@@ -14,7 +14,8 @@
 #endif
 #define MAX_DEPTH 7
 
-/* 2: the most explicit implementation, a function for each stencil size */
+/* 2: the most explicit implementation, a function for each stencil size
+ *    (other stencils use implementation 0) */
 #define CC0_IMPLEMENTATION 2
 
 /*--------------------------------------------------------------------------
@@ -58,7 +59,7 @@ hypre_PFMGCreateInterpOp( hypre_StructMatrix *A,
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
    if ( constant_coefficient == 2 )
    {
-      if ( rap_type == 0 )
+      if ( rap_type != 1 )
          /* A has variable diagonal, which will force all P coefficients to be variable */
       {
          hypre_StructMatrixSetConstantCoefficient(P, 0 );
@@ -119,6 +120,7 @@ hypre_PFMGSetupInterpOp( hypre_StructMatrix *A,
    HYPRE_Int              si0, si1;
    HYPRE_Int              mrk0, mrk1;
    HYPRE_Int              d;
+   HYPRE_Int              hand_coded, norm;
 
    /*----------------------------------------------------------
     * Initialize some things
@@ -133,6 +135,27 @@ hypre_PFMGSetupInterpOp( hypre_StructMatrix *A,
 
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
 
+   /* The 15-point routine handles the 15-point subsets of the 19-point
+    * stencil only, i.e., no corner entries */
+   hand_coded = hypre_PFMGStencilIsStandard(stencil);
+   if (hypre_StructStencilNDim(stencil) == 3 && stencil_size == 15 &&
+       hypre_PFMGStencilIsCompact(stencil))
+   {
+      hand_coded = 1;
+      for (si = 0; si < stencil_size; si++)
+      {
+         norm = 0;
+         for (d = 0; d < 3; d++)
+         {
+            norm += hypre_abs(hypre_IndexD(stencil_shape[si], d));
+         }
+         if (norm > 2)
+         {
+            hand_coded = 0;
+         }
+      }
+   }
+
    /*----------------------------------------------------------
     * Find stencil enties in A corresponding to P
     *----------------------------------------------------------*/
@@ -215,47 +238,48 @@ hypre_PFMGSetupInterpOp( hypre_StructMatrix *A,
          ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
            P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, si0, si1 );
 #else
-         switch (stencil_size)
+         /* stencils without a hand-coded routine use the general one */
+         if (!hand_coded)
          {
-            case 5:
-               hypre_PFMGSetupInterpOp_CC0_SS5
-               ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
-                 P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, P_stencil_shape );
-               break;
-            case 9:
-               hypre_PFMGSetupInterpOp_CC0_SS9
-               ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
-                 P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, P_stencil_shape );
-               break;
-            case 7:
-               hypre_PFMGSetupInterpOp_CC0_SS7
-               ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
-                 P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, P_stencil_shape );
-               break;
-            case 15:
-               hypre_PFMGSetupInterpOp_CC0_SS15
-               ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
-                 P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, P_stencil_shape );
-               break;
-            case 19:
-               hypre_PFMGSetupInterpOp_CC0_SS19
-               ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
-                 P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, P_stencil_shape );
-               break;
-            case 27:
-               hypre_PFMGSetupInterpOp_CC0_SS27
-               ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
-                 P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, P_stencil_shape );
-               break;
-            default:
-               /*
-               hypre_PFMGSetupInterpOp_CC0
+            hypre_PFMGSetupInterpOp_CC0
+            ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
+              P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, si0, si1 );
+         }
+         else
+         {
+            switch (stencil_size)
+            {
+               case 5:
+                  hypre_PFMGSetupInterpOp_CC0_SS5
                   ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
-                    P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, si0, si1 );
-                */
-
-               hypre_printf("hypre error: unsupported stencil size %d\n", stencil_size);
-               hypre_MPI_Abort(hypre_MPI_COMM_WORLD, 1);
+                    P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, P_stencil_shape );
+                  break;
+               case 9:
+                  hypre_PFMGSetupInterpOp_CC0_SS9
+                  ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
+                    P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, P_stencil_shape );
+                  break;
+               case 7:
+                  hypre_PFMGSetupInterpOp_CC0_SS7
+                  ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
+                    P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, P_stencil_shape );
+                  break;
+               case 15:
+                  hypre_PFMGSetupInterpOp_CC0_SS15
+                  ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
+                    P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, P_stencil_shape );
+                  break;
+               case 19:
+                  hypre_PFMGSetupInterpOp_CC0_SS19
+                  ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
+                    P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, P_stencil_shape );
+                  break;
+               case 27:
+                  hypre_PFMGSetupInterpOp_CC0_SS27
+                  ( i, A, A_dbox, cdir, stride, stridec, start, startc, loop_size,
+                    P_dbox, Pstenc0, Pstenc1, Pp0, Pp1, rap_type, P_stencil_shape );
+                  break;
+            }
          }
 #endif
       }
@@ -270,7 +294,7 @@ hypre_PFMGSetupInterpOp( hypre_StructMatrix *A,
    return hypre_error_flag;
 }
 
-#if CC0_IMPLEMENTATION == 0
+#if CC0_IMPLEMENTATION != 1
 
 HYPRE_Int
 hypre_PFMGSetupInterpOp_CC0
@@ -296,7 +320,6 @@ hypre_PFMGSetupInterpOp_CC0
    hypre_Index         *stencil_shape = hypre_StructStencilShape(stencil);
    HYPRE_Int            stencil_size = hypre_StructStencilSize(stencil);
    HYPRE_Int            warning_cnt = 0;
-   HYPRE_Int            data_location = hypre_StructGridDataLocation(hypre_StructMatrixGrid(A));
    HYPRE_Int          **data_indices = hypre_StructMatrixDataIndices(A);
    HYPRE_Complex       *matrixA_data = hypre_StructMatrixData(A);
    HYPRE_Int           *data_indices_boxi_d;
@@ -335,21 +358,8 @@ hypre_PFMGSetupInterpOp_CC0
 
       for (si = 0; si < stencil_size; si++)
       {
-#if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-         if (data_location != HYPRE_MEMORY_HOST)
-         {
-            Ap     = matrixA_data + data_indices_boxi_d[si];
-            Astenc = hypre_IndexD(stencil_shape_d[si], cdir);
-         }
-         else
-         {
-            Ap     = hypre_StructMatrixBoxData(A, i, si);
-            Astenc = hypre_IndexD(stencil_shape[si], cdir);
-         }
-#else
          Ap     = matrixA_data + data_indices_boxi_d[si];
          Astenc = hypre_IndexD(stencil_shape_d[si], cdir);
-#endif
 
          if (Astenc == 0)
          {
@@ -682,7 +692,7 @@ hypre_PFMGSetupInterpOp_CC2
    hypre_SetIndex3(diag_index, 0, 0, 0);
    diag_rank = hypre_StructStencilElementRank(stencil, diag_index);
 
-   if ( rap_type != 0 )
+   if ( rap_type == 1 )
    {
       /* simply force P to be constant coefficient, all 0.5's */
       Pi = hypre_CCBoxIndexRank(P_dbox, startc);
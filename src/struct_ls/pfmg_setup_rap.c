@@ -18,7 +18,8 @@
  *   used.
  *      rap_type = 0   Use optimized code for computing Galerkin operators
  *                     for special, common stencil patterns: 5 & 9 pt in
- *                     2d and 7, 19 & 27 in 3d.
+ *                     2d and 7, 19 & 27 in 3d.  Other compact stencils
+ *                     use tabulated terms (pfmg_setup_rapn.c).
  *      rap_type = 1   Use PARFLOW formula for coarse grid operator. Used
  *                     only with 5pt in 2d and 7pt in 3d.
  *      rap_type = 2   General purpose Galerkin code.
@@ -39,7 +40,11 @@ hypre_PFMGCreateRAPOp( hypre_StructMatrix *R,
 
    stencil = hypre_StructMatrixStencil(A);
 
-   if (rap_type == 0)
+   if (rap_type == 0 && !hypre_PFMGStencilIsStandard(stencil))
+   {
+      RAP = hypre_PFMGCreateRAPOpN(R, A, P, coarse_grid, cdir);
+   }
+   else if (rap_type == 0)
    {
       switch (hypre_StructStencilNDim(stencil))
       {
@@ -74,7 +79,7 @@ hypre_PFMGCreateRAPOp( hypre_StructMatrix *R,
 
 
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
-   if ( constant_coefficient == 2 && rap_type == 0 )
+   if ( constant_coefficient == 2 && rap_type != 1 )
    {
       /* A has variable diagonal, so, in the Galerkin case, P (and R) is
          entirely variable coefficient.  Thus RAP will be variable coefficient */
@@ -98,7 +103,8 @@ hypre_PFMGCreateRAPOp( hypre_StructMatrix *R,
  *   used.
  *      rap_type = 0   Use optimized code for computing Galerkin operators
  *                     for special, common stencil patterns: 5 & 9 pt in
- *                     2d and 7, 19 & 27 in 3d.
+ *                     2d and 7, 19 & 27 in 3d.  Other compact stencils
+ *                     use tabulated terms (pfmg_setup_rapn.c).
  *      rap_type = 1   Use PARFLOW formula for coarse grid operator. Used
  *                     only with 5pt in 2d and 7pt in 3d.
  *      rap_type = 2   General purpose Galerkin code.
@@ -140,7 +146,11 @@ hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
 #endif
    stencil = hypre_StructMatrixStencil(A);
 
-   if (rap_type == 0)
+   if (rap_type == 0 && !hypre_PFMGStencilIsStandard(stencil))
+   {
+      hypre_PFMGBuildRAPN(A, P, R, cdir, cindex, cstride, Ac_tmp);
+   }
+   else if (rap_type == 0)
    {
       switch (hypre_StructStencilNDim(stencil))
       {
@@ -0,0 +1,611 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Galerkin coarse grid operators for PFMG with general compact stencils.
+ *
+ * The routines in pfmg2_setup_rap.c and pfmg3_setup_rap.c are written out by
+ * hand for the 5- and 9-point stencils in 2D and the 7-, 19- and 27-point
+ * stencils in 3D.  The routines below compute RAP for any other stencil with
+ * offsets within one grid point, in any dimension.
+ *
+ * With coarsening in direction cdir, a coarse point c is at fine point 2c.
+ * Restriction takes fine point 2c+r (r = -1, 0, 1) to c, and a fine stencil
+ * entry with offset a in cdir connects it to fine point 2c+t, t = r+a.  For
+ * even t, this is the coarse point c+t/2.  For odd t, it is the F-point
+ * between the coarse points c+m and c+m+1, m = (t-1)/2, which interpolates
+ * from both.  Each such product is a term of RAP.  The terms of each coarse
+ * stencil entry are tabulated once per box, and one BoxLoop per coarse
+ * stencil entry sums them.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "_hypre_struct_mv.hpp"
+#include "pfmg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGStencilIsCompact
+ *
+ * Returns 1 if all stencil offsets are within one grid point.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGStencilIsCompact( hypre_StructStencil *stencil )
+{
+   HYPRE_Int    ndim          = hypre_StructStencilNDim(stencil);
+   hypre_Index *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int    stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int    s, d;
+
+   for (s = 0; s < stencil_size; s++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         if (hypre_abs(hypre_IndexD(stencil_shape[s], d)) > 1)
+         {
+            return 0;
+         }
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGStencilIsStandard
+ *
+ * Returns 1 if the stencil is one of the shapes with hand-coded setup
+ * routines: 5 or 9 points in 2D, and 7, 19 or 27 points in 3D.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGStencilIsStandard( hypre_StructStencil *stencil )
+{
+   HYPRE_Int    ndim          = hypre_StructStencilNDim(stencil);
+   hypre_Index *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int    stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int    max_norm, norm, s, d;
+
+   if (ndim == 2 && stencil_size == 5)
+   {
+      max_norm = 1;
+   }
+   else if (ndim == 2 && stencil_size == 9)
+   {
+      max_norm = 2;
+   }
+   else if (ndim == 3 && stencil_size == 7)
+   {
+      max_norm = 1;
+   }
+   else if (ndim == 3 && stencil_size == 19)
+   {
+      max_norm = 2;
+   }
+   else if (ndim == 3 && stencil_size == 27)
+   {
+      max_norm = 3;
+   }
+   else
+   {
+      return 0;
+   }
+
+   /* the offsets are distinct, so this identifies the shape */
+   if (!hypre_PFMGStencilIsCompact(stencil))
+   {
+      return 0;
+   }
+   for (s = 0; s < stencil_size; s++)
+   {
+      norm = 0;
+      for (d = 0; d < ndim; d++)
+      {
+         norm += hypre_abs(hypre_IndexD(stencil_shape[s], d));
+      }
+      if (norm > max_norm)
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * Coarse stencil offsets reached by the fine stencil entry 'shape' from the
+ * restriction side r (see the top of the file).  Returns the number of
+ * offsets.  If it is 2, the F-point is interpolated: offsets[0] uses the P
+ * entry -1 and offsets[1] the P entry +1, both at the P point pindex.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGRAPNOffsets( hypre_Index  shape,
+                       HYPRE_Int    cdir,
+                       HYPRE_Int    r,
+                       hypre_Index *offsets,
+                       hypre_Index  pindex )
+{
+   HYPRE_Int  t = r + hypre_IndexD(shape, cdir);
+   HYPRE_Int  m;
+
+   hypre_CopyIndex(shape, offsets[0]);
+   if (t % 2 == 0)
+   {
+      hypre_IndexD(offsets[0], cdir) = t / 2;
+      return 1;
+   }
+
+   m = (t - 1) / 2;
+   hypre_IndexD(offsets[0], cdir) = m;
+   hypre_CopyIndex(offsets[0], offsets[1]);
+   hypre_IndexD(offsets[1], cdir) = m + 1;
+   hypre_CopyIndex(offsets[0], pindex);
+
+   return 2;
+}
+
+/*--------------------------------------------------------------------------
+ * For symmetric storage, keep the offsets whose last nonzero component is
+ * negative, and the center.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGRAPNIsLower( HYPRE_Int   ndim,
+                       hypre_Index offset )
+{
+   HYPRE_Int  d;
+
+   for (d = ndim - 1; d >= 0; d--)
+   {
+      if (hypre_IndexD(offset, d) != 0)
+      {
+         return (hypre_IndexD(offset, d) < 0);
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGCreateRAPOpN
+ *
+ * Sets up the coarse grid operator structure.  The coarse stencil consists
+ * of the offsets reached by some term of RAP.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_PFMGCreateRAPOpN( hypre_StructMatrix *R,
+                        hypre_StructMatrix *A,
+                        hypre_StructMatrix *P,
+                        hypre_StructGrid   *coarse_grid,
+                        HYPRE_Int           cdir )
+{
+   HYPRE_Int              ndim           = hypre_StructMatrixNDim(A);
+   hypre_StructStencil   *A_stencil      = hypre_StructMatrixStencil(A);
+   hypre_Index           *A_stencil_shape = hypre_StructStencilShape(A_stencil);
+   HYPRE_Int              A_stencil_size = hypre_StructStencilSize(A_stencil);
+
+   hypre_StructMatrix    *RAP;
+   hypre_StructStencil   *RAP_stencil;
+   hypre_Index           *RAP_stencil_shape;
+   HYPRE_Int              RAP_stencil_size;
+   HYPRE_Int              RAP_num_ghost[] = {1, 1, 1, 1, 1, 1};
+
+   hypre_Index            offsets[2], pindex, index;
+   HYPRE_Int              reached[27];
+   HYPRE_Int              num_offsets, max_offsets, rank;
+   HYPRE_Int              s, r, k, d;
+
+   if (!hypre_PFMGStencilIsCompact(A_stencil))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "PFMG Galerkin RAP needs a compact stencil!");
+      return NULL;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Mark the reached offsets, ranked lexicographically in [-1,1]^ndim
+    *-----------------------------------------------------------------------*/
+
+   max_offsets = 1;
+   for (d = 0; d < ndim; d++)
+   {
+      max_offsets *= 3;
+   }
+   for (k = 0; k < max_offsets; k++)
+   {
+      reached[k] = 0;
+   }
+
+   for (s = 0; s < A_stencil_size; s++)
+   {
+      for (r = -1; r <= 1; r++)
+      {
+         num_offsets = hypre_PFMGRAPNOffsets(A_stencil_shape[s], cdir, r, offsets, pindex);
+         for (k = 0; k < num_offsets; k++)
+         {
+            rank = 0;
+            for (d = ndim - 1; d >= 0; d--)
+            {
+               rank = 3 * rank + hypre_IndexD(offsets[k], d) + 1;
+            }
+            reached[rank] = 1;
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Define RAP_stencil.  For symmetric A, only store the lower triangular
+    * part.
+    *-----------------------------------------------------------------------*/
+
+   RAP_stencil_shape = hypre_CTAlloc(hypre_Index, max_offsets, HYPRE_MEMORY_HOST);
+   RAP_stencil_size = 0;
+   for (k = 0; k < max_offsets; k++)
+   {
+      if (reached[k])
+      {
+         hypre_SetIndex(index, 0);
+         rank = k;
+         for (d = 0; d < ndim; d++)
+         {
+            hypre_IndexD(index, d) = (rank % 3) - 1;
+            rank /= 3;
+         }
+         if (!hypre_StructMatrixSymmetric(A) || hypre_PFMGRAPNIsLower(ndim, index))
+         {
+            hypre_CopyIndex(index, RAP_stencil_shape[RAP_stencil_size]);
+            RAP_stencil_size++;
+         }
+      }
+   }
+
+   RAP_stencil = hypre_StructStencilCreate(ndim, RAP_stencil_size, RAP_stencil_shape);
+   RAP = hypre_StructMatrixCreate(hypre_StructMatrixComm(A), coarse_grid, RAP_stencil);
+   hypre_StructStencilDestroy(RAP_stencil);
+
+   /*-----------------------------------------------------------------------
+    * Coarse operator in symmetric iff fine operator is
+    *-----------------------------------------------------------------------*/
+   hypre_StructMatrixSymmetric(RAP) = hypre_StructMatrixSymmetric(A);
+
+   /*-----------------------------------------------------------------------
+    * Set number of ghost points - one one each boundary
+    *-----------------------------------------------------------------------*/
+   hypre_StructMatrixSetNumGhost(RAP, RAP_num_ghost);
+
+   return RAP;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGBuildRAPN
+ *
+ * Computes the stored coefficients of RAP.  As in the hand-coded routines,
+ * no assumption is made about the symmetry of A or about R = transpose(P),
+ * and the c-to-c interpolation is the identity.
+ *
+ * Each term is a product coef * R * A * P, where the three factors are read
+ * at the indices iR, iA and iP times a 0/1 multiplier.  Factors that do not
+ * apply point to a 1.0 with multiplier 0, and constant off-diagonal
+ * coefficients of A (constant_coefficient 2) go into coef, so that the loop
+ * body has no branches and reads no host data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGBuildRAPN( hypre_StructMatrix *A,
+                     hypre_StructMatrix *P,
+                     hypre_StructMatrix *R,
+                     HYPRE_Int           cdir,
+                     hypre_Index         cindex,
+                     hypre_Index         cstride,
+                     hypre_StructMatrix *RAP     )
+{
+   HYPRE_Int              ndim              = hypre_StructMatrixNDim(A);
+   hypre_StructStencil   *A_stencil         = hypre_StructMatrixStencil(A);
+   hypre_Index           *A_stencil_shape   = hypre_StructStencilShape(A_stencil);
+   HYPRE_Int              A_stencil_size    = hypre_StructStencilSize(A_stencil);
+   hypre_StructStencil   *RAP_stencil       = hypre_StructMatrixStencil(RAP);
+   hypre_Index           *RAP_stencil_shape = hypre_StructStencilShape(RAP_stencil);
+   HYPRE_Int              RAP_stencil_size  = hypre_StructStencilSize(RAP_stencil);
+   HYPRE_Int             *symm_elements     = hypre_StructMatrixSymmElements(RAP);
+   HYPRE_Int              constant_coefficient   = hypre_StructMatrixConstantCoefficient(RAP);
+   HYPRE_Int              constant_coefficient_A = hypre_StructMatrixConstantCoefficient(A);
+   HYPRE_MemoryLocation   memory_location   = hypre_StructMatrixMemoryLocation(RAP);
+   HYPRE_Int              on_device;
+
+   hypre_StructGrid      *fgrid             = hypre_StructMatrixGrid(A);
+   HYPRE_Int             *fgrid_ids         = hypre_StructGridIDs(fgrid);
+   hypre_StructGrid      *cgrid             = hypre_StructMatrixGrid(RAP);
+   hypre_BoxArray        *cgrid_boxes       = hypre_StructGridBoxes(cgrid);
+   HYPRE_Int             *cgrid_ids         = hypre_StructGridIDs(cgrid);
+   hypre_Box             *cgrid_box;
+   hypre_IndexRef         cstart;
+   hypre_Index            stridec;
+   hypre_Index            fstart;
+   hypre_IndexRef         stridef;
+   hypre_Index            loop_size;
+
+   hypre_Box             *A_dbox;
+   hypre_Box             *P_dbox;
+   hypre_Box             *R_dbox;
+   hypre_Box             *RAP_dbox;
+
+   HYPRE_Real            *pa, *pb, *ra, *rb, *rap;
+   HYPRE_Real           **a_ptrs;
+   HYPRE_Int             *a_vars;
+   HYPRE_Real             one_h = 1.0;
+   HYPRE_Real            *one;
+
+   HYPRE_Real           **t_ptrs, **t_ptrs_d;
+   HYPRE_Int             *t_vars, *t_vars_d;
+   HYPRE_Real            *t_coef, *t_coef_d;
+   HYPRE_Int             *t_first;
+   HYPRE_Int              max_terms, nterms, t0, t1;
+
+   hypre_Index            zindex, offsets[2], pindex, index;
+   HYPRE_Int              zOffsetA, rbOffset;
+   HYPRE_Int              num_offsets, var;
+   HYPRE_Int              fi, ci, e, s, r, k, t, d;
+
+   hypre_assert( constant_coefficient == 0 || constant_coefficient == 1 );
+   hypre_assert( hypre_StructMatrixConstantCoefficient(R) == constant_coefficient );
+   hypre_assert( hypre_StructMatrixConstantCoefficient(P) == constant_coefficient );
+
+   /* constant coefficients are computed on the host */
+   var = (constant_coefficient == 0);
+   on_device = (var && hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_DEVICE);
+
+   stridef = cstride;
+   hypre_SetIndex(stridec, 1);
+   hypre_SetIndex(zindex, 0);
+   hypre_IndexD(zindex, cdir) = 1;
+
+   /* each (s,r) pair gives at most one term of a coarse stencil entry */
+   max_terms = RAP_stencil_size * 3 * A_stencil_size;
+   t_ptrs  = hypre_TAlloc(HYPRE_Real *, 3 * max_terms, HYPRE_MEMORY_HOST);
+   t_vars  = hypre_TAlloc(HYPRE_Int, 3 * max_terms, HYPRE_MEMORY_HOST);
+   t_coef  = hypre_TAlloc(HYPRE_Real, max_terms, HYPRE_MEMORY_HOST);
+   t_first = hypre_TAlloc(HYPRE_Int, RAP_stencil_size + 1, HYPRE_MEMORY_HOST);
+   a_ptrs  = hypre_TAlloc(HYPRE_Real *, A_stencil_size, HYPRE_MEMORY_HOST);
+   a_vars  = hypre_TAlloc(HYPRE_Int, A_stencil_size, HYPRE_MEMORY_HOST);
+
+   if (on_device)
+   {
+      one      = hypre_TAlloc(HYPRE_Real, 1, memory_location);
+      t_ptrs_d = hypre_TAlloc(HYPRE_Real *, 3 * max_terms, memory_location);
+      t_vars_d = hypre_TAlloc(HYPRE_Int, 3 * max_terms, memory_location);
+      t_coef_d = hypre_TAlloc(HYPRE_Real, max_terms, memory_location);
+      hypre_TMemcpy(one, &one_h, HYPRE_Real, 1, memory_location, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      one      = &one_h;
+      t_ptrs_d = t_ptrs;
+      t_vars_d = t_vars;
+      t_coef_d = t_coef;
+   }
+
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+
+      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+      cstart = hypre_BoxIMin(cgrid_box);
+      hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
+
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+      P_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(P), fi);
+      R_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R), fi);
+      RAP_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(RAP), ci);
+
+      /*-----------------------------------------------------------------
+       * Extract pointers for interpolation and restriction:
+       * pa and ra are the weights of entry -1, pb and rb of entry +1
+       *-----------------------------------------------------------------*/
+
+      hypre_SetIndex(index, 0);
+      hypre_IndexD(index, cdir) = -1;
+      pa = hypre_StructMatrixExtractPointerByIndex(P, fi, index);
+      ra = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+      pb = hypre_StructMatrixExtractPointerByIndex(P, fi, zindex);
+      rb = hypre_StructMatrixExtractPointerByIndex(R, fi, zindex);
+
+      zOffsetA = 0;
+      rbOffset = 0;
+      if (var)
+      {
+         zOffsetA = hypre_BoxOffsetDistance(A_dbox, zindex);
+         rbOffset = hypre_BoxOffsetDistance(R_dbox, zindex);
+      }
+
+      /* with constant_coefficient 2, only the diagonal of A varies */
+      for (s = 0; s < A_stencil_size; s++)
+      {
+         a_ptrs[s] = hypre_StructMatrixExtractPointerByIndex(A, fi, A_stencil_shape[s]);
+         a_vars[s] = (constant_coefficient_A == 0);
+         if (constant_coefficient_A == 2)
+         {
+            a_vars[s] = 1;
+            for (d = 0; d < ndim; d++)
+            {
+               if (hypre_IndexD(A_stencil_shape[s], d) != 0)
+               {
+                  a_vars[s] = 0;
+               }
+            }
+         }
+      }
+
+      /*-----------------------------------------------------------------
+       * Tabulate the terms of each stored coarse stencil entry
+       *-----------------------------------------------------------------*/
+
+      nterms = 0;
+      for (e = 0; e < RAP_stencil_size; e++)
+      {
+         t_first[e] = nterms;
+         if (symm_elements[e] >= 0)
+         {
+            continue;
+         }
+
+         for (s = 0; s < A_stencil_size; s++)
+         {
+            for (r = -1; r <= 1; r++)
+            {
+               num_offsets = hypre_PFMGRAPNOffsets(A_stencil_shape[s], cdir, r, offsets, pindex);
+               for (k = 0; k < num_offsets; k++)
+               {
+                  if (!hypre_IndexesEqual(offsets[k], RAP_stencil_shape[e], ndim))
+                  {
+                     continue;
+                  }
+
+                  /* restriction */
+                  t_vars[3 * nterms] = var;
+                  switch (r)
+                  {
+                     case -1:
+                        t_ptrs[3 * nterms] = rb - rbOffset;
+                        break;
+                     case 0:
+                        t_ptrs[3 * nterms] = one;
+                        t_vars[3 * nterms] = 0;
+                        break;
+                     case 1:
+                        t_ptrs[3 * nterms] = ra;
+                        break;
+                  }
+
+                  /* fine grid operator */
+                  if (a_vars[s])
+                  {
+                     t_ptrs[3 * nterms + 1] = a_ptrs[s] + r * zOffsetA;
+                     t_vars[3 * nterms + 1] = 1;
+                     t_coef[nterms] = 1.0;
+                  }
+                  else
+                  {
+                     t_ptrs[3 * nterms + 1] = one;
+                     t_vars[3 * nterms + 1] = 0;
+                     t_coef[nterms] = a_ptrs[s][0];
+                  }
+
+                  /* interpolation */
+                  if (num_offsets == 1)
+                  {
+                     t_ptrs[3 * nterms + 2] = one;
+                     t_vars[3 * nterms + 2] = 0;
+                  }
+                  else
+                  {
+                     t_ptrs[3 * nterms + 2] = (k == 0) ? pa : pb;
+                     t_vars[3 * nterms + 2] = var;
+                     if (var)
+                     {
+                        t_ptrs[3 * nterms + 2] += hypre_BoxOffsetDistance(P_dbox, pindex);
+                     }
+                  }
+
+                  nterms++;
+               }
+            }
+         }
+      }
+      t_first[RAP_stencil_size] = nterms;
+
+      /*-----------------------------------------------------------------
+       * Sum the terms
+       *-----------------------------------------------------------------*/
+
+      if (!var)
+      {
+         for (e = 0; e < RAP_stencil_size; e++)
+         {
+            if (symm_elements[e] < 0)
+            {
+               rap = hypre_StructMatrixBoxData(RAP, ci, e);
+               rap[0] = 0.0;
+               for (t = t_first[e]; t < t_first[e + 1]; t++)
+               {
+                  rap[0] += t_coef[t] * t_ptrs[3 * t][0] * t_ptrs[3 * t + 1][0] *
+                            t_ptrs[3 * t + 2][0];
+               }
+            }
+         }
+         continue;
+      }
+
+      if (on_device)
+      {
+         hypre_TMemcpy(t_ptrs_d, t_ptrs, HYPRE_Real *, 3 * nterms, memory_location,
+                       HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(t_vars_d, t_vars, HYPRE_Int, 3 * nterms, memory_location,
+                       HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(t_coef_d, t_coef, HYPRE_Real, nterms, memory_location,
+                       HYPRE_MEMORY_HOST);
+      }
+
+      hypre_BoxGetSize(cgrid_box, loop_size);
+
+      for (e = 0; e < RAP_stencil_size; e++)
+      {
+         if (symm_elements[e] >= 0)
+         {
+            continue;
+         }
+
+         rap = hypre_StructMatrixBoxData(RAP, ci, e);
+         t0  = t_first[e];
+         t1  = t_first[e + 1];
+
+#define DEVICE_VAR is_device_ptr(rap,t_ptrs_d,t_vars_d,t_coef_d)
+         hypre_BoxLoop4Begin(ndim, loop_size,
+                             P_dbox, cstart, stridec, iP,
+                             R_dbox, cstart, stridec, iR,
+                             A_dbox, fstart, stridef, iA,
+                             RAP_dbox, cstart, stridec, iAc);
+         {
+            HYPRE_Int  tt;
+            HYPRE_Real val = 0.0;
+
+            for (tt = t0; tt < t1; tt++)
+            {
+               val += t_coef_d[tt] *
+                      t_ptrs_d[3 * tt][iR * t_vars_d[3 * tt]] *
+                      t_ptrs_d[3 * tt + 1][iA * t_vars_d[3 * tt + 1]] *
+                      t_ptrs_d[3 * tt + 2][iP * t_vars_d[3 * tt + 2]];
+            }
+            rap[iAc] = val;
+         }
+         hypre_BoxLoop4End(iP, iR, iA, iAc);
+#undef DEVICE_VAR
+      }
+   }
+
+   if (on_device)
+   {
+      hypre_TFree(one, memory_location);
+      hypre_TFree(t_ptrs_d, memory_location);
+      hypre_TFree(t_vars_d, memory_location);
+      hypre_TFree(t_coef_d, memory_location);
+   }
+   hypre_TFree(t_ptrs, HYPRE_MEMORY_HOST);
+   hypre_TFree(t_vars, HYPRE_MEMORY_HOST);
+   hypre_TFree(t_coef, HYPRE_MEMORY_HOST);
+   hypre_TFree(t_first, HYPRE_MEMORY_HOST);
+   hypre_TFree(a_ptrs, HYPRE_MEMORY_HOST);
+   hypre_TFree(a_vars, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
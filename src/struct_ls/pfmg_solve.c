@@ -53,6 +53,7 @@ hypre_PFMGSolve( void               *pfmg_vdata,
    void                **matvec_data_l   = (pfmg_data -> matvec_data_l);
    void                **restrict_data_l = (pfmg_data -> restrict_data_l);
    void                **interp_data_l   = (pfmg_data -> interp_data_l);
+   void                 *coarse_solve_data = (pfmg_data -> coarse_solve_data);
    HYPRE_Int             logging         = (pfmg_data -> logging);
    HYPRE_Real           *norms           = (pfmg_data -> norms);
    HYPRE_Real           *rel_norms       = (pfmg_data -> rel_norms);
@@ -252,7 +253,11 @@ hypre_PFMGSolve( void               *pfmg_vdata,
           *--------------------------------------------------*/
          HYPRE_ANNOTATE_MGLEVEL_BEGIN(num_levels - 1);
 
-         if (active_l[l])
+         if (coarse_solve_data)
+         {
+            hypre_PFMGCoarseSolve(coarse_solve_data, A_l[l], b_l[l], x_l[l]);
+         }
+         else if (active_l[l])
          {
             hypre_PFMGRelaxSetZeroGuess(relax_data_l[l], 1);
             hypre_PFMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
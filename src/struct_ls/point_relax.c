@@ -270,6 +270,10 @@ hypre_PointRelaxSetup( void               *relax_vdata,
       hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
                              grid, &compute_pkgs[p]);
 
+      /* pick tile sizes for the host loops (if requested) */
+      hypre_StructTileTune(A, hypre_ComputePkgIndtBoxes(compute_pkgs[p]), stride);
+      hypre_StructTileTune(A, hypre_ComputePkgDeptBoxes(compute_pkgs[p]), stride);
+
       hypre_BoxArrayArrayDestroy(orig_indt_boxes);
       hypre_BoxArrayArrayDestroy(orig_dept_boxes);
    }
@@ -446,7 +450,6 @@ hypre_PointRelax( void               *relax_vdata,
             x_data_box =
                hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
 
-            Ap = hypre_StructMatrixBoxData(A, i, diag_rank);
             bp = hypre_StructVectorBoxData(b, i);
             xp = hypre_StructVectorBoxData(x, i);
 
@@ -457,9 +460,16 @@ hypre_PointRelax( void               *relax_vdata,
                start  = hypre_BoxIMin(compute_box);
                hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
+               /* generated coefficients */
+               if (hypre_StructMatrixCoeffFcn(A))
+               {
+                  hypre_PointRelax_coreGen(relax_vdata, A, 1, compute_box, bp, xp, xp,
+                                           b_data_box, x_data_box, x_data_box, stride);
+               }
                /* all matrix coefficients are constant */
-               if ( constant_coefficient == 1 )
+               else if ( constant_coefficient == 1 )
                {
+                  Ap = hypre_StructMatrixBoxData(A, i, diag_rank);
                   Ai = hypre_CCBoxIndexRank( A_data_box, start );
                   AAp0 = 1 / Ap[Ai];
 #define DEVICE_VAR is_device_ptr(xp,bp)
@@ -476,6 +486,7 @@ hypre_PointRelax( void               *relax_vdata,
                   only) are the same for the diagonal */
                else
                {
+                  Ap = hypre_StructMatrixBoxData(A, i, diag_rank);
 #define DEVICE_VAR is_device_ptr(xp,bp,Ap)
                   hypre_BoxLoop3Begin(hypre_StructVectorNDim(x), loop_size,
                                       A_data_box, start, stride, Ai,
@@ -568,6 +579,14 @@ hypre_PointRelax( void               *relax_vdata,
             {
                compute_box = hypre_BoxArrayBox(compute_box_a, j);
 
+               if (hypre_StructMatrixCoeffFcn(A))
+               {
+                  /* this includes the division by the diagonal */
+                  hypre_PointRelax_coreGen(relax_vdata, A, 0, compute_box, bp, xp, tp,
+                                           b_data_box, x_data_box, t_data_box, stride);
+                  continue;
+               }
+
                if ( constant_coefficient == 1 || constant_coefficient == 2 )
                {
                   hypre_PointRelax_core12(
@@ -699,6 +718,7 @@ hypre_PointRelax_core0( void               *relax_vdata,
    HYPRE_Int              diag_rank        = (relax_data -> diag_rank);
    hypre_IndexRef         start;
    hypre_Index            loop_size;
+   hypre_Index            tile_size;
    HYPRE_Int              si, sk, ssi[MAX_DEPTH], depth, k;
 
    stencil       = hypre_StructMatrixStencil(A);
@@ -707,15 +727,16 @@ hypre_PointRelax_core0( void               *relax_vdata,
 
    start  = hypre_BoxIMin(compute_box);
    hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+   hypre_StructTileGetSize(hypre_StructMatrixNDim(A), loop_size, tile_size);
 
 #define DEVICE_VAR is_device_ptr(tp,bp)
-   hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                       b_data_box, start, stride, bi,
-                       t_data_box, start, stride, ti);
+   hypre_TiledBoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                            b_data_box, start, stride, bi,
+                            t_data_box, start, stride, ti);
    {
       tp[ti] = bp[bi];
    }
-   hypre_BoxLoop2End(bi, ti);
+   hypre_TiledBoxLoop2End(bi, ti);
 #undef DEVICE_VAR
 
    /* unroll up to depth MAX_DEPTH */
@@ -782,10 +803,10 @@ hypre_PointRelax_core0( void               *relax_vdata,
       {
          case 7:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap6,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0] +
@@ -796,16 +817,16 @@ hypre_PointRelax_core0( void               *relax_vdata,
                   Ap5[Ai] * xp[xi + xoff5] +
                   Ap6[Ai] * xp[xi + xoff6];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_TiledBoxLoop3End(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
          case 6:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0] +
@@ -815,16 +836,16 @@ hypre_PointRelax_core0( void               *relax_vdata,
                   Ap4[Ai] * xp[xi + xoff4] +
                   Ap5[Ai] * xp[xi + xoff5];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_TiledBoxLoop3End(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
          case 5:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,Ap1,Ap2,Ap3,Ap4,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0] +
@@ -833,16 +854,16 @@ hypre_PointRelax_core0( void               *relax_vdata,
                   Ap3[Ai] * xp[xi + xoff3] +
                   Ap4[Ai] * xp[xi + xoff4];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_TiledBoxLoop3End(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
          case 4:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,Ap1,Ap2,Ap3,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0] +
@@ -850,52 +871,52 @@ hypre_PointRelax_core0( void               *relax_vdata,
                   Ap2[Ai] * xp[xi + xoff2] +
                   Ap3[Ai] * xp[xi + xoff3];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_TiledBoxLoop3End(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
          case 3:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,Ap1,Ap2,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0] +
                   Ap1[Ai] * xp[xi + xoff1] +
                   Ap2[Ai] * xp[xi + xoff2];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_TiledBoxLoop3End(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
          case 2:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,Ap1,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0] +
                   Ap1[Ai] * xp[xi + xoff1];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_TiledBoxLoop3End(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
          case 1:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_TiledBoxLoop3End(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
@@ -908,6 +929,124 @@ hypre_PointRelax_core0( void               *relax_vdata,
 }
 
 
+/* for generated coefficients, computes tp = (bp - offdiagonal * xp) / diagonal,
+   or tp = bp / diagonal for a zero initial guess (host only) ...*/
+HYPRE_Int
+hypre_PointRelax_coreGen( void               *relax_vdata,
+                          hypre_StructMatrix *A,
+                          HYPRE_Int           zero_guess,
+                          hypre_Box          *compute_box,
+                          HYPRE_Real         *bp,
+                          HYPRE_Real         *xp,
+                          HYPRE_Real         *tp,
+                          hypre_Box          *b_data_box,
+                          hypre_Box          *x_data_box,
+                          hypre_Box          *t_data_box,
+                          hypre_IndexRef      stride
+                        )
+{
+   hypre_PointRelaxData  *relax_data = (hypre_PointRelaxData *)relax_vdata;
+
+   hypre_StructStencil   *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int              ndim          = hypre_StructMatrixNDim(A);
+   HYPRE_Int              diag_rank     = (relax_data -> diag_rank);
+   HYPRE_Int              num_threads   = hypre_NumThreads();
+
+   HYPRE_Real            *values;
+   HYPRE_Int             *xoff;
+   HYPRE_Int              values_size, num_rows;
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+   HYPRE_Int              r, d, si;
+
+#if defined(HYPRE_USING_GPU)
+   if (hypre_GetExecPolicy1(hypre_StructVectorMemoryLocation(relax_data -> x)) != HYPRE_EXEC_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Generated coefficients are supported on the host only!");
+      return hypre_error_flag;
+   }
+#endif
+
+   start  = hypre_BoxIMin(compute_box);
+   hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+
+   num_rows = (hypre_IndexD(loop_size, 0) > 0) ? 1 : 0;
+   for (d = 1; d < ndim; d++)
+   {
+      num_rows *= hypre_IndexD(loop_size, d);
+   }
+   if (num_rows == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   /* one row of coefficients per thread */
+   values_size = hypre_BoxSizeD(compute_box, 0) * stencil_size;
+   values = hypre_TAlloc(HYPRE_Real, values_size * num_threads, HYPRE_MEMORY_HOST);
+   xoff   = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   for (si = 0; si < stencil_size; si++)
+   {
+      xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+   for (r = 0; r < num_rows; r++)
+   {
+      HYPRE_Real   *rvalues = values + hypre_GetThreadNum() * values_size;
+      HYPRE_Real   *vp, sum;
+      hypre_Index   index;
+      HYPRE_Int     bi, xi, ti, k, s, sk, sn, n;
+
+      hypre_StructMatrixGenerateRow(A, start, stride, loop_size, r, index, rvalues);
+      bi = hypre_BoxIndexRank(b_data_box, index);
+      xi = hypre_BoxIndexRank(x_data_box, index);
+      ti = hypre_BoxIndexRank(t_data_box, index);
+
+      for (k = 0; k < hypre_IndexD(loop_size, 0); k++)
+      {
+         vp = rvalues + k * hypre_IndexD(stride, 0) * stencil_size;
+
+         tp[ti] = bp[bi];
+         if (!zero_guess)
+         {
+            /* sum the off-diagonal terms in the groups of hypre_PointRelax_core0 */
+            for (s = 0; s < stencil_size; s += MAX_DEPTH)
+            {
+               sn  = hypre_min(s + MAX_DEPTH, stencil_size);
+               n   = 0;
+               sum = 0.0;
+               for (sk = s; sk < sn; sk++)
+               {
+                  if (sk != diag_rank)
+                  {
+                     sum = n ? (sum + vp[sk] * xp[xi + xoff[sk]]) : (vp[sk] * xp[xi + xoff[sk]]);
+                     n++;
+                  }
+               }
+               if (n)
+               {
+                  tp[ti] -= sum;
+               }
+            }
+         }
+         tp[ti] /= vp[diag_rank];
+
+         bi += hypre_IndexD(stride, 0);
+         xi += hypre_IndexD(stride, 0);
+         ti += hypre_IndexD(stride, 0);
+      }
+   }
+
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /* for constant_coefficient==1 or 2, all offdiagonal coefficients constant over space ...*/
 HYPRE_Int
 hypre_PointRelax_core12( void               *relax_vdata,
@@ -959,6 +1098,7 @@ hypre_PointRelax_core12( void               *relax_vdata,
    HYPRE_Int              diag_rank        = (relax_data -> diag_rank);
    hypre_IndexRef         start;
    hypre_Index            loop_size;
+   hypre_Index            tile_size;
    HYPRE_Int              si, sk, ssi[MAX_DEPTH], depth, k;
    HYPRE_Int              Ai;
 
@@ -968,6 +1108,7 @@ hypre_PointRelax_core12( void               *relax_vdata,
 
    start  = hypre_BoxIMin(compute_box);
    hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+   hypre_StructTileGetSize(hypre_StructMatrixNDim(A), loop_size, tile_size);
 
    /* The standard (variable coefficient) algorithm initializes
       tp=bp.  Do it here, but for constant diagonal, also
@@ -983,24 +1124,24 @@ hypre_PointRelax_core12( void               *relax_vdata,
       Apd = hypre_StructMatrixBoxData(A, boxarray_id, diag_rank);
       AApd = 1 / Apd[Ai];
 
-      hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                          b_data_box, start, stride, bi,
-                          t_data_box, start, stride, ti);
+      hypre_TiledBoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                               b_data_box, start, stride, bi,
+                               t_data_box, start, stride, ti);
       {
          tp[ti] = AApd * bp[bi];
       }
-      hypre_BoxLoop2End(bi, ti);
+      hypre_TiledBoxLoop2End(bi, ti);
    }
    else /* constant_coefficient==2, variable diagonal */
    {
       AApd = 1;
-      hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                          b_data_box, start, stride, bi,
-                          t_data_box, start, stride, ti);
+      hypre_TiledBoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                               b_data_box, start, stride, bi,
+                               t_data_box, start, stride, ti);
       {
          tp[ti] = bp[bi];
       }
-      hypre_BoxLoop2End(bi, ti);
+      hypre_TiledBoxLoop2End(bi, ti);
    }
 #undef DEVICE_VAR
 
@@ -1075,9 +1216,9 @@ hypre_PointRelax_core12( void               *relax_vdata,
             AAp4 = Ap4[Ai] * AApd;
             AAp5 = Ap5[Ai] * AApd;
             AAp6 = Ap6[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0] +
@@ -1088,7 +1229,7 @@ hypre_PointRelax_core12( void               *relax_vdata,
                   AAp5 * xp[xi + xoff5] +
                   AAp6 * xp[xi + xoff6];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_TiledBoxLoop2End(xi, ti);
             break;
 
          case 6:
@@ -1098,9 +1239,9 @@ hypre_PointRelax_core12( void               *relax_vdata,
             AAp3 = Ap3[Ai] * AApd;
             AAp4 = Ap4[Ai] * AApd;
             AAp5 = Ap5[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0] +
@@ -1110,7 +1251,7 @@ hypre_PointRelax_core12( void               *relax_vdata,
                   AAp4 * xp[xi + xoff4] +
                   AAp5 * xp[xi + xoff5];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_TiledBoxLoop2End(xi, ti);
             break;
 
          case 5:
@@ -1119,9 +1260,9 @@ hypre_PointRelax_core12( void               *relax_vdata,
             AAp2 = Ap2[Ai] * AApd;
             AAp3 = Ap3[Ai] * AApd;
             AAp4 = Ap4[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0] +
@@ -1130,7 +1271,7 @@ hypre_PointRelax_core12( void               *relax_vdata,
                   AAp3 * xp[xi + xoff3] +
                   AAp4 * xp[xi + xoff4];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_TiledBoxLoop2End(xi, ti);
             break;
 
          case 4:
@@ -1138,9 +1279,9 @@ hypre_PointRelax_core12( void               *relax_vdata,
             AAp1 = Ap1[Ai] * AApd;
             AAp2 = Ap2[Ai] * AApd;
             AAp3 = Ap3[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0] +
@@ -1148,49 +1289,49 @@ hypre_PointRelax_core12( void               *relax_vdata,
                   AAp2 * xp[xi + xoff2] +
                   AAp3 * xp[xi + xoff3];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_TiledBoxLoop2End(xi, ti);
             break;
 
          case 3:
             AAp0 = Ap0[Ai] * AApd;
             AAp1 = Ap1[Ai] * AApd;
             AAp2 = Ap2[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0] +
                   AAp1 * xp[xi + xoff1] +
                   AAp2 * xp[xi + xoff2];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_TiledBoxLoop2End(xi, ti);
             break;
 
          case 2:
             AAp0 = Ap0[Ai] * AApd;
             AAp1 = Ap1[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0] +
                   AAp1 * xp[xi + xoff1];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_TiledBoxLoop2End(xi, ti);
             break;
 
          case 1:
             AAp0 = Ap0[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_TiledBoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_TiledBoxLoop2End(xi, ti);
             break;
 
          case 0:
@@ -87,6 +87,22 @@ HYPRE_Int hypre_JacobiGetNumIterations ( void *jacobi_vdata, HYPRE_Int *num_iter
 HYPRE_Int hypre_JacobiSetTempVec ( void *jacobi_vdata, hypre_StructVector *t );
 HYPRE_Int hypre_JacobiGetFinalRelativeResidualNorm ( void *jacobi_vdata, HYPRE_Real *norm );
 
+/* line_relax.c */
+void *hypre_LineRelaxCreate ( MPI_Comm comm );
+HYPRE_Int hypre_LineRelaxDestroy ( void *relax_vdata );
+HYPRE_Int hypre_LineRelaxLinesAreWhole ( hypre_StructGrid *grid, HYPRE_Int line_dir );
+HYPRE_Int hypre_LineRelaxSetup ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                                 hypre_StructVector *x );
+HYPRE_Int hypre_LineRelax ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                            hypre_StructVector *x );
+HYPRE_Int hypre_LineRelaxSetMaxIter ( void *relax_vdata, HYPRE_Int max_iter );
+HYPRE_Int hypre_LineRelaxSetZeroGuess ( void *relax_vdata, HYPRE_Int zero_guess );
+HYPRE_Int hypre_LineRelaxSetWeight ( void *relax_vdata, HYPRE_Real weight );
+HYPRE_Int hypre_LineRelaxSetLineDir ( void *relax_vdata, HYPRE_Int line_dir );
+HYPRE_Int hypre_LineRelaxSetZebra ( void *relax_vdata, HYPRE_Int zebra );
+HYPRE_Int hypre_LineRelaxSetStartColor ( void *relax_vdata, HYPRE_Int start_color );
+HYPRE_Int hypre_LineRelaxGetNumIterations ( void *relax_vdata, HYPRE_Int *num_iterations );
+
 /* pcg_struct.c */
 void *hypre_StructKrylovCAlloc ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
 HYPRE_Int hypre_StructKrylovFree ( void *ptr );
@@ -102,6 +118,10 @@ HYPRE_Int hypre_StructKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_StructKrylovClearVector ( void *x );
 HYPRE_Int hypre_StructKrylovScaleVector ( HYPRE_Complex alpha, void *x );
 HYPRE_Int hypre_StructKrylovAxpy ( HYPRE_Complex alpha, void *x, void *y );
+HYPRE_Int hypre_StructKrylovAxpby ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+HYPRE_Int hypre_StructKrylovAxpy2 ( HYPRE_Complex alpha, void *x1, void *y1, HYPRE_Complex beta,
+                                    void *x2, void *y2, HYPRE_Real *result );
+HYPRE_Real hypre_StructKrylovAxpyInnerProd ( HYPRE_Complex alpha, void *x, void *y, void *z );
 HYPRE_Int hypre_StructKrylovIdentitySetup ( void *vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_StructKrylovIdentity ( void *vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_StructKrylovCommInfo ( void *A, HYPRE_Int *my_id, HYPRE_Int *num_procs );
@@ -211,6 +231,10 @@ HYPRE_Int hypre_PFMGSetNumPostRelax ( void *pfmg_vdata, HYPRE_Int num_post_relax
 HYPRE_Int hypre_PFMGGetNumPostRelax ( void *pfmg_vdata, HYPRE_Int *num_post_relax );
 HYPRE_Int hypre_PFMGSetSkipRelax ( void *pfmg_vdata, HYPRE_Int skip_relax );
 HYPRE_Int hypre_PFMGGetSkipRelax ( void *pfmg_vdata, HYPRE_Int *skip_relax );
+HYPRE_Int hypre_PFMGSetTemporalBlocking ( void *pfmg_vdata, HYPRE_Int temporal_blocking );
+HYPRE_Int hypre_PFMGGetTemporalBlocking ( void *pfmg_vdata, HYPRE_Int *temporal_blocking );
+HYPRE_Int hypre_PFMGSetMaxCoarseSize ( void *pfmg_vdata, HYPRE_Int max_coarse_size );
+HYPRE_Int hypre_PFMGGetMaxCoarseSize ( void *pfmg_vdata, HYPRE_Int *max_coarse_size );
 HYPRE_Int hypre_PFMGSetDxyz ( void *pfmg_vdata, HYPRE_Real *dxyz );
 HYPRE_Int hypre_PFMGSetLogging ( void *pfmg_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_PFMGGetLogging ( void *pfmg_vdata, HYPRE_Int *logging );
@@ -221,6 +245,14 @@ HYPRE_Int hypre_PFMGPrintLogging ( void *pfmg_vdata, HYPRE_Int myid );
 HYPRE_Int hypre_PFMGGetFinalRelativeResidualNorm ( void *pfmg_vdata,
                                                    HYPRE_Real *relative_residual_norm );
 
+/* pfmg_coarse_solve.c */
+void *hypre_PFMGCoarseSolveCreate ( MPI_Comm comm );
+HYPRE_Int hypre_PFMGCoarseSolveDestroy ( void *solve_vdata );
+HYPRE_Int hypre_PFMGCoarseSolveSetup ( void *solve_vdata, hypre_StructMatrix *A,
+                                       hypre_StructVector *b, hypre_StructVector *x );
+HYPRE_Int hypre_PFMGCoarseSolve ( void *solve_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                                  hypre_StructVector *x );
+
 /* pfmg_relax.c */
 void *hypre_PFMGRelaxCreate ( MPI_Comm comm );
 HYPRE_Int hypre_PFMGRelaxDestroy ( void *pfmg_relax_vdata );
@@ -236,6 +268,9 @@ HYPRE_Int hypre_PFMGRelaxSetTol ( void *pfmg_relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PFMGRelaxSetMaxIter ( void *pfmg_relax_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_PFMGRelaxSetZeroGuess ( void *pfmg_relax_vdata, HYPRE_Int zero_guess );
 HYPRE_Int hypre_PFMGRelaxSetTempVec ( void *pfmg_relax_vdata, hypre_StructVector *t );
+HYPRE_Int hypre_PFMGRelaxSetTemporalBlocking ( void *pfmg_relax_vdata,
+                                               HYPRE_Int temporal_blocking );
+HYPRE_Int hypre_PFMGRelaxSetLineDir ( void *pfmg_relax_vdata, HYPRE_Int line_dir );
 
 /* pfmg_setup.c */
 HYPRE_Int hypre_PFMGSetup ( void *pfmg_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
@@ -254,6 +289,8 @@ HYPRE_Int hypre_PFMGComputeDxyz_SS19( HYPRE_Int bi, hypre_StructMatrix *A, HYPRE
                                       HYPRE_Real *sqcxyz);
 HYPRE_Int hypre_PFMGComputeDxyz_SS27( HYPRE_Int bi, hypre_StructMatrix *A, HYPRE_Real *cxyz,
                                       HYPRE_Real *sqcxyz);
+HYPRE_Int hypre_PFMGComputeDxyz_SSN ( HYPRE_Int bi, hypre_StructMatrix *A, HYPRE_Real *cxyz,
+                                      HYPRE_Real *sqcxyz);
 HYPRE_Int hypre_ZeroDiagonal ( hypre_StructMatrix *A );
 
 /* pfmg_setup_interp.c */
@@ -330,6 +367,15 @@ HYPRE_Int hypre_PFMGSetupRAPOp ( hypre_StructMatrix *R, hypre_StructMatrix *A,
                                  hypre_StructMatrix *P, HYPRE_Int cdir, hypre_Index cindex, hypre_Index cstride, HYPRE_Int rap_type,
                                  hypre_StructMatrix *Ac );
 
+/* pfmg_setup_rapn.c */
+HYPRE_Int hypre_PFMGStencilIsCompact ( hypre_StructStencil *stencil );
+HYPRE_Int hypre_PFMGStencilIsStandard ( hypre_StructStencil *stencil );
+hypre_StructMatrix *hypre_PFMGCreateRAPOpN ( hypre_StructMatrix *R, hypre_StructMatrix *A,
+                                             hypre_StructMatrix *P, hypre_StructGrid *coarse_grid, HYPRE_Int cdir );
+HYPRE_Int hypre_PFMGBuildRAPN ( hypre_StructMatrix *A, hypre_StructMatrix *P,
+                                hypre_StructMatrix *R, HYPRE_Int cdir, hypre_Index cindex, hypre_Index cstride,
+                                hypre_StructMatrix *RAP );
+
 /* pfmg_solve.c */
 HYPRE_Int hypre_PFMGSolve ( void *pfmg_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
                             hypre_StructVector *x );
@@ -349,6 +395,9 @@ HYPRE_Int hypre_PointRelax_core12 ( void *relax_vdata, hypre_StructMatrix *A,
                                     HYPRE_Int constant_coefficient, hypre_Box *compute_box, HYPRE_Real *bp, HYPRE_Real *xp,
                                     HYPRE_Real *tp, HYPRE_Int boxarray_id, hypre_Box *A_data_box, hypre_Box *b_data_box,
                                     hypre_Box *x_data_box, hypre_Box *t_data_box, hypre_IndexRef stride );
+HYPRE_Int hypre_PointRelax_coreGen ( void *relax_vdata, hypre_StructMatrix *A, HYPRE_Int zero_guess,
+                                     hypre_Box *compute_box, HYPRE_Real *bp, HYPRE_Real *xp, HYPRE_Real *tp, hypre_Box *b_data_box,
+                                     hypre_Box *x_data_box, hypre_Box *t_data_box, hypre_IndexRef stride );
 HYPRE_Int hypre_PointRelaxSetTol ( void *relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PointRelaxGetTol ( void *relax_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_PointRelaxSetMaxIter ( void *relax_vdata, HYPRE_Int max_iter );
@@ -640,3 +689,20 @@ HYPRE_Int hypre_SparseMSGSetupRAPOp ( hypre_StructMatrix *R, hypre_StructMatrix
 /* sparse_msg_solve.c */
 HYPRE_Int hypre_SparseMSGSolve ( void *smsg_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
                                  hypre_StructVector *x );
+
+/* temporal_relax.c */
+void *hypre_TemporalRelaxCreate ( MPI_Comm comm );
+HYPRE_Int hypre_TemporalRelaxDestroy ( void *relax_vdata );
+HYPRE_Int hypre_TemporalRelaxMaxSweeps ( hypre_StructMatrix *A, HYPRE_Int relax_type );
+HYPRE_Int hypre_TemporalRelaxSetup ( void *relax_vdata, hypre_StructMatrix *A,
+                                     hypre_StructVector *b, hypre_StructVector *x );
+HYPRE_Int hypre_TemporalRelax ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                                hypre_StructVector *x );
+HYPRE_Int hypre_TemporalRelaxSetType ( void *relax_vdata, HYPRE_Int relax_type );
+HYPRE_Int hypre_TemporalRelaxSetWeight ( void *relax_vdata, HYPRE_Real weight );
+HYPRE_Int hypre_TemporalRelaxSetNumSweeps ( void *relax_vdata, HYPRE_Int num_sweeps );
+HYPRE_Int hypre_TemporalRelaxSetTileSize ( void *relax_vdata, hypre_Index tile_size );
+HYPRE_Int hypre_TemporalRelaxSetMaxIter ( void *relax_vdata, HYPRE_Int max_iter );
+HYPRE_Int hypre_TemporalRelaxSetZeroGuess ( void *relax_vdata, HYPRE_Int zero_guess );
+HYPRE_Int hypre_TemporalRelaxSetStartRed ( void *relax_vdata );
+HYPRE_Int hypre_TemporalRelaxSetStartBlack ( void *relax_vdata );
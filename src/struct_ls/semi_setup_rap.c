@@ -271,6 +271,194 @@ hypre_SemiCreateRAPOp( hypre_StructMatrix *R,
 }
 
 /*--------------------------------------------------------------------------
+ * hypre_SemiBuildRAPConstant
+ *
+ * Constant coefficient version of hypre_SemiBuildRAP (A, P, R, and RAP all
+ * have constant_coefficient = 1).  Every path of hypre_SemiBuildRAP involves
+ * the same coefficients at each point, so the entries are computed once per
+ * box, in the same order.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SemiBuildRAPConstant( hypre_StructMatrix *A,
+                            hypre_StructMatrix *P,
+                            hypre_StructMatrix *R,
+                            HYPRE_Int           cdir,
+                            HYPRE_Int           P_stored_as_transpose,
+                            hypre_StructMatrix *RAP     )
+{
+   hypre_StructStencil  *coarse_stencil       = hypre_StructMatrixStencil(RAP);
+   HYPRE_Int             coarse_stencil_size  = hypre_StructStencilSize(coarse_stencil);
+   HYPRE_Int            *coarse_symm_elements = hypre_StructMatrixSymmElements(RAP);
+   hypre_Index          *coarse_stencil_shape = hypre_StructStencilShape(coarse_stencil);
+   HYPRE_Int             dim                  = hypre_StructStencilNDim(coarse_stencil);
+   HYPRE_Int            *fgrid_ids            = hypre_StructGridIDs(hypre_StructMatrixGrid(A));
+   hypre_StructGrid     *cgrid                = hypre_StructMatrixGrid(RAP);
+   hypre_BoxArray       *cgrid_boxes          = hypre_StructGridBoxes(cgrid);
+   HYPRE_Int            *cgrid_ids            = hypre_StructGridIDs(cgrid);
+
+   hypre_Index           index;
+   HYPRE_Int             fi, ci;
+   HYPRE_Real            pa, pb, ra, rb, a;
+   HYPRE_Real           *a_ptr;
+   HYPRE_Real           *rap_ptrS, *rap_ptrU, *rap_ptrD;
+   HYPRE_Int             symm_path_multiplier;
+   HYPRE_Int             RAPloop, diag, d;
+
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+
+      /* interpolation and restriction weights (see hypre_SemiBuildRAP) */
+      hypre_SetIndex(index, 0);
+      hypre_IndexD(index, cdir) = P_stored_as_transpose ? 1 : -1;
+      pa = *hypre_StructMatrixExtractPointerByIndex(P, fi, index);
+      ra = *hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+      hypre_IndexD(index, cdir) = -hypre_IndexD(index, cdir);
+      pb = *hypre_StructMatrixExtractPointerByIndex(P, fi, index);
+      rb = *hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+
+      for (RAPloop = 0; RAPloop < coarse_stencil_size; RAPloop++)
+      {
+         if (coarse_symm_elements[RAPloop] == -1)
+         {
+            *hypre_StructMatrixBoxData(RAP, ci, RAPloop) = 0.0;
+         }
+      }
+
+      for (RAPloop = 0; RAPloop < coarse_stencil_size; RAPloop++)
+      {
+         if (coarse_symm_elements[RAPloop] != -1)
+         {
+            continue;
+         }
+
+         hypre_CopyIndex(coarse_stencil_shape[RAPloop], index);
+         a_ptr = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+         if (a_ptr == NULL)
+         {
+            continue;
+         }
+         a = *a_ptr;
+
+         switch (hypre_IndexD(index, cdir))
+         {
+            case 0:
+
+               hypre_IndexD(index, cdir) = 1;
+               rap_ptrU = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+               hypre_IndexD(index, cdir) = -1;
+               rap_ptrD = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+               hypre_IndexD(index, cdir) = 0;
+               rap_ptrS = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+               diag = 0;
+               for (d = 0; d < dim; d++)
+               {
+                  diag += hypre_IndexD(index, d) * hypre_IndexD(index, d);
+               }
+
+               *rap_ptrS += a;
+               if (!(diag == 0 && hypre_StructMatrixSymmetric(RAP)))
+               {
+                  *rap_ptrU += ra * a * pb;
+               }
+               *rap_ptrS += ra * a * pa;
+               *rap_ptrS += rb * a * pb;
+               *rap_ptrD += rb * a * pa;
+
+               break;
+
+            case -1:
+
+               rap_ptrD = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+               hypre_IndexD(index, cdir) = 0;
+               rap_ptrS = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+               symm_path_multiplier = 1;
+               diag = 0;
+               for (d = 0; d < dim; d++)
+               {
+                  diag += hypre_IndexD(index, d) * hypre_IndexD(index, d);
+               }
+               if (diag == 0 && hypre_StructMatrixSymmetric(RAP))
+               {
+                  symm_path_multiplier = 2;
+               }
+
+               *rap_ptrS += symm_path_multiplier * (a * pb);
+               *rap_ptrD += a * pa;
+               *rap_ptrS += symm_path_multiplier * (ra * a);
+               *rap_ptrD += rb * a;
+
+               break;
+
+            case 1:
+
+               rap_ptrU = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+               hypre_IndexD(index, cdir) = 0;
+               rap_ptrS = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+               symm_path_multiplier = 1;
+               diag = 0;
+               for (d = 0; d < dim; d++)
+               {
+                  diag += hypre_IndexD(index, d) * hypre_IndexD(index, d);
+               }
+               if (diag == 0 && hypre_StructMatrixSymmetric(RAP))
+               {
+                  symm_path_multiplier = 2;
+               }
+
+               *rap_ptrU += a * pb;
+               *rap_ptrS += symm_path_multiplier * (a * pa);
+               *rap_ptrU += ra * a;
+               *rap_ptrS += symm_path_multiplier * (rb * a);
+
+               break;
+         }
+      }
+   }
+
+   /* collapse entries when period = 1 in the coarsened direction */
+   if (hypre_IndexD(hypre_StructGridPeriodic(cgrid), cdir) == 1)
+   {
+      hypre_ForBoxI(ci, cgrid_boxes)
+      {
+         for (RAPloop = 0; RAPloop < coarse_stencil_size; RAPloop++)
+         {
+            hypre_CopyIndex(coarse_stencil_shape[RAPloop], index);
+            if (coarse_symm_elements[RAPloop] == -1 && hypre_IndexD(index, cdir) != 0)
+            {
+               rap_ptrD = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+               hypre_IndexD(index, cdir) = 0;
+               rap_ptrS = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+               symm_path_multiplier = 1;
+               diag = 0;
+               for (d = 0; d < dim; d++)
+               {
+                  diag += hypre_IndexD(index, d) * hypre_IndexD(index, d);
+               }
+               if (diag == 0 && hypre_StructMatrixSymmetric(RAP))
+               {
+                  symm_path_multiplier = 2;
+               }
+               *rap_ptrS += symm_path_multiplier * (*rap_ptrD);
+               *rap_ptrD = 0.0;
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SemiBuildRAP
+ *
+ * With constant_coefficient = 2, R, P, and RAP have variable coefficients
+ * and the constant entries of A are expanded to a temporary array.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -330,6 +518,18 @@ hypre_SemiBuildRAP( hypre_StructMatrix *A,
 
    HYPRE_Real            zero = 0.0;
 
+   HYPRE_Int             constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   HYPRE_MemoryLocation  memory_location = hypre_StructMatrixMemoryLocation(A);
+   HYPRE_Real           *a_tmp = NULL;
+   HYPRE_Real            a_val;
+   hypre_Index           a_size, ustride;
+
+   if (constant_coefficient == 1)
+   {
+      return hypre_SemiBuildRAPConstant(A, P, R, cdir, P_stored_as_transpose, RAP);
+   }
+   hypre_SetIndex(ustride, 1);
+
    coarse_stencil = hypre_StructMatrixStencil(RAP);
    coarse_stencil_size = hypre_StructStencilSize(coarse_stencil);
    coarse_symm_elements = hypre_StructMatrixSymmElements(RAP);
@@ -466,6 +666,12 @@ hypre_SemiBuildRAP( hypre_StructMatrix *A,
       COffsetA = hypre_BoxOffsetDistance(A_dbox, index);
       COffsetP = hypre_BoxOffsetDistance(P_dbox, index);
 
+      if (constant_coefficient == 2)
+      {
+         a_tmp = hypre_TAlloc(HYPRE_Real, hypre_BoxVolume(A_dbox), memory_location);
+         hypre_BoxGetSize(A_dbox, a_size);
+      }
+
       /*-----------------------------------------------------------------
        * Entries in RAP are calculated by accumulation, must first
        * zero out entries.
@@ -504,6 +710,21 @@ hypre_SemiBuildRAP( hypre_StructMatrix *A,
              *-------------------------------------------------------------*/
             hypre_CopyIndex(coarse_stencil_shape[RAPloop], index);
             a_ptr = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+            if (a_ptr != NULL && constant_coefficient == 2 &&
+                hypre_IndexEqual(index, 0, dim) == 0)
+            {
+               /* constant off-diagonal entry (stored on the host) */
+               a_val = *a_ptr;
+#define DEVICE_VAR is_device_ptr(a_tmp)
+               hypre_BoxLoop1Begin(hypre_StructMatrixNDim(A), a_size,
+                                   A_dbox, hypre_BoxIMin(A_dbox), ustride, ai);
+               {
+                  a_tmp[ai] = a_val;
+               }
+               hypre_BoxLoop1End(ai);
+#undef DEVICE_VAR
+               a_ptr = a_tmp;
+            }
             if (a_ptr != NULL)
             {
                switch (hypre_IndexD(index, cdir))
@@ -760,6 +981,8 @@ hypre_SemiBuildRAP( hypre_StructMatrix *A,
 
       } /* end of RAPloop */
 
+      hypre_TFree(a_tmp, memory_location);
+
    } /* end ForBoxI */
 
    /*-----------------------------------------------------------------
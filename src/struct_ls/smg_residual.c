@@ -84,6 +84,10 @@ hypre_SMGResidualSetup( void               *residual_vdata,
    hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
                           grid, &compute_pkg);
 
+   /* pick tile sizes for the host loops (if requested) */
+   hypre_StructTileTune(A, hypre_ComputePkgIndtBoxes(compute_pkg), base_stride);
+   hypre_StructTileTune(A, hypre_ComputePkgDeptBoxes(compute_pkg), base_stride);
+
    /*----------------------------------------------------------
     * Set up the residual data structure
     *----------------------------------------------------------*/
@@ -141,6 +145,7 @@ hypre_SMGResidual( void               *residual_vdata,
    HYPRE_Real             *rp;
 
    hypre_Index             loop_size;
+   hypre_Index             tile_size;
    hypre_IndexRef          start;
 
    hypre_StructStencil    *stencil;
@@ -188,15 +193,16 @@ hypre_SMGResidual( void               *residual_vdata,
                rp = hypre_StructVectorBoxData(r, i);
 
                hypre_BoxGetStrideSize(compute_box, base_stride, loop_size);
+               hypre_StructTileGetSize(hypre_StructMatrixNDim(A), loop_size, tile_size);
 
 #define DEVICE_VAR is_device_ptr(rp,bp)
-               hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                   b_data_box, start, base_stride, bi,
-                                   r_data_box, start, base_stride, ri);
+               hypre_TiledBoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                        b_data_box, start, base_stride, bi,
+                                        r_data_box, start, base_stride, ri);
                {
                   rp[ri] = bp[bi];
                }
-               hypre_BoxLoop2End(bi, ri);
+               hypre_TiledBoxLoop2End(bi, ri);
 #undef DEVICE_VAR
             }
          }
@@ -239,16 +245,17 @@ hypre_SMGResidual( void               *residual_vdata,
 
                hypre_BoxGetStrideSize(compute_box, base_stride,
                                       loop_size);
+               hypre_StructTileGetSize(hypre_StructMatrixNDim(A), loop_size, tile_size);
 
 #define DEVICE_VAR is_device_ptr(rp,Ap,xp)
-               hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                   A_data_box, start, base_stride, Ai,
-                                   x_data_box, start, base_stride, xi,
-                                   r_data_box, start, base_stride, ri);
+               hypre_TiledBoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size, tile_size,
+                                        A_data_box, start, base_stride, Ai,
+                                        x_data_box, start, base_stride, xi,
+                                        r_data_box, start, base_stride, ri);
                {
                   rp[ri] -= Ap[Ai] * xp[xi + xp_off];
                }
-               hypre_BoxLoop3End(Ai, xi, ri);
+               hypre_TiledBoxLoop3End(Ai, xi, ri);
 #undef DEVICE_VAR
             }
          }
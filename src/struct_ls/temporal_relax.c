@@ -0,0 +1,896 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Temporally blocked weighted Jacobi and red/black Gauss-Seidel for matrices
+ * with variable coefficients (host only).
+ *
+ * The right-hand side and the iterate are exchanged once with a ghost layer
+ * that is deep enough for num_sweeps sweeps, and all of these sweeps are then
+ * done tile by tile.  Within a tile, (half-)sweep h updates the tile grown by
+ * the stencil reach times the number of (half-)sweeps still to come, so the
+ * points of the ghost layer and of the neighboring tiles are relaxed
+ * redundantly and the tiles are independent of each other.  The (half-)sweeps
+ * are pipelined along the last dimension (a wavefront): sweep h works on plane
+ * z while sweep h+1 works on plane z - 2*reach, so that only 2*reach+1 planes
+ * of each intermediate iterate are kept and the matrix, the right-hand side
+ * and the iterate are streamed from memory once per num_sweeps sweeps.
+ *
+ * The redundant computation in the ghost layer needs the matrix coefficients
+ * there, so a copy of the matrix with the deep ghost layer is kept (see
+ * struct_halo.c).  Results are identical to hypre_PointRelax and
+ * hypre_RedBlackGS.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "_hypre_struct_mv.hpp"
+
+/* this currently cannot be greater than 7 (see point_relax.c) */
+#define hypre_TEMPORAL_CHUNK 7
+
+/* largest number of sweeps per ghost exchange */
+#define hypre_TEMPORAL_MAX_SWEEPS 8
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm                comm;
+
+   HYPRE_Int               relax_type;  /* 0 = weighted Jacobi, 1 = red/black GS */
+   HYPRE_Real              weight;
+   HYPRE_Int               max_iter;
+   HYPRE_Int               zero_guess;
+   HYPRE_Int               rb_start;
+   HYPRE_Int               num_sweeps;  /* sweeps per ghost exchange */
+   hypre_Index             tile_size;   /* 0 means the whole box extent */
+
+   hypre_Index             reach;       /* stencil reach in each dimension */
+   HYPRE_Int               diag_rank;
+
+   hypre_StructMatrix     *A;           /* copies with the deep ghost layer */
+   hypre_StructVector     *b;
+   hypre_StructVector     *x;
+   hypre_CommPkg          *b_comm_pkg;  /* separate packages, so that both */
+   hypre_CommPkg          *x_comm_pkg;  /* exchanges can be in flight */
+
+   HYPRE_Int               work_size;   /* per thread */
+   HYPRE_Real             *work;
+   HYPRE_Real            **rows;        /* per thread, 2 * stencil size */
+
+   /* log info (always logged) */
+   HYPRE_Int               num_iterations;
+   HYPRE_Int               time_index;
+
+} hypre_TemporalRelaxData;
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_TemporalRelaxCreate( MPI_Comm  comm )
+{
+   hypre_TemporalRelaxData *relax_data;
+
+   relax_data = hypre_CTAlloc(hypre_TemporalRelaxData, 1, HYPRE_MEMORY_HOST);
+
+   (relax_data -> comm)       = comm;
+   (relax_data -> time_index) = hypre_InitializeTiming("TemporalRelax");
+
+   /* set defaults */
+   (relax_data -> relax_type) = 0;
+   (relax_data -> weight)     = 1.0;
+   (relax_data -> max_iter)   = 1000;
+   (relax_data -> zero_guess) = 0;
+   (relax_data -> rb_start)   = 1;
+   (relax_data -> num_sweeps) = 2;
+   hypre_SetIndex3(relax_data -> tile_size, 0, 32, 0);
+
+   return (void *) relax_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_TemporalRelaxDestroyData( hypre_TemporalRelaxData *relax_data )
+{
+   hypre_StructMatrixDestroy(relax_data -> A);
+   hypre_StructVectorDestroy(relax_data -> b);
+   hypre_StructVectorDestroy(relax_data -> x);
+   hypre_CommPkgDestroy(relax_data -> b_comm_pkg);
+   hypre_CommPkgDestroy(relax_data -> x_comm_pkg);
+   hypre_TFree(relax_data -> work, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> rows, HYPRE_MEMORY_HOST);
+
+   (relax_data -> A)        = NULL;
+   (relax_data -> b)        = NULL;
+   (relax_data -> x)        = NULL;
+   (relax_data -> b_comm_pkg) = NULL;
+   (relax_data -> x_comm_pkg) = NULL;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_TemporalRelaxDestroy( void *relax_vdata )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   if (relax_data)
+   {
+      hypre_TemporalRelaxDestroyData(relax_data);
+      hypre_FinalizeTiming(relax_data -> time_index);
+      hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_TemporalRelaxMaxSweeps
+ *
+ * Returns the largest number of sweeps per ghost exchange that can be used
+ * for A, or 0 if temporal blocking is not available for A.  The depth of the
+ * ghost layer is limited as in hypre_StructHaloMaxDepth.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxMaxSweeps( hypre_StructMatrix *A,
+                              HYPRE_Int           relax_type )
+{
+   HYPRE_Int            ndim          = hypre_StructMatrixNDim(A);
+   hypre_StructGrid    *grid          = hypre_StructMatrixGrid(A);
+   hypre_StructStencil *stencil       = hypre_StructMatrixStencil(A);
+   HYPRE_Int            stencil_size  = hypre_StructStencilSize(stencil);
+   hypre_IndexRef       periodic      = hypre_StructGridPeriodic(grid);
+   HYPRE_Int            num_steps     = (relax_type == 1) ? 2 : 1;
+   HYPRE_Int            num_ghost[2 * HYPRE_MAXDIM];
+   HYPRE_Int            max_sweeps, d;
+
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
+   if (hypre_GetExecPolicy1(hypre_StructMatrixMemoryLocation(A)) != HYPRE_EXEC_HOST)
+   {
+      return 0;
+   }
+#endif
+
+   if (hypre_StructMatrixConstantCoefficient(A) != 0 || hypre_StructMatrixCoeffFcn(A))
+   {
+      return 0;
+   }
+
+   /* red/black ordering needs a 3-pt (1D), 5-pt (2D), or 7-pt (3D) stencil */
+   if (relax_type == 1 && stencil_size != 2 * ndim + 1)
+   {
+      return 0;
+   }
+
+   hypre_StructHaloNumGhost(stencil, num_steps, num_ghost);
+
+   if (relax_type == 1)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         if (num_ghost[2 * d] != num_steps || num_ghost[2 * d + 1] != num_steps)
+         {
+            return 0;
+         }
+
+         /* periodic images of ghost points must have the same color */
+         if (hypre_IndexD(periodic, d) % 2)
+         {
+            return 0;
+         }
+      }
+   }
+
+   /* the sweeps use a symmetric ghost layer */
+   for (d = 0; d < ndim; d++)
+   {
+      num_ghost[2 * d] = hypre_max(num_ghost[2 * d], num_ghost[2 * d + 1]);
+   }
+   max_sweeps = hypre_StructHaloMaxDepth(grid, num_ghost);
+
+   max_sweeps = hypre_min(max_sweeps, hypre_TEMPORAL_MAX_SWEEPS);
+
+   return max_sweeps;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetup( void               *relax_vdata,
+                          hypre_StructMatrix *A,
+                          hypre_StructVector *b,
+                          hypre_StructVector *x )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   HYPRE_Int             ndim       = hypre_StructMatrixNDim(A);
+   hypre_StructGrid     *grid       = hypre_StructMatrixGrid(A);
+   hypre_BoxArray       *boxes      = hypre_StructGridBoxes(grid);
+   HYPRE_Int             num_steps  = (relax_data -> num_sweeps) *
+                                      ((relax_data -> relax_type == 1) ? 2 : 1);
+   hypre_IndexRef        reach      = (relax_data -> reach);
+   HYPRE_Int             num_threads = hypre_NumThreads();
+
+   hypre_StructMatrix   *Ad;
+   hypre_StructVector   *bd;
+   hypre_StructVector   *xd;
+   hypre_CommPkg        *b_comm_pkg;
+   hypre_CommPkg        *x_comm_pkg;
+
+   hypre_StructStencil  *stencil;
+   HYPRE_Int             stencil_size;
+   HYPRE_Int             num_ghost[2 * HYPRE_MAXDIM];
+   hypre_Index           diag_index, tile;
+   hypre_Box            *box;
+
+   HYPRE_Int             work_size, row_size, h, i, s, d;
+
+   hypre_TemporalRelaxDestroyData(relax_data);
+
+   /*----------------------------------------------------------
+    * Find the stencil reach and the ghost layer depth
+    *----------------------------------------------------------*/
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_size  = hypre_StructStencilSize(stencil);
+
+   hypre_SetIndex3(diag_index, 0, 0, 0);
+   (relax_data -> diag_rank) = hypre_StructStencilElementRank(stencil, diag_index);
+
+   hypre_StructHaloNumGhost(stencil, 1, num_ghost);
+   hypre_SetIndex3(reach, 0, 0, 0);
+   for (d = 0; d < ndim; d++)
+   {
+      hypre_IndexD(reach, d) = hypre_max(num_ghost[2 * d], num_ghost[2 * d + 1]);
+      num_ghost[2 * d]     = num_steps * hypre_IndexD(reach, d);
+      num_ghost[2 * d + 1] = num_steps * hypre_IndexD(reach, d);
+   }
+
+   /*----------------------------------------------------------
+    * Copies of A, b, and x with the deep ghost layer
+    *----------------------------------------------------------*/
+
+   Ad = hypre_StructHaloMatrixCreate(A, num_ghost);
+   bd = hypre_StructHaloVectorCreate(grid, num_ghost);
+   xd = hypre_StructHaloVectorCreate(grid, num_ghost);
+
+   hypre_StructHaloCommPkgCreate(grid, num_ghost, hypre_StructVectorDataSpace(bd), 1,
+                                 &b_comm_pkg);
+   hypre_StructHaloCommPkgCreate(grid, num_ghost, hypre_StructVectorDataSpace(xd), 1,
+                                 &x_comm_pkg);
+
+   /*----------------------------------------------------------
+    * Tile buffers: 2*reach+1 planes of each intermediate
+    * (half-)sweep, plus row scratch
+    *----------------------------------------------------------*/
+
+   hypre_SetIndex3(tile, 1, 1, 1);
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      for (d = 0; d < ndim; d++)
+      {
+         s = hypre_BoxSizeD(box, d);
+         if (hypre_IndexD(relax_data -> tile_size, d) > 0)
+         {
+            s = hypre_min(s, hypre_IndexD(relax_data -> tile_size, d));
+         }
+         hypre_IndexD(tile, d) = hypre_max(hypre_IndexD(tile, d), s);
+      }
+   }
+
+   work_size = 0;
+   for (h = 1; h < num_steps; h++)
+   {
+      work_size += (hypre_IndexD(tile, 0) + 2 * (num_steps - h) * hypre_IndexD(reach, 0)) *
+                   (hypre_IndexD(tile, 1) + 2 * (num_steps - h) * hypre_IndexD(reach, 1)) *
+                   (2 * hypre_IndexD(reach, 2) + 1);
+   }
+   row_size   = hypre_IndexD(tile, 0) + 2 * num_steps * hypre_IndexD(reach, 0);
+   work_size += 2 * row_size + 2 * hypre_IndexD(reach, 0);
+
+   (relax_data -> work_size) = work_size;
+   (relax_data -> work)      = hypre_TAlloc(HYPRE_Real, work_size * num_threads,
+                                            HYPRE_MEMORY_HOST);
+   (relax_data -> rows)      = hypre_TAlloc(HYPRE_Real *, 2 * stencil_size * num_threads,
+                                            HYPRE_MEMORY_HOST);
+
+   (relax_data -> A)        = Ad;
+   (relax_data -> b)        = bd;
+   (relax_data -> x)        = xd;
+   (relax_data -> b_comm_pkg) = b_comm_pkg;
+   (relax_data -> x_comm_pkg) = x_comm_pkg;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Relaxes one row of (half-)sweep h.  Arow and urow point to the stencil
+ * coefficients and to the neighbors in the previous (half-)sweep of the
+ * first point of the row.  For red/black, only points with (index sum + first)
+ * even are relaxed, the others are copied.  The sums are formed in the same
+ * order as in hypre_PointRelax_core0 and hypre_RedBlackGS.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_TemporalRelaxRow( hypre_TemporalRelaxData  *relax_data,
+                        HYPRE_Int                 n,
+                        HYPRE_Int                 first,
+                        HYPRE_Real              **Arow,
+                        HYPRE_Real              **urow,
+                        HYPRE_Real               *bp,
+                        HYPRE_Real               *op,
+                        HYPRE_Real               *rp )
+{
+   HYPRE_Int    stencil_size = hypre_StructStencilSize(
+                                  hypre_StructMatrixStencil(relax_data -> A));
+   HYPRE_Int    diag_rank    = (relax_data -> diag_rank);
+   HYPRE_Real   weight       = (relax_data -> weight);
+   HYPRE_Real   weightc      = 1.0 - weight;
+   HYPRE_Real  *Adiag        = Arow[diag_rank];
+   HYPRE_Real  *center       = urow[diag_rank];
+   HYPRE_Real  *A0, *A1, *A2, *A3, *A4, *A5, *A6;
+   HYPRE_Real  *u0, *u1, *u2, *u3, *u4, *u5, *u6;
+   HYPRE_Real  *Ap[hypre_TEMPORAL_CHUNK];
+   HYPRE_Real  *up[hypre_TEMPORAL_CHUNK];
+   HYPRE_Int    i, s, si, depth;
+
+   if (relax_data -> relax_type == 1)
+   {
+      /* 3-pt, 5-pt, or 7-pt stencil */
+      depth = 0;
+      for (s = 0; s < stencil_size; s++)
+      {
+         if (s != diag_rank)
+         {
+            Ap[depth] = Arow[s];
+            up[depth] = urow[s];
+            depth++;
+         }
+      }
+      A0 = Ap[0]; A1 = Ap[1]; u0 = up[0]; u1 = up[1];
+      switch (depth)
+      {
+         case 6:
+            A2 = Ap[2]; A3 = Ap[3]; A4 = Ap[4]; A5 = Ap[5];
+            u2 = up[2]; u3 = up[3]; u4 = up[4]; u5 = up[5];
+            for (i = first; i < n; i += 2)
+            {
+               op[i] = (bp[i] -
+                        A0[i] * u0[i] - A1[i] * u1[i] - A2[i] * u2[i] -
+                        A3[i] * u3[i] - A4[i] * u4[i] - A5[i] * u5[i]) / Adiag[i];
+            }
+            break;
+
+         case 4:
+            A2 = Ap[2]; A3 = Ap[3]; u2 = up[2]; u3 = up[3];
+            for (i = first; i < n; i += 2)
+            {
+               op[i] = (bp[i] -
+                        A0[i] * u0[i] - A1[i] * u1[i] -
+                        A2[i] * u2[i] - A3[i] * u3[i]) / Adiag[i];
+            }
+            break;
+
+         case 2:
+            for (i = first; i < n; i += 2)
+            {
+               op[i] = (bp[i] - A0[i] * u0[i] - A1[i] * u1[i]) / Adiag[i];
+            }
+            break;
+      }
+      for (i = 1 - first; i < n; i += 2)
+      {
+         op[i] = center[i];
+      }
+
+      return;
+   }
+
+   for (i = 0; i < n; i++)
+   {
+      rp[i] = bp[i];
+   }
+   for (si = 0; si < stencil_size; si += hypre_TEMPORAL_CHUNK)
+   {
+      depth = 0;
+      for (s = si; s < hypre_min(si + hypre_TEMPORAL_CHUNK, stencil_size); s++)
+      {
+         if (s != diag_rank)
+         {
+            Ap[depth] = Arow[s];
+            up[depth] = urow[s];
+            depth++;
+         }
+      }
+
+      switch (depth)
+      {
+         case 7:
+            A0 = Ap[0]; A1 = Ap[1]; A2 = Ap[2]; A3 = Ap[3]; A4 = Ap[4]; A5 = Ap[5]; A6 = Ap[6];
+            u0 = up[0]; u1 = up[1]; u2 = up[2]; u3 = up[3]; u4 = up[4]; u5 = up[5]; u6 = up[6];
+            for (i = 0; i < n; i++)
+            {
+               rp[i] -= A0[i] * u0[i] + A1[i] * u1[i] + A2[i] * u2[i] + A3[i] * u3[i] +
+                        A4[i] * u4[i] + A5[i] * u5[i] + A6[i] * u6[i];
+            }
+            break;
+
+         case 6:
+            A0 = Ap[0]; A1 = Ap[1]; A2 = Ap[2]; A3 = Ap[3]; A4 = Ap[4]; A5 = Ap[5];
+            u0 = up[0]; u1 = up[1]; u2 = up[2]; u3 = up[3]; u4 = up[4]; u5 = up[5];
+            for (i = 0; i < n; i++)
+            {
+               rp[i] -= A0[i] * u0[i] + A1[i] * u1[i] + A2[i] * u2[i] + A3[i] * u3[i] +
+                        A4[i] * u4[i] + A5[i] * u5[i];
+            }
+            break;
+
+         case 5:
+            A0 = Ap[0]; A1 = Ap[1]; A2 = Ap[2]; A3 = Ap[3]; A4 = Ap[4];
+            u0 = up[0]; u1 = up[1]; u2 = up[2]; u3 = up[3]; u4 = up[4];
+            for (i = 0; i < n; i++)
+            {
+               rp[i] -= A0[i] * u0[i] + A1[i] * u1[i] + A2[i] * u2[i] + A3[i] * u3[i] +
+                        A4[i] * u4[i];
+            }
+            break;
+
+         case 4:
+            A0 = Ap[0]; A1 = Ap[1]; A2 = Ap[2]; A3 = Ap[3];
+            u0 = up[0]; u1 = up[1]; u2 = up[2]; u3 = up[3];
+            for (i = 0; i < n; i++)
+            {
+               rp[i] -= A0[i] * u0[i] + A1[i] * u1[i] + A2[i] * u2[i] + A3[i] * u3[i];
+            }
+            break;
+
+         case 3:
+            A0 = Ap[0]; A1 = Ap[1]; A2 = Ap[2];
+            u0 = up[0]; u1 = up[1]; u2 = up[2];
+            for (i = 0; i < n; i++)
+            {
+               rp[i] -= A0[i] * u0[i] + A1[i] * u1[i] + A2[i] * u2[i];
+            }
+            break;
+
+         case 2:
+            A0 = Ap[0]; A1 = Ap[1];
+            u0 = up[0]; u1 = up[1];
+            for (i = 0; i < n; i++)
+            {
+               rp[i] -= A0[i] * u0[i] + A1[i] * u1[i];
+            }
+            break;
+
+         case 1:
+            A0 = Ap[0];
+            u0 = up[0];
+            for (i = 0; i < n; i++)
+            {
+               rp[i] -= A0[i] * u0[i];
+            }
+            break;
+      }
+   }
+
+   if (weight != 1.0)
+   {
+      for (i = 0; i < n; i++)
+      {
+         op[i] = weight * (rp[i] / Adiag[i]) + weightc * center[i];
+      }
+   }
+   else
+   {
+      for (i = 0; i < n; i++)
+      {
+         op[i] = rp[i] / Adiag[i];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Does num_steps (half-)sweeps on the tile [tlo, thi] of box i and writes the
+ * result into x.  The previous iterate is the work vector (or zero if
+ * zero_guess), whose ghost layer must be current.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_TemporalRelaxTile( hypre_TemporalRelaxData  *relax_data,
+                         HYPRE_Int                 box_id,
+                         hypre_Index               tlo,
+                         hypre_Index               thi,
+                         HYPRE_Int                 num_steps,
+                         HYPRE_Int                 rb,
+                         HYPRE_Int                 zero_guess,
+                         hypre_StructVector       *x,
+                         HYPRE_Real               *work,
+                         HYPRE_Real              **rows )
+{
+   hypre_StructMatrix   *Ad            = (relax_data -> A);
+   hypre_StructVector   *bd            = (relax_data -> b);
+   hypre_StructVector   *xd            = (relax_data -> x);
+   hypre_IndexRef        reach         = (relax_data -> reach);
+   HYPRE_Int             ndim          = hypre_StructMatrixNDim(Ad);
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(Ad);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int             num_planes    = 2 * hypre_IndexD(reach, 2) + 1;
+
+   hypre_Box            *A_dbox        = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(Ad), box_id);
+   hypre_Box            *b_dbox        = hypre_BoxArrayBox(hypre_StructVectorDataSpace(bd), box_id);
+   hypre_Box            *xd_dbox       = hypre_BoxArrayBox(hypre_StructVectorDataSpace(xd), box_id);
+   hypre_Box            *x_dbox        = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), box_id);
+   HYPRE_Real           *bp            = hypre_StructVectorBoxData(bd, box_id);
+   HYPRE_Real           *xdp           = hypre_StructVectorBoxData(xd, box_id);
+   HYPRE_Real           *xp            = hypre_StructVectorBoxData(x, box_id);
+
+   HYPRE_Real          **Arow          = rows;
+   HYPRE_Real          **urow          = rows + stencil_size;
+   HYPRE_Real           *level[2 * hypre_TEMPORAL_MAX_SWEEPS + 1];
+   hypre_Index           lo[2 * hypre_TEMPORAL_MAX_SWEEPS + 1];
+   hypre_Index           size[2 * hypre_TEMPORAL_MAX_SWEEPS + 1];
+   HYPRE_Real           *rp, *zero, *op;
+   hypre_Index           index;
+
+   HYPRE_Int             num_times, t, tt, h, k, j, z, s, d;
+   HYPRE_Int             Ai, bi, plane, color, first;
+
+   /* region of (half-)sweep h: the tile grown by (num_steps - h) * reach */
+   rp = work;
+   for (h = 0; h <= num_steps; h++)
+   {
+      for (d = 0; d < 3; d++)
+      {
+         hypre_IndexD(lo[h], d)   = hypre_IndexD(tlo, d) -
+                                    (num_steps - h) * hypre_IndexD(reach, d);
+         hypre_IndexD(size[h], d) = hypre_IndexD(thi, d) - hypre_IndexD(tlo, d) + 1 +
+                                    2 * (num_steps - h) * hypre_IndexD(reach, d);
+      }
+      if (h > 0 && h < num_steps)
+      {
+         level[h] = rp;
+         rp += hypre_IndexD(size[h], 0) * hypre_IndexD(size[h], 1) * num_planes;
+      }
+   }
+   zero = rp + hypre_IndexD(size[0], 0);
+   if (zero_guess)
+   {
+      for (j = 0; j < hypre_IndexD(size[0], 0) + 2 * hypre_IndexD(reach, 0); j++)
+      {
+         zero[j] = 0.0;
+      }
+   }
+
+   /* wavefront: (half-)sweep h trails h-1 by 2*reach planes */
+   num_times = hypre_IndexD(size[1], 2) + 2 * hypre_IndexD(reach, 2) * (num_steps - 1);
+   for (t = 0; t < num_times; t++)
+   {
+      for (h = 1; h <= num_steps; h++)
+      {
+         tt = t - 2 * hypre_IndexD(reach, 2) * (h - 1);
+         if (tt < 0 || tt >= hypre_IndexD(size[h], 2))
+         {
+            continue;
+         }
+         z     = hypre_IndexD(lo[h], 2) + tt;
+         color = (rb + h - 1) % 2;
+
+         for (j = hypre_IndexD(lo[h], 1);
+              j < hypre_IndexD(lo[h], 1) + hypre_IndexD(size[h], 1); j++)
+         {
+            hypre_SetIndex3(index, hypre_IndexD(lo[h], 0), j, z);
+            Ai = hypre_BoxIndexRank(A_dbox, index);
+            bi = hypre_BoxIndexRank(b_dbox, index);
+
+            for (s = 0; s < stencil_size; s++)
+            {
+               Arow[s] = hypre_StructMatrixBoxData(Ad, box_id, s) + Ai;
+
+               k = h - 1;
+               if (k == 0 && zero_guess)
+               {
+                  urow[s] = zero + hypre_IndexD(reach, 0) +
+                            hypre_IndexD(stencil_shape[s], 0);
+               }
+               else if (k == 0)
+               {
+                  urow[s] = xdp + hypre_BoxIndexRank(xd_dbox, index) +
+                            hypre_BoxOffsetDistance(xd_dbox, stencil_shape[s]);
+               }
+               else
+               {
+                  plane = (z + hypre_IndexD(stencil_shape[s], 2)) % num_planes;
+                  plane = (plane < 0) ? plane + num_planes : plane;
+                  urow[s] = level[k] +
+                            (plane * hypre_IndexD(size[k], 1) +
+                             j + hypre_IndexD(stencil_shape[s], 1) - hypre_IndexD(lo[k], 1)) *
+                            hypre_IndexD(size[k], 0) +
+                            hypre_IndexD(lo[h], 0) + hypre_IndexD(stencil_shape[s], 0) -
+                            hypre_IndexD(lo[k], 0);
+               }
+            }
+
+            if (h == num_steps)
+            {
+               op = xp + hypre_BoxIndexRank(x_dbox, index);
+            }
+            else
+            {
+               plane = z % num_planes;
+               plane = (plane < 0) ? plane + num_planes : plane;
+               op = level[h] + (plane * hypre_IndexD(size[h], 1) + j - hypre_IndexD(lo[h], 1)) *
+                    hypre_IndexD(size[h], 0);
+            }
+
+            /* red/black: is the first point of the row relaxed? */
+            first = color;
+            for (d = 0; d < ndim; d++)
+            {
+               first += hypre_IndexD(index, d);
+            }
+            first = hypre_abs(first) % 2;
+
+            hypre_TemporalRelaxRow(relax_data, hypre_IndexD(size[h], 0), first,
+                                   Arow, urow, bp + bi, op, rp);
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelax( void               *relax_vdata,
+                     hypre_StructMatrix *A,
+                     hypre_StructVector *b,
+                     hypre_StructVector *x )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   HYPRE_Int             max_iter     = (relax_data -> max_iter);
+   HYPRE_Int             zero_guess   = (relax_data -> zero_guess);
+   HYPRE_Int             num_sweeps   = (relax_data -> num_sweeps);
+   HYPRE_Int             steps        = (relax_data -> relax_type == 1) ? 2 : 1;
+   hypre_CommPkg        *b_comm_pkg   = (relax_data -> b_comm_pkg);
+   hypre_CommPkg        *x_comm_pkg   = (relax_data -> x_comm_pkg);
+   hypre_StructVector   *bd           = (relax_data -> b);
+   hypre_StructVector   *xd           = (relax_data -> x);
+   HYPRE_Int             work_size    = (relax_data -> work_size);
+   HYPRE_Int             ndim         = hypre_StructVectorNDim(x);
+   HYPRE_Int             stencil_size = hypre_StructStencilSize(
+                                           hypre_StructMatrixStencil(relax_data -> A));
+   hypre_BoxArray       *boxes        = hypre_StructGridBoxes(hypre_StructVectorGrid(x));
+
+   hypre_CommHandle     *b_handle;
+   hypre_CommHandle     *x_handle = NULL;
+   hypre_Box            *box;
+   hypre_Index           tile, num_tiles;
+   HYPRE_Int             iter, nsweeps, i, t, d;
+
+   hypre_BeginTiming(relax_data -> time_index);
+
+   (relax_data -> num_iterations) = 0;
+
+   /* if max_iter is zero, return */
+   if (max_iter == 0)
+   {
+      /* if using a zero initial guess, return zero */
+      if (zero_guess)
+      {
+         hypre_StructVectorSetConstantValues(x, 0.0);
+      }
+
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
+   /* right-hand side with the deep ghost layer, for all sweeps */
+   hypre_StructCopy(b, bd);
+   hypre_InitializeCommunication(b_comm_pkg, hypre_StructVectorData(bd),
+                                 hypre_StructVectorData(bd), 0, 0, &b_handle);
+
+   for (iter = 0; iter < max_iter; iter += nsweeps)
+   {
+      nsweeps = hypre_min(num_sweeps, max_iter - iter);
+
+      if (!zero_guess)
+      {
+         hypre_StructCopy(x, xd);
+         hypre_InitializeCommunication(x_comm_pkg, hypre_StructVectorData(xd),
+                                       hypre_StructVectorData(xd), 0, 1, &x_handle);
+      }
+      if (b_handle)
+      {
+         hypre_FinalizeCommunication(b_handle);
+         b_handle = NULL;
+      }
+      if (x_handle)
+      {
+         hypre_FinalizeCommunication(x_handle);
+         x_handle = NULL;
+      }
+
+      hypre_ForBoxI(i, boxes)
+      {
+         box = hypre_BoxArrayBox(boxes, i);
+         if (hypre_BoxVolume(box) == 0)
+         {
+            continue;
+         }
+
+         hypre_SetIndex3(tile, 1, 1, 1);
+         hypre_SetIndex3(num_tiles, 1, 1, 1);
+         for (d = 0; d < ndim; d++)
+         {
+            hypre_IndexD(tile, d) = hypre_BoxSizeD(box, d);
+            if (hypre_IndexD(relax_data -> tile_size, d) > 0)
+            {
+               hypre_IndexD(tile, d) = hypre_min(hypre_IndexD(tile, d),
+                                                 hypre_IndexD(relax_data -> tile_size, d));
+            }
+            hypre_IndexD(num_tiles, d) = (hypre_BoxSizeD(box, d) + hypre_IndexD(tile, d) - 1) /
+                                         hypre_IndexD(tile, d);
+         }
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(t, d) HYPRE_SMP_SCHEDULE
+#endif
+         for (t = 0; t < hypre_IndexD(num_tiles, 0) * hypre_IndexD(num_tiles, 1) *
+              hypre_IndexD(num_tiles, 2); t++)
+         {
+            HYPRE_Int    tid = hypre_GetThreadNum();
+            HYPRE_Int    tt  = t;
+            hypre_Index  tlo, thi;
+
+            hypre_SetIndex3(tlo, 0, 0, 0);
+            hypre_SetIndex3(thi, 0, 0, 0);
+            for (d = 0; d < ndim; d++)
+            {
+               hypre_IndexD(tlo, d) = hypre_BoxIMinD(box, d) +
+                                      (tt % hypre_IndexD(num_tiles, d)) * hypre_IndexD(tile, d);
+               hypre_IndexD(thi, d) = hypre_min(hypre_IndexD(tlo, d) + hypre_IndexD(tile, d) - 1,
+                                                hypre_BoxIMaxD(box, d));
+               tt /= hypre_IndexD(num_tiles, d);
+            }
+
+            hypre_TemporalRelaxTile(relax_data, i, tlo, thi, nsweeps * steps,
+                                    (relax_data -> rb_start), zero_guess, x,
+                                    (relax_data -> work) + tid * work_size,
+                                    (relax_data -> rows) + tid * 2 * stencil_size);
+         }
+      }
+
+      zero_guess = 0;
+   }
+
+   (relax_data -> num_iterations) = max_iter;
+
+   hypre_EndTiming(relax_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetType( void      *relax_vdata,
+                            HYPRE_Int  relax_type )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> relax_type) = relax_type;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetWeight( void       *relax_vdata,
+                              HYPRE_Real  weight )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> weight) = weight;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetNumSweeps( void      *relax_vdata,
+                                 HYPRE_Int  num_sweeps )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> num_sweeps) = hypre_max(1, hypre_min(num_sweeps, hypre_TEMPORAL_MAX_SWEEPS));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetTileSize( void        *relax_vdata,
+                                hypre_Index  tile_size )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   hypre_CopyIndex(tile_size, relax_data -> tile_size);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetMaxIter( void      *relax_vdata,
+                               HYPRE_Int  max_iter )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetZeroGuess( void      *relax_vdata,
+                                 HYPRE_Int  zero_guess )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> zero_guess) = zero_guess;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetStartRed( void *relax_vdata )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> rb_start) = 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetStartBlack( void *relax_vdata )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> rb_start) = 0;
+
+   return hypre_error_flag;
+}
@@ -378,6 +378,17 @@ HYPRE_Int  HYPRE_StructMatrixSetConstantEntries( HYPRE_StructMatrix  matrix,
    return hypre_StructMatrixSetConstantEntries( matrix, nentries, entries );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixSetCoeffGenerator( HYPRE_StructMatrix          matrix,
+                                     HYPRE_StructMatrixCoeffFcn  fcn,
+                                     void                       *data )
+{
+   return ( hypre_StructMatrixSetCoeffGenerator(matrix, fcn, data) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -409,6 +420,32 @@ HYPRE_StructMatrixRead( MPI_Comm             comm,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixPrintBinary( const char         *filename,
+                               HYPRE_StructMatrix  matrix )
+{
+   return ( hypre_StructMatrixPrintBinary(filename, matrix) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixReadBinary( const char         *filename,
+                              HYPRE_StructMatrix  matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_StructMatrixReadBinary(filename, matrix) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
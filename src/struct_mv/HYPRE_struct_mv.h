@@ -343,6 +343,39 @@ HYPRE_Int HYPRE_StructMatrixSetConstantEntries( HYPRE_StructMatrix matrix,
                                                 HYPRE_Int          nentries,
                                                 HYPRE_Int         *entries );
 
+/**
+ * The coefficient generator function type (see
+ * \ref HYPRE_StructMatrixSetCoeffGenerator).  It computes the coefficients of
+ * all stencil entries at the indexes in the box [\e ilower, \e iupper] and
+ * stores them in \e values, ordered as in \ref HYPRE_StructMatrixSetBoxValues
+ * with the stencil entries in stencil order.
+ **/
+typedef HYPRE_Int (*HYPRE_StructMatrixCoeffFcn)(void          *data,
+                                                HYPRE_Int     *ilower,
+                                                HYPRE_Int     *iupper,
+                                                HYPRE_Complex *values);
+
+/**
+ * Compute the matrix coefficients on the fly with the function \e fcn instead
+ * of storing them.  The function is called with \e data as its first argument,
+ * typically for one row of grid points at a time, and may be called
+ * concurrently from several threads.  This must be called before
+ * \ref HYPRE_StructMatrixInitialize, and no coefficients are stored (the
+ * functions that set or get values return an error).
+ *
+ * Presently supported by \ref HYPRE_StructMatrixMatvec (and so by the Krylov
+ * solvers without a preconditioner), Jacobi, and PFMG, on the host only.
+ * Symmetric storage and constant entries are not supported.
+ *
+ * PFMG builds its interpolation and coarse operators from a stored copy of
+ * the coefficients, so the peak memory of its setup is not reduced.  The copy
+ * is freed at the end of setup (red/black relaxation keeps one), so only the
+ * memory of the solve phase is reduced.
+ **/
+HYPRE_Int HYPRE_StructMatrixSetCoeffGenerator( HYPRE_StructMatrix          matrix,
+                                               HYPRE_StructMatrixCoeffFcn  fcn,
+                                               void                       *data );
+
 /**
  * Set the ghost layer in the matrix
  **/
@@ -365,6 +398,25 @@ HYPRE_Int HYPRE_StructMatrixRead( MPI_Comm             comm,
                                   HYPRE_Int           *num_ghost,
                                   HYPRE_StructMatrix  *matrix );
 
+/**
+ * Collectively write the matrix coefficients to a single binary file shared by
+ * all processes.  Each process writes its boxes at a precomputed offset, so
+ * this is meant for checkpointing large problems.
+ **/
+HYPRE_Int HYPRE_StructMatrixPrintBinary(const char         *filename,
+                                        HYPRE_StructMatrix  matrix);
+
+/**
+ * Read the coefficients of an initialized matrix from a file written by
+ * \ref HYPRE_StructMatrixPrintBinary.  The matrix must have the same stencil,
+ * symmetry and constant coefficient type, but its grid may be distributed
+ * differently.  The file is memory-mapped where possible, and each process only
+ * reads the data that intersects its boxes.  Call \ref HYPRE_StructMatrixAssemble
+ * afterwards.
+ **/
+HYPRE_Int HYPRE_StructMatrixReadBinary(const char         *filename,
+                                       HYPRE_StructMatrix  matrix);
+
 /**
  * Matvec operator.  This operation is \f$y = \alpha A x + \beta y\f$ .
  * Note that you can do a simple matrix-vector multiply by setting
@@ -534,6 +586,23 @@ HYPRE_Int HYPRE_StructVectorRead( MPI_Comm             comm,
                                   HYPRE_Int           *num_ghost,
                                   HYPRE_StructVector  *vector );
 
+/**
+ * Collectively write the vector values to a single binary file shared by all
+ * processes.  Each process writes its boxes at a precomputed offset, so this
+ * is meant for checkpointing large problems.
+ **/
+HYPRE_Int HYPRE_StructVectorPrintBinary(const char         *filename,
+                                        HYPRE_StructVector  vector);
+
+/**
+ * Read the values of an initialized vector from a file written by
+ * \ref HYPRE_StructVectorPrintBinary.  The grid may be distributed differently
+ * from the one that was written.  The file is memory-mapped where possible,
+ * and each process only reads the data that intersects its boxes.
+ **/
+HYPRE_Int HYPRE_StructVectorReadBinary(const char         *filename,
+                                       HYPRE_StructVector  vector);
+
 /**@}*/
 /**@}*/
 
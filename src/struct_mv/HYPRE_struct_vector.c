@@ -319,6 +319,32 @@ HYPRE_StructVectorRead( MPI_Comm             comm,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructVectorPrintBinary( const char         *filename,
+                               HYPRE_StructVector  vector )
+{
+   return ( hypre_StructVectorPrintBinary(filename, vector) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructVectorReadBinary( const char         *filename,
+                              HYPRE_StructVector  vector )
+{
+   if (!vector)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_StructVectorReadBinary(filename, vector) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_StructVectorSetNumGhost
  *--------------------------------------------------------------------------*/
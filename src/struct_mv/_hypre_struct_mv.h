@@ -1181,6 +1181,10 @@ typedef struct hypre_StructMatrix_struct
 
    hypre_CommPkg        *comm_pkg;                  /* Info on how to update ghost data */
 
+   HYPRE_StructMatrixCoeffFcn  coeff_fcn;           /* If set, coefficients are generated
+                                                       on the fly and no data is stored */
+   void                 *coeff_data;                /* Data passed to coeff_fcn */
+
    HYPRE_Int             ref_count;
 
 } hypre_StructMatrix;
@@ -1209,6 +1213,8 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixNumGhost(matrix)            ((matrix) -> num_ghost)
 #define hypre_StructMatrixGlobalSize(matrix)          ((matrix) -> global_size)
 #define hypre_StructMatrixCommPkg(matrix)             ((matrix) -> comm_pkg)
+#define hypre_StructMatrixCoeffFcn(matrix)            ((matrix) -> coeff_fcn)
+#define hypre_StructMatrixCoeffData(matrix)           ((matrix) -> coeff_data)
 #define hypre_StructMatrixRefCount(matrix)            ((matrix) -> ref_count)
 
 #define hypre_StructMatrixNDim(matrix) \
@@ -1533,6 +1539,8 @@ HYPRE_Int HYPRE_StructMatrixSetConstantEntries ( HYPRE_StructMatrix matrix, HYPR
                                                  HYPRE_Int *entries );
 HYPRE_Int HYPRE_StructMatrixPrint ( const char *filename, HYPRE_StructMatrix matrix,
                                     HYPRE_Int all );
+HYPRE_Int HYPRE_StructMatrixPrintBinary ( const char *filename, HYPRE_StructMatrix matrix );
+HYPRE_Int HYPRE_StructMatrixReadBinary ( const char *filename, HYPRE_StructMatrix matrix );
 HYPRE_Int HYPRE_StructMatrixMatvec ( HYPRE_Complex alpha, HYPRE_StructMatrix A,
                                      HYPRE_StructVector x, HYPRE_Complex beta, HYPRE_StructVector y );
 HYPRE_Int HYPRE_StructMatrixClearBoundary( HYPRE_StructMatrix matrix );
@@ -1568,6 +1576,8 @@ HYPRE_Int HYPRE_StructVectorPrint ( const char *filename, HYPRE_StructVector vec
                                     HYPRE_Int all );
 HYPRE_Int HYPRE_StructVectorRead ( MPI_Comm comm, const char *filename,
                                    HYPRE_Int *num_ghost, HYPRE_StructVector *vector );
+HYPRE_Int HYPRE_StructVectorPrintBinary ( const char *filename, HYPRE_StructVector vector );
+HYPRE_Int HYPRE_StructVectorReadBinary ( const char *filename, HYPRE_StructVector vector );
 HYPRE_Int HYPRE_StructVectorSetNumGhost ( HYPRE_StructVector vector, HYPRE_Int *num_ghost );
 HYPRE_Int HYPRE_StructVectorCopy ( HYPRE_StructVector x, HYPRE_StructVector y );
 HYPRE_Int HYPRE_StructVectorSetConstantValues ( HYPRE_StructVector vector, HYPRE_Complex values );
@@ -1609,6 +1619,15 @@ HYPRE_Int hypre_StructCopy ( hypre_StructVector *x, hypre_StructVector *y );
 HYPRE_Int hypre_StructPartialCopy ( hypre_StructVector *x, hypre_StructVector *y,
                                     hypre_BoxArrayArray *array_boxes );
 
+/* struct_fused.c */
+HYPRE_Int hypre_StructAxpby ( HYPRE_Complex alpha, hypre_StructVector *x, HYPRE_Complex beta,
+                              hypre_StructVector *y );
+HYPRE_Real hypre_StructAxpyInnerProd ( HYPRE_Complex alpha, hypre_StructVector *x,
+                                       hypre_StructVector *y, hypre_StructVector *z );
+HYPRE_Int hypre_StructAxpy2 ( HYPRE_Complex alpha, hypre_StructVector *x1, hypre_StructVector *y1,
+                              HYPRE_Complex beta, hypre_StructVector *x2, hypre_StructVector *y2,
+                              HYPRE_Real *result );
+
 /* struct_grid.c */
 HYPRE_Int hypre_StructGridCreate ( MPI_Comm comm, HYPRE_Int dim, hypre_StructGrid **grid_ptr );
 HYPRE_Int hypre_StructGridRef ( hypre_StructGrid *grid, hypre_StructGrid **grid_ref );
@@ -1633,6 +1652,17 @@ HYPRE_Int hypre_StructGridGetMaxBoxSize ( hypre_StructGrid *grid );
 HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
                                            HYPRE_MemoryLocation data_location );
 #endif
+/* struct_halo.c */
+HYPRE_Int hypre_StructHaloNumGhost ( hypre_StructStencil *stencil, HYPRE_Int depth,
+                                     HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructHaloMaxDepth ( hypre_StructGrid *grid, HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructHaloComputeBoxes ( hypre_StructGrid *grid, HYPRE_Int *num_ghost,
+                                         HYPRE_Int depth, HYPRE_Int step, hypre_BoxArrayArray **compute_boxes_ptr );
+HYPRE_Int hypre_StructHaloCommPkgCreate ( hypre_StructGrid *grid, HYPRE_Int *num_ghost,
+                                          hypre_BoxArray *data_space, HYPRE_Int num_values, hypre_CommPkg **comm_pkg_ptr );
+hypre_StructVector *hypre_StructHaloVectorCreate ( hypre_StructGrid *grid, HYPRE_Int *num_ghost );
+hypre_StructMatrix *hypre_StructHaloMatrixCreate ( hypre_StructMatrix *A, HYPRE_Int *num_ghost );
+
 /* struct_innerprod.c */
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x, hypre_StructVector *y );
 
@@ -1649,6 +1679,12 @@ HYPRE_Int hypre_ReadBoxArrayData ( FILE *file, hypre_BoxArray *box_array,
 HYPRE_Int hypre_ReadBoxArrayData_CC ( FILE *file, hypre_BoxArray *box_array,
                                       hypre_BoxArray *data_space, HYPRE_Int stencil_size, HYPRE_Int real_stencil_size,
                                       HYPRE_Int constant_coefficient, HYPRE_Int dim, HYPRE_Complex *data );
+HYPRE_Int hypre_WriteBoxArrayDataBinary ( MPI_Comm comm, const char *filename,
+                                          hypre_BoxArray *box_array, HYPRE_Int num_values, HYPRE_Int num_info, hypre_uint64 *info,
+                                          HYPRE_Int num_const, HYPRE_Complex *const_data, HYPRE_Complex *data );
+HYPRE_Int hypre_ReadBoxArrayDataBinary ( const char *filename, hypre_BoxArray *box_array,
+                                         HYPRE_Int num_values, HYPRE_Int num_info, hypre_uint64 *info, HYPRE_Int num_const,
+                                         HYPRE_Complex *const_data, HYPRE_Complex *data );
 
 /* struct_matrix.c */
 HYPRE_Complex *hypre_StructMatrixExtractPointerByIndex ( hypre_StructMatrix *matrix, HYPRE_Int b,
@@ -1680,6 +1716,12 @@ HYPRE_Int hypre_StructMatrixSetConstantCoefficient ( hypre_StructMatrix *matrix,
                                                      HYPRE_Int constant_coefficient );
 HYPRE_Int hypre_StructMatrixSetConstantEntries ( hypre_StructMatrix *matrix, HYPRE_Int nentries,
                                                  HYPRE_Int *entries );
+HYPRE_Int hypre_StructMatrixSetCoeffGenerator ( hypre_StructMatrix *matrix,
+                                                HYPRE_StructMatrixCoeffFcn fcn, void *data );
+HYPRE_Int hypre_StructMatrixGenerateRow ( hypre_StructMatrix *matrix, hypre_IndexRef start,
+                                          hypre_IndexRef stride, hypre_Index loop_size, HYPRE_Int row, hypre_Index index,
+                                          HYPRE_Complex *values );
+hypre_StructMatrix *hypre_StructMatrixGenerateCopy ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixClearGhostValues ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixPrintData ( FILE *file, hypre_StructMatrix *matrix, HYPRE_Int all );
 HYPRE_Int hypre_StructMatrixReadData ( FILE *file, hypre_StructMatrix *matrix );
@@ -1687,6 +1729,8 @@ HYPRE_Int hypre_StructMatrixPrint ( const char *filename, hypre_StructMatrix *ma
                                     HYPRE_Int all );
 hypre_StructMatrix *hypre_StructMatrixRead ( MPI_Comm comm, const char *filename,
                                              HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructMatrixPrintBinary ( const char *filename, hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixReadBinary ( const char *filename, hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixMigrate ( hypre_StructMatrix *from_matrix,
                                       hypre_StructMatrix *to_matrix );
 HYPRE_Int hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix);
@@ -1707,10 +1751,22 @@ HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hy
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecGen ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
+                                  hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                HYPRE_Complex beta, hypre_StructVector *y );
 
+/* struct_matvec_powers.c */
+void *hypre_StructMatvecPowersCreate ( void );
+HYPRE_Int hypre_StructMatvecPowersDestroy ( void *powers_vdata );
+HYPRE_Int hypre_StructMatvecPowersSetup ( void *powers_vdata, hypre_StructMatrix *A,
+                                          HYPRE_Int num_powers, HYPRE_Int depth );
+HYPRE_Int hypre_StructMatvecPowersCompute ( void *powers_vdata, hypre_StructVector *x,
+                                            hypre_StructVector **y );
+HYPRE_Int hypre_StructMatvecPowers ( hypre_StructMatrix *A, hypre_StructVector *x,
+                                     HYPRE_Int num_powers, hypre_StructVector **y );
+
 /* struct_scale.c */
 HYPRE_Int hypre_StructScale ( HYPRE_Complex alpha, hypre_StructVector *y );
 
@@ -1724,6 +1780,11 @@ HYPRE_Int hypre_StructStencilElementRank ( hypre_StructStencil *stencil,
 HYPRE_Int hypre_StructStencilSymmetrize ( hypre_StructStencil *stencil,
                                           hypre_StructStencil **symm_stencil_ptr, HYPRE_Int **symm_elements_ptr );
 
+/* struct_tile.c */
+HYPRE_Int hypre_StructTileGetSize ( HYPRE_Int ndim, hypre_Index loop_size, hypre_Index tile_size );
+HYPRE_Int hypre_StructTileTune ( hypre_StructMatrix *A, hypre_BoxArrayArray *compute_box_aa,
+                                 hypre_IndexRef stride );
+
 /* struct_vector.c */
 hypre_StructVector *hypre_StructVectorCreate ( MPI_Comm comm, hypre_StructGrid *grid );
 hypre_StructVector *hypre_StructVectorRef ( hypre_StructVector *vector );
@@ -1760,6 +1821,8 @@ HYPRE_Int hypre_StructVectorPrint ( const char *filename, hypre_StructVector *ve
                                     HYPRE_Int all );
 hypre_StructVector *hypre_StructVectorRead ( MPI_Comm comm, const char *filename,
                                              HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructVectorPrintBinary ( const char *filename, hypre_StructVector *vector );
+HYPRE_Int hypre_StructVectorReadBinary ( const char *filename, hypre_StructVector *vector );
 hypre_StructVector *hypre_StructVectorClone ( hypre_StructVector *vector );
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -2541,6 +2604,132 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
    }                                                                          \
 }
 
+/*--------------------------------------------------------------------------
+ * Tiled BoxLoop macros:
+ *
+ * The loop is cut into tiles of size tile_size (in i/j/k) and the tiles are
+ * distributed over the threads.  Each tile is walked in lexicographic order,
+ * so with suitably sized tiles a thread keeps the neighboring planes of a
+ * stencil in cache.  Entries of tile_size that are not positive or exceed
+ * loop_size mean no tiling in that direction.  hypre_BoxLoopGetIndex is not
+ * supported in tiled loops.  See hypre_StructTileGetSize().
+ *--------------------------------------------------------------------------*/
+
+#define zypre_TiledBoxLoopDeclare() \
+HYPRE_Int  hypre__tile, hypre__num_tiles, hypre__d;\
+HYPRE_Int  hypre__n[3], hypre__tn[3], hypre__nt[3]
+
+#define zypre_TiledBoxLoopDeclareK(k) \
+HYPRE_Int  hypre__ikstart##k, hypre__sk##k[3]
+
+#define zypre_TiledBoxLoopInit(ndim, loop_size, tile_size) \
+hypre__num_tiles = 1;\
+for (hypre__d = 0; hypre__d < 3; hypre__d++)\
+{\
+   hypre__n[hypre__d]  = (hypre__d < (ndim)) ? loop_size[hypre__d] : 1;\
+   hypre__tn[hypre__d] = hypre__n[hypre__d];\
+   if (hypre__d < (ndim) && tile_size[hypre__d] > 0 &&\
+       tile_size[hypre__d] < hypre__n[hypre__d])\
+   {\
+      hypre__tn[hypre__d] = tile_size[hypre__d];\
+   }\
+   hypre__nt[hypre__d] = (hypre__tn[hypre__d] > 0) ?\
+      (hypre__n[hypre__d] + hypre__tn[hypre__d] - 1) / hypre__tn[hypre__d] : 0;\
+   hypre__num_tiles *= hypre__nt[hypre__d];\
+}
+
+#define zypre_TiledBoxLoopInitK(ndim, k, dboxk, startk, stridek) \
+hypre__sk##k[0] = stridek[0];\
+hypre__sk##k[1] = ((ndim) > 1) ? hypre_BoxSizeD(dboxk, 0) * stridek[1] : 0;\
+hypre__sk##k[2] = ((ndim) > 2) ?\
+   hypre_BoxSizeD(dboxk, 0) * hypre_BoxSizeD(dboxk, 1) * stridek[2] : 0;\
+hypre__ikstart##k = hypre_BoxIndexRank(dboxk, startk)
+
+#define zypre_TiledBoxLoopSet() \
+hypre__lo[0] = (hypre__tile % hypre__nt[0]) * hypre__tn[0];\
+hypre__lo[1] = ((hypre__tile / hypre__nt[0]) % hypre__nt[1]) * hypre__tn[1];\
+hypre__lo[2] = (hypre__tile / (hypre__nt[0] * hypre__nt[1])) * hypre__tn[2];\
+hypre__hi[0] = hypre_min(hypre__lo[0] + hypre__tn[0], hypre__n[0]);\
+hypre__hi[1] = hypre_min(hypre__lo[1] + hypre__tn[1], hypre__n[1]);\
+hypre__hi[2] = hypre_min(hypre__lo[2] + hypre__tn[2], hypre__n[2])
+
+#define zypre_TiledBoxLoopSetK(k, ik) \
+ik = hypre__ikstart##k + hypre__lo[0] * hypre__sk##k[0] +\
+     hypre__J * hypre__sk##k[1] + hypre__K * hypre__sk##k[2]
+
+#define zypre_TiledBoxLoop2Begin(ndim, loop_size, tile_size,                  \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2)                  \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopDeclareK(2);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, tile_size);                        \
+   zypre_TiledBoxLoopInitK(ndim, 1, dbox1, start1, stride1);                  \
+   zypre_TiledBoxLoopInitK(ndim, 2, dbox2, start2, stride2);                  \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int hypre__lo[3], hypre__hi[3], hypre__I, hypre__J, hypre__K;     \
+      HYPRE_Int i1, i2;                                                       \
+      zypre_TiledBoxLoopSet();                                                \
+      for (hypre__K = hypre__lo[2]; hypre__K < hypre__hi[2]; hypre__K++)      \
+      {                                                                       \
+         for (hypre__J = hypre__lo[1]; hypre__J < hypre__hi[1]; hypre__J++)   \
+         {                                                                    \
+            zypre_TiledBoxLoopSetK(1, i1);                                    \
+            zypre_TiledBoxLoopSetK(2, i2);                                    \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++)\
+            {
+
+#define zypre_TiledBoxLoop2End(i1, i2)                                        \
+               i1 += hypre__sk1[0];                                           \
+               i2 += hypre__sk2[0];                                           \
+            }                                                                 \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_TiledBoxLoop3Begin(ndim, loop_size, tile_size,                  \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2,                  \
+                                 dbox3, start3, stride3, i3)                  \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopDeclareK(2);                                             \
+   zypre_TiledBoxLoopDeclareK(3);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, tile_size);                        \
+   zypre_TiledBoxLoopInitK(ndim, 1, dbox1, start1, stride1);                  \
+   zypre_TiledBoxLoopInitK(ndim, 2, dbox2, start2, stride2);                  \
+   zypre_TiledBoxLoopInitK(ndim, 3, dbox3, start3, stride3);                  \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int hypre__lo[3], hypre__hi[3], hypre__I, hypre__J, hypre__K;     \
+      HYPRE_Int i1, i2, i3;                                                   \
+      zypre_TiledBoxLoopSet();                                                \
+      for (hypre__K = hypre__lo[2]; hypre__K < hypre__hi[2]; hypre__K++)      \
+      {                                                                       \
+         for (hypre__J = hypre__lo[1]; hypre__J < hypre__hi[1]; hypre__J++)   \
+         {                                                                    \
+            zypre_TiledBoxLoopSetK(1, i1);                                    \
+            zypre_TiledBoxLoopSetK(2, i2);                                    \
+            zypre_TiledBoxLoopSetK(3, i3);                                    \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++)\
+            {
+
+#define zypre_TiledBoxLoop3End(i1, i2, i3)                                    \
+               i1 += hypre__sk1[0];                                           \
+               i2 += hypre__sk2[0];                                           \
+               i3 += hypre__sk3[0];                                           \
+            }                                                                 \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
 #define zypre_BasicBoxLoop1Begin(ndim, loop_size,                             \
                                  stride1, i1)                                 \
 {                                                                             \
@@ -2699,6 +2888,10 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
 #define hypre_BoxLoop1ReductionEndHost     zypre_BoxLoop1ReductionEnd
 #define hypre_BoxLoop2ReductionBeginHost   zypre_BoxLoop2ReductionBegin
 #define hypre_BoxLoop2ReductionEndHost     zypre_BoxLoop2ReductionEnd
+#define hypre_TiledBoxLoop2BeginHost       zypre_TiledBoxLoop2Begin
+#define hypre_TiledBoxLoop2EndHost         zypre_TiledBoxLoop2End
+#define hypre_TiledBoxLoop3BeginHost       zypre_TiledBoxLoop3Begin
+#define hypre_TiledBoxLoop3EndHost         zypre_TiledBoxLoop3End
 
 //TODO TEMP FIX
 #if !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_HIP) && !defined(HYPRE_USING_DEVICE_OPENMP) && !defined(HYPRE_USING_SYCL)
@@ -2722,6 +2915,26 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
 #define hypre_BoxLoop1ReductionEnd     hypre_BoxLoop1ReductionEndHost
 #define hypre_BoxLoop2ReductionBegin   hypre_BoxLoop2ReductionBeginHost
 #define hypre_BoxLoop2ReductionEnd     hypre_BoxLoop2ReductionEndHost
+#define hypre_TiledBoxLoop2Begin       hypre_TiledBoxLoop2BeginHost
+#define hypre_TiledBoxLoop2End         hypre_TiledBoxLoop2EndHost
+#define hypre_TiledBoxLoop3Begin       hypre_TiledBoxLoop3BeginHost
+#define hypre_TiledBoxLoop3End         hypre_TiledBoxLoop3EndHost
+#else
+/* device BoxLoops have their own decomposition; tile sizes are ignored */
+#define hypre_TiledBoxLoop2Begin(ndim, loop_size, tile_size,                  \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2)                  \
+        hypre_BoxLoop2Begin(ndim, loop_size, dbox1, start1, stride1, i1,      \
+                                             dbox2, start2, stride2, i2)
+#define hypre_TiledBoxLoop2End         hypre_BoxLoop2End
+#define hypre_TiledBoxLoop3Begin(ndim, loop_size, tile_size,                  \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2,                  \
+                                 dbox3, start3, stride3, i3)                  \
+        hypre_BoxLoop3Begin(ndim, loop_size, dbox1, start1, stride1, i1,      \
+                                             dbox2, start2, stride2, i2,      \
+                                             dbox3, start3, stride3, i3)
+#define hypre_TiledBoxLoop3End         hypre_BoxLoop3End
 #endif
 
 #endif /* #ifndef HYPRE_BOXLOOP_HOST_HEADER */
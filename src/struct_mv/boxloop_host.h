@@ -208,6 +208,132 @@
    }                                                                          \
 }
 
+/*--------------------------------------------------------------------------
+ * Tiled BoxLoop macros:
+ *
+ * The loop is cut into tiles of size tile_size (in i/j/k) and the tiles are
+ * distributed over the threads.  Each tile is walked in lexicographic order,
+ * so with suitably sized tiles a thread keeps the neighboring planes of a
+ * stencil in cache.  Entries of tile_size that are not positive or exceed
+ * loop_size mean no tiling in that direction.  hypre_BoxLoopGetIndex is not
+ * supported in tiled loops.  See hypre_StructTileGetSize().
+ *--------------------------------------------------------------------------*/
+
+#define zypre_TiledBoxLoopDeclare() \
+HYPRE_Int  hypre__tile, hypre__num_tiles, hypre__d;\
+HYPRE_Int  hypre__n[3], hypre__tn[3], hypre__nt[3]
+
+#define zypre_TiledBoxLoopDeclareK(k) \
+HYPRE_Int  hypre__ikstart##k, hypre__sk##k[3]
+
+#define zypre_TiledBoxLoopInit(ndim, loop_size, tile_size) \
+hypre__num_tiles = 1;\
+for (hypre__d = 0; hypre__d < 3; hypre__d++)\
+{\
+   hypre__n[hypre__d]  = (hypre__d < (ndim)) ? loop_size[hypre__d] : 1;\
+   hypre__tn[hypre__d] = hypre__n[hypre__d];\
+   if (hypre__d < (ndim) && tile_size[hypre__d] > 0 &&\
+       tile_size[hypre__d] < hypre__n[hypre__d])\
+   {\
+      hypre__tn[hypre__d] = tile_size[hypre__d];\
+   }\
+   hypre__nt[hypre__d] = (hypre__tn[hypre__d] > 0) ?\
+      (hypre__n[hypre__d] + hypre__tn[hypre__d] - 1) / hypre__tn[hypre__d] : 0;\
+   hypre__num_tiles *= hypre__nt[hypre__d];\
+}
+
+#define zypre_TiledBoxLoopInitK(ndim, k, dboxk, startk, stridek) \
+hypre__sk##k[0] = stridek[0];\
+hypre__sk##k[1] = ((ndim) > 1) ? hypre_BoxSizeD(dboxk, 0) * stridek[1] : 0;\
+hypre__sk##k[2] = ((ndim) > 2) ?\
+   hypre_BoxSizeD(dboxk, 0) * hypre_BoxSizeD(dboxk, 1) * stridek[2] : 0;\
+hypre__ikstart##k = hypre_BoxIndexRank(dboxk, startk)
+
+#define zypre_TiledBoxLoopSet() \
+hypre__lo[0] = (hypre__tile % hypre__nt[0]) * hypre__tn[0];\
+hypre__lo[1] = ((hypre__tile / hypre__nt[0]) % hypre__nt[1]) * hypre__tn[1];\
+hypre__lo[2] = (hypre__tile / (hypre__nt[0] * hypre__nt[1])) * hypre__tn[2];\
+hypre__hi[0] = hypre_min(hypre__lo[0] + hypre__tn[0], hypre__n[0]);\
+hypre__hi[1] = hypre_min(hypre__lo[1] + hypre__tn[1], hypre__n[1]);\
+hypre__hi[2] = hypre_min(hypre__lo[2] + hypre__tn[2], hypre__n[2])
+
+#define zypre_TiledBoxLoopSetK(k, ik) \
+ik = hypre__ikstart##k + hypre__lo[0] * hypre__sk##k[0] +\
+     hypre__J * hypre__sk##k[1] + hypre__K * hypre__sk##k[2]
+
+#define zypre_TiledBoxLoop2Begin(ndim, loop_size, tile_size,                  \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2)                  \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopDeclareK(2);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, tile_size);                        \
+   zypre_TiledBoxLoopInitK(ndim, 1, dbox1, start1, stride1);                  \
+   zypre_TiledBoxLoopInitK(ndim, 2, dbox2, start2, stride2);                  \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int hypre__lo[3], hypre__hi[3], hypre__I, hypre__J, hypre__K;     \
+      HYPRE_Int i1, i2;                                                       \
+      zypre_TiledBoxLoopSet();                                                \
+      for (hypre__K = hypre__lo[2]; hypre__K < hypre__hi[2]; hypre__K++)      \
+      {                                                                       \
+         for (hypre__J = hypre__lo[1]; hypre__J < hypre__hi[1]; hypre__J++)   \
+         {                                                                    \
+            zypre_TiledBoxLoopSetK(1, i1);                                    \
+            zypre_TiledBoxLoopSetK(2, i2);                                    \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++)\
+            {
+
+#define zypre_TiledBoxLoop2End(i1, i2)                                        \
+               i1 += hypre__sk1[0];                                           \
+               i2 += hypre__sk2[0];                                           \
+            }                                                                 \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_TiledBoxLoop3Begin(ndim, loop_size, tile_size,                  \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2,                  \
+                                 dbox3, start3, stride3, i3)                  \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopDeclareK(2);                                             \
+   zypre_TiledBoxLoopDeclareK(3);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, tile_size);                        \
+   zypre_TiledBoxLoopInitK(ndim, 1, dbox1, start1, stride1);                  \
+   zypre_TiledBoxLoopInitK(ndim, 2, dbox2, start2, stride2);                  \
+   zypre_TiledBoxLoopInitK(ndim, 3, dbox3, start3, stride3);                  \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int hypre__lo[3], hypre__hi[3], hypre__I, hypre__J, hypre__K;     \
+      HYPRE_Int i1, i2, i3;                                                   \
+      zypre_TiledBoxLoopSet();                                                \
+      for (hypre__K = hypre__lo[2]; hypre__K < hypre__hi[2]; hypre__K++)      \
+      {                                                                       \
+         for (hypre__J = hypre__lo[1]; hypre__J < hypre__hi[1]; hypre__J++)   \
+         {                                                                    \
+            zypre_TiledBoxLoopSetK(1, i1);                                    \
+            zypre_TiledBoxLoopSetK(2, i2);                                    \
+            zypre_TiledBoxLoopSetK(3, i3);                                    \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++)\
+            {
+
+#define zypre_TiledBoxLoop3End(i1, i2, i3)                                    \
+               i1 += hypre__sk1[0];                                           \
+               i2 += hypre__sk2[0];                                           \
+               i3 += hypre__sk3[0];                                           \
+            }                                                                 \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
 #define zypre_BasicBoxLoop1Begin(ndim, loop_size,                             \
                                  stride1, i1)                                 \
 {                                                                             \
@@ -366,6 +492,10 @@
 #define hypre_BoxLoop1ReductionEndHost     zypre_BoxLoop1ReductionEnd
 #define hypre_BoxLoop2ReductionBeginHost   zypre_BoxLoop2ReductionBegin
 #define hypre_BoxLoop2ReductionEndHost     zypre_BoxLoop2ReductionEnd
+#define hypre_TiledBoxLoop2BeginHost       zypre_TiledBoxLoop2Begin
+#define hypre_TiledBoxLoop2EndHost         zypre_TiledBoxLoop2End
+#define hypre_TiledBoxLoop3BeginHost       zypre_TiledBoxLoop3Begin
+#define hypre_TiledBoxLoop3EndHost         zypre_TiledBoxLoop3End
 
 //TODO TEMP FIX
 #if !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_HIP) && !defined(HYPRE_USING_DEVICE_OPENMP) && !defined(HYPRE_USING_SYCL)
@@ -389,6 +519,26 @@
 #define hypre_BoxLoop1ReductionEnd     hypre_BoxLoop1ReductionEndHost
 #define hypre_BoxLoop2ReductionBegin   hypre_BoxLoop2ReductionBeginHost
 #define hypre_BoxLoop2ReductionEnd     hypre_BoxLoop2ReductionEndHost
+#define hypre_TiledBoxLoop2Begin       hypre_TiledBoxLoop2BeginHost
+#define hypre_TiledBoxLoop2End         hypre_TiledBoxLoop2EndHost
+#define hypre_TiledBoxLoop3Begin       hypre_TiledBoxLoop3BeginHost
+#define hypre_TiledBoxLoop3End         hypre_TiledBoxLoop3EndHost
+#else
+/* device BoxLoops have their own decomposition; tile sizes are ignored */
+#define hypre_TiledBoxLoop2Begin(ndim, loop_size, tile_size,                  \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2)                  \
+        hypre_BoxLoop2Begin(ndim, loop_size, dbox1, start1, stride1, i1,      \
+                                             dbox2, start2, stride2, i2)
+#define hypre_TiledBoxLoop2End         hypre_BoxLoop2End
+#define hypre_TiledBoxLoop3Begin(ndim, loop_size, tile_size,                  \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2,                  \
+                                 dbox3, start3, stride3, i3)                  \
+        hypre_BoxLoop3Begin(ndim, loop_size, dbox1, start1, stride1, i1,      \
+                                             dbox2, start2, stride2, i2,      \
+                                             dbox3, start3, stride3, i3)
+#define hypre_TiledBoxLoop3End         hypre_BoxLoop3End
 #endif
 
 #endif /* #ifndef HYPRE_BOXLOOP_HOST_HEADER */
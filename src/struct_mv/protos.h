@@ -224,6 +224,8 @@ HYPRE_Int HYPRE_StructMatrixSetConstantEntries ( HYPRE_StructMatrix matrix, HYPR
                                                  HYPRE_Int *entries );
 HYPRE_Int HYPRE_StructMatrixPrint ( const char *filename, HYPRE_StructMatrix matrix,
                                     HYPRE_Int all );
+HYPRE_Int HYPRE_StructMatrixPrintBinary ( const char *filename, HYPRE_StructMatrix matrix );
+HYPRE_Int HYPRE_StructMatrixReadBinary ( const char *filename, HYPRE_StructMatrix matrix );
 HYPRE_Int HYPRE_StructMatrixMatvec ( HYPRE_Complex alpha, HYPRE_StructMatrix A,
                                      HYPRE_StructVector x, HYPRE_Complex beta, HYPRE_StructVector y );
 HYPRE_Int HYPRE_StructMatrixClearBoundary( HYPRE_StructMatrix matrix );
@@ -259,6 +261,8 @@ HYPRE_Int HYPRE_StructVectorPrint ( const char *filename, HYPRE_StructVector vec
                                     HYPRE_Int all );
 HYPRE_Int HYPRE_StructVectorRead ( MPI_Comm comm, const char *filename,
                                    HYPRE_Int *num_ghost, HYPRE_StructVector *vector );
+HYPRE_Int HYPRE_StructVectorPrintBinary ( const char *filename, HYPRE_StructVector vector );
+HYPRE_Int HYPRE_StructVectorReadBinary ( const char *filename, HYPRE_StructVector vector );
 HYPRE_Int HYPRE_StructVectorSetNumGhost ( HYPRE_StructVector vector, HYPRE_Int *num_ghost );
 HYPRE_Int HYPRE_StructVectorCopy ( HYPRE_StructVector x, HYPRE_StructVector y );
 HYPRE_Int HYPRE_StructVectorSetConstantValues ( HYPRE_StructVector vector, HYPRE_Complex values );
@@ -300,6 +304,15 @@ HYPRE_Int hypre_StructCopy ( hypre_StructVector *x, hypre_StructVector *y );
 HYPRE_Int hypre_StructPartialCopy ( hypre_StructVector *x, hypre_StructVector *y,
                                     hypre_BoxArrayArray *array_boxes );
 
+/* struct_fused.c */
+HYPRE_Int hypre_StructAxpby ( HYPRE_Complex alpha, hypre_StructVector *x, HYPRE_Complex beta,
+                              hypre_StructVector *y );
+HYPRE_Real hypre_StructAxpyInnerProd ( HYPRE_Complex alpha, hypre_StructVector *x,
+                                       hypre_StructVector *y, hypre_StructVector *z );
+HYPRE_Int hypre_StructAxpy2 ( HYPRE_Complex alpha, hypre_StructVector *x1, hypre_StructVector *y1,
+                              HYPRE_Complex beta, hypre_StructVector *x2, hypre_StructVector *y2,
+                              HYPRE_Real *result );
+
 /* struct_grid.c */
 HYPRE_Int hypre_StructGridCreate ( MPI_Comm comm, HYPRE_Int dim, hypre_StructGrid **grid_ptr );
 HYPRE_Int hypre_StructGridRef ( hypre_StructGrid *grid, hypre_StructGrid **grid_ref );
@@ -324,6 +337,17 @@ HYPRE_Int hypre_StructGridGetMaxBoxSize ( hypre_StructGrid *grid );
 HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
                                            HYPRE_MemoryLocation data_location );
 #endif
+/* struct_halo.c */
+HYPRE_Int hypre_StructHaloNumGhost ( hypre_StructStencil *stencil, HYPRE_Int depth,
+                                     HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructHaloMaxDepth ( hypre_StructGrid *grid, HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructHaloComputeBoxes ( hypre_StructGrid *grid, HYPRE_Int *num_ghost,
+                                         HYPRE_Int depth, HYPRE_Int step, hypre_BoxArrayArray **compute_boxes_ptr );
+HYPRE_Int hypre_StructHaloCommPkgCreate ( hypre_StructGrid *grid, HYPRE_Int *num_ghost,
+                                          hypre_BoxArray *data_space, HYPRE_Int num_values, hypre_CommPkg **comm_pkg_ptr );
+hypre_StructVector *hypre_StructHaloVectorCreate ( hypre_StructGrid *grid, HYPRE_Int *num_ghost );
+hypre_StructMatrix *hypre_StructHaloMatrixCreate ( hypre_StructMatrix *A, HYPRE_Int *num_ghost );
+
 /* struct_innerprod.c */
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x, hypre_StructVector *y );
 
@@ -340,6 +364,12 @@ HYPRE_Int hypre_ReadBoxArrayData ( FILE *file, hypre_BoxArray *box_array,
 HYPRE_Int hypre_ReadBoxArrayData_CC ( FILE *file, hypre_BoxArray *box_array,
                                       hypre_BoxArray *data_space, HYPRE_Int stencil_size, HYPRE_Int real_stencil_size,
                                       HYPRE_Int constant_coefficient, HYPRE_Int dim, HYPRE_Complex *data );
+HYPRE_Int hypre_WriteBoxArrayDataBinary ( MPI_Comm comm, const char *filename,
+                                          hypre_BoxArray *box_array, HYPRE_Int num_values, HYPRE_Int num_info, hypre_uint64 *info,
+                                          HYPRE_Int num_const, HYPRE_Complex *const_data, HYPRE_Complex *data );
+HYPRE_Int hypre_ReadBoxArrayDataBinary ( const char *filename, hypre_BoxArray *box_array,
+                                         HYPRE_Int num_values, HYPRE_Int num_info, hypre_uint64 *info, HYPRE_Int num_const,
+                                         HYPRE_Complex *const_data, HYPRE_Complex *data );
 
 /* struct_matrix.c */
 HYPRE_Complex *hypre_StructMatrixExtractPointerByIndex ( hypre_StructMatrix *matrix, HYPRE_Int b,
@@ -371,6 +401,12 @@ HYPRE_Int hypre_StructMatrixSetConstantCoefficient ( hypre_StructMatrix *matrix,
                                                      HYPRE_Int constant_coefficient );
 HYPRE_Int hypre_StructMatrixSetConstantEntries ( hypre_StructMatrix *matrix, HYPRE_Int nentries,
                                                  HYPRE_Int *entries );
+HYPRE_Int hypre_StructMatrixSetCoeffGenerator ( hypre_StructMatrix *matrix,
+                                                HYPRE_StructMatrixCoeffFcn fcn, void *data );
+HYPRE_Int hypre_StructMatrixGenerateRow ( hypre_StructMatrix *matrix, hypre_IndexRef start,
+                                          hypre_IndexRef stride, hypre_Index loop_size, HYPRE_Int row, hypre_Index index,
+                                          HYPRE_Complex *values );
+hypre_StructMatrix *hypre_StructMatrixGenerateCopy ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixClearGhostValues ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixPrintData ( FILE *file, hypre_StructMatrix *matrix, HYPRE_Int all );
 HYPRE_Int hypre_StructMatrixReadData ( FILE *file, hypre_StructMatrix *matrix );
@@ -378,6 +414,8 @@ HYPRE_Int hypre_StructMatrixPrint ( const char *filename, hypre_StructMatrix *ma
                                     HYPRE_Int all );
 hypre_StructMatrix *hypre_StructMatrixRead ( MPI_Comm comm, const char *filename,
                                              HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructMatrixPrintBinary ( const char *filename, hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixReadBinary ( const char *filename, hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixMigrate ( hypre_StructMatrix *from_matrix,
                                       hypre_StructMatrix *to_matrix );
 HYPRE_Int hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix);
@@ -398,10 +436,22 @@ HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hy
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecGen ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
+                                  hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                HYPRE_Complex beta, hypre_StructVector *y );
 
+/* struct_matvec_powers.c */
+void *hypre_StructMatvecPowersCreate ( void );
+HYPRE_Int hypre_StructMatvecPowersDestroy ( void *powers_vdata );
+HYPRE_Int hypre_StructMatvecPowersSetup ( void *powers_vdata, hypre_StructMatrix *A,
+                                          HYPRE_Int num_powers, HYPRE_Int depth );
+HYPRE_Int hypre_StructMatvecPowersCompute ( void *powers_vdata, hypre_StructVector *x,
+                                            hypre_StructVector **y );
+HYPRE_Int hypre_StructMatvecPowers ( hypre_StructMatrix *A, hypre_StructVector *x,
+                                     HYPRE_Int num_powers, hypre_StructVector **y );
+
 /* struct_scale.c */
 HYPRE_Int hypre_StructScale ( HYPRE_Complex alpha, hypre_StructVector *y );
 
@@ -415,6 +465,11 @@ HYPRE_Int hypre_StructStencilElementRank ( hypre_StructStencil *stencil,
 HYPRE_Int hypre_StructStencilSymmetrize ( hypre_StructStencil *stencil,
                                           hypre_StructStencil **symm_stencil_ptr, HYPRE_Int **symm_elements_ptr );
 
+/* struct_tile.c */
+HYPRE_Int hypre_StructTileGetSize ( HYPRE_Int ndim, hypre_Index loop_size, hypre_Index tile_size );
+HYPRE_Int hypre_StructTileTune ( hypre_StructMatrix *A, hypre_BoxArrayArray *compute_box_aa,
+                                 hypre_IndexRef stride );
+
 /* struct_vector.c */
 hypre_StructVector *hypre_StructVectorCreate ( MPI_Comm comm, hypre_StructGrid *grid );
 hypre_StructVector *hypre_StructVectorRef ( hypre_StructVector *vector );
@@ -451,4 +506,6 @@ HYPRE_Int hypre_StructVectorPrint ( const char *filename, hypre_StructVector *ve
                                     HYPRE_Int all );
 hypre_StructVector *hypre_StructVectorRead ( MPI_Comm comm, const char *filename,
                                              HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructVectorPrintBinary ( const char *filename, hypre_StructVector *vector );
+HYPRE_Int hypre_StructVectorReadBinary ( const char *filename, hypre_StructVector *vector );
 hypre_StructVector *hypre_StructVectorClone ( hypre_StructVector *vector );
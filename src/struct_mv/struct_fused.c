@@ -0,0 +1,353 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Structured fused vector routines
+ *
+ * Each routine does in one pass over the grid what would otherwise take
+ * several calls of hypre_StructAxpy, hypre_StructScale and
+ * hypre_StructInnerProd.  The results are the same as those of the separate
+ * calls.  Vectors that are read at the same index must have the same data
+ * space; otherwise the separate routines are used.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_mv.h"
+#include "_hypre_struct_mv.hpp"
+
+/*--------------------------------------------------------------------------
+ * hypre_StructFusedSameDataSpace
+ *
+ * Returns 1 if x and y are laid out on the same data boxes.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_StructFusedSameDataSpace( hypre_StructVector *x,
+                                hypre_StructVector *y )
+{
+   HYPRE_Int        ndim         = hypre_StructVectorNDim(x);
+   hypre_BoxArray  *x_data_space = hypre_StructVectorDataSpace(x);
+   hypre_BoxArray  *y_data_space = hypre_StructVectorDataSpace(y);
+   hypre_Box       *x_data_box;
+   hypre_Box       *y_data_box;
+   HYPRE_Int        i;
+
+   if (hypre_BoxArraySize(x_data_space) != hypre_BoxArraySize(y_data_space))
+   {
+      return 0;
+   }
+
+   hypre_ForBoxI(i, x_data_space)
+   {
+      x_data_box = hypre_BoxArrayBox(x_data_space, i);
+      y_data_box = hypre_BoxArrayBox(y_data_space, i);
+      if (!hypre_IndexesEqual(hypre_BoxIMin(x_data_box), hypre_BoxIMin(y_data_box), ndim) ||
+          !hypre_IndexesEqual(hypre_BoxIMax(x_data_box), hypre_BoxIMax(y_data_box), ndim))
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructAxpby
+ *
+ * y = alpha*x + beta*y
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructAxpby( HYPRE_Complex       alpha,
+                   hypre_StructVector *x,
+                   HYPRE_Complex       beta,
+                   hypre_StructVector *y     )
+{
+   hypre_Box        *x_data_box;
+   hypre_Box        *y_data_box;
+
+   HYPRE_Complex    *xp;
+   HYPRE_Complex    *yp;
+
+   hypre_BoxArray   *boxes;
+   hypre_Box        *box;
+   hypre_Index       loop_size;
+   hypre_IndexRef    start;
+   hypre_Index       unit_stride;
+
+   HYPRE_Int         i;
+
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y));
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(yp,xp)
+      hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
+                          x_data_box, start, unit_stride, xi,
+                          y_data_box, start, unit_stride, yi);
+      {
+         yp[yi] = alpha * xp[xi] + beta * yp[yi];
+      }
+      hypre_BoxLoop2End(xi, yi);
+#undef DEVICE_VAR
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructAxpyInnerProd
+ *
+ * y = y + alpha*x, and returns <z,y> with the updated y (z may be y).  This
+ * is an axpy followed by hypre_StructInnerProd(z, y).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructAxpyInnerProd( HYPRE_Complex       alpha,
+                           hypre_StructVector *x,
+                           hypre_StructVector *y,
+                           hypre_StructVector *z )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   hypre_Box       *x_data_box;
+   hypre_Box       *y_data_box;
+
+   HYPRE_Complex   *xp;
+   HYPRE_Complex   *yp;
+   HYPRE_Complex   *zp;
+
+   hypre_BoxArray  *boxes;
+   hypre_Box       *box;
+   hypre_Index      loop_size;
+   hypre_IndexRef   start;
+   hypre_Index      unit_stride;
+
+   HYPRE_Int        ndim = hypre_StructVectorNDim(x);
+   HYPRE_Int        i;
+
+   HYPRE_Real       local_result = 0.0;
+
+   if (!hypre_StructFusedSameDataSpace(y, z))
+   {
+      hypre_StructAxpy(alpha, x, y);
+      return hypre_StructInnerProd(z, y);
+   }
+
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y));
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+      zp = hypre_StructVectorBoxData(z, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+#if defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_SYCL)
+      HYPRE_Real box_sum = 0.0;
+#elif defined(HYPRE_USING_RAJA)
+      ReduceSum<hypre_raja_reduce_policy, HYPRE_Real> box_sum(0.0);
+#elif defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+      ReduceSum<HYPRE_Real> box_sum(0.0);
+#else
+      HYPRE_Real box_sum = 0.0;
+#endif
+
+#ifdef HYPRE_BOX_REDUCTION
+#undef HYPRE_BOX_REDUCTION
+#endif
+
+#if defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_BOX_REDUCTION map(tofrom: box_sum) reduction(+:box_sum)
+#else
+#define HYPRE_BOX_REDUCTION reduction(+:box_sum)
+#endif
+
+#define DEVICE_VAR is_device_ptr(yp,xp,zp)
+      hypre_BoxLoop2ReductionBegin(ndim, loop_size,
+                                   x_data_box, start, unit_stride, xi,
+                                   y_data_box, start, unit_stride, yi,
+                                   box_sum)
+      {
+         yp[yi] += alpha * xp[xi];
+         HYPRE_Real tmp = zp[yi] * hypre_conj(yp[yi]);
+         box_sum += tmp;
+      }
+      hypre_BoxLoop2ReductionEnd(xi, yi, box_sum);
+#undef DEVICE_VAR
+#undef HYPRE_BOX_REDUCTION
+#define HYPRE_BOX_REDUCTION
+
+      local_result += (HYPRE_Real) box_sum;
+   }
+
+   process_result = (HYPRE_Real) local_result;
+
+   hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
+                       HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
+
+   hypre_IncFLOPCount(2 * hypre_StructVectorGlobalSize(x));
+
+   return final_innerprod_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructAxpy2
+ *
+ * y1 = y1 + alpha*x1 and y2 = y2 + beta*x2.  If result is not NULL, it is
+ * set to <y2,y2> with the updated y2.  This is the solution and residual
+ * update of CG, optionally with the residual norm.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructAxpy2( HYPRE_Complex       alpha,
+                   hypre_StructVector *x1,
+                   hypre_StructVector *y1,
+                   HYPRE_Complex       beta,
+                   hypre_StructVector *x2,
+                   hypre_StructVector *y2,
+                   HYPRE_Real         *result )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   hypre_Box       *y1_data_box;
+   hypre_Box       *y2_data_box;
+
+   HYPRE_Complex   *x1p, *y1p;
+   HYPRE_Complex   *x2p, *y2p;
+
+   hypre_BoxArray  *boxes;
+   hypre_Box       *box;
+   hypre_Index      loop_size;
+   hypre_IndexRef   start;
+   hypre_Index      unit_stride;
+
+   HYPRE_Int        ndim = hypre_StructVectorNDim(y1);
+   HYPRE_Int        i;
+
+   HYPRE_Real       local_result = 0.0;
+
+   if (!hypre_StructFusedSameDataSpace(x1, y1) || !hypre_StructFusedSameDataSpace(x2, y2))
+   {
+      hypre_StructAxpy(alpha, x1, y1);
+      hypre_StructAxpy(beta, x2, y2);
+      if (result)
+      {
+         *result = hypre_StructInnerProd(y2, y2);
+      }
+      return hypre_error_flag;
+   }
+
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y2));
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      y1_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y1), i);
+      y2_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y2), i);
+
+      x1p = hypre_StructVectorBoxData(x1, i);
+      y1p = hypre_StructVectorBoxData(y1, i);
+      x2p = hypre_StructVectorBoxData(x2, i);
+      y2p = hypre_StructVectorBoxData(y2, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+      if (!result)
+      {
+#define DEVICE_VAR is_device_ptr(y1p,x1p,y2p,x2p)
+         hypre_BoxLoop2Begin(ndim, loop_size,
+                             y1_data_box, start, unit_stride, yi1,
+                             y2_data_box, start, unit_stride, yi2);
+         {
+            y1p[yi1] += alpha * x1p[yi1];
+            y2p[yi2] += beta * x2p[yi2];
+         }
+         hypre_BoxLoop2End(yi1, yi2);
+#undef DEVICE_VAR
+         continue;
+      }
+
+#if defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_SYCL)
+      HYPRE_Real box_sum = 0.0;
+#elif defined(HYPRE_USING_RAJA)
+      ReduceSum<hypre_raja_reduce_policy, HYPRE_Real> box_sum(0.0);
+#elif defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+      ReduceSum<HYPRE_Real> box_sum(0.0);
+#else
+      HYPRE_Real box_sum = 0.0;
+#endif
+
+#ifdef HYPRE_BOX_REDUCTION
+#undef HYPRE_BOX_REDUCTION
+#endif
+
+#if defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_BOX_REDUCTION map(tofrom: box_sum) reduction(+:box_sum)
+#else
+#define HYPRE_BOX_REDUCTION reduction(+:box_sum)
+#endif
+
+#define DEVICE_VAR is_device_ptr(y1p,x1p,y2p,x2p)
+      hypre_BoxLoop2ReductionBegin(ndim, loop_size,
+                                   y1_data_box, start, unit_stride, yi1,
+                                   y2_data_box, start, unit_stride, yi2,
+                                   box_sum)
+      {
+         y1p[yi1] += alpha * x1p[yi1];
+         y2p[yi2] += beta * x2p[yi2];
+         HYPRE_Real tmp = y2p[yi2] * hypre_conj(y2p[yi2]);
+         box_sum += tmp;
+      }
+      hypre_BoxLoop2ReductionEnd(yi1, yi2, box_sum);
+#undef DEVICE_VAR
+#undef HYPRE_BOX_REDUCTION
+#define HYPRE_BOX_REDUCTION
+
+      local_result += (HYPRE_Real) box_sum;
+   }
+
+   if (result)
+   {
+      process_result = (HYPRE_Real) local_result;
+
+      hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
+                          HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(y2));
+
+      hypre_IncFLOPCount(2 * hypre_StructVectorGlobalSize(y2));
+
+      *result = final_innerprod_result;
+   }
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,275 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Deep ghost layers ("halos") for struct grids.
+ *
+ * A vector exchanged with a ghost layer of depth k times the stencil width
+ * can be used for k stencil applications without further communication,
+ * provided the ghost points are updated redundantly: step s (1 <= s <= k)
+ * is computed on the grid boxes grown by (k - s) stencil widths.  The
+ * routines below compute the ghost widths and the regions of each step, check
+ * how deep a halo the grid allows, and create comm packages and copies of
+ * matrices and vectors with a deep ghost layer.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_mv.h"
+#include "_hypre_struct_mv.hpp"
+
+/*--------------------------------------------------------------------------
+ * hypre_StructHaloNumGhost
+ *
+ * Ghost layer widths needed for depth applications of the stencil.  The
+ * widths are returned in num_ghost[2*d] (lower) and num_ghost[2*d+1] (upper)
+ * for d < HYPRE_MAXDIM; unused dimensions are set to 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructHaloNumGhost( hypre_StructStencil *stencil,
+                          HYPRE_Int            depth,
+                          HYPRE_Int           *num_ghost )
+{
+   HYPRE_Int    ndim          = hypre_StructStencilNDim(stencil);
+   hypre_Index *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int    stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int    s, d, offset;
+
+   for (d = 0; d < 2 * HYPRE_MAXDIM; d++)
+   {
+      num_ghost[d] = 0;
+   }
+
+   for (s = 0; s < stencil_size; s++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         offset = hypre_IndexD(stencil_shape[s], d);
+         num_ghost[2 * d]     = hypre_max(num_ghost[2 * d], -offset);
+         num_ghost[2 * d + 1] = hypre_max(num_ghost[2 * d + 1], offset);
+      }
+   }
+
+   for (d = 0; d < 2 * ndim; d++)
+   {
+      num_ghost[d] *= depth;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructHaloMaxDepth
+ *
+ * Returns the largest depth k such that a ghost layer of k times num_ghost
+ * can be exchanged on grid.  The neighbors of a box are only known within
+ * the grid's max_distance (unless all boxes are known everywhere), and the
+ * ghost layer may not wrap around a periodic dimension more than once.
+ * Returns HYPRE_INT_MAX if nothing limits the depth.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructHaloMaxDepth( hypre_StructGrid *grid,
+                          HYPRE_Int        *num_ghost )
+{
+   HYPRE_Int       ndim         = hypre_StructGridNDim(grid);
+   hypre_IndexRef  max_distance = hypre_StructGridMaxDistance(grid);
+   hypre_IndexRef  periodic     = hypre_StructGridPeriodic(grid);
+   HYPRE_Int       max_depth    = HYPRE_INT_MAX;
+   HYPRE_Int       known, width, d;
+
+   hypre_BoxManGetAllGlobalKnown(hypre_StructGridBoxMan(grid), &known);
+
+   for (d = 0; d < ndim; d++)
+   {
+      width = hypre_max(num_ghost[2 * d], num_ghost[2 * d + 1]);
+      if (width > 0)
+      {
+         if (!known)
+         {
+            max_depth = hypre_min(max_depth, hypre_IndexD(max_distance, d) / width);
+         }
+         if (hypre_IndexD(periodic, d) > 0)
+         {
+            max_depth = hypre_min(max_depth, hypre_IndexD(periodic, d) / width);
+         }
+      }
+   }
+
+   return max_depth;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructHaloComputeBoxes
+ *
+ * Returns the region of step (1 <= step <= depth) of depth redundant stencil
+ * applications, that is, the grid boxes grown by (depth - step) times
+ * num_ghost.  The result has one box per grid box, as in the compute boxes
+ * of a hypre_ComputePkg.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructHaloComputeBoxes( hypre_StructGrid      *grid,
+                              HYPRE_Int             *num_ghost,
+                              HYPRE_Int              depth,
+                              HYPRE_Int              step,
+                              hypre_BoxArrayArray  **compute_boxes_ptr )
+{
+   HYPRE_Int             ndim  = hypre_StructGridNDim(grid);
+   hypre_BoxArray       *boxes = hypre_StructGridBoxes(grid);
+   hypre_BoxArrayArray  *compute_boxes;
+   hypre_BoxArray       *compute_box_a;
+   hypre_Box            *compute_box;
+   HYPRE_Int             grow[2 * HYPRE_MAXDIM];
+   HYPRE_Int             i, d;
+
+   for (d = 0; d < 2 * HYPRE_MAXDIM; d++)
+   {
+      grow[d] = (depth - step) * num_ghost[d];
+   }
+
+   compute_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+   hypre_ForBoxI(i, boxes)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_boxes, i);
+      hypre_BoxArraySetSize(compute_box_a, 1);
+      compute_box = hypre_BoxArrayBox(compute_box_a, 0);
+      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), compute_box);
+      if (hypre_BoxVolume(compute_box) > 0)
+      {
+         hypre_BoxGrowByArray(compute_box, grow);
+      }
+   }
+
+   *compute_boxes_ptr = compute_boxes;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructHaloCommPkgCreate
+ *
+ * Creates a comm package that fills a ghost layer of width num_ghost
+ * (including the corners) of data laid out on data_space.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructHaloCommPkgCreate( hypre_StructGrid  *grid,
+                               HYPRE_Int         *num_ghost,
+                               hypre_BoxArray    *data_space,
+                               HYPRE_Int          num_values,
+                               hypre_CommPkg    **comm_pkg_ptr )
+{
+   hypre_CommInfo  *comm_info;
+
+   hypre_CreateCommInfoFromNumGhost(grid, num_ghost, &comm_info);
+   hypre_CommPkgCreate(comm_info, data_space, data_space, num_values, NULL, 0,
+                       hypre_StructGridComm(grid), comm_pkg_ptr);
+   hypre_CommInfoDestroy(comm_info);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructHaloVectorCreate
+ *
+ * Creates an assembled vector on grid with a ghost layer of width num_ghost.
+ * The ghost values are zero.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructVector *
+hypre_StructHaloVectorCreate( hypre_StructGrid *grid,
+                              HYPRE_Int        *num_ghost )
+{
+   hypre_StructVector  *vector;
+
+   vector = hypre_StructVectorCreate(hypre_StructGridComm(grid), grid);
+   hypre_StructVectorSetNumGhost(vector, num_ghost);
+   hypre_StructVectorInitialize(vector);
+   hypre_StructVectorAssemble(vector);
+
+   return vector;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructHaloMatrixCreate
+ *
+ * Creates an assembled copy of A with a ghost layer of width num_ghost, so
+ * that the coefficients of the points in the ghost layer are available for
+ * redundant computation.  As in any assembled matrix, the coefficients of
+ * ghost points outside of the grid are zero except for a unit diagonal, so
+ * redundant computation leaves zero values there zero.  This requires
+ * stored variable coefficients.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_StructHaloMatrixCreate( hypre_StructMatrix *A,
+                              HYPRE_Int          *num_ghost )
+{
+   HYPRE_Int             ndim          = hypre_StructMatrixNDim(A);
+   hypre_StructGrid     *grid          = hypre_StructMatrixGrid(A);
+   hypre_BoxArray       *boxes         = hypre_StructGridBoxes(grid);
+   HYPRE_Int             stencil_size  = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+   HYPRE_Int            *symm_elements = hypre_StructMatrixSymmElements(A);
+
+   hypre_StructMatrix   *Ah;
+   hypre_Box            *box;
+   hypre_Box            *A_dbox;
+   hypre_Box            *Ah_dbox;
+   hypre_IndexRef        start;
+   hypre_Index           unit_stride, loop_size;
+   HYPRE_Complex        *Ap, *Ahp;
+   HYPRE_Int             i, s;
+
+   if (hypre_StructMatrixConstantCoefficient(A) != 0 || hypre_StructMatrixCoeffFcn(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Halo copies need stored variable coefficients!");
+      return NULL;
+   }
+
+   Ah = hypre_StructMatrixCreate(hypre_StructMatrixComm(A), grid,
+                                 hypre_StructMatrixUserStencil(A));
+   hypre_StructMatrixSymmetric(Ah) = hypre_StructMatrixSymmetric(A);
+   hypre_StructMatrixSetNumGhost(Ah, num_ghost);
+   hypre_StructMatrixInitialize(Ah);
+
+   hypre_SetIndex(unit_stride, 1);
+   hypre_ForBoxI(i, boxes)
+   {
+      box     = hypre_BoxArrayBox(boxes, i);
+      start   = hypre_BoxIMin(box);
+      A_dbox  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      Ah_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(Ah), i);
+      hypre_BoxGetSize(box, loop_size);
+
+      for (s = 0; s < stencil_size; s++)
+      {
+         /* only the stored coefficients */
+         if (symm_elements[s] >= 0)
+         {
+            continue;
+         }
+
+         Ap  = hypre_StructMatrixBoxData(A, i, s);
+         Ahp = hypre_StructMatrixBoxData(Ah, i, s);
+
+#define DEVICE_VAR is_device_ptr(Ahp,Ap)
+         hypre_BoxLoop2Begin(ndim, loop_size,
+                             A_dbox, start, unit_stride, Ai,
+                             Ah_dbox, start, unit_stride, Ahi);
+         {
+            Ahp[Ahi] = Ap[Ai];
+         }
+         hypre_BoxLoop2End(Ai, Ahi);
+#undef DEVICE_VAR
+      }
+   }
+   hypre_StructMatrixAssemble(Ah);
+
+   return Ah;
+}
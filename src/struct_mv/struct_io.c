@@ -13,6 +13,13 @@
 
 #include "_hypre_struct_mv.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 /*--------------------------------------------------------------------------
  * hypre_PrintBoxArrayData
  *
@@ -359,3 +366,505 @@ hypre_ReadBoxArrayData_CC( FILE            *file,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * Binary box array data files
+ *
+ * All processes share one file.  It starts with a header of 8 hypre_uint64
+ * entries,
+ *
+ *   version, sizeof(HYPRE_Complex), ndim, num_boxes, num_values, num_const,
+ *   num_info, data offset (in bytes)
+ *
+ * followed by num_info caller-defined entries (e.g., a matrix stencil), a box
+ * table with 2*ndim+1 entries per box (imin, imax, and the offset of the box
+ * data in values), num_const constant values, and the box data.  The data of
+ * a box consists of num_values blocks of the box volume, ordered
+ * lexicographically as in the box loops.  Boxes are stored process by
+ * process, so each process writes its data at a precomputed offset with a
+ * single call.  On reading, each process maps the file and copies only the
+ * rows that intersect its boxes, so the box distribution may differ from the
+ * one that was written.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_BOX_DATA_BINARY_VERSION 1
+
+typedef struct
+{
+#ifndef _WIN32
+   char        *map;
+   size_t       size;
+#else
+   FILE        *file;
+#endif
+} hypre_BoxArrayDataFile;
+
+/* The helpers below return a nonzero status on their own failures (the error
+ * is also registered), so that earlier unrelated errors are not mistaken for
+ * read failures. */
+
+static HYPRE_Int
+hypre_BoxArrayDataFileOpen( const char             *filename,
+                            hypre_BoxArrayDataFile *dfile )
+{
+   char  msg[HYPRE_MAX_MSG_LEN];
+
+#ifndef _WIN32
+   struct stat  st;
+   int          fd;
+
+   (dfile -> map)  = NULL;
+   (dfile -> size) = 0;
+
+   fd = open(filename, O_RDONLY);
+   if (fd < 0 || fstat(fd, &st))
+   {
+      hypre_sprintf(msg, "Could not open input file %s", filename);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+      if (fd >= 0)
+      {
+         close(fd);
+      }
+      return 1;
+   }
+
+   /* Pages are only read from disk when they are touched */
+   (dfile -> size) = (size_t) st.st_size;
+   (dfile -> map)  = (char *) mmap(NULL, (dfile -> size), PROT_READ, MAP_SHARED, fd, 0);
+   close(fd);
+   if ((dfile -> map) == MAP_FAILED)
+   {
+      (dfile -> map) = NULL;
+      hypre_sprintf(msg, "Could not map input file %s", filename);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+      return 1;
+   }
+#else
+   if (((dfile -> file) = fopen(filename, "rb")) == NULL)
+   {
+      hypre_sprintf(msg, "Could not open input file %s", filename);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+      return 1;
+   }
+#endif
+
+   return 0;
+}
+
+static HYPRE_Int
+hypre_BoxArrayDataFileRead( hypre_BoxArrayDataFile *dfile,
+                            hypre_uint64            offset,
+                            size_t                  nbytes,
+                            void                   *buffer )
+{
+#ifndef _WIN32
+   if (offset + nbytes > (dfile -> size))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Read past the end of the binary file");
+      return 1;
+   }
+   hypre_TMemcpy(buffer, (dfile -> map) + offset, char, nbytes,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+#else
+   if (_fseeki64((dfile -> file), (__int64) offset, SEEK_SET) ||
+       fread(buffer, 1, nbytes, (dfile -> file)) != nbytes)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not read from the binary file");
+      return 1;
+   }
+#endif
+
+   return 0;
+}
+
+static HYPRE_Int
+hypre_BoxArrayDataFileClose( hypre_BoxArrayDataFile *dfile )
+{
+#ifndef _WIN32
+   if (dfile -> map)
+   {
+      munmap((dfile -> map), (dfile -> size));
+      (dfile -> map) = NULL;
+   }
+#else
+   if (dfile -> file)
+   {
+      fclose(dfile -> file);
+      (dfile -> file) = NULL;
+   }
+#endif
+
+   return 0;
+}
+
+/* Write nbytes at the given offset of an existing file */
+static HYPRE_Int
+hypre_BoxArrayDataFileWrite( const char   *filename,
+                             hypre_uint64  offset,
+                             size_t        nbytes,
+                             const void   *buffer )
+{
+   char       msg[HYPRE_MAX_MSG_LEN];
+   HYPRE_Int  status = 0;
+
+#ifndef _WIN32
+   const char  *bytes = (const char *) buffer;
+   ssize_t      count;
+   int          fd;
+
+   if ((fd = open(filename, O_WRONLY)) < 0)
+   {
+      hypre_sprintf(msg, "Could not open output file %s", filename);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+      return 1;
+   }
+   while (nbytes > 0)
+   {
+      count = pwrite(fd, bytes, nbytes, (off_t) offset);
+      if (count <= 0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not write all entries");
+         status = 1;
+         break;
+      }
+      bytes  += count;
+      offset += (hypre_uint64) count;
+      nbytes -= (size_t) count;
+   }
+   close(fd);
+#else
+   FILE  *file;
+
+   if ((file = fopen(filename, "r+b")) == NULL)
+   {
+      hypre_sprintf(msg, "Could not open output file %s", filename);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+      return 1;
+   }
+   if (_fseeki64(file, (__int64) offset, SEEK_SET) ||
+       fwrite(buffer, 1, nbytes, file) != nbytes)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not write all entries");
+      status = 1;
+   }
+   fclose(file);
+#endif
+
+   return status;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_WriteBoxArrayDataBinary
+ *
+ * Collective.  The data array holds the values of the local boxes packed as
+ * described above.  The constant values are taken from the first process
+ * that owns boxes.
+ *
+ * Note: data arrays are expected to live on the host memory.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WriteBoxArrayDataBinary( MPI_Comm         comm,
+                               const char      *filename,
+                               hypre_BoxArray  *box_array,
+                               HYPRE_Int        num_values,
+                               HYPRE_Int        num_info,
+                               hypre_uint64    *info,
+                               HYPRE_Int        num_const,
+                               HYPRE_Complex   *const_data,
+                               HYPRE_Complex   *data )
+{
+   HYPRE_Int        ndim      = hypre_BoxArrayNDim(box_array);
+   HYPRE_Int        num_local = hypre_BoxArraySize(box_array);
+   HYPRE_Int        num_entries = 2 * ndim + 1;
+
+   HYPRE_Int        num_procs, myid, root;
+   HYPRE_Int       *counts, *displs;
+   HYPRE_Int       *extents, *all_extents;
+   HYPRE_Int        num_boxes;
+   hypre_uint64     header[8];
+   hypre_uint64    *table;
+   hypre_uint64     offset, local_offset, volume;
+   size_t           local_size;
+   hypre_Box       *box;
+   FILE            *file;
+   char             msg[HYPRE_MAX_MSG_LEN];
+   HYPRE_Int        one = 1;
+   HYPRE_Int        i, p, d;
+
+   /* Exit if trying to write from big-endian machine */
+   if ((*(char*)&one) == 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Support to big-endian machines is incomplete!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   /* Gather the box extents of all processes */
+   counts = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   displs = hypre_TAlloc(HYPRE_Int, num_procs + 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&num_local, 1, HYPRE_MPI_INT, counts, 1, HYPRE_MPI_INT, comm);
+   displs[0] = 0;
+   for (p = 0; p < num_procs; p++)
+   {
+      displs[p + 1] = displs[p] + counts[p];
+   }
+   num_boxes = displs[num_procs];
+
+   extents = hypre_TAlloc(HYPRE_Int, 2 * ndim * num_local, HYPRE_MEMORY_HOST);
+   hypre_ForBoxI(i, box_array)
+   {
+      box = hypre_BoxArrayBox(box_array, i);
+      for (d = 0; d < ndim; d++)
+      {
+         extents[2 * ndim * i + d]        = hypre_BoxIMinD(box, d);
+         extents[2 * ndim * i + ndim + d] = hypre_BoxIMaxD(box, d);
+      }
+   }
+   all_extents = hypre_TAlloc(HYPRE_Int, 2 * ndim * num_boxes, HYPRE_MEMORY_HOST);
+   for (p = 0; p < num_procs; p++)
+   {
+      counts[p] *= 2 * ndim;
+      displs[p] *= 2 * ndim;
+   }
+   hypre_MPI_Allgatherv(extents, 2 * ndim * num_local, HYPRE_MPI_INT,
+                        all_extents, counts, displs, HYPRE_MPI_INT, comm);
+
+   /* Set up the box table and the offset of the local data */
+   root = -1;
+   table = hypre_TAlloc(hypre_uint64, num_entries * num_boxes, HYPRE_MEMORY_HOST);
+   offset = 0;
+   local_offset = 0;
+   for (p = 0; p < num_procs; p++)
+   {
+      if (p == myid)
+      {
+         local_offset = offset;
+      }
+      if (root < 0 && counts[p] > 0)
+      {
+         root = p;
+      }
+      for (i = displs[p] / (2 * ndim); i < (displs[p] + counts[p]) / (2 * ndim); i++)
+      {
+         volume = 1;
+         for (d = 0; d < ndim; d++)
+         {
+            table[num_entries * i + d]        = (hypre_uint64) all_extents[2 * ndim * i + d];
+            table[num_entries * i + ndim + d] = (hypre_uint64) all_extents[2 * ndim * i + ndim + d];
+            volume *= (hypre_uint64) (all_extents[2 * ndim * i + ndim + d] -
+                                      all_extents[2 * ndim * i + d] + 1);
+         }
+         table[num_entries * i + 2 * ndim] = offset;
+         offset += num_values * volume;
+      }
+   }
+   local_size = 0;
+   hypre_ForBoxI(i, box_array)
+   {
+      local_size += (size_t) num_values * hypre_BoxVolume(hypre_BoxArrayBox(box_array, i));
+   }
+   root = hypre_max(root, 0);
+
+   header[0] = (hypre_uint64) HYPRE_BOX_DATA_BINARY_VERSION;
+   header[1] = (hypre_uint64) sizeof(HYPRE_Complex);
+   header[2] = (hypre_uint64) ndim;
+   header[3] = (hypre_uint64) num_boxes;
+   header[4] = (hypre_uint64) num_values;
+   header[5] = (hypre_uint64) num_const;
+   header[6] = (hypre_uint64) num_info;
+   header[7] = (hypre_uint64) ((8 + num_info + num_entries * num_boxes) * sizeof(hypre_uint64) +
+                               num_const * sizeof(HYPRE_Complex));
+
+   /* One process creates the file and writes everything but the box data */
+   if (myid == root)
+   {
+      if ((file = fopen(filename, "wb")) == NULL)
+      {
+         hypre_sprintf(msg, "Could not open output file %s", filename);
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+      }
+      else
+      {
+         if ((fwrite(header, sizeof(hypre_uint64), 8, file) != 8) ||
+             (fwrite(info, sizeof(hypre_uint64), num_info, file) != (size_t) num_info) ||
+             (fwrite(table, sizeof(hypre_uint64), num_entries * num_boxes, file) !=
+              (size_t) (num_entries * num_boxes)) ||
+             (fwrite(const_data, sizeof(HYPRE_Complex), num_const, file) != (size_t) num_const))
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not write all header entries\n");
+         }
+         fclose(file);
+      }
+   }
+   hypre_MPI_Barrier(comm);
+
+   /* Each process writes its boxes at its own offset */
+   if (local_size > 0)
+   {
+      hypre_BoxArrayDataFileWrite(filename,
+                                  header[7] + local_offset * sizeof(HYPRE_Complex),
+                                  local_size * sizeof(HYPRE_Complex), data);
+   }
+   hypre_MPI_Barrier(comm);
+
+   hypre_TFree(counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(displs, HYPRE_MEMORY_HOST);
+   hypre_TFree(extents, HYPRE_MEMORY_HOST);
+   hypre_TFree(all_extents, HYPRE_MEMORY_HOST);
+   hypre_TFree(table, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReadBoxArrayDataBinary
+ *
+ * Reads the values on the boxes of box_array from a file written by
+ * hypre_WriteBoxArrayDataBinary, packed in the same way.  The layout
+ * (num_values, num_const and info) must match the one that was written.
+ * Points that are not in the file are left unchanged.  Failures are tracked
+ * locally (not through the sticky hypre_error_flag), and the file is always
+ * closed before returning.
+ *
+ * Note: data arrays are expected to live on the host memory.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ReadBoxArrayDataBinary( const char      *filename,
+                              hypre_BoxArray  *box_array,
+                              HYPRE_Int        num_values,
+                              HYPRE_Int        num_info,
+                              hypre_uint64    *info,
+                              HYPRE_Int        num_const,
+                              HYPRE_Complex   *const_data,
+                              HYPRE_Complex   *data )
+{
+   HYPRE_Int               ndim = hypre_BoxArrayNDim(box_array);
+   HYPRE_Int               num_entries = 2 * ndim + 1;
+
+   hypre_BoxArrayDataFile  dfile;
+   hypre_uint64            header[8];
+   hypre_uint64           *file_info = NULL;
+   hypre_uint64           *table = NULL;
+   hypre_uint64            file_offset, offset;
+   HYPRE_Int               num_boxes;
+   hypre_Box              *box, *file_box, *int_box;
+   hypre_Index             index;
+   HYPRE_Int               volume, file_volume, nx, num_rows;
+   HYPRE_Int               status;
+   HYPRE_Int               i, f, j, r, k, d;
+
+   if (hypre_BoxArrayDataFileOpen(filename, &dfile))
+   {
+      hypre_BoxArrayDataFileClose(&dfile);
+      return hypre_error_flag;
+   }
+
+   /* Check that the file matches the expected layout */
+   status = hypre_BoxArrayDataFileRead(&dfile, 0, 8 * sizeof(hypre_uint64), header);
+   if (status ||
+       header[0] != (hypre_uint64) HYPRE_BOX_DATA_BINARY_VERSION ||
+       header[1] != (hypre_uint64) sizeof(HYPRE_Complex) ||
+       header[2] != (hypre_uint64) ndim ||
+       header[4] != (hypre_uint64) num_values ||
+       header[5] != (hypre_uint64) num_const ||
+       header[6] != (hypre_uint64) num_info)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Incompatible binary file");
+      hypre_BoxArrayDataFileClose(&dfile);
+      return hypre_error_flag;
+   }
+   num_boxes = (HYPRE_Int) header[3];
+
+   file_info = hypre_TAlloc(hypre_uint64, num_info, HYPRE_MEMORY_HOST);
+   table = hypre_TAlloc(hypre_uint64, num_entries * num_boxes, HYPRE_MEMORY_HOST);
+   offset = 8 * sizeof(hypre_uint64);
+   status = hypre_BoxArrayDataFileRead(&dfile, offset, num_info * sizeof(hypre_uint64),
+                                       file_info);
+   offset += num_info * sizeof(hypre_uint64);
+   if (!status)
+   {
+      status = hypre_BoxArrayDataFileRead(&dfile, offset,
+                                          num_entries * num_boxes * sizeof(hypre_uint64), table);
+   }
+   offset += num_entries * num_boxes * sizeof(hypre_uint64);
+   if (!status)
+   {
+      status = hypre_BoxArrayDataFileRead(&dfile, offset, num_const * sizeof(HYPRE_Complex),
+                                          const_data);
+   }
+   for (j = 0; j < num_info && !status; j++)
+   {
+      if (file_info[j] != info[j])
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Incompatible binary file");
+         status = 1;
+      }
+   }
+
+   /* Copy the rows of the file boxes that intersect the local boxes */
+   file_box = hypre_BoxCreate(ndim);
+   int_box  = hypre_BoxCreate(ndim);
+   hypre_ForBoxI(i, box_array)
+   {
+      if (status)
+      {
+         break;
+      }
+
+      box = hypre_BoxArrayBox(box_array, i);
+      volume = hypre_BoxVolume(box);
+
+      for (f = 0; f < num_boxes; f++)
+      {
+         for (d = 0; d < ndim; d++)
+         {
+            hypre_BoxIMinD(file_box, d) = (HYPRE_Int) table[num_entries * f + d];
+            hypre_BoxIMaxD(file_box, d) = (HYPRE_Int) table[num_entries * f + ndim + d];
+         }
+         hypre_IntersectBoxes(box, file_box, int_box);
+         if (hypre_BoxVolume(int_box) == 0)
+         {
+            continue;
+         }
+
+         file_volume = hypre_BoxVolume(file_box);
+         file_offset = header[7] + table[num_entries * f + 2 * ndim] * sizeof(HYPRE_Complex);
+         nx = hypre_BoxSizeD(int_box, 0);
+         num_rows = hypre_BoxVolume(int_box) / nx;
+         for (j = 0; j < num_values && !status; j++)
+         {
+            for (r = 0; r < num_rows && !status; r++)
+            {
+               /* first index of row r */
+               k = r;
+               hypre_IndexD(index, 0) = hypre_BoxIMinD(int_box, 0);
+               for (d = 1; d < ndim; d++)
+               {
+                  hypre_IndexD(index, d) = hypre_BoxIMinD(int_box, d) +
+                                           k % hypre_BoxSizeD(int_box, d);
+                  k /= hypre_BoxSizeD(int_box, d);
+               }
+
+               offset = file_offset + ((hypre_uint64) j * file_volume +
+                                       hypre_BoxIndexRank(file_box, index)) * sizeof(HYPRE_Complex);
+               status = hypre_BoxArrayDataFileRead(&dfile, offset, nx * sizeof(HYPRE_Complex),
+                                                   &data[j * volume + hypre_BoxIndexRank(box, index)]);
+            }
+         }
+      }
+
+      data += num_values * volume;
+   }
+
+   hypre_BoxDestroy(file_box);
+   hypre_BoxDestroy(int_box);
+   hypre_TFree(file_info, HYPRE_MEMORY_HOST);
+   hypre_TFree(table, HYPRE_MEMORY_HOST);
+   hypre_BoxArrayDataFileClose(&dfile);
+
+   return hypre_error_flag;
+}
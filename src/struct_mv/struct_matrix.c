@@ -107,7 +107,9 @@ hypre_StructMatrixDestroy( hypre_StructMatrix *matrix )
          }
          hypre_TFree(hypre_StructMatrixStencilData(matrix), HYPRE_MEMORY_HOST);
          hypre_CommPkgDestroy(hypre_StructMatrixCommPkg(matrix));
-         if (hypre_BoxArraySize(hypre_StructMatrixDataSpace(matrix)) > 0)
+         /* no data space yet if the matrix was never initialized */
+         if (hypre_StructMatrixDataSpace(matrix) &&
+             hypre_BoxArraySize(hypre_StructMatrixDataSpace(matrix)) > 0)
          {
             hypre_TFree(hypre_StructMatrixDataIndices(matrix)[0], HYPRE_MEMORY_HOST);
          }
@@ -158,6 +160,14 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
 
    HYPRE_Int             i, j, d;
 
+   if (hypre_StructMatrixCoeffFcn(matrix) &&
+       (hypre_StructMatrixSymmetric(matrix) || hypre_StructMatrixConstantCoefficient(matrix)))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Generated coefficients need nonsymmetric variable coefficient storage!");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Set up stencil and num_values:
     *
@@ -412,6 +422,11 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
          data_size       = 0;
       }
 #endif
+      /* nothing is stored for generated coefficients */
+      if (hypre_StructMatrixCoeffFcn(matrix))
+      {
+         data_size = 0;
+      }
       hypre_StructMatrixDataSize(matrix)      = data_size;
       hypre_StructMatrixDataConstSize(matrix) = data_const_size;
 
@@ -582,6 +597,12 @@ hypre_StructMatrixSetValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Generated coefficients are not stored!");
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
    symm_elements        = hypre_StructMatrixSymmElements(matrix);
 
@@ -732,6 +753,12 @@ hypre_StructMatrixSetBoxValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int            i, s, istart, istop;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Generated coefficients are not stored!");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Initialize some things
     *-----------------------------------------------------------------------*/
@@ -922,6 +949,12 @@ hypre_StructMatrixSetConstantValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int           i, s;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Generated coefficients are not stored!");
+      return hypre_error_flag;
+   }
+
    boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
 
@@ -1081,6 +1114,12 @@ hypre_StructMatrixClearValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int            i, s, istart, istop;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Generated coefficients are not stored!");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Initialize some things
     *-----------------------------------------------------------------------*/
@@ -1155,6 +1194,12 @@ hypre_StructMatrixClearBoxValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int            i, s, istart, istop;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Generated coefficients are not stored!");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Initialize some things
     *-----------------------------------------------------------------------*/
@@ -1276,6 +1321,12 @@ hypre_StructMatrixAssemble( hypre_StructMatrix *matrix )
 
    constant_coefficient = hypre_StructMatrixConstantCoefficient( matrix );
 
+   /* nothing to assemble for generated coefficients */
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Set ghost zones along the domain boundary to the identity to enable code
     * simplifications elsewhere in hypre (e.g., CyclicReduction).
@@ -1551,6 +1602,131 @@ HYPRE_Int  hypre_StructMatrixSetConstantEntries( hypre_StructMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixSetCoeffGenerator
+ *
+ * Generated coefficients are computed by fcn when needed and are not stored.
+ * Must be called before hypre_StructMatrixInitialize.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixSetCoeffGenerator( hypre_StructMatrix         *matrix,
+                                     HYPRE_StructMatrixCoeffFcn  fcn,
+                                     void                       *data )
+{
+   hypre_StructMatrixCoeffFcn(matrix)  = fcn;
+   hypre_StructMatrixCoeffData(matrix) = data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixGenerateRow
+ *
+ * Generates the coefficients of row number 'row' of the points start + k*stride
+ * with 0 <= k < loop_size, where rows run along dimension 0 and are numbered
+ * lexicographically in the other dimensions.  On return, index is the first
+ * point of the row, and values holds the coefficients of the
+ * (loop_size[0]-1)*stride[0]+1 points from there on (stencil entries fastest).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixGenerateRow( hypre_StructMatrix *matrix,
+                               hypre_IndexRef      start,
+                               hypre_IndexRef      stride,
+                               hypre_Index         loop_size,
+                               HYPRE_Int           row,
+                               hypre_Index         index,
+                               HYPRE_Complex      *values )
+{
+   HYPRE_Int    ndim = hypre_StructMatrixNDim(matrix);
+   hypre_Index  upper;
+   HYPRE_Int    d;
+
+   hypre_CopyIndex(start, index);
+   for (d = 1; d < ndim; d++)
+   {
+      hypre_IndexD(index, d) += (row % hypre_IndexD(loop_size, d)) * hypre_IndexD(stride, d);
+      row /= hypre_IndexD(loop_size, d);
+   }
+   hypre_CopyIndex(index, upper);
+   hypre_IndexD(upper, 0) += (hypre_IndexD(loop_size, 0) - 1) * hypre_IndexD(stride, 0);
+
+   if ((hypre_StructMatrixCoeffFcn(matrix))(hypre_StructMatrixCoeffData(matrix),
+                                            index, upper, values))
+   {
+      hypre_error(HYPRE_ERROR_GENERIC);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixGenerateCopy
+ *
+ * Returns an assembled matrix that stores the generated coefficients of
+ * matrix, for code that needs stored coefficients.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_StructMatrixGenerateCopy( hypre_StructMatrix *matrix )
+{
+   HYPRE_Int             ndim         = hypre_StructMatrixNDim(matrix);
+   hypre_BoxArray       *boxes        = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
+   HYPRE_Int             stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(matrix));
+
+   hypre_StructMatrix   *copy;
+   hypre_Box            *box;
+   hypre_Index           index, loop_size, unit_stride;
+   HYPRE_Complex        *values, *datap;
+   HYPRE_Int             max_row, num_rows, i, r, s, k, d;
+
+   copy = hypre_StructMatrixCreate(hypre_StructMatrixComm(matrix),
+                                   hypre_StructMatrixGrid(matrix),
+                                   hypre_StructMatrixUserStencil(matrix));
+   hypre_StructMatrixSetNumGhost(copy, hypre_StructMatrixNumGhost(matrix));
+   hypre_StructMatrixInitialize(copy);
+
+   max_row = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      max_row = hypre_max(max_row, hypre_BoxSizeD(hypre_BoxArrayBox(boxes, i), 0));
+   }
+   values = hypre_TAlloc(HYPRE_Complex, max_row * stencil_size, HYPRE_MEMORY_HOST);
+
+   hypre_SetIndex(unit_stride, 1);
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      hypre_BoxGetSize(box, loop_size);
+
+      num_rows = (hypre_BoxVolume(box) > 0) ? 1 : 0;
+      for (d = 1; d < ndim; d++)
+      {
+         num_rows *= hypre_IndexD(loop_size, d);
+      }
+
+      for (r = 0; r < num_rows; r++)
+      {
+         hypre_StructMatrixGenerateRow(matrix, hypre_BoxIMin(box), unit_stride, loop_size,
+                                       r, index, values);
+         for (s = 0; s < stencil_size; s++)
+         {
+            datap = hypre_StructMatrixBoxDataValue(copy, i, s, index);
+            for (k = 0; k < hypre_IndexD(loop_size, 0); k++)
+            {
+               datap[k] = values[k * stencil_size + s];
+            }
+         }
+      }
+   }
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   hypre_StructMatrixAssemble(copy);
+
+   return copy;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1786,6 +1962,12 @@ hypre_StructMatrixPrint( const char         *filename,
    HYPRE_Int             i, j, d;
    HYPRE_Int             myid;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Generated coefficients are not stored!");
+      return hypre_error_flag;
+   }
+
    /*----------------------------------------
     * Open file
     *----------------------------------------*/
@@ -1960,6 +2142,268 @@ hypre_StructMatrixRead( MPI_Comm    comm,
    return matrix;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixBinaryLayout
+ *
+ * Splits the stored stencil entries into variable and constant ones, and sets
+ * up the info entries that identify the matrix layout in binary files.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_StructMatrixBinaryLayout( hypre_StructMatrix  *matrix,
+                                HYPRE_Int           *num_info_ptr,
+                                hypre_uint64       **info_ptr,
+                                HYPRE_Int           *num_var_ptr,
+                                HYPRE_Int          **var_entries_ptr,
+                                HYPRE_Int           *num_const_ptr,
+                                HYPRE_Int          **const_entries_ptr )
+{
+   HYPRE_Int             ndim          = hypre_StructMatrixNDim(matrix);
+   HYPRE_Int             ctecoef       = hypre_StructMatrixConstantCoefficient(matrix);
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(matrix);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int            *symm_elements = hypre_StructMatrixSymmElements(matrix);
+
+   hypre_uint64         *info;
+   HYPRE_Int            *var_entries, *const_entries;
+   HYPRE_Int             num_info, num_var, num_const;
+   HYPRE_Int             s, d;
+
+   info          = hypre_TAlloc(hypre_uint64, 3 + ndim * stencil_size, HYPRE_MEMORY_HOST);
+   var_entries   = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   const_entries = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+
+   num_info  = 3;
+   num_var   = 0;
+   num_const = 0;
+   for (s = 0; s < stencil_size; s++)
+   {
+      if (symm_elements[s] < 0)
+      {
+         if ( (ctecoef == 1) ||
+              (ctecoef == 2 && !hypre_IndexEqual(stencil_shape[s], 0, ndim)) )
+         {
+            const_entries[num_const++] = s;
+         }
+         else
+         {
+            var_entries[num_var++] = s;
+         }
+         for (d = 0; d < ndim; d++)
+         {
+            info[num_info++] = (hypre_uint64) hypre_IndexD(stencil_shape[s], d);
+         }
+      }
+   }
+   info[0] = (hypre_uint64) ctecoef;
+   info[1] = (hypre_uint64) hypre_StructMatrixSymmetric(matrix);
+   info[2] = (hypre_uint64) (num_var + num_const);
+
+   *num_info_ptr      = num_info;
+   *info_ptr          = info;
+   *num_var_ptr       = num_var;
+   *var_entries_ptr   = var_entries;
+   *num_const_ptr     = num_const;
+   *const_entries_ptr = const_entries;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixPackBinary
+ *
+ * Packs the current coefficients in the layout of the binary files: the
+ * constant entries, and the variable entries box by box, one stencil entry at
+ * a time.  Both arrays are returned on the host.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_StructMatrixPackBinary( hypre_StructMatrix  *matrix,
+                              HYPRE_Int            num_var,
+                              HYPRE_Int           *var_entries,
+                              HYPRE_Int            num_const,
+                              HYPRE_Int           *const_entries,
+                              HYPRE_Complex      **const_values_ptr,
+                              HYPRE_Complex      **values_ptr )
+{
+   hypre_BoxArray       *boxes           = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
+   HYPRE_MemoryLocation  memory_location = hypre_StructMatrixMemoryLocation(matrix);
+
+   hypre_Box            *box;
+   HYPRE_Complex        *const_values, *values, *h_values;
+   HYPRE_Int             size, volume, i, k;
+
+   /* Constant coefficients live on the host */
+   const_values = hypre_CTAlloc(HYPRE_Complex, num_const, HYPRE_MEMORY_HOST);
+   if (hypre_BoxArraySize(boxes) > 0)
+   {
+      for (k = 0; k < num_const; k++)
+      {
+         const_values[k] = *hypre_StructMatrixBoxData(matrix, 0, const_entries[k]);
+      }
+   }
+
+   size = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      size += num_var * hypre_BoxVolume(hypre_BoxArrayBox(boxes, i));
+   }
+   values = hypre_TAlloc(HYPRE_Complex, size, memory_location);
+
+   size = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      volume = hypre_BoxVolume(box);
+      for (k = 0; k < num_var; k++)
+      {
+         hypre_StructMatrixSetBoxValues(matrix, box, box, 1, &var_entries[k],
+                                        values + size, -1, i, 0);
+         size += volume;
+      }
+   }
+
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      h_values = hypre_TAlloc(HYPRE_Complex, size, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(h_values, values, HYPRE_Complex, size,
+                    HYPRE_MEMORY_HOST, memory_location);
+      hypre_TFree(values, memory_location);
+   }
+   else
+   {
+      h_values = values;
+   }
+
+   *const_values_ptr = const_values;
+   *values_ptr       = h_values;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixPrintBinary
+ *
+ * Collective.  Writes the stored coefficients on the grid boxes to a single
+ * binary file shared by all processes (see hypre_WriteBoxArrayDataBinary).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixPrintBinary( const char         *filename,
+                               hypre_StructMatrix *matrix )
+{
+   MPI_Comm              comm            = hypre_StructMatrixComm(matrix);
+   hypre_BoxArray       *boxes           = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
+
+   hypre_uint64         *info;
+   HYPRE_Int            *var_entries, *const_entries;
+   HYPRE_Int             num_info, num_var, num_const;
+   HYPRE_Complex        *const_values, *h_values;
+
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Generated coefficients are not stored!");
+      return hypre_error_flag;
+   }
+
+   hypre_StructMatrixBinaryLayout(matrix, &num_info, &info, &num_var, &var_entries,
+                                  &num_const, &const_entries);
+
+   hypre_StructMatrixPackBinary(matrix, num_var, var_entries, num_const, const_entries,
+                                &const_values, &h_values);
+
+   hypre_WriteBoxArrayDataBinary(comm, filename, boxes, num_var, num_info, info,
+                                 num_const, const_values, h_values);
+
+   hypre_TFree(h_values, HYPRE_MEMORY_HOST);
+   hypre_TFree(const_values, HYPRE_MEMORY_HOST);
+   hypre_TFree(info, HYPRE_MEMORY_HOST);
+   hypre_TFree(var_entries, HYPRE_MEMORY_HOST);
+   hypre_TFree(const_entries, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixReadBinary
+ *
+ * Reads the coefficients on the grid boxes of an initialized matrix from a
+ * file written by hypre_StructMatrixPrintBinary.  The matrix must have the
+ * same stencil, symmetry and constant coefficient type as the one written,
+ * but its grid may be distributed differently.  Coefficients at points that
+ * are not in the file are left unchanged.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixReadBinary( const char         *filename,
+                              hypre_StructMatrix *matrix )
+{
+   hypre_BoxArray       *boxes           = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
+   HYPRE_MemoryLocation  memory_location = hypre_StructMatrixMemoryLocation(matrix);
+
+   hypre_Box            *box;
+   hypre_uint64         *info;
+   HYPRE_Int            *var_entries, *const_entries;
+   HYPRE_Int             num_info, num_var, num_const;
+   HYPRE_Complex        *const_values, *values, *h_values;
+   HYPRE_Int             size, volume, i, k;
+
+   hypre_StructMatrixBinaryLayout(matrix, &num_info, &info, &num_var, &var_entries,
+                                  &num_const, &const_entries);
+
+   /* Start from the current coefficients, so entries that are not in the file
+    * (or are not read because of an error) are left unchanged */
+   hypre_StructMatrixPackBinary(matrix, num_var, var_entries, num_const, const_entries,
+                                &const_values, &h_values);
+   size = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      size += num_var * hypre_BoxVolume(hypre_BoxArrayBox(boxes, i));
+   }
+
+   hypre_ReadBoxArrayDataBinary(filename, boxes, num_var, num_info, info,
+                                num_const, const_values, h_values);
+
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      values = hypre_TAlloc(HYPRE_Complex, size, memory_location);
+      hypre_TMemcpy(values, h_values, HYPRE_Complex, size,
+                    memory_location, HYPRE_MEMORY_HOST);
+      hypre_TFree(h_values, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      values = h_values;
+   }
+
+   /* Unpack the coefficients box by box */
+   size = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      volume = hypre_BoxVolume(box);
+      for (k = 0; k < num_const; k++)
+      {
+         *hypre_StructMatrixBoxData(matrix, i, const_entries[k]) = const_values[k];
+      }
+      for (k = 0; k < num_var; k++)
+      {
+         hypre_StructMatrixSetBoxValues(matrix, box, box, 1, &var_entries[k],
+                                        values + size, 0, i, 0);
+         size += volume;
+      }
+   }
+
+   hypre_TFree(values, memory_location);
+   hypre_TFree(const_values, HYPRE_MEMORY_HOST);
+   hypre_TFree(info, HYPRE_MEMORY_HOST);
+   hypre_TFree(var_entries, HYPRE_MEMORY_HOST);
+   hypre_TFree(const_entries, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatrixMigrate
  *--------------------------------------------------------------------------*/
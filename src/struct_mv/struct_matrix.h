@@ -54,6 +54,10 @@ typedef struct hypre_StructMatrix_struct
 
    hypre_CommPkg        *comm_pkg;                  /* Info on how to update ghost data */
 
+   HYPRE_StructMatrixCoeffFcn  coeff_fcn;           /* If set, coefficients are generated
+                                                       on the fly and no data is stored */
+   void                 *coeff_data;                /* Data passed to coeff_fcn */
+
    HYPRE_Int             ref_count;
 
 } hypre_StructMatrix;
@@ -82,6 +86,8 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixNumGhost(matrix)            ((matrix) -> num_ghost)
 #define hypre_StructMatrixGlobalSize(matrix)          ((matrix) -> global_size)
 #define hypre_StructMatrixCommPkg(matrix)             ((matrix) -> comm_pkg)
+#define hypre_StructMatrixCoeffFcn(matrix)            ((matrix) -> coeff_fcn)
+#define hypre_StructMatrixCoeffData(matrix)           ((matrix) -> coeff_data)
 #define hypre_StructMatrixRefCount(matrix)            ((matrix) -> ref_count)
 
 #define hypre_StructMatrixNDim(matrix) \
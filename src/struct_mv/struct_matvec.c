@@ -73,6 +73,12 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
                           grid, &compute_pkg);
 
+   /* pick tile sizes for the host loops (if requested) */
+   hypre_StructTileTune(A, hypre_ComputePkgIndtBoxes(compute_pkg),
+                        hypre_ComputePkgStride(compute_pkg));
+   hypre_StructTileTune(A, hypre_ComputePkgDeptBoxes(compute_pkg),
+                        hypre_ComputePkgStride(compute_pkg));
+
    /*----------------------------------------------------------
     * Set up the matvec data structure
     *----------------------------------------------------------*/
@@ -252,7 +258,14 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
       {
          case 0:
          {
-            hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+            if (hypre_StructMatrixCoeffFcn(A))
+            {
+               hypre_StructMatvecGen( alpha, A, x, y, compute_box_aa, stride );
+            }
+            else
+            {
+               hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+            }
             break;
          }
          case 1:
@@ -321,6 +334,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
    HYPRE_Complex           *yp;
    HYPRE_Int                depth;
    hypre_Index              loop_size;
+   hypre_Index              tile_size;
    hypre_IndexRef           start;
    HYPRE_Int                ndim;
 
@@ -345,6 +359,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
          compute_box = hypre_BoxArrayBox(compute_box_a, j);
 
          hypre_BoxGetSize(compute_box, loop_size);
+         hypre_StructTileGetSize(ndim, loop_size, tile_size);
          start  = hypre_BoxIMin(compute_box);
 
          /* unroll up to depth MAX_DEPTH */
@@ -378,10 +393,10 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 6]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap6,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_TiledBoxLoop3Begin(ndim, loop_size, tile_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
@@ -392,7 +407,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                         Ap5[Ai] * xp[xi + xoff5] +
                         Ap6[Ai] * xp[xi + xoff6];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_TiledBoxLoop3End(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -419,10 +434,10 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 5]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_TiledBoxLoop3Begin(ndim, loop_size, tile_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
@@ -432,7 +447,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                         Ap4[Ai] * xp[xi + xoff4] +
                         Ap5[Ai] * xp[xi + xoff5];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_TiledBoxLoop3End(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -456,10 +471,10 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 4]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_TiledBoxLoop3Begin(ndim, loop_size, tile_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
@@ -468,7 +483,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                         Ap3[Ai] * xp[xi + xoff3] +
                         Ap4[Ai] * xp[xi + xoff4];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_TiledBoxLoop3End(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -489,10 +504,10 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 3]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_TiledBoxLoop3Begin(ndim, loop_size, tile_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
@@ -500,7 +515,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                         Ap2[Ai] * xp[xi + xoff2] +
                         Ap3[Ai] * xp[xi + xoff3];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_TiledBoxLoop3End(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -518,17 +533,17 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 2]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_TiledBoxLoop3Begin(ndim, loop_size, tile_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
                         Ap1[Ai] * xp[xi + xoff1] +
                         Ap2[Ai] * xp[xi + xoff2];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_TiledBoxLoop3End(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -543,16 +558,16 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 1]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_TiledBoxLoop3Begin(ndim, loop_size, tile_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
                         Ap1[Ai] * xp[xi + xoff1];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_TiledBoxLoop3End(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -564,15 +579,15 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 0]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_TiledBoxLoop3Begin(ndim, loop_size, tile_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_TiledBoxLoop3End(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -1373,6 +1388,139 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecGen
+ * core of struct matvec computation, for generated coefficients (host only).
+ * The coefficients are generated one row at a time, and the sums are formed
+ * in the same order as in hypre_StructMatvecCC0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_StructMatvecGen( HYPRE_Complex       alpha,
+                                 hypre_StructMatrix *A,
+                                 hypre_StructVector *x,
+                                 hypre_StructVector *y,
+                                 hypre_BoxArrayArray     *compute_box_aa,
+                                 hypre_IndexRef           stride
+                               )
+{
+   hypre_StructStencil     *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index             *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int                stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int                ndim          = hypre_StructVectorNDim(x);
+   HYPRE_Int                num_threads   = hypre_NumThreads();
+
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+   HYPRE_Complex           *values;
+   HYPRE_Int               *xoff;
+   HYPRE_Int                values_size, num_rows;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                i, j, r, d, si;
+
+#if defined(HYPRE_USING_GPU)
+   if (hypre_GetExecPolicy1(hypre_StructVectorMemoryLocation(y)) != HYPRE_EXEC_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Generated coefficients are supported on the host only!");
+      return hypre_error_flag;
+   }
+#endif
+
+   /* one row of coefficients per thread */
+   values_size = 0;
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         values_size = hypre_max(values_size,
+                                 hypre_BoxSizeD(hypre_BoxArrayBox(compute_box_a, j), 0));
+      }
+   }
+   values_size *= stencil_size;
+   values = hypre_TAlloc(HYPRE_Complex, values_size * num_threads, HYPRE_MEMORY_HOST);
+   xoff   = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+         start  = hypre_BoxIMin(compute_box);
+
+         num_rows = (hypre_IndexD(loop_size, 0) > 0) ? 1 : 0;
+         for (d = 1; d < ndim; d++)
+         {
+            num_rows *= hypre_IndexD(loop_size, d);
+         }
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+         for (r = 0; r < num_rows; r++)
+         {
+            HYPRE_Complex  *rvalues = values + hypre_GetThreadNum() * values_size;
+            HYPRE_Complex  *vp, sum;
+            hypre_Index     index;
+            HYPRE_Int       xi, yi, k, s, sj, depth;
+
+            hypre_StructMatrixGenerateRow(A, start, stride, loop_size, r, index, rvalues);
+            xi = hypre_BoxIndexRank(x_data_box, index);
+            yi = hypre_BoxIndexRank(y_data_box, index);
+
+            for (k = 0; k < hypre_IndexD(loop_size, 0); k++)
+            {
+               vp = rvalues + k * hypre_IndexD(stride, 0) * stencil_size;
+
+               /* sum up to MAX_DEPTH terms at a time, as in the CC0 kernel */
+               for (s = 0; s < stencil_size; s += MAX_DEPTH)
+               {
+                  depth = hypre_min(MAX_DEPTH, (stencil_size - s));
+                  sum = vp[s] * xp[xi + xoff[s]];
+                  for (sj = s + 1; sj < s + depth; sj++)
+                  {
+                     sum += vp[sj] * xp[xi + xoff[sj]];
+                  }
+                  yp[yi] += sum;
+               }
+               if (alpha != 1.0)
+               {
+                  yp[yi] *= alpha;
+               }
+
+               xi += hypre_IndexD(stride, 0);
+               yi += hypre_IndexD(stride, 0);
+            }
+         }
+      }
+   }
+
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecDestroy
  *--------------------------------------------------------------------------*/
@@ -0,0 +1,247 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Structured matrix powers: y[j] = A^(j+1) x for j = 0, ..., num_powers-1.
+ *
+ * The ghost layer of x is exchanged once for every depth products, and the
+ * products in between are computed redundantly in the ghost layer (see
+ * struct_halo.c).  The results are the same as those of num_powers calls of
+ * hypre_StructMatvec.  Matrices with stored variable coefficients only.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_mv.h"
+#include "_hypre_struct_mv.hpp"
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecPowersData data structure
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_StructMatrix    *A;              /* copy with a deep ghost layer */
+   HYPRE_Int              num_powers;
+   HYPRE_Int              depth;          /* products per ghost exchange */
+   hypre_StructVector    *v[2];           /* work vectors, same ghost layer */
+   hypre_CommPkg         *comm_pkg;
+   hypre_BoxArrayArray  **compute_boxes;  /* regions of steps 1, ..., depth */
+
+} hypre_StructMatvecPowersData;
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecPowersCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_StructMatvecPowersCreate( void )
+{
+   hypre_StructMatvecPowersData *powers_data;
+
+   powers_data = hypre_CTAlloc(hypre_StructMatvecPowersData, 1, HYPRE_MEMORY_HOST);
+
+   return (void *) powers_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecPowersDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecPowersDestroy( void *powers_vdata )
+{
+   hypre_StructMatvecPowersData *powers_data = (hypre_StructMatvecPowersData *)powers_vdata;
+   HYPRE_Int                     step;
+
+   if (powers_data)
+   {
+      hypre_StructMatrixDestroy(powers_data -> A);
+      hypre_StructVectorDestroy(powers_data -> v[0]);
+      hypre_StructVectorDestroy(powers_data -> v[1]);
+      hypre_CommPkgDestroy(powers_data -> comm_pkg);
+      if (powers_data -> compute_boxes)
+      {
+         for (step = 0; step < (powers_data -> depth); step++)
+         {
+            hypre_BoxArrayArrayDestroy(powers_data -> compute_boxes[step]);
+         }
+         hypre_TFree(powers_data -> compute_boxes, HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(powers_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecPowersSetup
+ *
+ * Sets up num_powers products with A.  If depth > 0, at most depth products
+ * are done per ghost exchange, otherwise as many as the grid allows.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecPowersSetup( void               *powers_vdata,
+                               hypre_StructMatrix *A,
+                               HYPRE_Int           num_powers,
+                               HYPRE_Int           depth )
+{
+   hypre_StructMatvecPowersData *powers_data = (hypre_StructMatvecPowersData *)powers_vdata;
+
+   hypre_StructGrid     *grid    = hypre_StructMatrixGrid(A);
+   hypre_StructStencil  *stencil = hypre_StructMatrixStencil(A);
+   HYPRE_Int             num_ghost[2 * HYPRE_MAXDIM];
+   HYPRE_Int             d, step;
+
+   if (hypre_StructMatrixConstantCoefficient(A) != 0 || hypre_StructMatrixCoeffFcn(A))
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   /*----------------------------------------------------------
+    * Number of products per exchange
+    *----------------------------------------------------------*/
+
+   hypre_StructHaloNumGhost(stencil, 1, num_ghost);
+   if (depth <= 0)
+   {
+      depth = num_powers;
+   }
+   depth = hypre_min(depth, num_powers);
+   depth = hypre_min(depth, hypre_StructHaloMaxDepth(grid, num_ghost));
+   depth = hypre_max(depth, 1);
+
+   /*----------------------------------------------------------
+    * Regions of the steps between two exchanges
+    *----------------------------------------------------------*/
+
+   (powers_data -> compute_boxes) = hypre_TAlloc(hypre_BoxArrayArray *, depth,
+                                                 HYPRE_MEMORY_HOST);
+   for (step = 1; step <= depth; step++)
+   {
+      hypre_StructHaloComputeBoxes(grid, num_ghost, depth, step,
+                                   &(powers_data -> compute_boxes[step - 1]));
+   }
+
+   /*----------------------------------------------------------
+    * Matrix and work vectors with the deep ghost layer
+    *----------------------------------------------------------*/
+
+   for (d = 0; d < 2 * HYPRE_MAXDIM; d++)
+   {
+      num_ghost[d] *= depth;
+   }
+
+   (powers_data -> A)    = hypre_StructHaloMatrixCreate(A, num_ghost);
+   (powers_data -> v[0]) = hypre_StructHaloVectorCreate(grid, num_ghost);
+   (powers_data -> v[1]) = hypre_StructHaloVectorCreate(grid, num_ghost);
+   hypre_StructHaloCommPkgCreate(grid, num_ghost,
+                                 hypre_StructVectorDataSpace(powers_data -> v[0]), 1,
+                                 &(powers_data -> comm_pkg));
+
+   (powers_data -> num_powers) = num_powers;
+   (powers_data -> depth)      = depth;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecPowersCompute
+ *
+ * Computes y[j] = A^(j+1) x for j = 0, ..., num_powers-1.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecPowersCompute( void                *powers_vdata,
+                                 hypre_StructVector  *x,
+                                 hypre_StructVector **y )
+{
+   hypre_StructMatvecPowersData *powers_data = (hypre_StructMatvecPowersData *)powers_vdata;
+
+   hypre_StructMatrix    *A             = (powers_data -> A);
+   HYPRE_Int              num_powers    = (powers_data -> num_powers);
+   HYPRE_Int              depth         = (powers_data -> depth);
+   hypre_StructVector   **v             = (powers_data -> v);
+   hypre_CommPkg         *comm_pkg      = (powers_data -> comm_pkg);
+   HYPRE_Int              ndim          = hypre_StructVectorNDim(x);
+
+   hypre_CommHandle      *comm_handle;
+   hypre_BoxArrayArray   *compute_box_aa;
+   hypre_Box             *compute_box;
+   hypre_Box             *v_data_box;
+   HYPRE_Complex         *vp;
+   hypre_Index            unit_stride, loop_size;
+   hypre_IndexRef         start;
+   HYPRE_Int              power, nsteps, step, cur, i;
+
+   hypre_SetIndex(unit_stride, 1);
+
+   cur = 0;
+   hypre_StructCopy(x, v[cur]);
+
+   for (power = 0; power < num_powers; power += nsteps)
+   {
+      nsteps = hypre_min(depth, num_powers - power);
+
+      hypre_InitializeCommunication(comm_pkg, hypre_StructVectorData(v[cur]),
+                                    hypre_StructVectorData(v[cur]), 0, 0, &comm_handle);
+      hypre_FinalizeCommunication(comm_handle);
+
+      /* the last block may have fewer steps and starts at a smaller region */
+      for (step = depth - nsteps; step < depth; step++)
+      {
+         compute_box_aa = (powers_data -> compute_boxes[step]);
+
+         /* v[1-cur] = A v[cur] on the region of this step */
+         hypre_ForBoxArrayI(i, compute_box_aa)
+         {
+            compute_box = hypre_BoxArrayBox(hypre_BoxArrayArrayBoxArray(compute_box_aa, i), 0);
+            v_data_box  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(v[1 - cur]), i);
+            vp          = hypre_StructVectorBoxData(v[1 - cur], i);
+            start       = hypre_BoxIMin(compute_box);
+            hypre_BoxGetSize(compute_box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(vp)
+            hypre_BoxLoop1Begin(ndim, loop_size,
+                                v_data_box, start, unit_stride, vi);
+            {
+               vp[vi] = 0.0;
+            }
+            hypre_BoxLoop1End(vi);
+#undef DEVICE_VAR
+         }
+         hypre_StructMatvecCC0(1.0, A, v[cur], v[1 - cur], compute_box_aa, unit_stride);
+
+         cur = 1 - cur;
+         hypre_StructCopy(v[cur], y[power + step - (depth - nsteps)]);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecPowers
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecPowers( hypre_StructMatrix  *A,
+                          hypre_StructVector  *x,
+                          HYPRE_Int            num_powers,
+                          hypre_StructVector **y )
+{
+   void *powers_data;
+
+   powers_data = hypre_StructMatvecPowersCreate();
+   hypre_StructMatvecPowersSetup(powers_data, A, num_powers, 0);
+   hypre_StructMatvecPowersCompute(powers_data, x, y);
+   hypre_StructMatvecPowersDestroy(powers_data);
+
+   return hypre_error_flag;
+}
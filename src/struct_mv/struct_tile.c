@@ -0,0 +1,359 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Tile sizes for the tiled host BoxLoops
+ *
+ * Tile sizes come either from HYPRE_SetStructTileSize or, when tuning is on,
+ * from a per-handle cache of (loop size, tile size) pairs that is filled at
+ * setup by hypre_StructTileTune.  In both cases the tiles are refined in the
+ * slowest directions until there is at least one tile per thread.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_mv.h"
+
+/* loops smaller than this are not tuned (and not tiled unless requested) */
+#define HYPRE_STRUCT_TILE_MIN_VOLUME 32768
+
+/* entries of the tile cache: loop size followed by tile size */
+#define HYPRE_STRUCT_TILE_ENTRY 6
+
+/*--------------------------------------------------------------------------
+ * Refine tile_size in the slowest directions until every thread gets a tile.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_StructTileBalance( HYPRE_Int    ndim,
+                         hypre_Index  loop_size,
+                         hypre_Index  tile_size )
+{
+   HYPRE_Int  num_threads = hypre_NumThreads();
+   HYPRE_Int  num_tiles, nt, rest, need, d;
+
+   num_tiles = 1;
+   for (d = 0; d < ndim; d++)
+   {
+      if (loop_size[d] < 1)
+      {
+         return hypre_error_flag;
+      }
+      num_tiles *= (loop_size[d] + tile_size[d] - 1) / tile_size[d];
+   }
+
+   for (d = ndim - 1; (d >= 0) && (num_tiles < num_threads); d--)
+   {
+      nt   = (loop_size[d] + tile_size[d] - 1) / tile_size[d];
+      rest = num_tiles / nt;
+      need = hypre_min((num_threads + rest - 1) / rest, loop_size[d]);
+
+      tile_size[d] = (loop_size[d] + need - 1) / need;
+      num_tiles    = rest * ((loop_size[d] + tile_size[d] - 1) / tile_size[d]);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Look up loop_size in the tile cache.  Returns 1 if found.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_StructTileLookup( HYPRE_Int    ndim,
+                        hypre_Index  loop_size,
+                        hypre_Index  tile_size )
+{
+   hypre_Handle *handle     = hypre_handle();
+   HYPRE_Int    *cache      = hypre_HandleStructTileCache(handle);
+   HYPRE_Int     cache_size = hypre_HandleStructTileCacheSize(handle);
+   HYPRE_Int    *entry;
+   HYPRE_Int     e, d;
+
+   for (e = 0; e < cache_size; e++)
+   {
+      entry = cache + e * HYPRE_STRUCT_TILE_ENTRY;
+      for (d = 0; d < 3; d++)
+      {
+         if (entry[d] != ((d < ndim) ? loop_size[d] : 1))
+         {
+            break;
+         }
+      }
+      if (d == 3)
+      {
+         for (d = 0; d < ndim; d++)
+         {
+            tile_size[d] = entry[3 + d];
+         }
+         return 1;
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructTileGetSize
+ *
+ * Returns the tile size to use with hypre_TiledBoxLoop for a loop of size
+ * loop_size.  Without tiling, the tiles are slabs with one per thread.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructTileGetSize( HYPRE_Int    ndim,
+                         hypre_Index  loop_size,
+                         hypre_Index  tile_size )
+{
+   hypre_Handle *handle    = hypre_handle();
+   HYPRE_Int    *user_size = hypre_HandleStructTileSize(handle);
+   HYPRE_Int     d;
+
+   for (d = 0; d < HYPRE_MAXDIM; d++)
+   {
+      tile_size[d] = 1;
+   }
+   for (d = 0; d < ndim; d++)
+   {
+      tile_size[d] = hypre_max(loop_size[d], 1);
+      if (d < 3 && user_size[d] > 0)
+      {
+         tile_size[d] = hypre_min(user_size[d], tile_size[d]);
+      }
+   }
+
+   if (hypre_HandleStructTileTune(handle))
+   {
+      hypre_StructTileLookup(ndim, loop_size, tile_size);
+   }
+
+   hypre_StructTileBalance(ndim, loop_size, tile_size);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Time one stencil sweep y = A x over a loop with the given tile size.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+hypre_StructTileTime( HYPRE_Int       ndim,
+                      hypre_Index     loop_size,
+                      hypre_Index     tile_size,
+                      hypre_Box      *A_data_box,
+                      hypre_Box      *x_data_box,
+                      hypre_IndexRef  start,
+                      hypre_IndexRef  stride,
+                      HYPRE_Int       stencil_size,
+                      HYPRE_Complex **Ap,
+                      HYPRE_Int      *xoff,
+                      HYPRE_Complex  *xp,
+                      HYPRE_Complex  *yp )
+{
+   HYPRE_Real  time_begin, time;
+   HYPRE_Int   rep;
+
+   time = -1.0;
+   for (rep = 0; rep < 2; rep++)
+   {
+      time_begin = hypre_MPI_Wtime();
+
+      zypre_TiledBoxLoop3Begin(ndim, loop_size, tile_size,
+                               A_data_box, start, stride, Ai,
+                               x_data_box, start, stride, xi,
+                               x_data_box, start, stride, yi);
+      {
+         HYPRE_Complex  val = 0.0;
+         HYPRE_Int      si;
+
+         for (si = 0; si < stencil_size; si++)
+         {
+            val += Ap[si][Ai] * xp[xi + xoff[si]];
+         }
+         yp[yi] = val;
+      }
+      zypre_TiledBoxLoop3End(Ai, xi, yi);
+
+      time_begin = hypre_MPI_Wtime() - time_begin;
+      if (time < 0.0 || time_begin < time)
+      {
+         time = time_begin;
+      }
+   }
+
+   return time;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructTileTune
+ *
+ * Picks tile sizes for the loops over compute_box_aa (with the given stride)
+ * by timing a stencil sweep with the coefficients of A for a few candidate
+ * tile sizes.  The result is cached per loop size, so each size is tuned only
+ * once.  Does nothing unless tuning was requested with
+ * HYPRE_SetStructTileTune, or for device data, constant coefficients and
+ * generated coefficients.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructTileTune( hypre_StructMatrix  *A,
+                      hypre_BoxArrayArray *compute_box_aa,
+                      hypre_IndexRef       stride )
+{
+   hypre_Handle         *handle  = hypre_handle();
+   HYPRE_Int             ndim    = hypre_StructMatrixNDim(A);
+   hypre_StructStencil  *stencil = hypre_StructMatrixStencil(A);
+   hypre_Index          *shape   = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size = hypre_StructStencilSize(stencil);
+
+   /* candidate tile sizes; 0 means no tiling in that direction */
+   HYPRE_Int             cand_i[3] = {0, 128, 64};
+   HYPRE_Int             cand_j[4] = {0, 32, 16, 8};
+   HYPRE_Int             cand_k[3] = {0, 16, 8};
+
+   hypre_BoxArray       *compute_box_a;
+   hypre_Box            *compute_box;
+   hypre_Box            *A_data_box;
+   hypre_Box            *x_data_box;
+   hypre_IndexRef        start;
+   hypre_Index           loop_size, tile_size, best_size;
+
+   HYPRE_Complex       **Ap;
+   HYPRE_Complex        *xp, *yp;
+   HYPRE_Int            *xoff;
+   HYPRE_Int            *cache, *entry;
+   HYPRE_Int             cache_size, volume, xvolume, width;
+   HYPRE_Int             ci, cj, ck, i, j, si, d;
+   HYPRE_Real            time, best_time;
+
+   if (!hypre_HandleStructTileTune(handle) ||
+       hypre_StructMatrixConstantCoefficient(A) ||
+       hypre_StructMatrixCoeffFcn(A) ||
+       hypre_GetExecPolicy1(hypre_StructMatrixMemoryLocation(A)) == HYPRE_EXEC_DEVICE)
+   {
+      return hypre_error_flag;
+   }
+
+   /* the scratch vectors are padded by the stencil width */
+   width = 0;
+   for (si = 0; si < stencil_size; si++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         width = hypre_max(width, hypre_abs(hypre_IndexD(shape[si], d)));
+      }
+   }
+
+   Ap   = hypre_TAlloc(HYPRE_Complex *, stencil_size, HYPRE_MEMORY_HOST);
+   xoff = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   x_data_box = hypre_BoxCreate(ndim);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+      A_data_box    = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+         start = hypre_BoxIMin(compute_box);
+         hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+
+         volume = 1;
+         for (d = 0; d < ndim; d++)
+         {
+            volume *= loop_size[d];
+         }
+         if (volume < HYPRE_STRUCT_TILE_MIN_VOLUME ||
+             hypre_StructTileLookup(ndim, loop_size, tile_size))
+         {
+            continue;
+         }
+
+         hypre_CopyBox(A_data_box, x_data_box);
+         hypre_BoxGrowByValue(x_data_box, width);
+         xvolume = hypre_BoxVolume(x_data_box);
+         xp = hypre_CTAlloc(HYPRE_Complex, xvolume, HYPRE_MEMORY_HOST);
+         yp = hypre_CTAlloc(HYPRE_Complex, xvolume, HYPRE_MEMORY_HOST);
+         for (si = 0; si < stencil_size; si++)
+         {
+            Ap[si]   = hypre_StructMatrixBoxData(A, i, si);
+            xoff[si] = hypre_BoxOffsetDistance(x_data_box, shape[si]);
+         }
+
+         /* time the candidates, keeping the fastest */
+         best_time = -1.0;
+         hypre_SetIndex(best_size, 1);
+         for (ck = 0; ck < ((ndim > 2) ? 3 : 1); ck++)
+         {
+            for (cj = 0; cj < ((ndim > 1) ? 4 : 1); cj++)
+            {
+               for (ci = 0; ci < 3; ci++)
+               {
+                  HYPRE_Int  cand[3];
+
+                  cand[0] = cand_i[ci];
+                  cand[1] = cand_j[cj];
+                  cand[2] = cand_k[ck];
+
+                  hypre_SetIndex(tile_size, 1);
+                  for (d = 0; d < ndim; d++)
+                  {
+                     tile_size[d] = loop_size[d];
+                     if (cand[d] > 0)
+                     {
+                        if (cand[d] >= loop_size[d])
+                        {
+                           break;
+                        }
+                        tile_size[d] = cand[d];
+                     }
+                  }
+                  if (d < ndim)
+                  {
+                     /* same as a candidate without tiling in direction d */
+                     continue;
+                  }
+                  hypre_StructTileBalance(ndim, loop_size, tile_size);
+
+                  time = hypre_StructTileTime(ndim, loop_size, tile_size,
+                                              A_data_box, x_data_box, start, stride,
+                                              stencil_size, Ap, xoff, xp, yp);
+                  if (best_time < 0.0 || time < best_time)
+                  {
+                     best_time = time;
+                     hypre_CopyIndex(tile_size, best_size);
+                  }
+               }
+            }
+         }
+
+         hypre_TFree(xp, HYPRE_MEMORY_HOST);
+         hypre_TFree(yp, HYPRE_MEMORY_HOST);
+
+         /* add the result to the cache */
+         cache_size = hypre_HandleStructTileCacheSize(handle);
+         cache = hypre_TReAlloc(hypre_HandleStructTileCache(handle), HYPRE_Int,
+                                (cache_size + 1) * HYPRE_STRUCT_TILE_ENTRY,
+                                HYPRE_MEMORY_HOST);
+         entry = cache + cache_size * HYPRE_STRUCT_TILE_ENTRY;
+         for (d = 0; d < 3; d++)
+         {
+            entry[d]     = (d < ndim) ? loop_size[d] : 1;
+            entry[3 + d] = (d < ndim) ? best_size[d] : 1;
+         }
+         hypre_HandleStructTileCache(handle)     = cache;
+         hypre_HandleStructTileCacheSize(handle) = cache_size + 1;
+      }
+   }
+
+   hypre_BoxDestroy(x_data_box);
+   hypre_TFree(Ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
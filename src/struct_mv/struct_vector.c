@@ -1273,6 +1273,137 @@ hypre_StructVectorRead( MPI_Comm    comm,
    return vector;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructVectorPrintBinary
+ *
+ * Collective.  Writes the values on the grid boxes to a single binary file
+ * shared by all processes (see hypre_WriteBoxArrayDataBinary).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructVectorPrintBinary( const char         *filename,
+                               hypre_StructVector *vector )
+{
+   MPI_Comm              comm            = hypre_StructVectorComm(vector);
+   hypre_BoxArray       *boxes           = hypre_StructGridBoxes(hypre_StructVectorGrid(vector));
+   HYPRE_MemoryLocation  memory_location = hypre_StructVectorMemoryLocation(vector);
+
+   hypre_Box            *box;
+   HYPRE_Complex        *values, *h_values;
+   HYPRE_Int             size, i;
+
+   /* Pack the values box by box */
+   size = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      size += hypre_BoxVolume(hypre_BoxArrayBox(boxes, i));
+   }
+   values = hypre_TAlloc(HYPRE_Complex, size, memory_location);
+
+   size = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      hypre_StructVectorSetBoxValues(vector, box, box, values + size, -1, i, 0);
+      size += hypre_BoxVolume(box);
+   }
+
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      h_values = hypre_TAlloc(HYPRE_Complex, size, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(h_values, values, HYPRE_Complex, size,
+                    HYPRE_MEMORY_HOST, memory_location);
+      hypre_TFree(values, memory_location);
+   }
+   else
+   {
+      h_values = values;
+   }
+
+   hypre_WriteBoxArrayDataBinary(comm, filename, boxes, 1, 0, NULL, 0, NULL, h_values);
+
+   hypre_TFree(h_values, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructVectorReadBinary
+ *
+ * Reads the values on the grid boxes of an initialized vector from a file
+ * written by hypre_StructVectorPrintBinary.  The grid may be distributed
+ * differently from the one that was written.  Values at points that are not in
+ * the file are left unchanged.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructVectorReadBinary( const char         *filename,
+                              hypre_StructVector *vector )
+{
+   hypre_BoxArray       *boxes           = hypre_StructGridBoxes(hypre_StructVectorGrid(vector));
+   HYPRE_MemoryLocation  memory_location = hypre_StructVectorMemoryLocation(vector);
+
+   hypre_Box            *box;
+   HYPRE_Complex        *values, *h_values;
+   HYPRE_Int             size, i;
+
+   /* Start from the current values, so points that are not in the file (or
+    * are not read because of an error) are left unchanged */
+   size = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      size += hypre_BoxVolume(hypre_BoxArrayBox(boxes, i));
+   }
+   values = hypre_TAlloc(HYPRE_Complex, size, memory_location);
+
+   size = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      hypre_StructVectorSetBoxValues(vector, box, box, values + size, -1, i, 0);
+      size += hypre_BoxVolume(box);
+   }
+
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      h_values = hypre_TAlloc(HYPRE_Complex, size, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(h_values, values, HYPRE_Complex, size,
+                    HYPRE_MEMORY_HOST, memory_location);
+      hypre_TFree(values, memory_location);
+   }
+   else
+   {
+      h_values = values;
+   }
+
+   hypre_ReadBoxArrayDataBinary(filename, boxes, 1, 0, NULL, 0, NULL, h_values);
+
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      values = hypre_TAlloc(HYPRE_Complex, size, memory_location);
+      hypre_TMemcpy(values, h_values, HYPRE_Complex, size,
+                    memory_location, HYPRE_MEMORY_HOST);
+      hypre_TFree(h_values, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      values = h_values;
+   }
+
+   /* Unpack the values box by box */
+   size = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      hypre_StructVectorSetBoxValues(vector, box, box, values + size, 0, i, 0);
+      size += hypre_BoxVolume(box);
+   }
+
+   hypre_TFree(values, memory_location);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * The following is used only as a debugging aid.
  *
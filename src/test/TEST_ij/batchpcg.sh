@@ -0,0 +1,62 @@
+#!/bin/bash
+# Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+# HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+#
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+
+TNAME=`basename $0 .sh`
+RTOL=$1
+ATOL=$2
+
+#=============================================================================
+# Breakdown systems must not change the iteration counts of the others
+#=============================================================================
+
+grep "^System" ${TNAME}.out.0 > ${TNAME}.testdata
+grep "^System" ${TNAME}.out.2 | head -12 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "^System" ${TNAME}.out.1 > ${TNAME}.testdata
+grep "^System" ${TNAME}.out.3 | head -12 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# Per-system results must not depend on the number of processes
+#=============================================================================
+
+grep "^System\|^Breakdown" ${TNAME}.out.2 > ${TNAME}.testdata
+grep "^System\|^Breakdown" ${TNAME}.out.4 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "^System\|^Breakdown" ${TNAME}.out.3 > ${TNAME}.testdata
+grep "^System\|^Breakdown" ${TNAME}.out.5 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# compare with baseline case
+#=============================================================================
+
+FILES="\
+ ${TNAME}.out.0\
+ ${TNAME}.out.1\
+ ${TNAME}.out.2\
+ ${TNAME}.out.3\
+ ${TNAME}.out.4\
+ ${TNAME}.out.5\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep "^System\|^Breakdown" $i
+  tail -3 $i
+done > ${TNAME}.out
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
+rm -f ${TNAME}.testdata*
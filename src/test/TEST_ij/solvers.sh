@@ -49,6 +49,58 @@ tail -3 ${TNAME}.out.403.p | head -2 > ${TNAME}.testdata
 tail -3 ${TNAME}.out.403.n | head -2 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+tail -3 ${TNAME}.out.406.csr | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.406.sell | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.407.csr | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.407.sell | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+# The numeric resetup keeps the CF splitting and the interpolation patterns
+# of the first setup, so it may take more iterations than a full setup, but
+# no more than 1.5 times as many
+its_full=`grep "^Iterations" ${TNAME}.out.410.full | awk '{print $NF}'`
+its_num=`grep "^Iterations" ${TNAME}.out.410.num | awk '{print $NF}'`
+if ! awk -v a="$its_full" -v b="$its_num" 'BEGIN {exit !(a > 0 && b > 0 && 2*b <= 3*a)}'; then
+   echo "Iterations of ${TNAME}.out.410.num exceed 1.5 times those of ${TNAME}.out.410.full: $its_num $its_full" >&2
+fi
+
+# The overlap relaxes the interior rows first, so only the iteration counts
+# are the same; the final residual norms must agree within a factor of 10
+tail -3 ${TNAME}.out.411.std | head -1 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.411.ov | head -1 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+res_std=`grep "Final Relative Residual Norm" ${TNAME}.out.411.std | awk '{print $NF}'`
+res_ov=`grep "Final Relative Residual Norm" ${TNAME}.out.411.ov | awk '{print $NF}'`
+if ! awk -v a="$res_std" -v b="$res_ov" 'BEGIN {exit !(a > 0 && b > 0 && a < 10*b && b < 10*a)}'; then
+   echo "Final residuals of ${TNAME}.out.411.std and ${TNAME}.out.411.ov differ: $res_std $res_ov" >&2
+fi
+
+tail -3 ${TNAME}.out.412.sep | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.412.fused | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.413.std | head -1 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.413.pipe | head -1 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.415.cgs2 | head -1 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.415.cgs3 | head -1 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+if ! grep -q "^0,relax," ${TNAME}.out.417.csv; then
+   echo "Missing relaxation entry in ${TNAME}.out.417.csv" >&2
+fi
+
+# The product plans sum in another order than a full Galerkin product, so the
+# coarse operators of each resetup must agree with it up to a relative
+# difference (Frobenius norm) of 1e-12; about 1e-16 is seen at np=3
+if [ `grep -c "relative difference to full Galerkin" ${TNAME}.out.420` != 3 ]; then
+   echo "Missing Galerkin product checks in ${TNAME}.out.420" >&2
+fi
+grep "relative difference to full Galerkin" ${TNAME}.out.420 | awk '$NF > 1e-12 {print}' >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -186,6 +238,18 @@ FILES="\
  ${TNAME}.out.213\
  ${TNAME}.out.404\
  ${TNAME}.out.405\
+ ${TNAME}.out.408\
+ ${TNAME}.out.409\
+ ${TNAME}.out.410.full\
+ ${TNAME}.out.410.num\
+ ${TNAME}.out.411.std\
+ ${TNAME}.out.411.ov\
+ ${TNAME}.out.414\
+ ${TNAME}.out.416\
+ ${TNAME}.out.417\
+ ${TNAME}.out.418\
+ ${TNAME}.out.419\
+ ${TNAME}.out.420\
 "
 
 for i in $FILES
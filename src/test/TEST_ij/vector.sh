@@ -81,5 +81,59 @@ if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
    echo "Incorrect number of runs in ${TNAME}.out.B" >&2
 fi
 
+#=============================================================================
+# C. SpMM kernels for interleaved multivectors with 2, 4, 8 and 16 vectors
+#=============================================================================
+
+# The kernels sum in the same order as the single vector and column-major
+# loops, so the products must agree up to contracted multiply-adds (1e-14)
+for i in C0 C1 C2 C3
+do
+  if [ `grep -c "Relative difference" ${TNAME}.out.$i` != 2 ]; then
+     echo "Missing matvec checks in ${TNAME}.out.$i" >&2
+  fi
+  grep "Relative difference" ${TNAME}.out.$i | awk '$NF > 1e-14 {print}' >&2
+done
+
+# With identical components, the multivector solves must match a single vector
+for i in C11 C12 C13 C14
+do
+  tail -3 ${TNAME}.out.C10 > ${TNAME}.testdata
+  tail -3 ${TNAME}.out.$i > ${TNAME}.testdata.temp
+  diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+for i in C21 C22
+do
+  tail -3 ${TNAME}.out.C20 > ${TNAME}.testdata
+  tail -3 ${TNAME}.out.$i > ${TNAME}.testdata.temp
+  diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+FILES="\
+ ${TNAME}.out.C10\
+ ${TNAME}.out.C11\
+ ${TNAME}.out.C12\
+ ${TNAME}.out.C13\
+ ${TNAME}.out.C14\
+ ${TNAME}.out.C20\
+ ${TNAME}.out.C21\
+ ${TNAME}.out.C22
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -3 $i
+done > ${TNAME}.out.C
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out.C | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out.C" >&2
+fi
+
+rm -f ${TNAME}.testdata*
+
 # put all of the output files together
 cat ${TNAME}.out.[A-Z] > ${TNAME}.out
@@ -0,0 +1,74 @@
+#!/bin/bash
+# Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+# HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+#
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+
+TNAME=`basename $0 .sh`
+RTOL=$1
+ATOL=$2
+
+#=============================================================================
+# Check that the direct ParCSR build matches IJ assembly
+#=============================================================================
+
+tail -3 ${TNAME}.out.00 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.01 > ${TNAME}.testdata.temp
+(../runcheck.sh ${TNAME}.testdata ${TNAME}.testdata.temp $RTOL $ATOL) >&2
+
+tail -3 ${TNAME}.out.02 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.03 > ${TNAME}.testdata.temp
+(../runcheck.sh ${TNAME}.testdata ${TNAME}.testdata.temp $RTOL $ATOL) >&2
+
+tail -3 ${TNAME}.out.04 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.05 > ${TNAME}.testdata.temp
+(../runcheck.sh ${TNAME}.testdata ${TNAME}.testdata.temp $RTOL $ATOL) >&2
+
+tail -3 ${TNAME}.out.06 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.07 > ${TNAME}.testdata.temp
+(../runcheck.sh ${TNAME}.testdata ${TNAME}.testdata.temp $RTOL $ATOL) >&2
+
+tail -3 ${TNAME}.out.08 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.09 > ${TNAME}.testdata.temp
+(../runcheck.sh ${TNAME}.testdata ${TNAME}.testdata.temp $RTOL $ATOL) >&2
+
+tail -3 ${TNAME}.out.10 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.11 > ${TNAME}.testdata.temp
+(../runcheck.sh ${TNAME}.testdata ${TNAME}.testdata.temp $RTOL $ATOL) >&2
+
+tail -3 ${TNAME}.out.12 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.13 > ${TNAME}.testdata.temp
+(../runcheck.sh ${TNAME}.testdata ${TNAME}.testdata.temp $RTOL $ATOL) >&2
+
+tail -3 ${TNAME}.out.14 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.15 > ${TNAME}.testdata.temp
+(../runcheck.sh ${TNAME}.testdata ${TNAME}.testdata.temp $RTOL $ATOL) >&2
+
+#=============================================================================
+# compare with baseline case
+#=============================================================================
+
+TNUM="\
+ 00 01 02 03 04 05 06 07\
+ 08 09 10 11 12 13 14 15\
+"
+
+for i in $TNUM
+do
+  FILE="${TNAME}.out.$i"
+  echo "# Output file: ${FILE}"
+  tail -3 ${FILE}
+done > ${TNAME}.out
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $TNUM | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
+#=============================================================================
+# remove temporary files
+#=============================================================================
+
+rm -f ${TNAME}.testdata*
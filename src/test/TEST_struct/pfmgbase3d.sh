@@ -46,6 +46,14 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 tail -3 ${TNAME}.out.7 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+
+tail -3 ${TNAME}.out.8 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+
+tail -3 ${TNAME}.out.9 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -59,6 +67,8 @@ FILES="\
  ${TNAME}.out.5\
  ${TNAME}.out.6\
  ${TNAME}.out.7\
+ ${TNAME}.out.8\
+ ${TNAME}.out.9\
 "
 
 for i in $FILES
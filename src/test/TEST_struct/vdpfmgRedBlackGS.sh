@@ -64,6 +64,9 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 tail -3 ${TNAME}.out.11 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+tail -3 ${TNAME}.out.12 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -81,6 +84,7 @@ FILES="\
  ${TNAME}.out.9\
  ${TNAME}.out.10\
  ${TNAME}.out.11\
+ ${TNAME}.out.12\
 "
 
 for i in $FILES
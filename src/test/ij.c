@@ -97,6 +97,15 @@ HYPRE_Int SetSysVcoefValues(HYPRE_Int num_fun, HYPRE_BigInt nx, HYPRE_BigInt ny,
 HYPRE_Int BuildParCoordinates (HYPRE_Int argc, char *argv [], HYPRE_Int arg_index,
                                HYPRE_Int *coorddim_ptr, float **coord_ptr );
 
+HYPRE_Int ScaleHalfMatrix (HYPRE_ParCSRMatrix parcsr_A, HYPRE_Real scale);
+HYPRE_Int TestMultiVectorMatvec (HYPRE_ParCSRMatrix parcsr_A, HYPRE_Int num_vectors);
+
+/* From _hypre_parcsr_ls.h, which declares builders that conflict with the ones above */
+HYPRE_Int hypre_BoomerAMGResetupGalerkinDiff ( void *amg_vdata, HYPRE_Real *rel_diff );
+HYPRE_Int TestBatchPCG (HYPRE_ParCSRMatrix parcsr_A, HYPRE_Int num_regular,
+                        HYPRE_Int breakdown, HYPRE_Int precond_type,
+                        HYPRE_Real tol, HYPRE_Int max_iter );
+
 extern HYPRE_Int hypre_FlexGMRESModifyPCAMGExample(void *precond_data, HYPRE_Int iterations,
                                                    HYPRE_Real rel_residual_norm);
 
@@ -116,8 +125,11 @@ main( hypre_int argc,
    HYPRE_Int           add = 0;
    HYPRE_Int           check_constant = 0;
    HYPRE_Int           off_proc = 0;
+   HYPRE_Int           elements = 0;
+   HYPRE_Int           offproc_stream = 0;
    HYPRE_Int           chunk = 0;
    HYPRE_Int           omp_flag = 0;
+   HYPRE_Int           num_threads = 0;
    HYPRE_Int           build_matrix_type;
    HYPRE_Int           build_matrix_arg_index;
    HYPRE_Int           build_matrix_M;
@@ -217,6 +229,7 @@ main( hypre_int argc,
    HYPRE_Int           test_init = 0;
    HYPRE_Int           test_ij = 0;
    HYPRE_Int           test_multivec = 0;
+   HYPRE_Int           test_spmm = 0;
    HYPRE_Int           test_scaling = 0;
    HYPRE_Int           test_error = 0;
 
@@ -275,6 +288,11 @@ main( hypre_int argc,
    HYPRE_Int    rap2     = 0;
    HYPRE_Int    mod_rap2 = 0;
    HYPRE_Int    keepTranspose = 0;
+   HYPRE_Int    mixed_precision = 0;
+   HYPRE_Int    numeric_resetup = 0;
+   HYPRE_Int    relax_overlap = 0;
+   HYPRE_Int    fused_transfer = 0;
+   char        *amg_profile_file = NULL;
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int    dslu_threshold = -1;
 #endif
@@ -295,6 +313,9 @@ main( hypre_int argc,
    HYPRE_Int  cheby_scale = 1;
    HYPRE_Real cheby_fraction = .3;
 
+   /* host SpMV storage */
+   HYPRE_Int  spmv_use_sell = 0;
+
 #if defined(HYPRE_USING_GPU)
 #if defined(HYPRE_USING_CUSPARSE) && CUSPARSE_VERSION >= 11000
    /* CUSPARSE_SPMV_ALG_DEFAULT doesn't provide deterministic results */
@@ -316,6 +337,11 @@ main( hypre_int argc,
 #endif
    HYPRE_Int      nmv = 100;
 
+   /* batched PCG test */
+   HYPRE_Int      batch_pcg = 0;
+   HYPRE_Int      batch_pcg_precond = 1;
+   HYPRE_Int      batch_pcg_breakdown = 0;
+
    /* for CGC BM Aug 25, 2006 */
    HYPRE_Int      cgcits = 1;
    /* for coordinate plotting BM Oct 24, 2006 */
@@ -346,6 +372,7 @@ main( hypre_int argc,
    /* parameters for COGMRES */
    HYPRE_Int    cgs = 1;
    HYPRE_Int    unroll = 0;
+   HYPRE_Int    cogmres_pipelined = 0;
    /* parameters for LGMRES */
    HYPRE_Int    aug_dim;
    /* parameters for GSMG */
@@ -387,6 +414,12 @@ main( hypre_int argc,
    HYPRE_Int  two_norm = 1;
    HYPRE_Int  skip_break = 0;
    HYPRE_Int  flex = 0;
+   HYPRE_Int  pcg_variant = 0;
+   HYPRE_Int  pcg_s_step = 3;
+   HYPRE_Int  second_n = 0;
+   HYPRE_Real second_scale = 0.0;
+   HYPRE_Int  num_resetups = 1;
+   HYPRE_Int  resetup_check = 0;
    HYPRE_Int  pcgIterations = 0;
    HYPRE_Int  pcgMode = 1;
    HYPRE_Real pcgTol = 1e-2;
@@ -756,6 +789,11 @@ main( hypre_int argc,
          arg_index++;
          test_multivec = 1;
       }
+      else if ( strcmp(argv[arg_index], "-test_spmm") == 0 )
+      {
+         arg_index++;
+         test_spmm = 1;
+      }
       else if ( strcmp(argv[arg_index], "-test_scaling") == 0 )
       {
          arg_index++;
@@ -803,11 +841,26 @@ main( hypre_int argc,
          arg_index++;
          off_proc = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-elements") == 0 )
+      {
+         arg_index++;
+         elements = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-offproc_stream") == 0 )
+      {
+         arg_index++;
+         offproc_stream = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-omp") == 0 )
       {
          arg_index++;
          omp_flag = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+         num_threads = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_constant") == 0 )
       {
          arg_index++;
@@ -844,6 +897,11 @@ main( hypre_int argc,
          arg_index++;
          num_components = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-mv_sell") == 0 )
+      {
+         arg_index++;
+         spmv_use_sell = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-rhsfromfile") == 0 )
       {
          arg_index++;
@@ -1681,6 +1739,11 @@ main( hypre_int argc,
          arg_index++;
          unroll = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-cogmres_pipe") == 0 )
+      {
+         arg_index++;
+         cogmres_pipelined = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_residual") == 0 )
       {
          arg_index++;
@@ -1919,6 +1982,36 @@ main( hypre_int argc,
          arg_index++;
          flex  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pcg_variant") == 0 )
+      {
+         arg_index++;
+         pcg_variant  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-pcg_sstep") == 0 )
+      {
+         arg_index++;
+         pcg_s_step  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-second_n") == 0 )
+      {
+         arg_index++;
+         second_n  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-second_scale") == 0 )
+      {
+         arg_index++;
+         second_scale  = (HYPRE_Real)atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-num_resetups") == 0 )
+      {
+         arg_index++;
+         num_resetups  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-resetup_check") == 0 )
+      {
+         arg_index++;
+         resetup_check  = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-var") == 0 )
       {
          arg_index++;
@@ -2097,6 +2190,31 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-mixed_prec") == 0 )
+      {
+         arg_index++;
+         mixed_precision = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-numeric_resetup") == 0 )
+      {
+         arg_index++;
+         numeric_resetup = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-relax_overlap") == 0 )
+      {
+         arg_index++;
+         relax_overlap = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-fused_transfer") == 0 )
+      {
+         arg_index++;
+         fused_transfer = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-amg_profile") == 0 )
+      {
+         arg_index++;
+         amg_profile_file = argv[arg_index++];
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -2119,6 +2237,21 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-batch_pcg") == 0 )
+      {
+         arg_index++;
+         batch_pcg = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-batch_pcg_precond") == 0 )
+      {
+         arg_index++;
+         batch_pcg_precond = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-batch_pcg_breakdown") == 0 )
+      {
+         arg_index++;
+         batch_pcg_breakdown = 1;
+      }
       else if ( strcmp(argv[arg_index], "-printbin") == 0 )
       {
          arg_index++;
@@ -2275,9 +2408,16 @@ main( hypre_int argc,
          hypre_printf("  -exact_size            : inserts immediately into ParCSR structure\n");
          hypre_printf("  -storage_low           : allocates not enough storage for aux struct\n");
          hypre_printf("  -concrete_parcsr       : use parcsr matrix type as concrete type\n");
+         hypre_printf("  -mv_sell <val>         : use SELL-C-sigma storage for host SpMV\n");
+         hypre_printf("  -nthreads <val>        : number of OpenMP threads (ignored without OpenMP)\n");
+         hypre_printf("  -elements <val>        : with -test_ij, add two-point elements on the couplings\n");
+         hypre_printf("                           1=element plan, 2=HYPRE_IJMatrixAddToValues\n");
+         hypre_printf("  -offproc_stream <n>    : with -test_ij, stream off-proc AddToValues entries\n");
+         hypre_printf("                           in batches of n per destination (0=stash)\n");
          hypre_printf("\n");
          hypre_printf("  -rbm <val> <filename>  : rigid body mode vectors\n");
          hypre_printf("  -nc <val>              : number of components of a vector (multivector)\n");
+         hypre_printf("  -test_spmm             : compare matvecs with -nc vectors against single vectors\n");
          hypre_printf("  -rhsfromfile           : ");
          hypre_printf("rhs read from multiple files (IJ format)\n");
          hypre_printf("  -rhsfrombinfile        : ");
@@ -2437,6 +2577,11 @@ main( hypre_int argc,
          hypre_printf("  -jtr  <val>            : set truncation threshold for Jacobi interpolation = val \n");
          hypre_printf("  -Ssw  <val>            : set S-commpkg-switch = val \n");
          hypre_printf("  -mxrs <val>            : set AMG maximum row sum threshold for dependency weakening \n");
+         hypre_printf("  -mixed_prec <val>      : store AMG operators from level val on in single precision\n");
+         hypre_printf("  -numeric_resetup <val> : reuse CF splitting and P/R in AMG resetups (see -second_time)\n");
+         hypre_printf("  -relax_overlap <val>   : relax interior rows during halo exchange in hybrid GS\n");
+         hypre_printf("  -fused_transfer <val>  : fuse residual/restriction and interpolation/correction\n");
+         hypre_printf("  -amg_profile <file>    : write the per-level AMG profile to file (solvers 0, 1)\n");
          hypre_printf("  -nf <val>              : set number of functions for systems AMG\n");
          hypre_printf("  -numsamp <val>         : set number of sample vectors for GSMG\n");
 
@@ -2450,12 +2595,23 @@ main( hypre_int argc,
 
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
+         hypre_printf("  -cgs  <val>            : COGMRES orthogonalization (1: CGS, 2: CGS2, 3: one-reduce CGS2)\n");
+         hypre_printf("  -cogmres_pipe  <val>   : use pipelined COGMRES if val = 1\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
          hypre_printf("  -tol  <val>            : set solver convergence tolerance = val\n");
          hypre_printf("  -atol  <val>           : set solver absolute convergence tolerance = val\n");
          hypre_printf("  -max_iter  <val>       : set max iterations\n");
+         hypre_printf("  -pcg_variant  <val>    : PCG variant: 0 standard, 1 pipelined, 2 s-step\n");
+         hypre_printf("  -pcg_sstep  <val>      : number of steps per block of s-step PCG\n");
+         hypre_printf("  -second_n  <val>       : with -second_time, set up and solve PCG the second\n");
+         hypre_printf("                           time on a val^3 7-point Laplacian\n");
+         hypre_printf("  -second_scale  <val>   : with -second_time, scale the couplings within the first\n");
+         hypre_printf("                           half of the unknowns by val before the second PCG setup\n");
+         hypre_printf("  -num_resetups  <val>   : with -second_time, repeat the second PCG setup val times\n");
+         hypre_printf("  -resetup_check  <val>  : with -second_time and AMG-PCG, compare the coarse\n");
+         hypre_printf("                           operators after each setup with full Galerkin products\n");
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
@@ -2482,6 +2638,15 @@ main( hypre_int argc,
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
          hypre_printf("\n");
+         hypre_printf("  -batch_pcg <n>         : solve a batch of n local systems with\n");
+         hypre_printf("                           batched PCG instead of the solver; the\n");
+         hypre_printf("                           systems are shifted/scaled copies of the\n");
+         hypre_printf("                           local diagonal block of A\n");
+         hypre_printf("  -batch_pcg_precond <n> : batched PCG preconditioner\n");
+         hypre_printf("       0=none  1=Jacobi (default)  2=ILU(0)\n");
+         hypre_printf("  -batch_pcg_breakdown   : append a zero-rhs, an indefinite and a\n");
+         hypre_printf("                           singular system to the batch\n");
+         hypre_printf("\n");
          /* begin lobpcg */
 
          hypre_printf("LOBPCG options:\n");
@@ -2689,6 +2854,15 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* host SpMV storage */
+   ierr = HYPRE_SetSpMVUseSell(spmv_use_sell); hypre_assert(ierr == 0);
+
+   /* OpenMP threads; the default comes from OMP_NUM_THREADS */
+   if (num_threads > 0)
+   {
+      hypre_SetNumThreads(num_threads);
+   }
+
 #if defined(HYPRE_USING_GPU)
    ierr = HYPRE_SetSpMVUseVendor(spmv_use_vendor); hypre_assert(ierr == 0);
    /* use vendor implementation for SpGEMM */
@@ -3006,6 +3180,11 @@ main( hypre_int argc,
          HYPRE_IJMatrixSetOMPFlag(ij_A, 1);
       }
 
+      if (offproc_stream)
+      {
+         ierr += HYPRE_IJMatrixSetOffProcStreaming(ij_A, offproc_stream);
+      }
+
       /* move arrays to `memory_location' */
       HYPRE_Int    *num_cols_h = num_cols;
       HYPRE_BigInt *row_nums_h = row_nums;
@@ -3185,6 +3364,91 @@ main( hypre_int argc,
 
       ierr += HYPRE_IJMatrixAssemble( ij_A );
 
+      /* Add a two-point element [v -v; -v v] on each coupling (i,j), j > i,
+         either with the element plan or with HYPRE_IJMatrixAddToValues.
+         Both give the same matrix.  The matrix is applied once first, so
+         that the SELL copy (-mv_sell) is built before the values change. */
+      if (elements)
+      {
+         HYPRE_Int           num_elements = 0, e;
+         HYPRE_BigInt       *element_dofs;
+         HYPRE_Real         *element_values;
+         hypre_ParCSRMatrix *ij_parcsr;
+         hypre_ParVector    *ex, *ey;
+
+         ierr += HYPRE_IJMatrixGetObject( ij_A, &object);
+         ij_parcsr = (hypre_ParCSRMatrix *) object;
+         ex = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(ij_parcsr),
+                                    hypre_ParCSRMatrixRowStarts(ij_parcsr));
+         ey = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(ij_parcsr),
+                                    hypre_ParCSRMatrixRowStarts(ij_parcsr));
+         hypre_ParVectorInitialize(ex);
+         hypre_ParVectorInitialize(ey);
+         hypre_ParVectorSetConstantValues(ex, 1.0);
+         hypre_ParCSRMatrixMatvec(1.0, ij_parcsr, ex, 0.0, ey);
+         hypre_ParVectorDestroy(ex);
+         hypre_ParVectorDestroy(ey);
+
+         for (big_i = first_local_row; big_i <= last_local_row; big_i++)
+         {
+            ierr += HYPRE_ParCSRMatrixGetRow(parcsr_A, big_i, &size, &col_inds, &values);
+            for (j = 0; j < size; j++)
+            {
+               if (col_inds[j] > big_i)
+               {
+                  num_elements++;
+               }
+            }
+            ierr += HYPRE_ParCSRMatrixRestoreRow(parcsr_A, big_i, &size, &col_inds, &values);
+         }
+         element_dofs   = hypre_CTAlloc(HYPRE_BigInt, 2 * num_elements, HYPRE_MEMORY_HOST);
+         element_values = hypre_CTAlloc(HYPRE_Real,   4 * num_elements, HYPRE_MEMORY_HOST);
+         e = 0;
+         for (big_i = first_local_row; big_i <= last_local_row; big_i++)
+         {
+            ierr += HYPRE_ParCSRMatrixGetRow(parcsr_A, big_i, &size, &col_inds, &values);
+            for (j = 0; j < size; j++)
+            {
+               if (col_inds[j] > big_i)
+               {
+                  val = 0.1 * (HYPRE_Real) (1 + (big_i + col_inds[j]) % 3);
+                  element_dofs[2 * e]       = big_i;
+                  element_dofs[2 * e + 1]   = col_inds[j];
+                  element_values[4 * e]     =  val;
+                  element_values[4 * e + 1] = -val;
+                  element_values[4 * e + 2] = -val;
+                  element_values[4 * e + 3] =  val;
+                  e++;
+               }
+            }
+            ierr += HYPRE_ParCSRMatrixRestoreRow(parcsr_A, big_i, &size, &col_inds, &values);
+         }
+
+         if (elements == 1)
+         {
+            ierr += HYPRE_IJMatrixSetElementPlan(ij_A, num_elements, 2, element_dofs);
+            ierr += HYPRE_IJMatrixAddToElementValues(ij_A, element_values);
+         }
+         else
+         {
+            HYPRE_Int two = 2;
+
+            for (e = 0; e < num_elements; e++)
+            {
+               ierr += HYPRE_IJMatrixAddToValues(ij_A, 1, &two, &element_dofs[2 * e],
+                                                 &element_dofs[2 * e],
+                                                 &element_values[4 * e]);
+               ierr += HYPRE_IJMatrixAddToValues(ij_A, 1, &two, &element_dofs[2 * e + 1],
+                                                 &element_dofs[2 * e],
+                                                 &element_values[4 * e + 2]);
+            }
+            ierr += HYPRE_IJMatrixAssemble( ij_A );
+         }
+
+         hypre_TFree(element_dofs, HYPRE_MEMORY_HOST);
+         hypre_TFree(element_values, HYPRE_MEMORY_HOST);
+      }
+
       /*-----------------------------------------------------------
        * Fetch the resulting underlying matrix out
        *-----------------------------------------------------------*/
@@ -4039,6 +4303,15 @@ main( hypre_int argc,
       HYPRE_IJVectorDestroy(ij_bf);
    }
 
+   /*-----------------------------------------------------------
+    * Test multivector matvecs
+    *-----------------------------------------------------------*/
+
+   if (test_spmm && num_components > 1)
+   {
+      TestMultiVectorMatvec(parcsr_A, num_components);
+   }
+
    /*-----------------------------------------------------------
     * Test matrix scaling: B = diag(ld) * A * diag(rd)
     *-----------------------------------------------------------*/
@@ -4158,6 +4431,18 @@ main( hypre_int argc,
       goto final;
    }
 
+   /*-----------------------------------------------------------
+    * Solve a batch of local systems with batched PCG
+    *-----------------------------------------------------------*/
+
+   if (batch_pcg > 0)
+   {
+      TestBatchPCG(parcsr_A, batch_pcg, batch_pcg_breakdown, batch_pcg_precond,
+                   tol, max_iter);
+
+      goto final;
+   }
+
    /*-----------------------------------------------------------
     * Solve the system using the hybrid solver
     *-----------------------------------------------------------*/
@@ -4474,6 +4759,11 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetMixedPrecision(amg_solver, mixed_precision);
+      HYPRE_BoomerAMGSetNumericResetup(amg_solver, numeric_resetup);
+      HYPRE_BoomerAMGSetRelaxOverlap(amg_solver, relax_overlap);
+      HYPRE_BoomerAMGSetFusedTransfer(amg_solver, fused_transfer);
+      HYPRE_BoomerAMGSetProfile(amg_solver, amg_profile_file != NULL);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -4638,6 +4928,10 @@ main( hypre_int argc,
 
       if (solver_id == 0)
       {
+         if (amg_profile_file)
+         {
+            HYPRE_BoomerAMGPrintProfile(amg_solver, amg_profile_file);
+         }
          HYPRE_BoomerAMGDestroy(amg_solver);
       }
       else if (solver_id == 90)
@@ -4768,6 +5062,10 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetMixedPrecision(amg_solver, mixed_precision);
+      HYPRE_BoomerAMGSetNumericResetup(amg_solver, numeric_resetup);
+      HYPRE_BoomerAMGSetRelaxOverlap(amg_solver, relax_overlap);
+      HYPRE_BoomerAMGSetFusedTransfer(amg_solver, fused_transfer);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol - 1]);
@@ -4845,6 +5143,9 @@ main( hypre_int argc,
                        solver_id == 43 || solver_id == 71))
       /*end lobpcg */
    {
+      HYPRE_ParCSRMatrix parcsr_A2 = NULL;
+      HYPRE_ParVector    b2 = NULL, x2 = NULL;
+
       time_index = hypre_InitializeTiming("PCG Setup");
       hypre_BeginTiming(time_index);
 
@@ -4854,6 +5155,8 @@ main( hypre_int argc,
       HYPRE_PCGSetTwoNorm(pcg_solver, 1);
       HYPRE_PCGSetFlex(pcg_solver, flex);
       HYPRE_PCGSetSkipBreak(pcg_solver, skip_break);
+      HYPRE_PCGSetVariant(pcg_solver, pcg_variant);
+      HYPRE_PCGSetSStep(pcg_solver, pcg_s_step);
       HYPRE_PCGSetRelChange(pcg_solver, rel_change);
       HYPRE_PCGSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_PCGSetAbsoluteTol(pcg_solver, atol);
@@ -4976,6 +5279,11 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNumericResetup(pcg_precond, numeric_resetup);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetFusedTransfer(pcg_precond, fused_transfer);
+         HYPRE_BoomerAMGSetProfile(pcg_precond, amg_profile_file != NULL);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5165,6 +5473,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNumericResetup(pcg_precond, numeric_resetup);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetFusedTransfer(pcg_precond, fused_transfer);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5394,8 +5706,57 @@ main( hypre_int argc,
 
          hypre_GpuProfilingPushRange("PCG-Setup-2");
 
-         HYPRE_PCGSetup(pcg_solver, (HYPRE_Matrix) parcsr_M,
-                        (HYPRE_Vector) b, (HYPRE_Vector) x);
+         if (second_n > 0)
+         {
+            /* Set up the same solver again on a system of another size */
+            HYPRE_Real values[4] = {6.0, -1.0, -1.0, -1.0};
+
+            parcsr_A2 = (HYPRE_ParCSRMatrix)
+                        GenerateLaplacian(comm, second_n, second_n, second_n,
+                                          num_procs, 1, 1, myid, 0, 0, values);
+            b2 = (HYPRE_ParVector)
+                 hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(parcsr_A2),
+                                       hypre_ParCSRMatrixRowStarts(parcsr_A2));
+            x2 = (HYPRE_ParVector)
+                 hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(parcsr_A2),
+                                       hypre_ParCSRMatrixRowStarts(parcsr_A2));
+            hypre_ParVectorInitialize(b2);
+            hypre_ParVectorInitialize(x2);
+            hypre_ParVectorSetConstantValues(b2, 1.0);
+            hypre_ParVectorSetConstantValues(x2, 0.0);
+
+            HYPRE_PCGSetup(pcg_solver, (HYPRE_Matrix) parcsr_A2,
+                           (HYPRE_Vector) b2, (HYPRE_Vector) x2);
+         }
+         else
+         {
+            for (j = 0; j < num_resetups; j++)
+            {
+               if (second_scale != 0.0)
+               {
+                  /* Change the coefficients, but not the sparsity pattern */
+                  ScaleHalfMatrix(parcsr_A, second_scale);
+                  if (parcsr_M != parcsr_A)
+                  {
+                     ScaleHalfMatrix(parcsr_M, second_scale);
+                  }
+               }
+               HYPRE_PCGSetup(pcg_solver, (HYPRE_Matrix) parcsr_M,
+                              (HYPRE_Vector) b, (HYPRE_Vector) x);
+
+               if (resetup_check && solver_id == 1)
+               {
+                  HYPRE_Real rel_diff;
+
+                  hypre_BoomerAMGResetupGalerkinDiff((void *) pcg_precond, &rel_diff);
+                  if (myid == 0)
+                  {
+                     hypre_printf("Setup %d: relative difference to full Galerkin products = %e\n",
+                                  j + 2, rel_diff);
+                  }
+               }
+            }
+         }
 
          hypre_GpuProfilingPopRange();
 
@@ -5409,8 +5770,16 @@ main( hypre_int argc,
 
          hypre_GpuProfilingPushRange("PCG-Solve-2");
 
-         HYPRE_PCGSolve(pcg_solver, (HYPRE_Matrix)parcsr_A,
-                        (HYPRE_Vector)b, (HYPRE_Vector)x);
+         if (second_n > 0)
+         {
+            HYPRE_PCGSolve(pcg_solver, (HYPRE_Matrix)parcsr_A2,
+                           (HYPRE_Vector)b2, (HYPRE_Vector)x2);
+         }
+         else
+         {
+            HYPRE_PCGSolve(pcg_solver, (HYPRE_Matrix)parcsr_A,
+                           (HYPRE_Vector)b, (HYPRE_Vector)x);
+         }
 
          hypre_GpuProfilingPopRange();
 
@@ -5431,6 +5800,10 @@ main( hypre_int argc,
 
       if (solver_id == 1)
       {
+         if (amg_profile_file)
+         {
+            HYPRE_BoomerAMGPrintProfile(pcg_precond, amg_profile_file);
+         }
          HYPRE_BoomerAMGDestroy(pcg_precond);
       }
       else if (solver_id == 8)
@@ -5485,6 +5858,13 @@ main( hypre_int argc,
          HYPRE_MGRDestroy(pcg_precond);
       }
 
+      if (parcsr_A2)
+      {
+         HYPRE_ParCSRMatrixDestroy(parcsr_A2);
+         HYPRE_ParVectorDestroy(b2);
+         HYPRE_ParVectorDestroy(x2);
+      }
+
       if (myid == 0)
       {
          hypre_printf("\n");
@@ -6681,6 +7061,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(amg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNumericResetup(amg_precond, numeric_resetup);
+         HYPRE_BoomerAMGSetRelaxOverlap(amg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetFusedTransfer(amg_precond, fused_transfer);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
@@ -6873,6 +7257,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNumericResetup(pcg_precond, numeric_resetup);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetFusedTransfer(pcg_precond, fused_transfer);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7228,6 +7616,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNumericResetup(pcg_precond, numeric_resetup);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetFusedTransfer(pcg_precond, fused_transfer);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7438,6 +7830,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNumericResetup(pcg_precond, numeric_resetup);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetFusedTransfer(pcg_precond, fused_transfer);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7854,6 +8250,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNumericResetup(pcg_precond, numeric_resetup);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetFusedTransfer(pcg_precond, fused_transfer);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8137,6 +8537,7 @@ main( hypre_int argc,
       HYPRE_COGMRESSetKDim(pcg_solver, k_dim);
       HYPRE_COGMRESSetUnroll(pcg_solver, unroll);
       HYPRE_COGMRESSetCGS(pcg_solver, cgs);
+      HYPRE_COGMRESSetPipelined(pcg_solver, cogmres_pipelined);
       HYPRE_COGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_COGMRESSetTol(pcg_solver, tol);
       HYPRE_COGMRESSetAbsoluteTol(pcg_solver, atol);
@@ -8259,6 +8660,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNumericResetup(pcg_precond, numeric_resetup);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetFusedTransfer(pcg_precond, fused_transfer);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8591,6 +8996,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNumericResetup(pcg_precond, numeric_resetup);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetFusedTransfer(pcg_precond, fused_transfer);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8890,6 +9299,10 @@ main( hypre_int argc,
       HYPRE_ILUSetLevelOfFill(ilu_solver, ilu_lfil);
       /* set local reordering type */
       HYPRE_ILUSetLocalReordering(ilu_solver, ilu_reordering);
+      /* set triangular solve type */
+      HYPRE_ILUSetTriSolve(ilu_solver, ilu_tri_solve);
+      HYPRE_ILUSetLowerJacobiIters(ilu_solver, ilu_ljac_iters);
+      HYPRE_ILUSetUpperJacobiIters(ilu_solver, ilu_ujac_iters);
       /* set print level */
       HYPRE_ILUSetPrintLevel(ilu_solver, 2);
       /* set max iterations */
@@ -11281,3 +11694,334 @@ BuildParIsoLaplacian( HYPRE_Int argc, char** argv, HYPRE_ParCSRMatrix *A_ptr )
 }
 
 /* end lobpcg */
+
+/*----------------------------------------------------------------------
+ * Solve a batch of systems built from the local diagonal block D of A
+ * with batched PCG.  Regular system k is s_k (D + sigma_k diag(D)) with
+ * the shifts sigma_k = {0, 0.01, 0.1, 1} and scalings s_k = {1, 1e3, 1e-3}
+ * cycling, so the batch mixes well and poorly conditioned systems.  With
+ * breakdown, three systems are appended: one with a zero right-hand side,
+ * the indefinite -D, and the singular diag(+1,-1,+1,...) (singular for the
+ * Krylov iteration with b = 1 when the local size is even).  Each system
+ * reports its iteration count and the relative residual of its final
+ * iterate, computed here.
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+TestBatchPCG( HYPRE_ParCSRMatrix  parcsr_A,
+              HYPRE_Int           num_regular,
+              HYPRE_Int           breakdown,
+              HYPRE_Int           precond_type,
+              HYPRE_Real          tol,
+              HYPRE_Int           max_iter )
+{
+   hypre_CSRMatrix  *A_diag = hypre_ParCSRMatrixDiag(parcsr_A);
+   HYPRE_Int         n      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        *A_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int        *A_j    = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex    *A_a    = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int         nnz    = A_i[n];
+
+   HYPRE_Real        shifts[4] = {0.0, 0.01, 0.1, 1.0};
+   HYPRE_Real        scales[3] = {1.0, 1.0e3, 1.0e-3};
+
+   HYPRE_Solver      solver;
+   HYPRE_Int         num_systems, num_iterations, global_iterations;
+   HYPRE_Int         myid, ierr, conv_flag, k, i, jj;
+   HYPRE_Int        *system_iterations;
+   HYPRE_Complex    *values, *vk, *b, *x;
+   HYPRE_Real        diag, rnorm, bnorm, rel_norm, final_norm, global_norm;
+
+   hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid);
+
+   num_systems = num_regular + (breakdown ? 3 : 0);
+
+   values            = hypre_CTAlloc(HYPRE_Complex, num_systems * nnz, HYPRE_MEMORY_HOST);
+   b                 = hypre_CTAlloc(HYPRE_Complex, num_systems * n, HYPRE_MEMORY_HOST);
+   x                 = hypre_CTAlloc(HYPRE_Complex, num_systems * n, HYPRE_MEMORY_HOST);
+   system_iterations = hypre_CTAlloc(HYPRE_Int, num_systems, HYPRE_MEMORY_HOST);
+
+   for (k = 0; k < num_systems; k++)
+   {
+      vk = values + k * nnz;
+      for (i = 0; i < n; i++)
+      {
+         b[k * n + i] = 1.0;
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            diag = (A_j[jj] == i) ? 1.0 : 0.0;
+            if (k < num_regular)
+            {
+               vk[jj] = scales[k % 3] * (A_a[jj] + diag * shifts[k % 4] * A_a[jj]);
+            }
+            else if (k == num_regular)
+            {
+               /* zero right-hand side: converged at iteration 0 */
+               vk[jj] = A_a[jj];
+               b[k * n + i] = 0.0;
+            }
+            else if (k == num_regular + 1)
+            {
+               /* indefinite */
+               vk[jj] = -A_a[jj];
+            }
+            else
+            {
+               /* singular: <r,z> = <p,Ap> = 0 in the first iteration */
+               vk[jj] = diag * ((i % 2) ? -1.0 : 1.0);
+            }
+         }
+      }
+   }
+
+   HYPRE_BatchPCGCreate(&solver);
+   HYPRE_BatchPCGSetTol(solver, tol);
+   HYPRE_BatchPCGSetMaxIter(solver, max_iter);
+   HYPRE_BatchPCGSetPrecondType(solver, precond_type);
+   HYPRE_BatchPCGSetup(solver, num_systems, n, A_i, A_j, values);
+
+   ierr = HYPRE_BatchPCGSolve(solver, b, x);
+   conv_flag = HYPRE_CheckError(ierr, HYPRE_ERROR_CONV) ? 1 : 0;
+   HYPRE_ClearAllErrors();
+
+   HYPRE_BatchPCGGetNumIterations(solver, &num_iterations);
+   HYPRE_BatchPCGGetSystemNumIterations(solver, system_iterations);
+   HYPRE_BatchPCGGetFinalRelativeResidualNorm(solver, &final_norm);
+
+   if (myid == 0)
+   {
+      hypre_printf("\nBatched PCG: %d systems of %d rows, preconditioner %d\n",
+                   num_systems, n, precond_type);
+   }
+   for (k = 0; k < num_systems; k++)
+   {
+      vk = values + k * nnz;
+      rnorm = bnorm = 0.0;
+      for (i = 0; i < n; i++)
+      {
+         HYPRE_Complex ri = b[k * n + i];
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            ri -= vk[jj] * x[k * n + A_j[jj]];
+         }
+         rnorm += ri * ri;
+         bnorm += b[k * n + i] * b[k * n + i];
+      }
+      rel_norm = (bnorm > 0.0) ? sqrt(rnorm / bnorm) : sqrt(rnorm);
+      if (myid == 0)
+      {
+         hypre_printf("System %d: iterations = %d, relative residual = %s\n",
+                      k, system_iterations[k], (rel_norm <= tol) ? "converged" : "not converged");
+      }
+   }
+
+   hypre_MPI_Allreduce(&num_iterations, &global_iterations, 1, HYPRE_MPI_INT,
+                       hypre_MPI_MAX, hypre_MPI_COMM_WORLD);
+   hypre_MPI_Allreduce(&final_norm, &global_norm, 1, HYPRE_MPI_REAL,
+                       hypre_MPI_MAX, hypre_MPI_COMM_WORLD);
+   if (myid == 0)
+   {
+      hypre_printf("Breakdown reported = %d\n", conv_flag);
+      hypre_printf("\n");
+      hypre_printf("Iterations = %d\n", global_iterations);
+      hypre_printf("Final Relative Residual Norm = %e\n", global_norm);
+      hypre_printf("\n");
+   }
+
+   HYPRE_BatchPCGDestroy(solver);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+   hypre_TFree(b, HYPRE_MEMORY_HOST);
+   hypre_TFree(x, HYPRE_MEMORY_HOST);
+   hypre_TFree(system_iterations, HYPRE_MEMORY_HOST);
+
+   return (0);
+}
+
+/*----------------------------------------------------------------------
+ * Multiply the couplings between the unknowns of the first half of the
+ * global rows by scale, and adjust the diagonal to keep the row sums. This
+ * keeps A symmetric and its sparsity pattern, but introduces a coefficient
+ * jump. Assumes that the diagonal is the first entry of each row of diag.
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+ScaleHalfMatrix( HYPRE_ParCSRMatrix parcsr_A,
+                 HYPRE_Real         scale )
+{
+   hypre_CSRMatrix      *A_diag       = hypre_ParCSRMatrixDiag(parcsr_A);
+   hypre_CSRMatrix      *A_offd       = hypre_ParCSRMatrixOffd(parcsr_A);
+   HYPRE_BigInt          num_rows     = hypre_ParCSRMatrixGlobalNumRows(parcsr_A);
+   HYPRE_BigInt          first_row    = hypre_ParCSRMatrixFirstRowIndex(parcsr_A);
+   HYPRE_BigInt          first_col    = hypre_ParCSRMatrixFirstColDiag(parcsr_A);
+   HYPRE_BigInt         *col_map_offd = hypre_ParCSRMatrixColMapOffd(parcsr_A);
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(parcsr_A);
+   HYPRE_Int            *A_diag_i, *A_diag_j, *A_offd_i, *A_offd_j;
+   HYPRE_Real           *A_diag_data, *A_offd_data;
+   HYPRE_Real            diff;
+   HYPRE_Int             i, jj;
+
+   hypre_ParCSRMatrixMigrate(parcsr_A, HYPRE_MEMORY_HOST);
+
+   A_diag_i    = hypre_CSRMatrixI(A_diag);
+   A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   A_diag_data = hypre_CSRMatrixData(A_diag);
+   A_offd_i    = hypre_CSRMatrixI(A_offd);
+   A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   A_offd_data = hypre_CSRMatrixData(A_offd);
+
+   for (i = 0; i < hypre_CSRMatrixNumRows(A_diag); i++)
+   {
+      if (2 * (first_row + i) >= num_rows)
+      {
+         continue;
+      }
+
+      diff = 0.0;
+      for (jj = A_diag_i[i] + 1; jj < A_diag_i[i + 1]; jj++)
+      {
+         if (2 * (first_col + A_diag_j[jj]) < num_rows)
+         {
+            diff += (scale - 1.0) * A_diag_data[jj];
+            A_diag_data[jj] *= scale;
+         }
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+      {
+         if (2 * col_map_offd[A_offd_j[jj]] < num_rows)
+         {
+            diff += (scale - 1.0) * A_offd_data[jj];
+            A_offd_data[jj] *= scale;
+         }
+      }
+      A_diag_data[A_diag_i[i]] -= diff;
+   }
+
+   hypre_ParCSRMatrixMigrate(parcsr_A, memory_location);
+
+   return (0);
+}
+
+/*----------------------------------------------------------------------
+ * Compare y = A*x for a multivector x of num_vectors columns with the
+ * products of A with each column. In parallel, the product with the offd
+ * part of A uses the interleaved halo of x. Also compare the products of
+ * the diag part of A with x stored by columns and by rows (interleaved).
+ * Host only.
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+TestMultiVectorMatvec( HYPRE_ParCSRMatrix parcsr_A,
+                       HYPRE_Int          num_vectors )
+{
+   MPI_Comm          comm        = hypre_ParCSRMatrixComm(parcsr_A);
+   hypre_CSRMatrix  *A_diag      = hypre_ParCSRMatrixDiag(parcsr_A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int         num_cols    = hypre_CSRMatrixNumCols(A_diag);
+   hypre_ParVector  *x, *y, *xc, *yc;
+   hypre_Vector     *x_row, *y_diag, *y_row;
+   HYPRE_Complex    *x_data, *y_data, *yc_data, *y_ref;
+   HYPRE_Complex    *x_row_data, *y_diag_data, *y_row_data;
+   HYPRE_Real        diff[2], norm[2], gdiff[2], gnorm[2];
+   HYPRE_Int         myid, c, i;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(parcsr_A)) != HYPRE_EXEC_HOST)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Multivector matvec test skipped: host only\n");
+      }
+      return (0);
+   }
+
+   x = hypre_ParMultiVectorCreate(comm, hypre_ParCSRMatrixGlobalNumCols(parcsr_A),
+                                  hypre_ParCSRMatrixColStarts(parcsr_A), num_vectors);
+   y = hypre_ParMultiVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(parcsr_A),
+                                  hypre_ParCSRMatrixRowStarts(parcsr_A), num_vectors);
+   xc = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumCols(parcsr_A),
+                              hypre_ParCSRMatrixColStarts(parcsr_A));
+   yc = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(parcsr_A),
+                              hypre_ParCSRMatrixRowStarts(parcsr_A));
+   hypre_ParVectorInitialize_v2(x, HYPRE_MEMORY_HOST);
+   hypre_ParVectorInitialize_v2(y, HYPRE_MEMORY_HOST);
+   hypre_ParVectorInitialize_v2(xc, HYPRE_MEMORY_HOST);
+   hypre_ParVectorInitialize_v2(yc, HYPRE_MEMORY_HOST);
+   hypre_ParVectorSetRandomValues(x, 2747);
+
+   x_data  = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   y_data  = hypre_VectorData(hypre_ParVectorLocalVector(y));
+   yc_data = hypre_VectorData(hypre_ParVectorLocalVector(yc));
+   y_ref   = hypre_TAlloc(HYPRE_Complex, num_rows * num_vectors, HYPRE_MEMORY_HOST);
+
+   /* Multivector against single vectors. The single vector products come
+    * first: the communication package of A is only updated from one vector
+    * to num_vectors vectors */
+   for (c = 0; c < num_vectors; c++)
+   {
+      hypre_TMemcpy(hypre_VectorData(hypre_ParVectorLocalVector(xc)), x_data + c * num_cols,
+                    HYPRE_Complex, num_cols, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatrixMatvec(1.0, parcsr_A, xc, 0.0, yc);
+      hypre_TMemcpy(y_ref + c * num_rows, yc_data, HYPRE_Complex, num_rows,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   hypre_ParCSRMatrixMatvec(1.0, parcsr_A, x, 0.0, y);
+
+   diff[0] = norm[0] = 0.0;
+   for (i = 0; i < num_rows * num_vectors; i++)
+   {
+      diff[0] = hypre_max(diff[0], hypre_cabs(y_data[i] - y_ref[i]));
+      norm[0] = hypre_max(norm[0], hypre_cabs(y_ref[i]));
+   }
+
+   /* Diag part with x stored by columns and by rows */
+   x_row = hypre_SeqMultiVectorCreate(num_cols, num_vectors);
+   hypre_VectorMultiVecStorageMethod(x_row) = 1;
+   y_diag = hypre_SeqMultiVectorCreate(num_rows, num_vectors);
+   y_row = hypre_SeqMultiVectorCreate(num_rows, num_vectors);
+   hypre_SeqVectorInitialize_v2(x_row, HYPRE_MEMORY_HOST);
+   hypre_SeqVectorInitialize_v2(y_diag, HYPRE_MEMORY_HOST);
+   hypre_SeqVectorInitialize_v2(y_row, HYPRE_MEMORY_HOST);
+   x_row_data  = hypre_VectorData(x_row);
+   y_diag_data = hypre_VectorData(y_diag);
+   y_row_data  = hypre_VectorData(y_row);
+
+   for (c = 0; c < num_vectors; c++)
+   {
+      for (i = 0; i < num_cols; i++)
+      {
+         x_row_data[i * num_vectors + c] = x_data[c * num_cols + i];
+      }
+   }
+   hypre_CSRMatrixMatvec(1.0, A_diag, hypre_ParVectorLocalVector(x), 0.0, y_diag);
+   hypre_CSRMatrixMatvec(1.0, A_diag, x_row, 0.0, y_row);
+
+   diff[1] = norm[1] = 0.0;
+   for (i = 0; i < num_rows * num_vectors; i++)
+   {
+      diff[1] = hypre_max(diff[1], hypre_cabs(y_row_data[i] - y_diag_data[i]));
+      norm[1] = hypre_max(norm[1], hypre_cabs(y_diag_data[i]));
+   }
+
+   hypre_MPI_Allreduce(diff, gdiff, 2, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+   hypre_MPI_Allreduce(norm, gnorm, 2, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+   if (myid == 0)
+   {
+      hypre_printf("\nMultivector matvec with %d vectors:\n", num_vectors);
+      hypre_printf("Relative difference to single vectors = %e\n",
+                   (gnorm[0] > 0.0) ? gdiff[0] / gnorm[0] : gdiff[0]);
+      hypre_printf("Relative difference of row-major to column-major = %e\n",
+                   (gnorm[1] > 0.0) ? gdiff[1] / gnorm[1] : gdiff[1]);
+   }
+
+   hypre_TFree(y_ref, HYPRE_MEMORY_HOST);
+   hypre_SeqVectorDestroy(x_row);
+   hypre_SeqVectorDestroy(y_diag);
+   hypre_SeqVectorDestroy(y_row);
+   hypre_ParVectorDestroy(x);
+   hypre_ParVectorDestroy(y);
+   hypre_ParVectorDestroy(xc);
+   hypre_ParVectorDestroy(yc);
+
+   return (0);
+}
@@ -2245,6 +2245,8 @@ PrintUsage( char *progname,
       hypre_printf("                        248- Struct BiCGSTAB with diagonal scaling\n");
       hypre_printf("                        249- Struct BiCGSTAB\n");
       hypre_printf("  -print             : print out the system\n");
+      hypre_printf("  -parcsr_direct     : build ParCSR matrix without IJ assembly\n");
+      hypre_printf("  -reassemble        : add the stencil values again and reassemble\n");
       hypre_printf("  -rhsfromcosine     : solution is cosine function (default)\n");
       hypre_printf("  -rhsone            : rhs is vector with unit components\n");
       hypre_printf("  -tol <val>         : convergence tolerance (default 1e-6)\n");
@@ -2255,6 +2257,7 @@ PrintUsage( char *progname,
       hypre_printf("  -recompute <bool>  : Recompute residual in PCG?\n");
       hypre_printf("  -v <n_pre> <n_post>: SysPFMG and Struct- # of pre and post relax\n");
       hypre_printf("  -skip <s>          : SysPFMG and Struct- skip relaxation (0 or 1)\n");
+      hypre_printf("  -interleave        : SysPFMG- node-interleaved level matrices\n");
       hypre_printf("  -rap <r>           : Struct- coarse grid operator type\n");
       hypre_printf("                        0 - Galerkin (default)\n");
       hypre_printf("                        1 - non-Galerkin ParFlow operators\n");
@@ -2338,6 +2341,8 @@ main( hypre_int argc,
    Index                *distribute;
    Index                *block;
    HYPRE_Int             solver_id, object_type;
+   HYPRE_Int             direct_parcsr;
+   HYPRE_Int             reassemble;
    HYPRE_Int             print_system;
    HYPRE_Int             cosine;
    HYPRE_Real            scale;
@@ -2384,6 +2389,7 @@ main( hypre_int argc,
 
    HYPRE_Int             n_pre, n_post;
    HYPRE_Int             skip;
+   HYPRE_Int             interleaved;
    HYPRE_Int             rap;
    HYPRE_Int             relax;
    HYPRE_Real            jacobi_weight;
@@ -2489,6 +2495,8 @@ main( hypre_int argc,
    jump  = 0;
    gradient_matrix = 0;
    object_type = HYPRE_SSTRUCT;
+   direct_parcsr = 0;
+   reassemble = 0;
    solver_type = 1;
    recompute_res = 0;   /* What should be the default here? */
    cf_tol = 0.90;
@@ -2504,6 +2512,7 @@ main( hypre_int argc,
    print_system = 0;
    cosine = 1;
    skip = 0;
+   interleaved = 0;
    n_pre  = 1;
    n_post = 1;
 
@@ -2693,6 +2702,16 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-parcsr_direct") == 0 )
+      {
+         arg_index++;
+         direct_parcsr = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-reassemble") == 0 )
+      {
+         arg_index++;
+         reassemble = 1;
+      }
       else if ( strcmp(argv[arg_index], "-rhsfromcosine") == 0 )
       {
          arg_index++;
@@ -2719,6 +2738,11 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-interleave") == 0 )
+      {
+         arg_index++;
+         interleaved = 1;
+      }
       else if ( strcmp(argv[arg_index], "-rap") == 0 )
       {
          arg_index++;
@@ -3188,6 +3212,7 @@ main( hypre_int argc,
       {
          HYPRE_SStructMatrixSetObjectType(A, object_type);
       }
+      HYPRE_SStructMatrixSetDirectParCSR(A, direct_parcsr);
 
       HYPRE_SStructMatrixInitialize(A);
 
@@ -3434,6 +3459,40 @@ main( hypre_int argc,
       }
 
       HYPRE_SStructMatrixAssemble(A);
+
+      if (reassemble && data.nstencils > 0)
+      {
+         /* Add the stencil values once more to the assembled matrix */
+         for (part = 0; part < data.nparts; part++)
+         {
+            pdata = data.pdata[part];
+            for (var = 0; var < pdata.nvars; var++)
+            {
+               s = pdata.stencil_num[var];
+               for (i = 0; i < data.stencil_sizes[s]; i++)
+               {
+                  for (j = 0; j < pdata.max_boxsize; j++)
+                  {
+                     values[j] = data.stencil_values[s][i];
+                  }
+
+                  hypre_TMemcpy(d_values, values, HYPRE_Real, values_size,
+                                memory_location, HYPRE_MEMORY_HOST);
+
+                  for (box = 0; box < pdata.nboxes; box++)
+                  {
+                     GetVariableBox(pdata.ilowers[box], pdata.iuppers[box],
+                                    pdata.vartypes[var], ilower, iupper);
+
+                     HYPRE_SStructMatrixAddToBoxValues(A, part, ilower, iupper,
+                                                       var, 1, &i, d_values);
+                  }
+               }
+            }
+         }
+
+         HYPRE_SStructMatrixAssemble(A);
+      }
    }
 
    /*-----------------------------------------------------------
@@ -3960,6 +4019,7 @@ main( hypre_int argc,
       HYPRE_SStructSysPFMGSetNumPreRelax(solver, n_pre);
       HYPRE_SStructSysPFMGSetNumPostRelax(solver, n_post);
       HYPRE_SStructSysPFMGSetSkipRelax(solver, skip);
+      HYPRE_SStructSysPFMGSetInterleaved(solver, interleaved);
       /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
       HYPRE_SStructSysPFMGSetPrintLevel(solver, 1);
       HYPRE_SStructSysPFMGSetLogging(solver, 1);
@@ -4083,6 +4143,7 @@ main( hypre_int argc,
          HYPRE_SStructSysPFMGSetNumPreRelax(precond, n_pre);
          HYPRE_SStructSysPFMGSetNumPostRelax(precond, n_post);
          HYPRE_SStructSysPFMGSetSkipRelax(precond, skip);
+         HYPRE_SStructSysPFMGSetInterleaved(precond, interleaved);
          /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
          HYPRE_PCGSetPrecond( (HYPRE_Solver) solver,
                               (HYPRE_PtrToSolverFcn) HYPRE_SStructSysPFMGSolve,
@@ -4203,6 +4264,7 @@ main( hypre_int argc,
             HYPRE_SStructSysPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_SStructSysPFMGSetNumPostRelax(precond, n_post);
             HYPRE_SStructSysPFMGSetSkipRelax(precond, skip);
+            HYPRE_SStructSysPFMGSetInterleaved(precond, interleaved);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_PCGSetPrecond( (HYPRE_Solver) solver,
                                  (HYPRE_PtrToSolverFcn) HYPRE_SStructSysPFMGSolve,
@@ -4403,6 +4465,7 @@ main( hypre_int argc,
             HYPRE_SStructSysPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_SStructSysPFMGSetNumPostRelax(precond, n_post);
             HYPRE_SStructSysPFMGSetSkipRelax(precond, skip);
+            HYPRE_SStructSysPFMGSetInterleaved(precond, interleaved);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_LOBPCGSetPrecond( (HYPRE_Solver) solver,
                                     (HYPRE_PtrToSolverFcn) HYPRE_SStructSysPFMGSolve,
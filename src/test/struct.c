@@ -50,6 +50,32 @@ HYPRE_Int AddValuesVector( hypre_StructGrid  *gridvector,
                            HYPRE_Int          *period,
                            HYPRE_Real         value  )  ;
 
+/* Laplacian-like operator with a general compact stencil (-stencil option) */
+typedef struct
+{
+   HYPRE_Int    ndim;
+   HYPRE_Int    size;
+   HYPRE_Int    offsets[27][3];
+   HYPRE_Real   coeffs[27];
+   HYPRE_Int    imin[3];
+   HYPRE_Int    imax[3];
+   HYPRE_Int    periodic[3];
+
+} StencilData;
+
+HYPRE_Int SetStencilData( StencilData *data, HYPRE_Int dim, HYPRE_Int npoints,
+                          HYPRE_Real cx, HYPRE_Real cy, HYPRE_Real cz );
+
+HYPRE_Int SetStencilDataGrid( StencilData *data, HYPRE_StructGrid grid );
+
+HYPRE_Int StencilDataCoeffs( void *data, HYPRE_Int *ilower, HYPRE_Int *iupper,
+                             HYPRE_Complex *values );
+
+HYPRE_Int AddValuesMatrixGeneral( HYPRE_StructMatrix A, HYPRE_StructGrid gridmatrix,
+                                  StencilData *data );
+
+HYPRE_Int TestMatvecPowers( HYPRE_StructMatrix A, HYPRE_Int num_powers, HYPRE_Int depth );
+
 /*--------------------------------------------------------------------------
  * Test driver for structured matrix interface (structured storage)
  *--------------------------------------------------------------------------*/
@@ -99,6 +125,9 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks ;
    HYPRE_Int           skip;
+   HYPRE_Int           tblock;
+   HYPRE_Int           fused;
+   HYPRE_Int           max_csize;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -118,6 +147,11 @@ main( hypre_int argc,
    HYPRE_Int           stencil_size;
    HYPRE_Int           diag_rank;
    hypre_Index         diag_index;
+   HYPRE_Int           stencil_npoints;
+   StencilData         stencil_data;
+   HYPRE_Int           matvec_powers, matvec_depth;
+   HYPRE_Int           generator;
+   HYPRE_Int           tile[3], tile_tune;
 
    HYPRE_StructGrid    grid;
    HYPRE_StructGrid    readgrid;
@@ -137,6 +171,8 @@ main( hypre_int argc,
    HYPRE_Int           sum;
 
    HYPRE_Int           print_system = 0;
+   HYPRE_Int           print_binary = 0;
+   HYPRE_Int           read_binary = 0;
 #if defined(HYPRE_USING_MEMORY_TRACKER)
    HYPRE_Int           print_mem_tracker = 0;
    char                mem_tracker_name[HYPRE_MAX_FILE_NAME_LEN] = {0};
@@ -223,6 +259,15 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   tblock = 0;
+   fused = 1;
+   max_csize = 0;
+   stencil_npoints = 0;
+   matvec_powers = 0;
+   matvec_depth = 0;
+   generator = 0;
+   tile[0] = tile[1] = tile[2] = 0;
+   tile_tune = 0;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -417,6 +462,49 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-tb") == 0 )
+      {
+         arg_index++;
+         tblock = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-fused") == 0 )
+      {
+         arg_index++;
+         fused = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-csize") == 0 )
+      {
+         arg_index++;
+         max_csize = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-tile") == 0 )
+      {
+         arg_index++;
+         tile[0] = atoi(argv[arg_index++]);
+         tile[1] = atoi(argv[arg_index++]);
+         tile[2] = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-tile_tune") == 0 )
+      {
+         arg_index++;
+         tile_tune = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-stencil") == 0 )
+      {
+         arg_index++;
+         stencil_npoints = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-generator") == 0 )
+      {
+         arg_index++;
+         generator = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-matvec_powers") == 0 )
+      {
+         arg_index++;
+         matvec_powers = atoi(argv[arg_index++]);
+         matvec_depth  = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-jump") == 0 )
       {
          arg_index++;
@@ -442,6 +530,16 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-print_binary") == 0 )
+      {
+         arg_index++;
+         print_binary = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-read_binary") == 0 )
+      {
+         arg_index++;
+         read_binary = 1;
+      }
       else if ( strcmp(argv[arg_index], "-help") == 0 )
       {
          print_usage = 1;
@@ -564,6 +662,16 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* tiling of the host struct kernels */
+   if (tile[0] > 0 || tile[1] > 0 || tile[2] > 0)
+   {
+      HYPRE_SetStructTileSize(tile[0], tile[1], tile[2]);
+   }
+   if (tile_tune)
+   {
+      HYPRE_SetStructTileTune(tile_tune);
+   }
+
    /* begin lobpcg */
 
    if ( solver_id == 0 && lobpcgFlag )
@@ -642,15 +750,33 @@ main( hypre_int argc,
       hypre_printf("                        1 - Weighted Jacobi (default)\n");
       hypre_printf("                        2 - R/B Gauss-Seidel\n");
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
+      hypre_printf("                        4 - Weighted line Jacobi (PFMG)\n");
+      hypre_printf("                        5 - Zebra line Gauss-Seidel (PFMG)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
+      hypre_printf("  -tb <n>             : relaxation sweeps per ghost exchange in PFMG\n");
+      hypre_printf("  -fused <f>          : fused vector kernels in PCG/GMRES (0 or 1, default 1)\n");
+      hypre_printf("  -csize <n>          : direct coarse solve up to n points in PFMG\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
+      hypre_printf("  -tile <ti> <tj> <tk>: tile sizes for the host struct kernels\n");
+      hypre_printf("  -tile_tune          : autotune the tile sizes\n");
+      hypre_printf("  -stencil <n>        : Laplacian-like operator with an n-point stencil\n");
+      hypre_printf("                        (nonsymmetric storage, no convection)\n");
+      hypre_printf("                        1D: 3; 2D: 5, 7, 9; 3D: 7, 15, 19, 27\n");
+      hypre_printf("  -generator          : generate the -stencil operator on the fly instead\n");
+      hypre_printf("                        of storing it (default: 2*dim+1 points, host only)\n");
+      hypre_printf("  -matvec_powers <k> <depth> : check A^j x, j = 1..k, computed with\n");
+      hypre_printf("                        depth products per exchange (0: max) against\n");
+      hypre_printf("                        repeated matvecs\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
       hypre_printf("                        1 - PCG (default)\n");
       hypre_printf("                        2 - GMRES\n");
       hypre_printf("  -recompute <bool>   : Recompute residual in PCG?\n");
       hypre_printf("  -cf <cf>            : convergence factor for Hybrid\n");
+      hypre_printf("  -print_binary       : write A, b and x0 to the binary files struct.bin.*\n");
+      hypre_printf("  -read_binary        : replace A, b and x0 by the ones in struct.bin.*,\n");
+      hypre_printf("                        which may have been written with another -P or -b\n");
       hypre_printf("\n");
 
       /* begin lobpcg */
@@ -721,6 +847,46 @@ main( hypre_int argc,
       }
    }
 
+   if (generator && stencil_npoints == 0)
+   {
+      stencil_npoints = 2 * dim + 1;
+   }
+
+   if (generator)
+   {
+      if (solver_id == 3 || solver_id == 4 || solver_id == 13 || solver_id == 14 ||
+          matvec_powers > 0 || print_system || print_binary || read_binary)
+      {
+         if (myid == 0)
+         {
+            hypre_printf("Error: -generator needs variable coefficients and stored-matrix\n");
+            hypre_printf("       features (-matvec_powers, -print*) are not available\n");
+         }
+         exit(1);
+      }
+   }
+
+   if (stencil_npoints > 0)
+   {
+      if (sum > 0 || conx != 0.0 || cony != 0.0 || conz != 0.0)
+      {
+         if (myid == 0)
+         {
+            hypre_printf("Error: -stencil does not support convection or reading from files\n");
+         }
+         exit(1);
+      }
+      if (SetStencilData(&stencil_data, dim, stencil_npoints, cx, cy, cz))
+      {
+         if (myid == 0)
+         {
+            hypre_printf("Error: unsupported %d-point stencil in %dD\n", stencil_npoints, dim);
+         }
+         exit(1);
+      }
+      sym = 0;
+   }
+
    if ((conx != 0.0 || cony != 0 || conz != 0) && sym == 1 )
    {
       if (myid == 0)
@@ -761,6 +927,10 @@ main( hypre_int argc,
       hypre_printf("  (n_pre, n_post) = (%d, %d)\n", n_pre, n_post);
       hypre_printf("  dim             = %d\n", dim);
       hypre_printf("  skip            = %d\n", skip);
+      hypre_printf("  tblock          = %d\n", tblock);
+      hypre_printf("  max_csize       = %d\n", max_csize);
+      hypre_printf("  stencil         = %d\n", stencil_npoints);
+      hypre_printf("  generator       = %d\n", generator);
       hypre_printf("  sym             = %d\n", sym);
       hypre_printf("  rap             = %d\n", rap);
       hypre_printf("  relax           = %d\n", relax);
@@ -777,6 +947,9 @@ main( hypre_int argc,
       hypre_printf("  (n_pre, n_post) = (%d, %d)\n", n_pre, n_post);
       hypre_printf("  dim             = %d\n", dim);
       hypre_printf("  skip            = %d\n", skip);
+      hypre_printf("  tblock          = %d\n", tblock);
+      hypre_printf("  max_csize       = %d\n", max_csize);
+      hypre_printf("  stencil         = %d\n", stencil_npoints);
       hypre_printf("  sym             = %d\n", sym);
       hypre_printf("  rap             = %d\n", rap);
       hypre_printf("  relax           = %d\n", relax);
@@ -939,10 +1112,21 @@ main( hypre_int argc,
        * which is always the case for read_fromfile_param == 0
        *-----------------------------------------------------------*/
 
-      HYPRE_StructStencilCreate(dim, (2 - sym)*dim + 1, &stencil);
-      for (s = 0; s < (2 - sym)*dim + 1; s++)
+      if (stencil_npoints > 0)
+      {
+         HYPRE_StructStencilCreate(dim, stencil_data.size, &stencil);
+         for (s = 0; s < stencil_data.size; s++)
+         {
+            HYPRE_StructStencilSetElement(stencil, s, stencil_data.offsets[s]);
+         }
+      }
+      else
       {
-         HYPRE_StructStencilSetElement(stencil, s, offsets[s]);
+         HYPRE_StructStencilCreate(dim, (2 - sym)*dim + 1, &stencil);
+         for (s = 0; s < (2 - sym)*dim + 1; s++)
+         {
+            HYPRE_StructStencilSetElement(stencil, s, offsets[s]);
+         }
       }
 
       /*-----------------------------------------------------------
@@ -1119,20 +1303,41 @@ main( hypre_int argc,
          }
 
          HYPRE_StructMatrixSetSymmetric(A, sym);
+         if (generator)
+         {
+            SetStencilDataGrid(&stencil_data, grid);
+            HYPRE_StructMatrixSetCoeffGenerator(A, StencilDataCoeffs, &stencil_data);
+         }
          HYPRE_StructMatrixInitialize(A);
 
          /*-----------------------------------------------------------
           * Fill in the matrix elements
           *-----------------------------------------------------------*/
 
-         AddValuesMatrix(A, grid, cx, cy, cz, conx, cony, conz);
+         if (generator)
+         {
+            /* The coefficients are generated by StencilDataCoeffs */
+         }
+         else if (stencil_npoints > 0)
+         {
+            /* The coefficients already vanish on the real boundary */
+            SetStencilDataGrid(&stencil_data, grid);
+            if (AddValuesMatrixGeneral(A, grid, &stencil_data))
+            {
+               exit(1);
+            }
+         }
+         else
+         {
+            AddValuesMatrix(A, grid, cx, cy, cz, conx, cony, conz);
 
-         /* Zero out stencils reaching to real boundary */
-         /* But in constant coefficient case, no special stencils! */
+            /* Zero out stencils reaching to real boundary */
+            /* But in constant coefficient case, no special stencils! */
 
-         if ( constant_coefficient == 0 )
-         {
-            SetStencilBndry(A, grid, periodic);
+            if ( constant_coefficient == 0 )
+            {
+               SetStencilBndry(A, grid, periodic);
+            }
          }
          HYPRE_StructMatrixAssemble(A);
          /*-----------------------------------------------------------
@@ -1393,6 +1598,32 @@ main( hypre_int argc,
          HYPRE_StructVectorPrint("struct.out.x0", x, 0);
       }
 
+      if (print_binary)
+      {
+         HYPRE_StructMatrixPrintBinary("struct.bin.A", A);
+         HYPRE_StructVectorPrintBinary("struct.bin.b", b);
+         HYPRE_StructVectorPrintBinary("struct.bin.x0", x);
+      }
+
+      if (read_binary)
+      {
+         HYPRE_StructMatrixReadBinary("struct.bin.A", A);
+         HYPRE_StructMatrixAssemble(A);
+         HYPRE_StructVectorReadBinary("struct.bin.b", b);
+         HYPRE_StructVectorAssemble(b);
+         HYPRE_StructVectorReadBinary("struct.bin.x0", x);
+         HYPRE_StructVectorAssemble(x);
+      }
+
+      /*-----------------------------------------------------------
+       * Check the matrix powers kernel
+       *-----------------------------------------------------------*/
+
+      if (matvec_powers > 0)
+      {
+         TestMatvecPowers(A, matvec_powers, matvec_depth);
+      }
+
       /*-----------------------------------------------------------
        * Solve the system using SMG
        *-----------------------------------------------------------*/
@@ -1486,6 +1717,8 @@ main( hypre_int argc,
          HYPRE_StructPFMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructPFMGSetNumPostRelax(solver, n_post);
          HYPRE_StructPFMGSetSkipRelax(solver, skip);
+         HYPRE_StructPFMGSetTemporalBlocking(solver, tblock);
+         HYPRE_StructPFMGSetMaxCoarseSize(solver, max_csize);
          /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
          HYPRE_StructPFMGSetPrintLevel(solver, 1);
          HYPRE_StructPFMGSetLogging(solver, 1);
@@ -1624,6 +1857,7 @@ main( hypre_int argc,
          hypre_BeginTiming(time_index);
 
          HYPRE_StructPCGCreate(hypre_MPI_COMM_WORLD, &solver);
+         HYPRE_StructPCGSetFusedOps(solver, fused);
          HYPRE_PCGSetMaxIter( (HYPRE_Solver)solver, 100 );
          HYPRE_PCGSetTol( (HYPRE_Solver)solver, tol );
          HYPRE_PCGSetTwoNorm( (HYPRE_Solver)solver, 1 );
@@ -1668,6 +1902,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
+            HYPRE_StructPFMGSetMaxCoarseSize(precond, max_csize);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1837,6 +2073,8 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
+               HYPRE_StructPFMGSetMaxCoarseSize(precond, max_csize);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2088,6 +2326,8 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
+               HYPRE_StructPFMGSetMaxCoarseSize(precond, max_csize);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2351,6 +2591,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
+            HYPRE_StructPFMGSetMaxCoarseSize(precond, max_csize);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2431,6 +2673,7 @@ main( hypre_int argc,
          hypre_BeginTiming(time_index);
 
          HYPRE_StructGMRESCreate(hypre_MPI_COMM_WORLD, &solver);
+         HYPRE_StructGMRESSetFusedOps(solver, fused);
          HYPRE_GMRESSetKDim( (HYPRE_Solver) solver, 5 );
          HYPRE_GMRESSetMaxIter( (HYPRE_Solver)solver, 100 );
          HYPRE_GMRESSetTol( (HYPRE_Solver)solver, tol );
@@ -2475,6 +2718,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
+            HYPRE_StructPFMGSetMaxCoarseSize(precond, max_csize);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2626,6 +2871,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
+            HYPRE_StructPFMGSetMaxCoarseSize(precond, max_csize);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2777,6 +3024,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
+            HYPRE_StructPFMGSetMaxCoarseSize(precond, max_csize);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2875,6 +3124,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
+            HYPRE_StructPFMGSetMaxCoarseSize(precond, max_csize);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -3593,3 +3844,380 @@ SetStencilBndry(HYPRE_StructMatrix A,
 
    return ierr;
 }
+
+/*--------------------------------------------------------------------------
+ * Set up a Laplacian-like operator with a compact npoints stencil.  Entries
+ * with one nonzero offset component get -c_d, edge diagonals -(c_a + c_b)/4,
+ * corners -(cx + cy + cz)/12, and the center minus the sum of the others.
+ * Returns nonzero if the stencil shape is not supported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+SetStencilData( StencilData *data,
+                HYPRE_Int    dim,
+                HYPRE_Int    npoints,
+                HYPRE_Real   cx,
+                HYPRE_Real   cy,
+                HYPRE_Real   cz )
+{
+   HYPRE_Real  c[3];
+   HYPRE_Real  center;
+   HYPRE_Int   o[3], d, k, s, inshape;
+
+   c[0] = cx;
+   c[1] = cy;
+   c[2] = cz;
+
+   /* check the shape */
+   switch (dim)
+   {
+      case 1:
+         if (npoints != 3) { return 1; }
+         break;
+      case 2:
+         if (npoints != 5 && npoints != 7 && npoints != 9) { return 1; }
+         break;
+      case 3:
+         if (npoints != 7 && npoints != 15 && npoints != 19 && npoints != 27) { return 1; }
+         break;
+      default:
+         return 1;
+   }
+
+   data -> ndim = dim;
+   data -> size = 0;
+   center = 0.0;
+   for (o[2] = -(dim > 2); o[2] <= (dim > 2); o[2]++)
+   {
+      for (o[1] = -(dim > 1); o[1] <= (dim > 1); o[1]++)
+      {
+         for (o[0] = -1; o[0] <= 1; o[0]++)
+         {
+            k = (o[0] != 0) + (o[1] != 0) + (o[2] != 0);
+
+            /* 2D 7-point: 5-point plus the (-1,-1) and (1,1) diagonals,
+               3D 15-point: 7-point plus the corners */
+            inshape = (k <= 1) ||
+                      (npoints == 7 && dim == 2 && o[0] == o[1]) ||
+                      (npoints == 15 && k == 3) ||
+                      (npoints == 19 && k == 2) ||
+                      (npoints == 9 || npoints == 27);
+            if (!inshape)
+            {
+               continue;
+            }
+
+            s = (data -> size)++;
+            for (d = 0; d < 3; d++)
+            {
+               (data -> offsets)[s][d] = o[d];
+            }
+            (data -> coeffs)[s] = 0.0;
+            for (d = 0; d < dim; d++)
+            {
+               if (o[d] != 0)
+               {
+                  (data -> coeffs)[s] -= c[d];
+               }
+            }
+            if (k > 1)
+            {
+               (data -> coeffs)[s] /= (HYPRE_Real) (k == 2 ? 4 : 12);
+            }
+            center -= (data -> coeffs)[s];
+         }
+      }
+   }
+
+   /* the center entry has no nonzero offset component */
+   for (s = 0; s < (data -> size); s++)
+   {
+      if (!(data -> offsets)[s][0] && !(data -> offsets)[s][1] && !(data -> offsets)[s][2])
+      {
+         (data -> coeffs)[s] = center;
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Store the global extents and periodicity of the grid in the stencil data
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+SetStencilDataGrid( StencilData      *data,
+                    HYPRE_StructGrid  grid )
+{
+   hypre_Box  *bbox = hypre_StructGridBoundingBox(grid);
+   HYPRE_Int   d;
+
+   for (d = 0; d < 3; d++)
+   {
+      (data -> imin)[d]     = (d < (data -> ndim)) ? hypre_BoxIMinD(bbox, d) : 0;
+      (data -> imax)[d]     = (d < (data -> ndim)) ? hypre_BoxIMaxD(bbox, d) : 0;
+      (data -> periodic)[d] = (d < (data -> ndim)) ? hypre_StructGridPeriodic(grid)[d] : 0;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Coefficients of the stencil data operator on the box [ilower, iupper],
+ * ordered as in HYPRE_StructMatrixSetBoxValues.  Entries reaching across a
+ * non-periodic boundary are zero.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+StencilDataCoeffs( void          *vdata,
+                   HYPRE_Int     *ilower,
+                   HYPRE_Int     *iupper,
+                   HYPRE_Complex *values )
+{
+   StencilData *data = (StencilData *) vdata;
+   HYPRE_Int    ndim = (data -> ndim);
+   HYPRE_Int    size = (data -> size);
+   HYPRE_Int    lo[3], hi[3], index[3];
+   HYPRE_Int    d, s, n, ii;
+
+   for (d = 0; d < 3; d++)
+   {
+      lo[d] = (d < ndim) ? ilower[d] : 0;
+      hi[d] = (d < ndim) ? iupper[d] : 0;
+   }
+
+   n = 0;
+   for (index[2] = lo[2]; index[2] <= hi[2]; index[2]++)
+   {
+      for (index[1] = lo[1]; index[1] <= hi[1]; index[1]++)
+      {
+         for (index[0] = lo[0]; index[0] <= hi[0]; index[0]++)
+         {
+            for (s = 0; s < size; s++)
+            {
+               values[n] = (data -> coeffs)[s];
+               for (d = 0; d < ndim; d++)
+               {
+                  ii = index[d] + (data -> offsets)[s][d];
+                  if (!(data -> periodic)[d] &&
+                      (ii < (data -> imin)[d] || ii > (data -> imax)[d]))
+                  {
+                     values[n] = 0.0;
+                  }
+               }
+               n++;
+            }
+         }
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Fill in a matrix with the stencil data operator.  As in AddValuesMatrix,
+ * constant-coefficient matrices do not treat the boundary specially.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+AddValuesMatrixGeneral( HYPRE_StructMatrix  A,
+                        HYPRE_StructGrid    gridmatrix,
+                        StencilData        *data )
+{
+   hypre_BoxArray      *gridboxes = hypre_StructGridBoxes(gridmatrix);
+   HYPRE_Int            size      = (data -> size);
+   HYPRE_Int            constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   HYPRE_MemoryLocation memory_location = hypre_StructMatrixMemoryLocation(A);
+   hypre_Box           *box;
+   HYPRE_Real          *values;
+   HYPRE_Real          *values_h;
+   HYPRE_Real           offd_values[27];
+   HYPRE_Int            stencil_indices[27];
+   HYPRE_Int            volume, bi, s, i, n, center = -1;
+
+   for (s = 0; s < size; s++)
+   {
+      stencil_indices[s] = s;
+      if (!(data -> offsets)[s][0] && !(data -> offsets)[s][1] && !(data -> offsets)[s][2])
+      {
+         center = s;
+      }
+   }
+   if (center < 0)
+   {
+      hypre_printf("Error: the stencil has no center entry\n");
+      return 1;
+   }
+
+   if (constant_coefficient == 0)
+   {
+      hypre_ForBoxI(bi, gridboxes)
+      {
+         box      = hypre_BoxArrayBox(gridboxes, bi);
+         volume   = hypre_BoxVolume(box);
+         values   = hypre_CTAlloc(HYPRE_Real, size * volume, memory_location);
+         values_h = hypre_CTAlloc(HYPRE_Real, size * volume, HYPRE_MEMORY_HOST);
+
+         StencilDataCoeffs(data, hypre_BoxIMin(box), hypre_BoxIMax(box), values_h);
+
+         hypre_TMemcpy(values, values_h, HYPRE_Real, size * volume, memory_location,
+                       HYPRE_MEMORY_HOST);
+         HYPRE_StructMatrixSetBoxValues(A, hypre_BoxIMin(box), hypre_BoxIMax(box),
+                                        size, stencil_indices, values);
+
+         hypre_TFree(values, memory_location);
+         hypre_TFree(values_h, HYPRE_MEMORY_HOST);
+      }
+   }
+   else if (constant_coefficient == 1)
+   {
+      if (hypre_BoxArraySize(gridboxes) > 0)
+      {
+         HYPRE_StructMatrixSetConstantValues(A, size, stencil_indices, (data -> coeffs));
+      }
+   }
+   else
+   {
+      /* constant off-diagonal entries, variable center */
+      n = 0;
+      for (s = 0; s < size; s++)
+      {
+         if (s != center)
+         {
+            stencil_indices[n] = s;
+            offd_values[n]     = (data -> coeffs)[s];
+            n++;
+         }
+      }
+      if (hypre_BoxArraySize(gridboxes) > 0)
+      {
+         HYPRE_StructMatrixSetConstantValues(A, n, stencil_indices, offd_values);
+      }
+
+      stencil_indices[0] = center;
+      hypre_ForBoxI(bi, gridboxes)
+      {
+         box      = hypre_BoxArrayBox(gridboxes, bi);
+         volume   = hypre_BoxVolume(box);
+         values   = hypre_CTAlloc(HYPRE_Real, volume, memory_location);
+         values_h = hypre_CTAlloc(HYPRE_Real, volume, HYPRE_MEMORY_HOST);
+
+         for (i = 0; i < volume; i++)
+         {
+            values_h[i] = (data -> coeffs)[center];
+         }
+
+         hypre_TMemcpy(values, values_h, HYPRE_Real, volume, memory_location, HYPRE_MEMORY_HOST);
+         HYPRE_StructMatrixSetBoxValues(A, hypre_BoxIMin(box), hypre_BoxIMax(box),
+                                        1, stencil_indices, values);
+
+         hypre_TFree(values, memory_location);
+         hypre_TFree(values_h, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Compute y_j = A^j x for j = 1, ..., num_powers with the matrix powers
+ * kernel and with repeated matvecs and print the norms of y_j and of the
+ * differences.  The entries of x depend only on the global index, so the
+ * output does not depend on the processor topology.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+TestMatvecPowers( HYPRE_StructMatrix  A,
+                  HYPRE_Int           num_powers,
+                  HYPRE_Int           depth )
+{
+   MPI_Comm             comm = hypre_StructMatrixComm(A);
+   hypre_StructGrid    *grid = hypre_StructMatrixGrid(A);
+   HYPRE_Int            ndim = hypre_StructGridNDim(grid);
+   hypre_BoxArray      *gridboxes = hypre_StructGridBoxes(grid);
+   HYPRE_MemoryLocation memory_location = hypre_StructMatrixMemoryLocation(A);
+   hypre_StructVector  *x, *z[2];
+   hypre_StructVector **y;
+   hypre_Box           *box;
+   HYPRE_Real          *values, *values_h;
+   HYPRE_Real           ynorm, dnorm;
+   HYPRE_Int            index[3], lo[3], hi[3];
+   void                *powers_data;
+   HYPRE_Int            myid, bi, d, i, j, volume;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   x    = hypre_StructVectorCreate(comm, grid);
+   z[0] = hypre_StructVectorCreate(comm, grid);
+   z[1] = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorInitialize(x);
+   hypre_StructVectorInitialize(z[0]);
+   hypre_StructVectorInitialize(z[1]);
+   y = hypre_CTAlloc(hypre_StructVector *, num_powers, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_powers; j++)
+   {
+      y[j] = hypre_StructVectorCreate(comm, grid);
+      hypre_StructVectorInitialize(y[j]);
+   }
+
+   /* x(i) = ((7 i0 + 13 i1 + 29 i2) mod 17) / 17 */
+   hypre_ForBoxI(bi, gridboxes)
+   {
+      box      = hypre_BoxArrayBox(gridboxes, bi);
+      volume   = hypre_BoxVolume(box);
+      values   = hypre_CTAlloc(HYPRE_Real, volume, memory_location);
+      values_h = hypre_CTAlloc(HYPRE_Real, volume, HYPRE_MEMORY_HOST);
+      for (d = 0; d < 3; d++)
+      {
+         lo[d] = (d < ndim) ? hypre_BoxIMinD(box, d) : 0;
+         hi[d] = (d < ndim) ? hypre_BoxIMaxD(box, d) : 0;
+      }
+      i = 0;
+      for (index[2] = lo[2]; index[2] <= hi[2]; index[2]++)
+      {
+         for (index[1] = lo[1]; index[1] <= hi[1]; index[1]++)
+         {
+            for (index[0] = lo[0]; index[0] <= hi[0]; index[0]++)
+            {
+               values_h[i++] = (HYPRE_Real)
+                               ((((7 * index[0] + 13 * index[1] + 29 * index[2]) % 17) + 17) % 17) / 17.0;
+            }
+         }
+      }
+      hypre_TMemcpy(values, values_h, HYPRE_Real, volume, memory_location, HYPRE_MEMORY_HOST);
+      hypre_StructVectorSetBoxValues(x, box, box, values, 0, -1, 0);
+      hypre_TFree(values, memory_location);
+      hypre_TFree(values_h, HYPRE_MEMORY_HOST);
+   }
+   hypre_StructVectorAssemble(x);
+
+   powers_data = hypre_StructMatvecPowersCreate();
+   hypre_StructMatvecPowersSetup(powers_data, A, num_powers, depth);
+   hypre_StructMatvecPowersCompute(powers_data, x, y);
+   hypre_StructMatvecPowersDestroy(powers_data);
+
+   hypre_StructCopy(x, z[0]);
+   for (j = 0; j < num_powers; j++)
+   {
+      hypre_StructMatvec(1.0, A, z[j % 2], 0.0, z[(j + 1) % 2]);
+
+      ynorm = hypre_sqrt(hypre_StructInnerProd(y[j], y[j]));
+      hypre_StructAxpy(-1.0, z[(j + 1) % 2], y[j]);
+      dnorm = hypre_sqrt(hypre_StructInnerProd(y[j], y[j]));
+      if (myid == 0)
+      {
+         hypre_printf("Matvec power %d: norm = %e, difference = %e\n", j + 1, ynorm, dnorm);
+      }
+   }
+
+   hypre_StructVectorDestroy(x);
+   hypre_StructVectorDestroy(z[0]);
+   hypre_StructVectorDestroy(z[1]);
+   for (j = 0; j < num_powers; j++)
+   {
+      hypre_StructVectorDestroy(y[j]);
+   }
+   hypre_TFree(y, HYPRE_MEMORY_HOST);
+
+   return 0;
+}
@@ -31,6 +31,35 @@ HYPRE_SetSpMVUseVendor( HYPRE_Int use_vendor )
    return hypre_SetSpMVUseVendor(use_vendor);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_SetSpMVUseSell
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetSpMVUseSell( HYPRE_Int use_sell )
+{
+   return hypre_SetSpMVUseSell(use_sell);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetStructTileSize
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetStructTileSize( HYPRE_Int tile_i,
+                         HYPRE_Int tile_j,
+                         HYPRE_Int tile_k )
+{
+   return hypre_SetStructTileSize(tile_i, tile_j, tile_k);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetStructTileTune
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetStructTileTune( HYPRE_Int tune )
+{
+   return hypre_SetStructTileTune(tune);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_SetSpGemmUseVendor
  *--------------------------------------------------------------------------*/
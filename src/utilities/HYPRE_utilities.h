@@ -333,6 +333,28 @@ HYPRE_Int HYPRE_SetGPUMemoryPoolSize(HYPRE_Int bin_growth, HYPRE_Int min_bin, HY
 
 HYPRE_Int HYPRE_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int HYPRE_SetSpMVUseVendor( HYPRE_Int use_vendor );
+
+/**
+ * (Optional) Use SELL-C-sigma (sliced ELLPACK) companion storage for host
+ * CSR matvecs. The companion is built lazily on the first matvec with each
+ * matrix. Default is 0 (plain CSR).
+ **/
+HYPRE_Int HYPRE_SetSpMVUseSell( HYPRE_Int use_sell );
+
+/**
+ * (Optional) Tile sizes in i/j/k for the host BoxLoops of the struct matvec,
+ * PFMG relaxation and SMG residual kernels.  Tiles are distributed over the
+ * OpenMP threads and each is walked lexicographically.  A value of 0 means no
+ * tiling in that direction.  Default is 0 (no tiling).  Ignored on devices.
+ **/
+HYPRE_Int HYPRE_SetStructTileSize( HYPRE_Int tile_i, HYPRE_Int tile_j, HYPRE_Int tile_k );
+
+/**
+ * (Optional) If set to 1, the struct kernels above pick their tile sizes at
+ * setup by timing a few candidates for each box size.  The choice is cached
+ * per box size and overrides HYPRE_SetStructTileSize.  Default is 0.
+ **/
+HYPRE_Int HYPRE_SetStructTileTune( HYPRE_Int tune );
 /* Backwards compatibility with HYPRE_SetSpGemmUseCusparse() */
 #define HYPRE_SetSpGemmUseCusparse(use_vendor) HYPRE_SetSpGemmUseVendor(use_vendor)
 HYPRE_Int HYPRE_SetSpGemmUseVendor( HYPRE_Int use_vendor );
@@ -622,6 +622,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -824,6 +825,9 @@ HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count, hypre_MPI_Request *array_of_reques
                              HYPRE_Int *index, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
+                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm,
+                                hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                             hypre_MPI_Datatype datatype, hypre_MPI_Op op, HYPRE_Int root, hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf, void *recvbuf, HYPRE_Int count,
@@ -1533,6 +1537,73 @@ HYPRE_Int hypre_GetTiming( const char *heading, HYPRE_Real *wall_time_ptr, MPI_C
 
 #endif
 
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header file for the level/phase profiler
+ *
+ *****************************************************************************/
+
+#ifndef hypre_PROFILER_HEADER
+#define hypre_PROFILER_HEADER
+
+/*--------------------------------------------------------------------------
+ * Metrics recorded per (level, phase) entry
+ *--------------------------------------------------------------------------*/
+
+typedef enum hypre_ProfilerMetric_enum
+{
+   HYPRE_PROFILER_CALLS = 0,
+   HYPRE_PROFILER_TIME,          /* wall time in seconds */
+   HYPRE_PROFILER_FLOPS,         /* floating point operations (model) */
+   HYPRE_PROFILER_BYTES,         /* bytes moved to/from memory (model) */
+   HYPRE_PROFILER_MESSAGES,      /* point-to-point messages sent */
+   HYPRE_PROFILER_MESSAGE_BYTES, /* bytes sent in point-to-point messages */
+   HYPRE_PROFILER_NUM_METRICS
+
+} hypre_ProfilerMetric;
+
+/*--------------------------------------------------------------------------
+ * hypre_Profiler
+ *
+ * Accumulates the metrics above for each level and phase. The phase names
+ * are owned by the caller. data and start are indexed by
+ * (level * num_phases + phase) * HYPRE_PROFILER_NUM_METRICS + metric.
+ *--------------------------------------------------------------------------*/
+
+typedef struct hypre_Profiler_struct
+{
+   HYPRE_Int     num_levels;
+   HYPRE_Int     num_phases;
+   const char  **phase_names;
+
+   HYPRE_Real   *data;
+   HYPRE_Real   *start;
+
+} hypre_Profiler;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ProfilerNumLevels(profiler)      ((profiler) -> num_levels)
+#define hypre_ProfilerNumPhases(profiler)      ((profiler) -> num_phases)
+#define hypre_ProfilerPhaseNames(profiler)     ((profiler) -> phase_names)
+#define hypre_ProfilerPhaseName(profiler, i)   ((profiler) -> phase_names[i])
+#define hypre_ProfilerData(profiler)           ((profiler) -> data)
+#define hypre_ProfilerStart(profiler)          ((profiler) -> start)
+
+#define hypre_ProfilerEntry(profiler, level, phase) \
+   (hypre_ProfilerData(profiler) + \
+    ((level) * hypre_ProfilerNumPhases(profiler) + (phase)) * HYPRE_PROFILER_NUM_METRICS)
+
+#endif
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
  * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
@@ -1737,6 +1808,15 @@ typedef struct
    HYPRE_Int              struct_comm_recv_buffer_size;
    HYPRE_Int              struct_comm_send_buffer_size;
 
+   /* host SpMV options */
+   HYPRE_Int              spmv_use_sell;    /* use SELL-C-sigma companion storage */
+
+   /* host struct BoxLoop tiling */
+   HYPRE_Int              struct_tile_size[3];    /* tile sizes in i/j/k, 0: no tiling */
+   HYPRE_Int              struct_tile_tune;       /* pick tile sizes at setup */
+   HYPRE_Int              struct_tile_cache_size;
+   HYPRE_Int             *struct_tile_cache;      /* tuned (loop size, tile size) pairs */
+
 #if defined(HYPRE_USING_GPU)
    hypre_DeviceData      *device_data;
    HYPRE_Int              device_gs_method; /* device G-S options */
@@ -1777,6 +1857,13 @@ typedef struct
 #define hypre_HandleStructCommRecvBufferSize(hypre_handle)       ((hypre_handle) -> struct_comm_recv_buffer_size)
 #define hypre_HandleStructCommSendBufferSize(hypre_handle)       ((hypre_handle) -> struct_comm_send_buffer_size)
 
+#define hypre_HandleSpMVUseSell(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+
+#define hypre_HandleStructTileSize(hypre_handle)                 ((hypre_handle) -> struct_tile_size)
+#define hypre_HandleStructTileTune(hypre_handle)                 ((hypre_handle) -> struct_tile_tune)
+#define hypre_HandleStructTileCacheSize(hypre_handle)            ((hypre_handle) -> struct_tile_cache_size)
+#define hypre_HandleStructTileCache(hypre_handle)                ((hypre_handle) -> struct_tile_cache)
+
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
 
@@ -2301,6 +2388,17 @@ void hypre_GpuProfilingPushRangeColor(const char *name, HYPRE_Int cid);
 void hypre_GpuProfilingPushRange(const char *name);
 void hypre_GpuProfilingPopRange(void);
 
+/* profiler.c */
+HYPRE_Int hypre_ProfilerAddMessages ( HYPRE_Int num_messages, HYPRE_Real num_bytes );
+hypre_Profiler *hypre_ProfilerCreate ( HYPRE_Int num_phases, const char **phase_names );
+HYPRE_Int hypre_ProfilerDestroy ( hypre_Profiler *profiler );
+HYPRE_Int hypre_ProfilerReset ( hypre_Profiler *profiler );
+HYPRE_Int hypre_ProfilerBegin ( hypre_Profiler *profiler, HYPRE_Int level, HYPRE_Int phase );
+HYPRE_Int hypre_ProfilerEnd ( hypre_Profiler *profiler, HYPRE_Int level, HYPRE_Int phase );
+HYPRE_Int hypre_ProfilerAddWork ( hypre_Profiler *profiler, HYPRE_Int level, HYPRE_Int phase,
+                                  HYPRE_Real flops, HYPRE_Real bytes );
+HYPRE_Int hypre_ProfilerPrint ( hypre_Profiler *profiler, MPI_Comm comm, const char *filename );
+
 /* utilities.c */
 HYPRE_Int hypre_multmod(HYPRE_Int a, HYPRE_Int b, HYPRE_Int mod);
 void hypre_partition1D(HYPRE_Int n, HYPRE_Int p, HYPRE_Int j, HYPRE_Int *s, HYPRE_Int *e);
@@ -2318,6 +2416,9 @@ HYPRE_Int hypre_ForceSyncComputeStream(hypre_Handle *hypre_handle);
 /* handle.c */
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
+HYPRE_Int hypre_SetSpMVUseSell( HYPRE_Int use_sell );
+HYPRE_Int hypre_SetStructTileSize( HYPRE_Int tile_i, HYPRE_Int tile_j, HYPRE_Int tile_k );
+HYPRE_Int hypre_SetStructTileTune( HYPRE_Int tune );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmAlgorithm( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmBinned( HYPRE_Int value );
@@ -34,6 +34,36 @@ hypre_SetSpMVUseVendor( HYPRE_Int use_vendor )
    return hypre_error_flag;
 }
 
+/* Host SpMV */
+HYPRE_Int
+hypre_SetSpMVUseSell( HYPRE_Int use_sell )
+{
+   hypre_HandleSpMVUseSell(hypre_handle()) = use_sell;
+
+   return hypre_error_flag;
+}
+
+/* Host struct BoxLoop tiling */
+HYPRE_Int
+hypre_SetStructTileSize( HYPRE_Int tile_i,
+                         HYPRE_Int tile_j,
+                         HYPRE_Int tile_k )
+{
+   hypre_HandleStructTileSize(hypre_handle())[0] = tile_i;
+   hypre_HandleStructTileSize(hypre_handle())[1] = tile_j;
+   hypre_HandleStructTileSize(hypre_handle())[2] = tile_k;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SetStructTileTune( HYPRE_Int tune )
+{
+   hypre_HandleStructTileTune(hypre_handle()) = tune;
+
+   return hypre_error_flag;
+}
+
 /* GPU SpGemm */
 HYPRE_Int
 hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor )
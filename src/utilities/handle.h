@@ -29,6 +29,15 @@ typedef struct
    HYPRE_Int              struct_comm_recv_buffer_size;
    HYPRE_Int              struct_comm_send_buffer_size;
 
+   /* host SpMV options */
+   HYPRE_Int              spmv_use_sell;    /* use SELL-C-sigma companion storage */
+
+   /* host struct BoxLoop tiling */
+   HYPRE_Int              struct_tile_size[3];    /* tile sizes in i/j/k, 0: no tiling */
+   HYPRE_Int              struct_tile_tune;       /* pick tile sizes at setup */
+   HYPRE_Int              struct_tile_cache_size;
+   HYPRE_Int             *struct_tile_cache;      /* tuned (loop size, tile size) pairs */
+
 #if defined(HYPRE_USING_GPU)
    hypre_DeviceData      *device_data;
    HYPRE_Int              device_gs_method; /* device G-S options */
@@ -69,6 +78,13 @@ typedef struct
 #define hypre_HandleStructCommRecvBufferSize(hypre_handle)       ((hypre_handle) -> struct_comm_recv_buffer_size)
 #define hypre_HandleStructCommSendBufferSize(hypre_handle)       ((hypre_handle) -> struct_comm_send_buffer_size)
 
+#define hypre_HandleSpMVUseSell(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+
+#define hypre_HandleStructTileSize(hypre_handle)                 ((hypre_handle) -> struct_tile_size)
+#define hypre_HandleStructTileTune(hypre_handle)                 ((hypre_handle) -> struct_tile_tune)
+#define hypre_HandleStructTileCacheSize(hypre_handle)            ((hypre_handle) -> struct_tile_cache_size)
+#define hypre_HandleStructTileCache(hypre_handle)                ((hypre_handle) -> struct_tile_cache)
+
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
 
@@ -642,6 +642,20 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void               *sendbuf,
+                      void               *recvbuf,
+                      HYPRE_Int           count,
+                      hypre_MPI_Datatype  datatype,
+                      hypre_MPI_Op        op,
+                      hypre_MPI_Comm      comm,
+                      hypre_MPI_Request  *request )
+{
+   hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+   *request = hypre_MPI_REQUEST_NULL;
+   return 0;
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -1277,6 +1291,25 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return result;
 }
 
+/* Falls back to a blocking reduction for MPI versions before 3 */
+HYPRE_Int
+hypre_MPI_Iallreduce( void               *sendbuf,
+                      void               *recvbuf,
+                      HYPRE_Int           count,
+                      hypre_MPI_Datatype  datatype,
+                      hypre_MPI_Op        op,
+                      hypre_MPI_Comm      comm,
+                      hypre_MPI_Request  *request )
+{
+#if MPI_VERSION > 2
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   *request = hypre_MPI_REQUEST_NULL;
+   return hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
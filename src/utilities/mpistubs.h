@@ -119,6 +119,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -321,6 +322,9 @@ HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count, hypre_MPI_Request *array_of_reques
                              HYPRE_Int *index, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
+                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm,
+                                hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                             hypre_MPI_Datatype datatype, hypre_MPI_Op op, HYPRE_Int root, hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf, void *recvbuf, HYPRE_Int count,
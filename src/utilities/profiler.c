@@ -0,0 +1,370 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Level/phase profiler: records wall time, modeled flops and memory traffic,
+ * and point-to-point messages for each (level, phase) pair of a multilevel
+ * method, and reports them across ranks (min/max/avg) in JSON or CSV.
+ *
+ * Messages are counted globally through hypre_ProfilerAddMessages, which is
+ * called by the ParCSR communication handles; hypre_ProfilerBegin/End
+ * attribute the difference of the counters to the current entry.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+static const char *hypre_profiler_metric_names[HYPRE_PROFILER_NUM_METRICS] =
+{
+   "calls", "time", "flops", "bytes", "messages", "message_bytes"
+};
+
+/* messages sent and their volume, since the start of the run */
+static HYPRE_Real hypre_profiler_num_messages = 0.0;
+static HYPRE_Real hypre_profiler_message_bytes = 0.0;
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfilerAddMessages
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfilerAddMessages( HYPRE_Int  num_messages,
+                           HYPRE_Real num_bytes )
+{
+   hypre_profiler_num_messages  += (HYPRE_Real) num_messages;
+   hypre_profiler_message_bytes += num_bytes;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfilerCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_Profiler *
+hypre_ProfilerCreate( HYPRE_Int     num_phases,
+                      const char  **phase_names )
+{
+   hypre_Profiler *profiler;
+
+   profiler = hypre_CTAlloc(hypre_Profiler, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ProfilerNumLevels(profiler)  = 0;
+   hypre_ProfilerNumPhases(profiler)  = num_phases;
+   hypre_ProfilerPhaseNames(profiler) = phase_names;
+   hypre_ProfilerData(profiler)       = NULL;
+   hypre_ProfilerStart(profiler)      = NULL;
+
+   return profiler;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfilerDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfilerDestroy( hypre_Profiler *profiler )
+{
+   if (profiler)
+   {
+      hypre_TFree(hypre_ProfilerData(profiler), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ProfilerStart(profiler), HYPRE_MEMORY_HOST);
+      hypre_TFree(profiler, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfilerReset
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfilerReset( hypre_Profiler *profiler )
+{
+   HYPRE_Int size;
+
+   if (profiler)
+   {
+      size = hypre_ProfilerNumLevels(profiler) * hypre_ProfilerNumPhases(profiler) *
+             HYPRE_PROFILER_NUM_METRICS;
+      if (size > 0)
+      {
+         hypre_Memset(hypre_ProfilerData(profiler), 0, size * sizeof(HYPRE_Real),
+                      HYPRE_MEMORY_HOST);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfilerResize
+ *
+ * Makes room for at least num_levels levels, keeping the recorded data.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ProfilerResize( hypre_Profiler *profiler,
+                      HYPRE_Int       num_levels )
+{
+   HYPRE_Int old_size, new_size;
+
+   if (num_levels <= hypre_ProfilerNumLevels(profiler))
+   {
+      return hypre_error_flag;
+   }
+
+   old_size = hypre_ProfilerNumLevels(profiler) * hypre_ProfilerNumPhases(profiler) *
+              HYPRE_PROFILER_NUM_METRICS;
+   new_size = num_levels * hypre_ProfilerNumPhases(profiler) * HYPRE_PROFILER_NUM_METRICS;
+
+   hypre_ProfilerData(profiler)  = hypre_TReAlloc(hypre_ProfilerData(profiler), HYPRE_Real,
+                                                  new_size, HYPRE_MEMORY_HOST);
+   hypre_ProfilerStart(profiler) = hypre_TReAlloc(hypre_ProfilerStart(profiler), HYPRE_Real,
+                                                  new_size, HYPRE_MEMORY_HOST);
+   hypre_Memset(hypre_ProfilerData(profiler) + old_size, 0,
+                (new_size - old_size) * sizeof(HYPRE_Real), HYPRE_MEMORY_HOST);
+   hypre_Memset(hypre_ProfilerStart(profiler) + old_size, 0,
+                (new_size - old_size) * sizeof(HYPRE_Real), HYPRE_MEMORY_HOST);
+
+   hypre_ProfilerNumLevels(profiler) = num_levels;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfilerBegin, hypre_ProfilerEnd
+ *
+ * Time and messages between the two calls are added to the entry (level,
+ * phase). Entries may be nested, but an entry must not be nested in itself.
+ * Both are no-ops for a NULL profiler.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfilerBegin( hypre_Profiler *profiler,
+                     HYPRE_Int       level,
+                     HYPRE_Int       phase )
+{
+   HYPRE_Real *start;
+
+   if (!profiler)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_ProfilerResize(profiler, level + 1);
+
+#if defined(HYPRE_USING_GPU)
+   hypre_ForceSyncComputeStream(hypre_handle());
+#endif
+
+   start = hypre_ProfilerStart(profiler) +
+           (level * hypre_ProfilerNumPhases(profiler) + phase) * HYPRE_PROFILER_NUM_METRICS;
+   start[HYPRE_PROFILER_TIME]          = hypre_MPI_Wtime();
+   start[HYPRE_PROFILER_MESSAGES]      = hypre_profiler_num_messages;
+   start[HYPRE_PROFILER_MESSAGE_BYTES] = hypre_profiler_message_bytes;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ProfilerEnd( hypre_Profiler *profiler,
+                   HYPRE_Int       level,
+                   HYPRE_Int       phase )
+{
+   HYPRE_Real *start, *entry;
+
+   if (!profiler)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_ProfilerResize(profiler, level + 1);
+
+#if defined(HYPRE_USING_GPU)
+   hypre_ForceSyncComputeStream(hypre_handle());
+#endif
+
+   start = hypre_ProfilerStart(profiler) +
+           (level * hypre_ProfilerNumPhases(profiler) + phase) * HYPRE_PROFILER_NUM_METRICS;
+   entry = hypre_ProfilerEntry(profiler, level, phase);
+
+   entry[HYPRE_PROFILER_CALLS]         += 1.0;
+   entry[HYPRE_PROFILER_TIME]          += hypre_MPI_Wtime() - start[HYPRE_PROFILER_TIME];
+   entry[HYPRE_PROFILER_MESSAGES]      += hypre_profiler_num_messages -
+                                          start[HYPRE_PROFILER_MESSAGES];
+   entry[HYPRE_PROFILER_MESSAGE_BYTES] += hypre_profiler_message_bytes -
+                                          start[HYPRE_PROFILER_MESSAGE_BYTES];
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfilerAddWork
+ *
+ * Adds (modeled) floating point operations and memory traffic to the entry
+ * (level, phase). No-op for a NULL profiler.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfilerAddWork( hypre_Profiler *profiler,
+                       HYPRE_Int       level,
+                       HYPRE_Int       phase,
+                       HYPRE_Real      flops,
+                       HYPRE_Real      bytes )
+{
+   HYPRE_Real *entry;
+
+   if (!profiler)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_ProfilerResize(profiler, level + 1);
+
+   entry = hypre_ProfilerEntry(profiler, level, phase);
+   entry[HYPRE_PROFILER_FLOPS] += flops;
+   entry[HYPRE_PROFILER_BYTES] += bytes;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfilerPrint
+ *
+ * Collective on comm. Writes, from rank 0, the min/max/avg across the ranks
+ * of comm of every metric of every entry that was entered at least once.
+ * The output is CSV if filename ends with ".csv", and JSON otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfilerPrint( hypre_Profiler *profiler,
+                     MPI_Comm        comm,
+                     const char     *filename )
+{
+   HYPRE_Int    num_levels, num_phases, size, csv;
+   HYPRE_Int    my_id, num_procs;
+   HYPRE_Int    level, phase, k, m, first;
+   HYPRE_Real  *dmin, *dmax, *dsum;
+   HYPRE_Real  *emin, *emax, *esum;
+   FILE        *file;
+   size_t       len;
+
+   if (!profiler)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (!filename)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /* All ranks need the same number of levels for the reductions */
+   num_levels = hypre_ProfilerNumLevels(profiler);
+   hypre_MPI_Allreduce(&hypre_ProfilerNumLevels(profiler), &num_levels, 1, HYPRE_MPI_INT,
+                       hypre_MPI_MAX, comm);
+   hypre_ProfilerResize(profiler, num_levels);
+
+   num_phases = hypre_ProfilerNumPhases(profiler);
+   size       = num_levels * num_phases * HYPRE_PROFILER_NUM_METRICS;
+
+   dmin = hypre_CTAlloc(HYPRE_Real, 3 * size, HYPRE_MEMORY_HOST);
+   dmax = dmin + size;
+   dsum = dmax + size;
+   hypre_MPI_Allreduce(hypre_ProfilerData(profiler), dmin, size, HYPRE_MPI_REAL,
+                       hypre_MPI_MIN, comm);
+   hypre_MPI_Allreduce(hypre_ProfilerData(profiler), dmax, size, HYPRE_MPI_REAL,
+                       hypre_MPI_MAX, comm);
+   hypre_MPI_Allreduce(hypre_ProfilerData(profiler), dsum, size, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+
+   if (my_id == 0)
+   {
+      if ((file = fopen(filename, "w")) == NULL)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+         hypre_TFree(dmin, HYPRE_MEMORY_HOST);
+         return hypre_error_flag;
+      }
+
+      len = strlen(filename);
+      csv = (len >= 4 && strcmp(filename + len - 4, ".csv") == 0);
+
+      if (csv)
+      {
+         hypre_fprintf(file, "level,phase");
+         for (m = 0; m < HYPRE_PROFILER_NUM_METRICS; m++)
+         {
+            hypre_fprintf(file, ",%s_min,%s_max,%s_avg", hypre_profiler_metric_names[m],
+                          hypre_profiler_metric_names[m], hypre_profiler_metric_names[m]);
+         }
+         hypre_fprintf(file, "\n");
+      }
+      else
+      {
+         hypre_fprintf(file, "{\n  \"num_procs\": %d,\n  \"entries\": [", num_procs);
+      }
+
+      first = 1;
+      for (level = 0; level < num_levels; level++)
+      {
+         for (phase = 0; phase < num_phases; phase++)
+         {
+            k    = (level * num_phases + phase) * HYPRE_PROFILER_NUM_METRICS;
+            emin = dmin + k;
+            emax = dmax + k;
+            esum = dsum + k;
+
+            if (emax[HYPRE_PROFILER_CALLS] == 0.0)
+            {
+               continue;
+            }
+
+            if (csv)
+            {
+               hypre_fprintf(file, "%d,%s", level, hypre_ProfilerPhaseName(profiler, phase));
+               for (m = 0; m < HYPRE_PROFILER_NUM_METRICS; m++)
+               {
+                  hypre_fprintf(file, ",%.6e,%.6e,%.6e", emin[m], emax[m], esum[m] / num_procs);
+               }
+               hypre_fprintf(file, "\n");
+            }
+            else
+            {
+               hypre_fprintf(file, "%s\n    {\"level\": %d, \"phase\": \"%s\"", first ? "" : ",",
+                             level, hypre_ProfilerPhaseName(profiler, phase));
+               for (m = 0; m < HYPRE_PROFILER_NUM_METRICS; m++)
+               {
+                  hypre_fprintf(file, ",\n     \"%s\": {\"min\": %.6e, \"max\": %.6e, \"avg\": %.6e}",
+                                hypre_profiler_metric_names[m], emin[m], emax[m],
+                                esum[m] / num_procs);
+               }
+               hypre_fprintf(file, "}");
+            }
+            first = 0;
+         }
+      }
+
+      if (!csv)
+      {
+         hypre_fprintf(file, "\n  ]\n}\n");
+      }
+
+      fclose(file);
+   }
+
+   hypre_TFree(dmin, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
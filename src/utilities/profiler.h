@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header file for the level/phase profiler
+ *
+ *****************************************************************************/
+
+#ifndef hypre_PROFILER_HEADER
+#define hypre_PROFILER_HEADER
+
+/*--------------------------------------------------------------------------
+ * Metrics recorded per (level, phase) entry
+ *--------------------------------------------------------------------------*/
+
+typedef enum hypre_ProfilerMetric_enum
+{
+   HYPRE_PROFILER_CALLS = 0,
+   HYPRE_PROFILER_TIME,          /* wall time in seconds */
+   HYPRE_PROFILER_FLOPS,         /* floating point operations (model) */
+   HYPRE_PROFILER_BYTES,         /* bytes moved to/from memory (model) */
+   HYPRE_PROFILER_MESSAGES,      /* point-to-point messages sent */
+   HYPRE_PROFILER_MESSAGE_BYTES, /* bytes sent in point-to-point messages */
+   HYPRE_PROFILER_NUM_METRICS
+
+} hypre_ProfilerMetric;
+
+/*--------------------------------------------------------------------------
+ * hypre_Profiler
+ *
+ * Accumulates the metrics above for each level and phase. The phase names
+ * are owned by the caller. data and start are indexed by
+ * (level * num_phases + phase) * HYPRE_PROFILER_NUM_METRICS + metric.
+ *--------------------------------------------------------------------------*/
+
+typedef struct hypre_Profiler_struct
+{
+   HYPRE_Int     num_levels;
+   HYPRE_Int     num_phases;
+   const char  **phase_names;
+
+   HYPRE_Real   *data;
+   HYPRE_Real   *start;
+
+} hypre_Profiler;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ProfilerNumLevels(profiler)      ((profiler) -> num_levels)
+#define hypre_ProfilerNumPhases(profiler)      ((profiler) -> num_phases)
+#define hypre_ProfilerPhaseNames(profiler)     ((profiler) -> phase_names)
+#define hypre_ProfilerPhaseName(profiler, i)   ((profiler) -> phase_names[i])
+#define hypre_ProfilerData(profiler)           ((profiler) -> data)
+#define hypre_ProfilerStart(profiler)          ((profiler) -> start)
+
+#define hypre_ProfilerEntry(profiler, level, phase) \
+   (hypre_ProfilerData(profiler) + \
+    ((level) * hypre_ProfilerNumPhases(profiler) + (phase)) * HYPRE_PROFILER_NUM_METRICS)
+
+#endif
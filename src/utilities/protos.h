@@ -360,6 +360,17 @@ void hypre_GpuProfilingPushRangeColor(const char *name, HYPRE_Int cid);
 void hypre_GpuProfilingPushRange(const char *name);
 void hypre_GpuProfilingPopRange(void);
 
+/* profiler.c */
+HYPRE_Int hypre_ProfilerAddMessages ( HYPRE_Int num_messages, HYPRE_Real num_bytes );
+hypre_Profiler *hypre_ProfilerCreate ( HYPRE_Int num_phases, const char **phase_names );
+HYPRE_Int hypre_ProfilerDestroy ( hypre_Profiler *profiler );
+HYPRE_Int hypre_ProfilerReset ( hypre_Profiler *profiler );
+HYPRE_Int hypre_ProfilerBegin ( hypre_Profiler *profiler, HYPRE_Int level, HYPRE_Int phase );
+HYPRE_Int hypre_ProfilerEnd ( hypre_Profiler *profiler, HYPRE_Int level, HYPRE_Int phase );
+HYPRE_Int hypre_ProfilerAddWork ( hypre_Profiler *profiler, HYPRE_Int level, HYPRE_Int phase,
+                                  HYPRE_Real flops, HYPRE_Real bytes );
+HYPRE_Int hypre_ProfilerPrint ( hypre_Profiler *profiler, MPI_Comm comm, const char *filename );
+
 /* utilities.c */
 HYPRE_Int hypre_multmod(HYPRE_Int a, HYPRE_Int b, HYPRE_Int mod);
 void hypre_partition1D(HYPRE_Int n, HYPRE_Int p, HYPRE_Int j, HYPRE_Int *s, HYPRE_Int *e);
@@ -377,6 +388,9 @@ HYPRE_Int hypre_ForceSyncComputeStream(hypre_Handle *hypre_handle);
 /* handle.c */
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
+HYPRE_Int hypre_SetSpMVUseSell( HYPRE_Int use_sell );
+HYPRE_Int hypre_SetStructTileSize( HYPRE_Int tile_i, HYPRE_Int tile_j, HYPRE_Int tile_k );
+HYPRE_Int hypre_SetStructTileTune( HYPRE_Int tune );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmAlgorithm( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmBinned( HYPRE_Int value );